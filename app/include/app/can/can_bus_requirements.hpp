@@ -0,0 +1,20 @@
+#pragma once
+
+#include "domain/can/can_frame.hpp"
+
+namespace app::can {
+
+/**
+ * @brief Non-blocking access to the board-to-board CAN-FD bus.
+ */
+class CanBusRequirements {
+ public:
+  virtual ~CanBusRequirements() = default;
+
+  /** @brief Queues a frame for transmission; false when the TX queue is full. */
+  virtual bool Send(const domain::can::CanFrame& frame) noexcept = 0;
+  /** @brief Takes the oldest received frame; false when none is pending. */
+  virtual bool Receive(domain::can::CanFrame& out_frame) noexcept = 0;
+};
+
+}  // namespace app::can
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <cstdint>
+
+#include "app/can/can_bus_requirements.hpp"
+#include "app/can/can_chain_control_requirements.hpp"
+#include "app/config/can.hpp"
+#include "app/config/music.hpp"
+#include "domain/can/can_event_frame.hpp"
+#include "domain/can/can_frame.hpp"
+#include "domain/can/clock_sync.hpp"
+#include "domain/music/music_event.hpp"
+
+namespace app::can {
+
+/**
+ * @brief Board chaining over CAN-FD: batches local events into frames for the other boards and
+ * pushes the events received from them to remote_events, which the MIDI output task merges
+ * with its local ones.
+ *
+ * The master board broadcasts clock sync frames; the others forward their events converted to
+ * the master's timebase, so the merged events compare correctly on the master. Until its clock
+ * sync has locked, a slave does not forward at all: its timestamps would be in its own
+ * timebase, which the master would misplace by the whole clock offset.
+ */
+class CanChain {
+ public:
+  CanChain(std::uint8_t board_id, CanBusRequirements& bus,
+           app::config::MusicEventQueue& remote_events) noexcept
+      : bus_(bus),
+        remote_events_(remote_events),
+        is_clock_master_(board_id == app::config::CAN_MASTER_BOARD_ID),
+        packer_(board_id),
+        unpacker_(board_id) {}
+
+  void Reset() noexcept {
+    packer_.Reset();
+    unpacker_.Reset();
+    clock_sync_.Reset();
+    next_sync_ticks_ = 0;
+    sync_sequence_ = 0;
+  }
+
+  /** @brief Restarts the clock sync; a master sends its first sync on the next Service(). */
+  void Start(std::uint32_t now_ticks) noexcept {
+    clock_sync_.Reset();
+    next_sync_ticks_ = now_ticks;
+  }
+
+  /** @brief Queues a local event for the other boards; false while a slave is not locked. */
+  bool Forward(const domain::music::MusicEvent& event) noexcept {
+    if (!is_clock_master_ && !clock_sync_.locked()) {
+      return false;
+    }
+    domain::music::MusicEvent forwarded = event;
+    forwarded.timestamp_ticks = clock_sync_.ToMaster(event.timestamp_ticks);
+    packer_.Push(forwarded, *this);
+    return true;
+  }
+
+  /**
+   * @brief Once per poll: sends a due clock sync, flushes the open frames and takes in all
+   * received frames.
+   */
+  void Service(std::uint32_t now_ticks) noexcept {
+    ServiceClockSync(now_ticks);
+    Flush();
+    domain::can::CanFrame frame{};
+    while (bus_.Receive(frame)) {
+      std::uint32_t master_ticks = 0;
+      if (domain::can::ParseClockSyncFrame(frame, master_ticks)) {
+        if (!is_clock_master_) {
+          clock_sync_.OnSync(master_ticks,
+                             frame.timestamp_ticks - app::config::CAN_CLOCK_SYNC_TRANSIT_TICKS);
+        }
+        continue;
+      }
+      (void) unpacker_.Unpack(frame, *this);
+    }
+  }
+
+  void Flush() noexcept {
+    packer_.Flush(*this);
+  }
+
+  CanChainStats stats() const noexcept {
+    const domain::can::CanEventPackerStats& tx = packer_.stats();
+    const domain::can::CanEventUnpackerStats& rx = unpacker_.stats();
+    CanChainStats s{};
+    s.board_id = packer_.board_id();
+    s.frames_sent = tx.frames_sent;
+    s.dropped_frame_count = tx.dropped_frame_count;
+    s.frames_received = rx.frames_received;
+    s.events_received = rx.events_received;
+    s.lost_frame_count = rx.lost_frame_count;
+    if (is_clock_master_) {
+      s.clock_sync = CanClockSyncState::kMaster;
+    } else {
+      s.clock_sync = clock_sync_.locked() ? CanClockSyncState::kLocked
+                                          : CanClockSyncState::kUnlocked;
+    }
+    s.clock_offset_ticks = clock_sync_.offset_ticks();
+    s.clock_drift_ppb = clock_sync_.drift_ppb();
+    return s;
+  }
+
+  /** @brief Packer sink: queues a frame on the bus. */
+  bool OnCanFrame(const domain::can::CanFrame& frame) noexcept {
+    return bus_.Send(frame);
+  }
+
+  /** @brief Unpacker sink: hands an event from another board to the MIDI output. */
+  void OnRemoteEvent(std::uint8_t board_id, const domain::music::MusicEvent& event) noexcept {
+    (void) board_id;
+    (void) remote_events_.Push(event);
+  }
+
+ private:
+  void ServiceClockSync(std::uint32_t now_ticks) noexcept {
+    if (!is_clock_master_ || static_cast<std::int32_t>(now_ticks - next_sync_ticks_) < 0) {
+      return;
+    }
+    // A sync the TX queue cannot take is simply skipped; the slaves fit over many of them.
+    (void) bus_.Send(domain::can::MakeClockSyncFrame(sync_sequence_++, now_ticks));
+    next_sync_ticks_ = now_ticks + app::config::CAN_CLOCK_SYNC_PERIOD_TICKS;
+  }
+
+  CanBusRequirements& bus_;
+  app::config::MusicEventQueue& remote_events_;
+  // The master keeps its own timebase; its estimator stays unlocked and ToMaster() is identity.
+  bool is_clock_master_ = true;
+  domain::can::CanEventPacker packer_;
+  domain::can::CanEventUnpacker unpacker_;
+  app::config::CanClockSyncEstimator clock_sync_{app::config::CAN_CLOCK_SYNC_CONFIG};
+  std::uint32_t next_sync_ticks_ = 0;
+  std::uint8_t sync_sequence_ = 0;
+};
+
+}  // namespace app::can
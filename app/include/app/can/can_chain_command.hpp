@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstdint>
+
+namespace app::can {
+
+enum class CanChainCommandKind : std::uint8_t {
+  kEnable = 0,
+  kDisable = 1,
+};
+
+struct CanChainCommand {
+  CanChainCommandKind kind{CanChainCommandKind::kDisable};
+};
+
+}  // namespace app::can
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstdint>
+
+namespace app::can {
+
+enum class CanClockSyncState : std::uint8_t {
+  kMaster = 0,
+  kUnlocked = 1,
+  kLocked = 2,
+};
+
+/**
+ * @brief Board chaining over CAN: frames this board sent and received from the other boards,
+ * and how this board's clock relates to the master's (master - local).
+ */
+struct CanChainStats {
+  std::uint8_t board_id{0};
+  std::uint32_t frames_sent{0};
+  std::uint32_t dropped_frame_count{0};
+  std::uint32_t frames_received{0};
+  std::uint32_t events_received{0};
+  std::uint32_t lost_frame_count{0};
+  CanClockSyncState clock_sync{CanClockSyncState::kMaster};
+  std::int32_t clock_offset_ticks{0};
+  std::int32_t clock_drift_ppb{0};
+};
+
+struct CanChainStatus {
+  bool enabled{false};
+  CanChainStats stats{};
+};
+
+class CanChainControlRequirements {
+ public:
+  virtual ~CanChainControlRequirements() = default;
+
+  virtual bool RequestEnable() noexcept = 0;
+  virtual bool RequestDisable() noexcept = 0;
+  virtual CanChainStatus GetStatus() const noexcept = 0;
+};
+
+}  // namespace app::can
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "domain/music/music_event.hpp"
+
+namespace app::can {
+
+/**
+ * @brief The MIDI output side of board chaining: local events handed to the other boards and
+ * events received from them. Both calls run in the MIDI output task only.
+ */
+class CanChainEventsRequirements {
+ public:
+  virtual ~CanChainEventsRequirements() = default;
+
+  /** @brief Hands a local event to the chain; dropped while chaining is off. */
+  virtual void Forward(const domain::music::MusicEvent& event) noexcept = 0;
+  /** @brief Takes the oldest event received from another board; false when none is pending. */
+  virtual bool TryPopRemote(domain::music::MusicEvent& out_event) noexcept = 0;
+};
+
+}  // namespace app::can
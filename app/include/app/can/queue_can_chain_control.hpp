@@ -0,0 +1,54 @@
+#pragma once
+
+#include "app/can/can_chain_command.hpp"
+#include "app/can/can_chain_control_requirements.hpp"
+#include "os/queue.hpp"
+
+namespace app::can {
+
+class QueueCanChainControl final : public CanChainControlRequirements {
+ public:
+  QueueCanChainControl(os::Queue<CanChainCommand, 4>& queue, volatile bool& enabled,
+                       const volatile CanChainStats& stats) noexcept
+      : queue_(queue), enabled_(enabled), stats_(stats) {}
+
+  bool RequestEnable() noexcept override {
+    if (enabled_) {
+      return true;
+    }
+    CanChainCommand cmd{};
+    cmd.kind = CanChainCommandKind::kEnable;
+    return queue_.Send(cmd, os::kNoWait);
+  }
+
+  bool RequestDisable() noexcept override {
+    if (!enabled_) {
+      return true;
+    }
+    CanChainCommand cmd{};
+    cmd.kind = CanChainCommandKind::kDisable;
+    return queue_.Send(cmd, os::kNoWait);
+  }
+
+  CanChainStatus GetStatus() const noexcept override {
+    CanChainStatus s{};
+    s.enabled = enabled_;
+    s.stats.board_id = stats_.board_id;
+    s.stats.frames_sent = stats_.frames_sent;
+    s.stats.dropped_frame_count = stats_.dropped_frame_count;
+    s.stats.frames_received = stats_.frames_received;
+    s.stats.events_received = stats_.events_received;
+    s.stats.lost_frame_count = stats_.lost_frame_count;
+    s.stats.clock_sync = stats_.clock_sync;
+    s.stats.clock_offset_ticks = stats_.clock_offset_ticks;
+    s.stats.clock_drift_ppb = stats_.clock_drift_ppb;
+    return s;
+  }
+
+ private:
+  os::Queue<CanChainCommand, 4>& queue_;
+  volatile bool& enabled_;
+  const volatile CanChainStats& stats_;
+};
+
+}  // namespace app::can
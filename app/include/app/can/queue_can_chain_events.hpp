@@ -0,0 +1,35 @@
+#pragma once
+
+#include "app/can/can_chain_events_requirements.hpp"
+#include "app/config/music.hpp"
+#include "domain/music/music_event.hpp"
+
+namespace app::can {
+
+/**
+ * @brief Links the MIDI output task to the CAN chain task through two SPSC event queues: the
+ * MIDI task produces the local events and consumes the remote ones.
+ */
+class QueueCanChainEvents final : public CanChainEventsRequirements {
+ public:
+  QueueCanChainEvents(const volatile bool& enabled, app::config::MusicEventQueue& local_events,
+                      app::config::MusicEventQueue& remote_events) noexcept
+      : enabled_(enabled), local_events_(local_events), remote_events_(remote_events) {}
+
+  void Forward(const domain::music::MusicEvent& event) noexcept override {
+    if (enabled_) {
+      (void) local_events_.Push(event);
+    }
+  }
+
+  bool TryPopRemote(domain::music::MusicEvent& out_event) noexcept override {
+    return remote_events_.TryPop(out_event);
+  }
+
+ private:
+  const volatile bool& enabled_;
+  app::config::MusicEventQueue& local_events_;
+  app::config::MusicEventQueue& remote_events_;
+};
+
+}  // namespace app::can
@@ -2,10 +2,18 @@
 
 #include "app/analog/acquisition_control_requirements.hpp"
 #include "app/analog/acquisition_state_requirements.hpp"
+#include "app/can/can_chain_control_requirements.hpp"
+#include "app/can/can_chain_events_requirements.hpp"
+#include "app/config/music.hpp"
 #include "app/logging/logger_requirements.hpp"
+#include "app/midi/midi_output_control_requirements.hpp"
+#include "app/telemetry/capture_control_requirements.hpp"
 #include "app/telemetry/sensor_rtt_telemetry_control_requirements.hpp"
+#include "app/telemetry/sensor_sample_tap.hpp"
 #include "domain/io/stream_requirements.hpp"
+#include "domain/sensors/sensor_baseline_requirements.hpp"
 #include "domain/sensors/sensor_registry.hpp"
+#include "domain/sensors/sensor_stats_requirements.hpp"
 
 namespace app::composition {
 
@@ -29,18 +37,59 @@ struct SensorsContext {
   domain::sensors::SensorRegistry& registry;
 };
 
+struct SensorNoiseContext {
+  domain::sensors::SensorStatsRequirements& stats;
+};
+
+struct SensorBaselineContext {
+  domain::sensors::SensorBaselineRequirements& baselines;
+};
+
+struct SensorSamplesContext {
+  app::telemetry::SensorSampleTap& tap;
+};
+
+struct SensorCaptureContext {
+  app::telemetry::CaptureControlRequirements& capture;
+};
+
 struct SensorRttTelemetryControlContext {
   app::telemetry::SensorRttTelemetryControlRequirements& control;
 };
 
-AdcControlContext CreateAnalogSubsystem() noexcept;
+struct MusicEventsContext {
+  app::config::MusicEventQueue& queue;
+};
+
+struct CanChainContext {
+  app::can::CanChainEventsRequirements& events;
+  app::can::CanChainControlRequirements& control;
+};
+
+struct MidiOutputControlContext {
+  app::midi::MidiOutputControlRequirements& control;
+};
+
+MusicEventsContext CreateMusicEventsContext() noexcept;
+AdcControlContext CreateAnalogSubsystem(MusicEventsContext& music_events) noexcept;
 AdcStateContext CreateAdcStateContext() noexcept;
 SensorsContext CreateSensorsContext() noexcept;
+SensorSamplesContext CreateSensorSamplesContext() noexcept;
+SensorCaptureContext CreateSensorCaptureContext() noexcept;
+SensorNoiseContext CreateSensorNoiseContext() noexcept;
+SensorBaselineContext CreateSensorBaselineContext() noexcept;
 
 SensorRttTelemetryControlContext CreateSensorRttTelemetrySubsystem(
-    SensorsContext& sensors, AdcStateContext& adc_state) noexcept;
+    SensorsContext& sensors, AdcStateContext& adc_state, SensorSamplesContext& sensor_samples,
+    SensorCaptureContext& sensor_capture) noexcept;
+CanChainContext CreateCanChainSubsystem() noexcept;
+MidiOutputControlContext CreateMidiOutputSubsystem(MusicEventsContext& music_events,
+                                                   CanChainContext& can_chain) noexcept;
 void CreateShellSubsystem(ConsoleContext& console, AdcControlContext& adc_control,
-                          SensorsContext& sensors,
-                          SensorRttTelemetryControlContext& sensor_rtt) noexcept;
+                          SensorsContext& sensors, SensorNoiseContext& sensor_noise,
+                          SensorBaselineContext& sensor_baseline,
+                          SensorCaptureContext& sensor_capture,
+                          SensorRttTelemetryControlContext& sensor_rtt,
+                          MidiOutputControlContext& midi_output) noexcept;
 
 }  // namespace app::composition
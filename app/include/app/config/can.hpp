@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "domain/can/clock_sync.hpp"
+
+namespace app::config {
+
+// Board chaining over FDCAN1 (500 kbit/s arbitration, 2 Mbit/s data). Board 0 drives the MIDI
+// outputs and merges the events of the other boards; any other board forwards its events.
+// Each board of a chain must be built with a distinct id (and its own MUSIC_FIRST_NOTE).
+constexpr std::uint8_t CAN_BOARD_ID = 0;
+constexpr std::uint8_t CAN_MASTER_BOARD_ID = 0;
+// The chain task polls like the MIDI output task, so a local event waits at most one period
+// before its frame is flushed.
+constexpr std::uint32_t CAN_CHAIN_POLL_PERIOD_MS = 1;
+
+// Clock sync: board 0 broadcasts its timestamp counter every 100 ms (~0.2% of the bus); the
+// other boards fit offset and drift over windows of 4 syncs and, once locked, forward their
+// events in board 0's timebase.
+constexpr std::uint32_t CAN_CLOCK_SYNC_PERIOD_TICKS = 100000;
+constexpr domain::can::ClockSyncConfig CAN_CLOCK_SYNC_CONFIG{4, 5000};
+constexpr std::size_t CAN_CLOCK_SYNC_HISTORY = 8;
+// Syncs are stamped in the RX FIFO 1 interrupt, once the 8-byte frame has ended: arbitration and
+// trailer at 500 kbit/s plus the data phase at 2 Mbit/s take about 100 us.
+constexpr std::uint32_t CAN_CLOCK_SYNC_TRANSIT_TICKS = 100;
+
+using CanClockSyncEstimator = domain::can::ClockSyncEstimator<CAN_CLOCK_SYNC_HISTORY>;
+
+}  // namespace app::config
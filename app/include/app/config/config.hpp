@@ -15,19 +15,60 @@ namespace config {
 constexpr uint32_t SHELL_TASK_PRIORITY = 1;
 constexpr uint32_t ANALOG_ACQUISITION_TASK_PRIORITY = 3;
 constexpr uint32_t SENSOR_RTT_TELEMETRY_TASK_PRIORITY = 1;
+constexpr uint32_t MIDI_OUTPUT_TASK_PRIORITY = 2;
+constexpr uint32_t CAN_CHAIN_TASK_PRIORITY = 2;
 
 // Stack sizes
 constexpr uint32_t SHELL_TASK_STACK_BYTES = 2048;
 constexpr uint32_t ANALOG_ACQUISITION_TASK_STACK_BYTES = 2048;
 constexpr uint32_t SENSOR_RTT_TELEMETRY_TASK_STACK_BYTES = 1024;
+constexpr uint32_t MIDI_OUTPUT_TASK_STACK_BYTES = 1536;
+constexpr uint32_t CAN_CHAIN_TASK_STACK_BYTES = 1024;
 
 // Shell
 constexpr uint32_t SHELL_TASK_IDLE_DELAY_MS = 10;
 
+// Sensor telemetry link. Boards without a debugger attached send the same frames over USART3
+// (PD8 TX, through a USB-serial adapter) instead of RTT; MIDI routed to USART3 is then dropped.
+enum class SensorTelemetryLink : uint8_t {
+  kRtt = 0,
+  kUsart3 = 1,
+};
+constexpr SensorTelemetryLink SENSOR_TELEMETRY_LINK = SensorTelemetryLink::kRtt;
+constexpr uint32_t SENSOR_TELEMETRY_UART_BAUD_RATE = 3'000'000;
+// Each of the two DMA buffers; at 3 Mbaud one takes ~7 ms on the line.
+constexpr uint32_t SENSOR_TELEMETRY_UART_BUFFER_BYTES = 2048;
+
 // RTT Telemetry
 constexpr uint32_t RTT_TELEMETRY_SENSOR_CHANNEL = 1;
-constexpr uint32_t RTT_TELEMETRY_SENSOR_BUFFER_SIZE = 1024;
+constexpr uint32_t RTT_TELEMETRY_SENSOR_BUFFER_SIZE = 4096;
 constexpr uint32_t RTT_TELEMETRY_SENSOR_PERIOD_MS = 1;
+// Acquisition scans queued between acquisition and telemetry (one per ms).
+constexpr uint32_t RTT_TELEMETRY_SAMPLE_RING_CAPACITY = 64;
+// Scan frames are gathered into one RTT write of up to this many bytes.
+constexpr uint32_t RTT_TELEMETRY_SAMPLE_BATCH_BYTES = 512;
+// Delta mode: a compressed block is sent once full or once it spans this many timestamp ticks.
+constexpr uint32_t RTT_TELEMETRY_DELTA_BLOCK_TICKS = 10000;
+// Delta mode: records per channel between absolute values, bounding resync after a loss.
+constexpr uint32_t RTT_TELEMETRY_DELTA_KEYFRAME_INTERVAL = 100;
+// Envelope mode: closed min/max/mean envelopes (one per telemetry period) waiting to be sent.
+constexpr uint32_t RTT_TELEMETRY_ENVELOPE_RING_CAPACITY = 4;
+// Scan streams back off (full -> delta -> envelopes of growing period) while the host lags.
+constexpr bool RTT_TELEMETRY_ADAPTIVE_RATE = true;
+// Envelope period of the first envelope backoff step; each further step is 5 times longer.
+constexpr uint32_t RTT_TELEMETRY_BACKOFF_ENVELOPE_MS = 10;
+
+// Triggered capture
+// Full scans of every channel kept in RAM_D2 (48 bytes each): 6 s of history at 1 kHz, which
+// also bounds the length of a "record".
+constexpr uint32_t CAPTURE_SCAN_CAPACITY = 6000;
+constexpr uint32_t CAPTURE_DEFAULT_PRE_SCANS = 50;
+constexpr uint32_t CAPTURE_DEFAULT_POST_SCANS = 200;
+
+// Live snapshot
+// Minimum spacing of LiveSnapshot publishes at the start of RAM_D3. A debugger polling in the
+// background gets at least this long to copy the latest slot before it is rewritten.
+constexpr uint32_t LIVE_SNAPSHOT_PERIOD_TICKS = 10000;
 
 }  // namespace config
 
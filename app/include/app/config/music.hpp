@@ -0,0 +1,74 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "domain/midi/jitter_buffer.hpp"
+#include "domain/midi/midi_output_scheduler.hpp"
+#include "domain/music/continuous_controller_tracker.hpp"
+#include "domain/music/controller_event.hpp"
+#include "domain/music/key_tracker.hpp"
+#include "domain/music/music_event_queue.hpp"
+#include "domain/music/poly_pressure_generator.hpp"
+#include "domain/music/types.hpp"
+
+namespace app::config {
+
+// Keyboard: sensor SENx plays note MUSIC_FIRST_NOTE + (x - 1).
+// Key positions are the processed sensor values (mA above the resting baseline).
+constexpr domain::music::NoteNumber MUSIC_FIRST_NOTE = domain::music::kNoteC4;
+constexpr domain::music::KeyTrackerConfig MUSIC_KEY_TRACKER_CONFIG{};
+constexpr domain::music::PolyPressureConfig MUSIC_POLY_PRESSURE_CONFIG{};
+
+// Pedals: an assigned sensor drives its controller (7- or 14-bit) instead of playing a note.
+// sensor_id 0 leaves the pedal unassigned; as shipped every sensor is a key.
+struct MusicPedalConfig {
+  std::uint8_t sensor_id = 0;
+  domain::music::ContinuousControllerConfig controller{};
+};
+
+constexpr std::size_t MUSIC_PEDAL_COUNT = 2;
+using MusicPedalConfigs = std::array<MusicPedalConfig, MUSIC_PEDAL_COUNT>;
+constexpr MusicPedalConfigs MUSIC_PEDALS{{
+    {.sensor_id = 0,
+     .controller = {.controller = domain::music::kControllerSustainPedal,
+                    .resolution = domain::music::ControllerResolution::k7Bit}},
+    {.sensor_id = 0,
+     .controller = {.controller = domain::music::kControllerSoftPedal,
+                    .resolution = domain::music::ControllerResolution::k7Bit}},
+}};
+
+// Events between the acquisition task and the output task. Notes are never evicted by
+// controller traffic; the controller ring keeps the latest values when the output falls behind.
+constexpr std::size_t MUSIC_NOTE_QUEUE_CAPACITY = 64;
+constexpr std::size_t MUSIC_CONTROLLER_QUEUE_CAPACITY = 64;
+
+using MusicEventQueue =
+    domain::music::MusicEventQueue<MUSIC_NOTE_QUEUE_CAPACITY, MUSIC_CONTROLLER_QUEUE_CAPACITY>;
+
+// MIDI output (USART2/USART3 at 31250 baud, ~1 ms per 3-byte message).
+// Channel is 0-based (0 is MIDI channel 1).
+constexpr std::uint8_t MIDI_DEFAULT_CHANNEL = 0;
+constexpr std::size_t MIDI_UART_TX_FIFO_SIZE = 256;
+constexpr std::uint32_t MIDI_OUTPUT_POLL_PERIOD_MS = 1;
+
+// Link model: 320 us per byte, and at most one poll period of bytes queued in the UART so a
+// note never waits behind more than ~1 ms of controller traffic.
+constexpr domain::midi::MidiOutputSchedulerConfig MIDI_OUTPUT_SCHEDULER_CONFIG{
+    320, MIDI_OUTPUT_POLL_PERIOD_MS * 1000u};
+constexpr std::size_t MIDI_SCHEDULER_NOTE_CAPACITY = 64;
+
+using MidiOutputScheduler = domain::midi::MidiOutputScheduler<MIDI_SCHEDULER_NOTE_CAPACITY>;
+
+// Constant-latency mode: events leave at timestamp + latency (TIM2 alarm). Off by default;
+// a few ms covers the frame processing and DMA batching spread.
+constexpr std::uint32_t MIDI_DEFAULT_LATENCY_TICKS = 0;
+constexpr std::uint32_t MIDI_MAX_LATENCY_TICKS = 20000;
+constexpr domain::midi::JitterBufferConfig MIDI_JITTER_BUFFER_CONFIG{MIDI_DEFAULT_LATENCY_TICKS,
+                                                                     100};
+constexpr std::size_t MIDI_JITTER_BUFFER_CAPACITY = 64;
+
+using MidiJitterBuffer = domain::midi::JitterBuffer<MIDI_JITTER_BUFFER_CAPACITY>;
+
+}  // namespace app::config
@@ -6,6 +6,7 @@
 #include "domain/signal/filters/ema_filter.hpp"
 #include "domain/signal/filters/identity_filter.hpp"
 #include "domain/signal/processing_pipeline/signal_processing_pipeline.hpp"
+#include "domain/signal/processors/baseline_tracker.hpp"
 #include "domain/signal/processors/tia_current_converter.hpp"
 
 namespace app::config {
@@ -15,6 +16,18 @@ constexpr bool SIGNAL_FILTERING_ENABLED = false;
 constexpr std::int32_t SIGNAL_EMA_ALPHA_NUMERATOR = 1;
 constexpr std::int32_t SIGNAL_EMA_ALPHA_DENOMINATOR = 8;
 
+// Baseline tracking removes the slow drift of the resting level (ambient light, temperature).
+// The baseline follows the TIA current with a very slow EMA (~4 s time constant at 1 kHz) and
+// freezes as soon as the signal leaves the gate around it (key moving). A resting level that
+// jumps up beyond the gate is taken as the new baseline once the signal has stayed there, within
+// the gate, for SIGNAL_BASELINE_RECOVERY_SAMPLES samples (30 s at 1 kHz).
+constexpr std::int32_t SIGNAL_BASELINE_ALPHA_NUMERATOR = 1;
+constexpr std::int32_t SIGNAL_BASELINE_ALPHA_DENOMINATOR = 4096;
+// Gate in mA (1/100 mA is ~576 ADC counts with the current TIA settings).
+constexpr std::int32_t SIGNAL_BASELINE_GATE_NUMERATOR = 1;
+constexpr std::int32_t SIGNAL_BASELINE_GATE_DENOMINATOR = 100;
+constexpr std::uint32_t SIGNAL_BASELINE_RECOVERY_SAMPLES = 30000;
+
 // Decimation factor is applied on segments of the pipeline to reduce processing frequency.
 // Set to 1 to disable decimation.
 constexpr std::uint8_t SIGNAL_DECIMATION_FACTOR = 1;
@@ -34,8 +47,15 @@ using FilteringPipeline =
 
 }  // namespace signal_filtering_detail
 
+using AnalogSensorBaselineTracker =
+    domain::signal::processors::BaselineTracker<SIGNAL_BASELINE_ALPHA_NUMERATOR,
+                                                SIGNAL_BASELINE_ALPHA_DENOMINATOR,
+                                                SIGNAL_BASELINE_GATE_NUMERATOR,
+                                                SIGNAL_BASELINE_GATE_DENOMINATOR,
+                                                SIGNAL_BASELINE_RECOVERY_SAMPLES>;
+
 using AnalogSensorProcessor = domain::signal::processing_pipeline::SignalProcessingPipeline<
-    domain::signal::processors::TiaCurrentConverter<2048, 16, 1800>,
+    domain::signal::processors::TiaCurrentConverter<2048, 16, 1800>, AnalogSensorBaselineTracker,
     signal_filtering_detail::FilteringPipeline>;
 
 }  // namespace app::config
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+
+#include "app/midi/midi_protocol.hpp"
+#include "app/midi/midi_route.hpp"
+
+namespace app::midi {
+
+enum class MidiOutputCommandKind : std::uint8_t {
+  kEnable = 0,
+  kDisable = 1,
+  kSetRoute = 2,
+  kSetChannel = 3,
+  kSetLatency = 4,
+  // Sent from the TIM2 alarm interrupt when the next buffered event is due.
+  kWake = 5,
+  kSetProtocol = 6,
+};
+
+struct MidiOutputCommand {
+  MidiOutputCommandKind kind{MidiOutputCommandKind::kDisable};
+  MidiRoute route{MidiRoute::kUart2};
+  MidiProtocol protocol{MidiProtocol::kMidi1};
+  std::uint8_t channel{0};
+  std::uint32_t latency_ticks{0};
+};
+
+}  // namespace app::midi
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstdint>
+
+#include "app/can/can_chain_control_requirements.hpp"
+#include "app/midi/midi_protocol.hpp"
+#include "app/midi/midi_route.hpp"
+
+namespace app::midi {
+
+/**
+ * @brief Output scheduler statistics, delays in timestamp ticks (us) until the first byte hits
+ * the wire.
+ */
+struct MidiOutputSchedulerStats {
+  std::uint32_t note_delay_mean_ticks{0};
+  std::uint32_t note_delay_max_ticks{0};
+  std::uint32_t controller_delay_mean_ticks{0};
+  std::uint32_t controller_delay_max_ticks{0};
+  std::uint32_t coalesced_count{0};
+  std::uint32_t dropped_note_count{0};
+};
+
+/**
+ * @brief Constant-latency mode: latency_ticks == 0 means events are sent as soon as possible.
+ */
+struct MidiOutputLatencyStats {
+  std::uint32_t latency_ticks{0};
+  std::uint32_t released_count{0};
+  std::uint32_t late_count{0};
+  std::uint32_t max_late_ticks{0};
+  std::uint32_t overflow_count{0};
+};
+
+struct MidiOutputStatus {
+  bool enabled{false};
+  MidiRoute route{MidiRoute::kUart2};
+  MidiProtocol protocol{MidiProtocol::kMidi1};
+  std::uint8_t channel{0};
+  std::uint32_t message_count{0};
+  std::uint32_t byte_count{0};
+  std::uint32_t dropped_note_count{0};
+  std::uint32_t dropped_controller_count{0};
+  MidiOutputSchedulerStats scheduler{};
+  MidiOutputLatencyStats latency{};
+  bool chain_enabled{false};
+  app::can::CanChainStats chain{};
+};
+
+class MidiOutputControlRequirements {
+ public:
+  virtual ~MidiOutputControlRequirements() = default;
+
+  virtual bool RequestEnable() noexcept = 0;
+  virtual bool RequestDisable() noexcept = 0;
+  virtual bool RequestRoute(MidiRoute route) noexcept = 0;
+  virtual bool RequestChannel(std::uint8_t channel) noexcept = 0;
+  virtual bool RequestLatency(std::uint32_t latency_ticks) noexcept = 0;
+  virtual bool RequestProtocol(MidiProtocol protocol) noexcept = 0;
+  virtual bool RequestChain(bool enabled) noexcept = 0;
+  virtual MidiOutputStatus GetStatus() const noexcept = 0;
+};
+
+}  // namespace app::midi
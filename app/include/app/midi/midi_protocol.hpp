@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstdint>
+
+namespace app::midi {
+
+/**
+ * @brief Wire format of the MIDI links. kMidi2 sends Universal MIDI Packets, each 32-bit word
+ * most significant byte first, for UMP-aware receivers.
+ */
+enum class MidiProtocol : std::uint8_t {
+  kMidi1 = 0,
+  kMidi2 = 1,
+};
+
+}  // namespace app::midi
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <cstdint>
+
+namespace app::midi {
+
+enum class MidiRoute : std::uint8_t {
+  kUart2 = 0,
+  kUart3 = 1,
+  kBoth = 2,
+};
+
+}  // namespace app::midi
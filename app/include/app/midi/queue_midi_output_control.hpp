@@ -0,0 +1,127 @@
+#pragma once
+
+#include <cstdint>
+
+#include "app/can/can_chain_control_requirements.hpp"
+#include "app/config/music.hpp"
+#include "app/midi/midi_output_command.hpp"
+#include "app/midi/midi_output_control_requirements.hpp"
+#include "os/queue.hpp"
+
+namespace app::midi {
+
+class QueueMidiOutputControl final : public MidiOutputControlRequirements {
+ public:
+  QueueMidiOutputControl(os::Queue<MidiOutputCommand, 4>& queue,
+                         const app::config::MusicEventQueue& events, volatile bool& enabled,
+                         volatile MidiRoute& route, volatile MidiProtocol& protocol,
+                         volatile std::uint8_t& channel,
+                         volatile std::uint32_t& message_count,
+                         volatile std::uint32_t& byte_count,
+                         const volatile MidiOutputSchedulerStats& scheduler_stats,
+                         const volatile MidiOutputLatencyStats& latency_stats,
+                         app::can::CanChainControlRequirements& chain) noexcept
+      : queue_(queue),
+        events_(events),
+        enabled_(enabled),
+        route_(route),
+        protocol_(protocol),
+        channel_(channel),
+        message_count_(message_count),
+        byte_count_(byte_count),
+        scheduler_stats_(scheduler_stats),
+        latency_stats_(latency_stats),
+        chain_(chain) {}
+
+  bool RequestEnable() noexcept override {
+    if (enabled_) {
+      return true;
+    }
+    MidiOutputCommand cmd{};
+    cmd.kind = MidiOutputCommandKind::kEnable;
+    return queue_.Send(cmd, os::kNoWait);
+  }
+
+  bool RequestDisable() noexcept override {
+    if (!enabled_) {
+      return true;
+    }
+    MidiOutputCommand cmd{};
+    cmd.kind = MidiOutputCommandKind::kDisable;
+    return queue_.Send(cmd, os::kNoWait);
+  }
+
+  bool RequestRoute(MidiRoute route) noexcept override {
+    MidiOutputCommand cmd{};
+    cmd.kind = MidiOutputCommandKind::kSetRoute;
+    cmd.route = route;
+    return queue_.Send(cmd, os::kNoWait);
+  }
+
+  bool RequestChannel(std::uint8_t channel) noexcept override {
+    MidiOutputCommand cmd{};
+    cmd.kind = MidiOutputCommandKind::kSetChannel;
+    cmd.channel = channel;
+    return queue_.Send(cmd, os::kNoWait);
+  }
+
+  bool RequestLatency(std::uint32_t latency_ticks) noexcept override {
+    MidiOutputCommand cmd{};
+    cmd.kind = MidiOutputCommandKind::kSetLatency;
+    cmd.latency_ticks = latency_ticks;
+    return queue_.Send(cmd, os::kNoWait);
+  }
+
+  bool RequestProtocol(MidiProtocol protocol) noexcept override {
+    MidiOutputCommand cmd{};
+    cmd.kind = MidiOutputCommandKind::kSetProtocol;
+    cmd.protocol = protocol;
+    return queue_.Send(cmd, os::kNoWait);
+  }
+
+  bool RequestChain(bool enabled) noexcept override {
+    return enabled ? chain_.RequestEnable() : chain_.RequestDisable();
+  }
+
+  MidiOutputStatus GetStatus() const noexcept override {
+    MidiOutputStatus s{};
+    s.enabled = enabled_;
+    s.route = route_;
+    s.protocol = protocol_;
+    s.channel = channel_;
+    s.message_count = message_count_;
+    s.byte_count = byte_count_;
+    s.scheduler.note_delay_mean_ticks = scheduler_stats_.note_delay_mean_ticks;
+    s.scheduler.note_delay_max_ticks = scheduler_stats_.note_delay_max_ticks;
+    s.scheduler.controller_delay_mean_ticks = scheduler_stats_.controller_delay_mean_ticks;
+    s.scheduler.controller_delay_max_ticks = scheduler_stats_.controller_delay_max_ticks;
+    s.scheduler.coalesced_count = scheduler_stats_.coalesced_count;
+    s.scheduler.dropped_note_count = scheduler_stats_.dropped_note_count;
+    s.dropped_note_count = events_.dropped_note_count() + s.scheduler.dropped_note_count;
+    s.dropped_controller_count = events_.dropped_controller_count();
+    s.latency.latency_ticks = latency_stats_.latency_ticks;
+    s.latency.released_count = latency_stats_.released_count;
+    s.latency.late_count = latency_stats_.late_count;
+    s.latency.max_late_ticks = latency_stats_.max_late_ticks;
+    s.latency.overflow_count = latency_stats_.overflow_count;
+    const app::can::CanChainStatus chain = chain_.GetStatus();
+    s.chain_enabled = chain.enabled;
+    s.chain = chain.stats;
+    return s;
+  }
+
+ private:
+  os::Queue<MidiOutputCommand, 4>& queue_;
+  const app::config::MusicEventQueue& events_;
+  volatile bool& enabled_;
+  volatile MidiRoute& route_;
+  volatile MidiProtocol& protocol_;
+  volatile std::uint8_t& channel_;
+  volatile std::uint32_t& message_count_;
+  volatile std::uint32_t& byte_count_;
+  const volatile MidiOutputSchedulerStats& scheduler_stats_;
+  const volatile MidiOutputLatencyStats& latency_stats_;
+  app::can::CanChainControlRequirements& chain_;
+};
+
+}  // namespace app::midi
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "app/config/music.hpp"
+#include "app/config/sensors.hpp"
+#include "app/music/keyboard_scanner_requirements.hpp"
+#include "domain/music/continuous_controller_tracker.hpp"
+#include "domain/music/controller_event.hpp"
+#include "domain/music/key_tracker.hpp"
+#include "domain/music/note_event.hpp"
+#include "domain/music/poly_pressure_generator.hpp"
+#include "domain/sensors/sensor.hpp"
+
+namespace app::music {
+
+/**
+ * @brief Turns the processed sensor values into note and poly pressure events pushed to the
+ * music event queue. Key i is sensors[i]; it plays MUSIC_FIRST_NOTE + i.
+ *
+ * A sensor assigned to a pedal is not a key: its value drives the pedal's controller instead.
+ */
+class KeyboardScanner final : public KeyboardScannerRequirements {
+ public:
+  static constexpr std::size_t kKeyCount = app::config_sensors::kSensorCount;
+  static constexpr std::size_t kPedalCount = app::config::MUSIC_PEDAL_COUNT;
+
+  KeyboardScanner(domain::sensors::Sensor* const* sensors, app::config::MusicEventQueue& events,
+                  const app::config::MusicPedalConfigs& pedals) noexcept
+      : sensors_(sensors),
+        events_(events),
+        key_tracker_(app::config::MUSIC_KEY_TRACKER_CONFIG, domain::music::kDefaultVelocityCurve,
+                     app::config::MUSIC_FIRST_NOTE),
+        pressure_generator_(app::config::MUSIC_POLY_PRESSURE_CONFIG,
+                            app::config::MUSIC_FIRST_NOTE),
+        pedals_(pedals),
+        pedal_trackers_(MakePedalTrackers(pedals, std::make_index_sequence<kPedalCount>{})) {
+    for (std::size_t i = 0; i < kPedalCount; ++i) {
+      const std::uint8_t id = pedals[i].sensor_id;
+      pedal_key_index_[i] = id != 0u && id <= kKeyCount ? id - 1u : kKeyCount;
+      if (pedal_key_index_[i] < kKeyCount) {
+        pedal_key_mask_ |= 1u << pedal_key_index_[i];
+      }
+    }
+  }
+
+  void Scan() noexcept override {
+    if (sensors_ == nullptr) {
+      return;
+    }
+    for (std::size_t i = 0; i < kKeyCount; ++i) {
+      const domain::sensors::Sensor* sensor = sensors_[i];
+      positions_[i] = sensor != nullptr ? sensor->last_processed_value() : 0.0f;
+      timestamps_ticks_[i] = sensor != nullptr ? sensor->last_timestamp_ticks() : 0u;
+    }
+    for (std::size_t i = 0; i < kKeyCount; ++i) {
+      if ((pedal_key_mask_ & (1u << i)) == 0u) {
+        key_tracker_.Update(i, positions_[i], timestamps_ticks_[i], events_);
+      }
+    }
+    pressure_generator_.Scan(key_tracker_, positions_, timestamps_ticks_, events_);
+    for (std::size_t i = 0; i < kPedalCount; ++i) {
+      const std::size_t key = pedal_key_index_[i];
+      if (key < kKeyCount && sensors_[key] != nullptr) {
+        pedal_trackers_[i].Update(positions_[key], timestamps_ticks_[key], events_);
+      }
+    }
+  }
+
+  void ReleaseAll(std::uint32_t timestamp_ticks) noexcept override {
+    for (std::size_t i = 0; i < kKeyCount; ++i) {
+      const domain::music::KeyState state = key_tracker_.state(i);
+      if (state == domain::music::KeyState::kStruck ||
+          state == domain::music::KeyState::kReleased) {
+        pressure_generator_.Update(i, domain::music::KeyState::kRest, 0.0f, timestamp_ticks,
+                                   events_);
+        domain::music::NoteEvent event{};
+        event.type = domain::music::NoteEventType::kNoteOff;
+        event.note = static_cast<domain::music::NoteNumber>(app::config::MUSIC_FIRST_NOTE + i);
+        event.timestamp_ticks = timestamp_ticks;
+        events_.OnNoteEvent(event);
+      }
+    }
+    key_tracker_.Reset();
+    pressure_generator_.Reset();
+
+    // A pedal left down would hold the notes just ended.
+    for (std::size_t i = 0; i < kPedalCount; ++i) {
+      domain::music::ContinuousControllerTracker& pedal = pedal_trackers_[i];
+      if (pedal.has_value() && pedal.value() != 0u) {
+        domain::music::ControllerEvent event{};
+        event.controller = pedals_[i].controller.controller;
+        event.resolution = pedals_[i].controller.resolution;
+        event.timestamp_ticks = timestamp_ticks;
+        events_.OnControllerEvent(event);
+      }
+      pedal.Reset();
+    }
+  }
+
+ private:
+  using PedalTrackers = std::array<domain::music::ContinuousControllerTracker, kPedalCount>;
+
+  template <std::size_t... kPedal>
+  static PedalTrackers MakePedalTrackers(const app::config::MusicPedalConfigs& pedals,
+                                         std::index_sequence<kPedal...>) noexcept {
+    return {domain::music::ContinuousControllerTracker(pedals[kPedal].controller)...};
+  }
+
+  domain::sensors::Sensor* const* sensors_ = nullptr;
+  app::config::MusicEventQueue& events_;
+  domain::music::KeyTracker<kKeyCount> key_tracker_;
+  domain::music::PolyPressureGenerator<kKeyCount> pressure_generator_;
+  float positions_[kKeyCount] = {};
+  std::uint32_t timestamps_ticks_[kKeyCount] = {};
+
+  app::config::MusicPedalConfigs pedals_;
+  PedalTrackers pedal_trackers_;
+  // Key index of each pedal's sensor, kKeyCount when unassigned.
+  std::array<std::size_t, kPedalCount> pedal_key_index_{};
+  std::uint32_t pedal_key_mask_ = 0;
+};
+
+}  // namespace app::music
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstdint>
+
+namespace app::music {
+
+class KeyboardScannerRequirements {
+ public:
+  virtual ~KeyboardScannerRequirements() = default;
+
+  // Runs key detection on the latest sensor values (acquisition context).
+  virtual void Scan() noexcept = 0;
+  // Ends every sounding note and returns all keys to rest (acquisition stopped).
+  virtual void ReleaseAll(std::uint32_t timestamp_ticks) noexcept = 0;
+};
+
+}  // namespace app::music
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <string_view>
+
+#include "domain/sensors/sensor_baseline_requirements.hpp"
+#include "shell/command_requirements.hpp"
+
+namespace app::shell::commands {
+
+class BaselineCommand final : public ::shell::CommandRequirements {
+ public:
+  explicit BaselineCommand(domain::sensors::SensorBaselineRequirements& baselines) noexcept
+      : baselines_(baselines) {}
+
+  std::string_view Name() const noexcept override {
+    return "baseline";
+  }
+  std::string_view Help() const noexcept override {
+    return "Show per-sensor resting baseline (mA)";
+  }
+  void Run(int argc, char** argv, domain::io::WritableStreamRequirements& out) noexcept override;
+
+ private:
+  domain::sensors::SensorBaselineRequirements& baselines_;
+};
+
+}  // namespace app::shell::commands
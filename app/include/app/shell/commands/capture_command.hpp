@@ -0,0 +1,30 @@
+#pragma once
+
+#include <string_view>
+
+#include "app/telemetry/capture_control_requirements.hpp"
+#include "domain/sensors/sensor_registry.hpp"
+#include "shell/command_requirements.hpp"
+
+namespace app::shell::commands {
+
+class CaptureCommand final : public ::shell::CommandRequirements {
+ public:
+  CaptureCommand(domain::sensors::SensorRegistry& registry,
+                 app::telemetry::CaptureControlRequirements& capture) noexcept
+      : registry_(registry), capture_(capture) {}
+
+  std::string_view Name() const noexcept override {
+    return "capture";
+  }
+  std::string_view Help() const noexcept override {
+    return "Capture every raw channel around a key trigger, then read it out";
+  }
+  void Run(int argc, char** argv, domain::io::WritableStreamRequirements& out) noexcept override;
+
+ private:
+  domain::sensors::SensorRegistry& registry_;
+  app::telemetry::CaptureControlRequirements& capture_;
+};
+
+}  // namespace app::shell::commands
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <string_view>
+
+#include "app/midi/midi_output_control_requirements.hpp"
+#include "shell/command_requirements.hpp"
+
+namespace app::shell::commands {
+
+class MidiCommand final : public ::shell::CommandRequirements {
+ public:
+  explicit MidiCommand(app::midi::MidiOutputControlRequirements& control) noexcept
+      : control_(control) {}
+
+  std::string_view Name() const noexcept override {
+    return "midi";
+  }
+  std::string_view Help() const noexcept override {
+    return "Control MIDI output on USART2/USART3";
+  }
+
+  void Run(int argc, char** argv, domain::io::WritableStreamRequirements& out) noexcept override;
+
+ private:
+  app::midi::MidiOutputControlRequirements& control_;
+};
+
+}  // namespace app::shell::commands
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <string_view>
+
+#include "domain/sensors/sensor_stats_requirements.hpp"
+#include "shell/command_requirements.hpp"
+
+namespace app::shell::commands {
+
+class NoiseCommand final : public ::shell::CommandRequirements {
+ public:
+  explicit NoiseCommand(domain::sensors::SensorStatsRequirements& stats) noexcept
+      : stats_(stats) {}
+
+  std::string_view Name() const noexcept override {
+    return "noise";
+  }
+  std::string_view Help() const noexcept override {
+    return "Show per-sensor raw noise statistics (reset)";
+  }
+  void Run(int argc, char** argv, domain::io::WritableStreamRequirements& out) noexcept override;
+
+ private:
+  domain::sensors::SensorStatsRequirements& stats_;
+};
+
+}  // namespace app::shell::commands
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <string_view>
+
+#include "app/telemetry/capture_control_requirements.hpp"
+#include "app/telemetry/sensor_rtt_telemetry_control_requirements.hpp"
+#include "shell/command_requirements.hpp"
+
+namespace app::shell::commands {
+
+/**
+ * @brief Records every raw channel at the full acquisition rate into the capture buffer and has
+ * the telemetry task send the recording over RTT once it is complete.
+ */
+class RecordCommand final : public ::shell::CommandRequirements {
+ public:
+  RecordCommand(app::telemetry::CaptureControlRequirements& capture,
+                app::telemetry::SensorRttTelemetryControlRequirements& telemetry) noexcept
+      : capture_(capture), telemetry_(telemetry) {}
+
+  std::string_view Name() const noexcept override {
+    return "record";
+  }
+  std::string_view Help() const noexcept override {
+    return "Record every raw channel for a few seconds, then drain it over RTT";
+  }
+  void Run(int argc, char** argv, domain::io::WritableStreamRequirements& out) noexcept override;
+
+ private:
+  app::telemetry::CaptureControlRequirements& capture_;
+  app::telemetry::SensorRttTelemetryControlRequirements& telemetry_;
+};
+
+}  // namespace app::shell::commands
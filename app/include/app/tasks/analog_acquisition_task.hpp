@@ -7,10 +7,13 @@
 #include "app/analog/adc_rank_mapped_frame_decoder.hpp"
 #include "app/config/sensors.hpp"
 #include "app/config/signal_processing.hpp"
+#include "app/music/keyboard_scanner_requirements.hpp"
+#include "app/telemetry/sensor_sample_tap_requirements.hpp"
 #include "app/time/timestamp_counter_requirements.hpp"
 #include "bsp/adc/adc_dma.hpp"
 #include "bsp/gpio_requirements.hpp"
 #include "domain/sensors/processed_sensor_group.hpp"
+#include "domain/sensors/sensor_noise_monitor.hpp"
 #include "os/queue.hpp"
 
 namespace app::analog {
@@ -22,14 +25,17 @@ namespace app::Tasks {
 class AnalogAcquisitionTask {
  public:
   using Processor = app::config::AnalogSensorProcessor;
-  using ProcessedSensorGroup = domain::sensors::ProcessedSensorGroup<Processor>;
+  using NoiseMonitor = domain::sensors::SensorNoiseMonitor<app::config_sensors::kSensorCount>;
+  using ProcessedSensorGroup = domain::sensors::ProcessedSensorGroup<Processor, NoiseMonitor>;
 
   AnalogAcquisitionTask(os::Queue<bsp::adc::AdcFrameDescriptor, 8>& queue,
                         os::Queue<app::analog::AcquisitionCommand, 4>& control_queue,
                         bsp::GpioRequirements& tia_shutdown, bsp::adc::AdcDma& adc_dma,
                         app::time::TimestampCounterRequirements& timestamp_counter,
                         volatile app::analog::AcquisitionState& state,
-                        ProcessedSensorGroup& analog_group) noexcept;
+                        ProcessedSensorGroup& analog_group,
+                        app::music::KeyboardScannerRequirements& keyboard_scanner,
+                        app::telemetry::SensorSampleTapRequirements& sample_tap) noexcept;
 
   bool start() noexcept;
 
@@ -54,6 +60,8 @@ class AnalogAcquisitionTask {
   app::time::TimestampCounterRequirements& timestamp_counter_;
   volatile app::analog::AcquisitionState& state_;
   ProcessedSensorGroup& analog_group_;
+  app::music::KeyboardScannerRequirements& keyboard_scanner_;
+  app::telemetry::SensorSampleTapRequirements& sample_tap_;
 
   app::analog::AdcRankMappedFrameDecoder decoder_{};
 
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "app/can/can_bus_requirements.hpp"
+#include "app/can/can_chain.hpp"
+#include "app/can/can_chain_command.hpp"
+#include "app/can/can_chain_control_requirements.hpp"
+#include "app/config/can.hpp"
+#include "app/config/music.hpp"
+#include "app/time/timestamp_counter_requirements.hpp"
+#include "os/queue.hpp"
+
+namespace app::Tasks {
+
+/**
+ * @brief Runs the board chaining over FDCAN1 next to the MIDI output task: forwards the local
+ * events the MIDI task hands over to the other boards and pushes the events received from them
+ * to the MIDI task's remote event queue. While disabled, the local events still queued are
+ * drained and discarded.
+ */
+class CanChainTask {
+ public:
+  CanChainTask(os::Queue<app::can::CanChainCommand, 4>& control_queue,
+               app::config::MusicEventQueue& local_events,
+               app::config::MusicEventQueue& remote_events, volatile bool& enabled,
+               volatile app::can::CanChainStats& stats,
+               const app::time::TimestampCounterRequirements& timestamp_counter,
+               app::can::CanBusRequirements& can_bus) noexcept;
+
+  bool start() noexcept;
+
+ private:
+  static void entry(void* ctx) noexcept;
+  void run() noexcept;
+
+  void ApplyCommand(const app::can::CanChainCommand& cmd) noexcept;
+  void Poll() noexcept;
+  void PublishStats() noexcept;
+
+  os::Queue<app::can::CanChainCommand, 4>& control_queue_;
+  app::config::MusicEventQueue& local_events_;
+  volatile bool& enabled_;
+  volatile app::can::CanChainStats& stats_;
+  const app::time::TimestampCounterRequirements& timestamp_counter_;
+
+  app::can::CanChain chain_;
+};
+
+}  // namespace app::Tasks
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "app/can/can_chain_events_requirements.hpp"
+#include "app/config/music.hpp"
+#include "app/midi/midi_output_command.hpp"
+#include "app/midi/midi_output_control_requirements.hpp"
+#include "app/midi/midi_protocol.hpp"
+#include "app/midi/midi_route.hpp"
+#include "app/time/alarm_requirements.hpp"
+#include "app/time/timestamp_counter_requirements.hpp"
+#include "domain/io/stream_requirements.hpp"
+#include "domain/midi/midi1_encoder.hpp"
+#include "domain/midi/ump_encoder.hpp"
+#include "domain/music/music_event.hpp"
+#include "os/queue.hpp"
+
+namespace app::Tasks {
+
+/**
+ * @brief Drains the music event queue to the MIDI UARTs, off the acquisition task.
+ * Events go through the output scheduler, which sends notes first and only feeds the UARTs as
+ * fast as the 31250 baud link drains. Each link has its own encoder since running status is per
+ * receiver; in MIDI 2.0 mode a shared UMP encoder is used instead. While disabled, events are
+ * still drained and discarded so that notes played meanwhile are not sent late.
+ *
+ * With a nonzero latency, events first wait in a jitter buffer until timestamp + latency; the
+ * TIM2 alarm wakes the task through the control queue when the earliest one is due.
+ *
+ * Local events are also handed to the CAN chain, and events received from the other boards
+ * join the local ones in front of the jitter buffer and scheduler.
+ */
+class MidiOutputTask {
+ public:
+  MidiOutputTask(os::Queue<app::midi::MidiOutputCommand, 4>& control_queue,
+                 app::config::MusicEventQueue& events, app::can::CanChainEventsRequirements& chain,
+                 domain::io::WritableStreamRequirements& uart2,
+                 domain::io::WritableStreamRequirements& uart3, volatile bool& enabled,
+                 volatile app::midi::MidiRoute& route, volatile app::midi::MidiProtocol& protocol,
+                 volatile std::uint8_t& channel, volatile std::uint32_t& message_count,
+                 volatile std::uint32_t& byte_count,
+                 volatile app::midi::MidiOutputSchedulerStats& scheduler_stats,
+                 volatile app::midi::MidiOutputLatencyStats& latency_stats,
+                 const app::time::TimestampCounterRequirements& timestamp_counter,
+                 app::time::AlarmRequirements& alarm) noexcept;
+
+  bool start() noexcept;
+
+  /** @brief Scheduler sink: encodes and writes one event, returns the longest link's bytes. */
+  std::size_t OnScheduledEvent(const domain::music::MusicEvent& event) noexcept;
+  /** @brief Jitter buffer sink: hands a due event to the scheduler. */
+  void OnReleasedEvent(const domain::music::MusicEvent& event) noexcept;
+
+ private:
+  static void entry(void* ctx) noexcept;
+  void run() noexcept;
+
+  void ApplyCommand(const app::midi::MidiOutputCommand& cmd) noexcept;
+  void Dispatch(const domain::music::MusicEvent& event) noexcept;
+  void DrainEvents() noexcept;
+  void ArmNextDeadline() noexcept;
+  void PublishSchedulerStats() noexcept;
+  void PublishLatencyStats() noexcept;
+  std::size_t EncodeUmp(const domain::music::MusicEvent& event, std::uint8_t* out) const noexcept;
+  std::uint32_t SendTo(domain::midi::Midi1Encoder& encoder,
+                       domain::io::WritableStreamRequirements& stream,
+                       const domain::music::MusicEvent& event) noexcept;
+
+  os::Queue<app::midi::MidiOutputCommand, 4>& control_queue_;
+  app::config::MusicEventQueue& events_;
+  app::can::CanChainEventsRequirements& chain_;
+  domain::io::WritableStreamRequirements& uart2_;
+  domain::io::WritableStreamRequirements& uart3_;
+
+  volatile bool& enabled_;
+  volatile app::midi::MidiRoute& route_;
+  volatile app::midi::MidiProtocol& protocol_;
+  volatile std::uint8_t& channel_;
+  volatile std::uint32_t& message_count_;
+  volatile std::uint32_t& byte_count_;
+  volatile app::midi::MidiOutputSchedulerStats& scheduler_stats_;
+  volatile app::midi::MidiOutputLatencyStats& latency_stats_;
+  const app::time::TimestampCounterRequirements& timestamp_counter_;
+  app::time::AlarmRequirements& alarm_;
+
+  app::config::MidiJitterBuffer jitter_buffer_{app::config::MIDI_JITTER_BUFFER_CONFIG};
+  app::config::MidiOutputScheduler scheduler_{app::config::MIDI_OUTPUT_SCHEDULER_CONFIG};
+
+  domain::midi::Midi1Encoder uart2_encoder_{};
+  domain::midi::Midi1Encoder uart3_encoder_{};
+  domain::midi::UmpEncoder ump_encoder_{};
+};
+
+}  // namespace app::Tasks
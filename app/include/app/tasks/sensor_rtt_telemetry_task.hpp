@@ -1,42 +1,109 @@
 #pragma once
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
 
 #include "app/analog/acquisition_state_requirements.hpp"
+#include "app/config/config.hpp"
+#include "app/telemetry/capture_control_requirements.hpp"
 #include "app/telemetry/sensor_rtt_telemetry_command.hpp"
+#include "app/telemetry/sensor_sample_source_requirements.hpp"
 #include "app/telemetry/telemetry_sender_requirements.hpp"
 #include "domain/sensors/sensor_registry.hpp"
-#include "os/queue.hpp"
+#include "domain/telemetry/scan_delta_codec.hpp"
+#include "domain/telemetry/scan_envelope.hpp"
+#include "domain/telemetry/sensor_scan_frame.hpp"
+#include "domain/telemetry/telemetry_frame.hpp"
+#include "domain/telemetry/telemetry_rate_controller.hpp"
+#include "os/queue_requirements.hpp"
 
 namespace app::Tasks {
 
 class SensorRttTelemetryTask {
  public:
-  SensorRttTelemetryTask(os::Queue<app::telemetry::SensorRttTelemetryCommand, 4>& control_queue,
-                         domain::sensors::SensorRegistry& registry,
-                         app::analog::AcquisitionStateRequirements& adc_state,
-                         app::telemetry::TelemetrySenderRequirements& telemetry_sender,
-                         volatile bool& enabled, volatile std::uint8_t& sensor_id,
-                         volatile domain::sensors::SensorRttMode& mode,
-                         volatile std::uint32_t& period_ms) noexcept;
+  SensorRttTelemetryTask(
+      os::QueueRequirements<app::telemetry::SensorRttTelemetryCommand>& control_queue,
+      domain::sensors::SensorRegistry& registry,
+      app::analog::AcquisitionStateRequirements& adc_state,
+      app::telemetry::TelemetrySenderRequirements& telemetry_sender,
+      app::telemetry::SensorSampleSourceRequirements& samples,
+      app::telemetry::CaptureControlRequirements& capture, volatile bool& enabled,
+      volatile std::uint8_t& sensor_id, volatile domain::sensors::SensorRttMode& mode,
+      volatile std::uint32_t& period_ms, volatile std::uint32_t& channel_mask,
+      volatile app::telemetry::ScanEncoding& encoding, volatile std::uint32_t& dropped_frames,
+      volatile std::uint32_t& capture_remaining, volatile std::uint8_t& backoff_level) noexcept;
 
   bool start() noexcept;
 
+  // One pass of the task loop: waits for a command or the next period, then sends what is due.
+  void Step() noexcept;
+
  private:
   static void entry(void* ctx) noexcept;
   void run() noexcept;
 
   void ApplyCommand(const app::telemetry::SensorRttTelemetryCommand& cmd) noexcept;
+  void SendSingle(const domain::sensors::Sensor& sensor) noexcept;
+  void DrainSamples() noexcept;
+  void DrainDeltaBlocks() noexcept;
+  void DrainEnvelopes() noexcept;
+  void FlushDeltaBlock() noexcept;
+  void DiscardSamples() noexcept;
+  void DiscardScans() noexcept;
+  void DiscardEnvelopes() noexcept;
+  void ObserveMask(std::uint32_t mask, domain::sensors::SensorRttMode mode) noexcept;
+  std::uint32_t QueuedDrops() noexcept;
+  void AdaptRate(std::uint32_t elapsed_ms) noexcept;
+  void ApplyBackoff() noexcept;
+  void BeginCaptureReadout() noexcept;
+  void EndCaptureReadout() noexcept;
+  bool CaptureStillFrozen() noexcept;
+  std::size_t EncodeCaptureInfo(std::uint8_t* out, std::size_t capacity) noexcept;
+  void SendCaptureScans() noexcept;
 
-  os::Queue<app::telemetry::SensorRttTelemetryCommand, 4>& control_queue_;
+  os::QueueRequirements<app::telemetry::SensorRttTelemetryCommand>& control_queue_;
   domain::sensors::SensorRegistry& registry_;
   app::analog::AcquisitionStateRequirements& adc_state_;
   app::telemetry::TelemetrySenderRequirements& telemetry_sender_;
+  app::telemetry::SensorSampleSourceRequirements& samples_;
+  app::telemetry::CaptureControlRequirements& capture_;
 
   volatile bool& enabled_;
   volatile std::uint8_t& sensor_id_;
   volatile domain::sensors::SensorRttMode& mode_;
   volatile std::uint32_t& period_ms_;
+  volatile std::uint32_t& channel_mask_;
+  volatile app::telemetry::ScanEncoding& encoding_;
+  volatile std::uint32_t& dropped_frames_;
+  volatile std::uint32_t& capture_remaining_;
+  volatile std::uint8_t& backoff_level_;
+
+  domain::telemetry::TelemetryFrameEncoder frame_encoder_{};
+  domain::telemetry::SensorScanFrameBuilder scan_frame_{};
+  domain::telemetry::ScanEnvelopeFrameBuilder envelope_frame_{};
+  domain::telemetry::ScanDeltaEncoder<> delta_block_{
+      domain::telemetry::ScanDeltaConfig{app::config::RTT_TELEMETRY_DELTA_KEYFRAME_INTERVAL}};
+  std::array<std::uint8_t, app::config::RTT_TELEMETRY_SAMPLE_BATCH_BYTES> batch_{};
+  // Records copied off the tap live here: an envelope alone would take ~400 B of the task stack.
+  domain::telemetry::SensorScanSample sample_{};
+  app::telemetry::SensorScanEnvelope envelope_{};
+  std::uint32_t dropped_base_ = 0;
+
+  // The scan stream actually sent: the requested one (encoding_, period_ms_) backed off by
+  // rate_.level() steps while the host lags.
+  domain::telemetry::TelemetryRateController rate_{};
+  app::telemetry::ScanEncoding active_encoding_{app::telemetry::ScanEncoding::kFull};
+  std::uint32_t active_period_ms_ = app::config::RTT_TELEMETRY_SENSOR_PERIOD_MS;
+
+  // The capture being read out, identified by its size and trigger time so a re-arm and new
+  // trigger during the readout ends it instead of mixing two captures. While waiting, the
+  // readout was requested before the capture froze.
+  app::telemetry::CaptureStatus capture_status_{};
+  std::uint32_t capture_mask_ = 0;
+  std::size_t capture_next_ = 0;
+  bool capture_info_sent_ = false;
+  bool capture_waiting_ = false;
 };
 
 }  // namespace app::Tasks
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "app/config/sensors.hpp"
+#include "domain/telemetry/trigger_capture.hpp"
+
+namespace app::telemetry {
+
+/** @brief One raw scan of every sensor, values[id - 1] for sensor id. */
+using CaptureScan = domain::telemetry::CaptureScan<app::config_sensors::kSensorCount>;
+
+struct CaptureStatus {
+  domain::telemetry::CaptureState state{domain::telemetry::CaptureState::kIdle};
+  domain::telemetry::TriggerConfig config{};
+  /** @brief Scans of the frozen capture, 0 until it is frozen. */
+  std::uint32_t scan_count{0};
+  std::uint32_t trigger_index{0};
+  std::uint32_t trigger_timestamp_ticks{0};
+  std::uint32_t capacity{0};
+};
+
+class CaptureControlRequirements {
+ public:
+  virtual ~CaptureControlRequirements() = default;
+
+  virtual bool Arm(const domain::telemetry::TriggerConfig& config) noexcept = 0;
+  virtual void Disarm() noexcept = 0;
+  virtual CaptureStatus GetStatus() const noexcept = 0;
+  /** @brief Scan of the frozen capture (0 = oldest); false when out of range or not frozen. */
+  virtual bool ReadScan(std::size_t index, CaptureScan& out_scan) const noexcept = 0;
+};
+
+}  // namespace app::telemetry
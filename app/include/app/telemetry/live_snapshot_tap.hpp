@@ -0,0 +1,66 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "app/config/analog_acquisition.hpp"
+#include "app/config/config.hpp"
+#include "app/config/sensors.hpp"
+#include "app/telemetry/sensor_sample_tap_requirements.hpp"
+#include "domain/sensors/sensor.hpp"
+#include "domain/sensors/sensor_registry.hpp"
+#include "domain/telemetry/live_snapshot.hpp"
+
+namespace app::telemetry {
+
+/**
+ * @brief Publishes the latest raw and processed value of every sensor into a LiveSnapshot at
+ * most once per period_ticks, for a debugger to read without any help from the target.
+ */
+class LiveSnapshotTap final : public SensorSampleTapRequirements {
+ public:
+  using Snapshot = domain::telemetry::LiveSnapshot<app::config_sensors::kSensorCount>;
+
+  LiveSnapshotTap(domain::sensors::SensorRegistry& registry, Snapshot& snapshot,
+                  std::uint32_t period_ticks = app::config::LIVE_SNAPSHOT_PERIOD_TICKS) noexcept
+      : publisher_(snapshot, app::config::ANALOG_TICKS_PER_SECOND), period_ticks_(period_ticks) {
+    for (std::size_t i = 0; i < sensors_.size(); ++i) {
+      sensors_[i] = registry.FindById(static_cast<std::uint8_t>(i + 1u));
+      if (sensors_[i] != nullptr) {
+        fitted_mask_ |= 1u << i;
+      }
+    }
+  }
+
+  void OnSequence(const std::uint8_t* /*sensor_ids*/, std::size_t /*count*/,
+                  std::uint32_t timestamp_ticks) noexcept override {
+    if (published_ && timestamp_ticks - last_publish_ticks_ < period_ticks_) {
+      return;
+    }
+    published_ = true;
+    last_publish_ticks_ = timestamp_ticks;
+    publisher_.Publish(timestamp_ticks, fitted_mask_,
+                       [this](domain::telemetry::LiveSnapshotChannel* channels) noexcept {
+                         for (std::size_t i = 0; i < sensors_.size(); ++i) {
+                           const domain::sensors::Sensor* sensor = sensors_[i];
+                           if (sensor == nullptr) {
+                             continue;
+                           }
+                           channels[i].raw = sensor->last_raw_value();
+                           channels[i].processed = sensor->last_processed_value();
+                           channels[i].timestamp_ticks = sensor->last_timestamp_ticks();
+                         }
+                       });
+  }
+
+ private:
+  domain::telemetry::LiveSnapshotPublisher<app::config_sensors::kSensorCount> publisher_;
+  std::array<const domain::sensors::Sensor*, app::config_sensors::kSensorCount> sensors_{};
+  std::uint32_t fitted_mask_ = 0;
+  std::uint32_t period_ticks_ = 0;
+  std::uint32_t last_publish_ticks_ = 0;
+  bool published_ = false;
+};
+
+}  // namespace app::telemetry
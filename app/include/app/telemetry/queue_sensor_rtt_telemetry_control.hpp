@@ -4,6 +4,7 @@
 
 #include "app/telemetry/sensor_rtt_telemetry_command.hpp"
 #include "app/telemetry/sensor_rtt_telemetry_control_requirements.hpp"
+#include "app/telemetry/telemetry_sender_requirements.hpp"
 #include "os/queue.hpp"
 
 namespace app::telemetry {
@@ -11,17 +12,29 @@ namespace app::telemetry {
 class QueueSensorRttTelemetryControl final : public SensorRttTelemetryControlRequirements {
  public:
   QueueSensorRttTelemetryControl(os::Queue<SensorRttTelemetryCommand, 4>& queue,
+                                 const TelemetrySenderRequirements& sender,
                                  volatile bool& enabled, volatile std::uint8_t& sensor_id,
                                  volatile domain::sensors::SensorRttMode& mode,
-                                 volatile std::uint32_t& period_ms) noexcept
+                                 volatile std::uint32_t& period_ms,
+                                 volatile std::uint32_t& channel_mask,
+                                 volatile ScanEncoding& encoding,
+                                 volatile std::uint32_t& dropped_frames,
+                                 volatile std::uint32_t& capture_remaining,
+                                 volatile std::uint8_t& backoff_level) noexcept
       : queue_(queue),
+        sender_(sender),
         enabled_(enabled),
         sensor_id_(sensor_id),
         mode_(mode),
-        period_ms_(period_ms) {}
+        period_ms_(period_ms),
+        channel_mask_(channel_mask),
+        encoding_(encoding),
+        dropped_frames_(dropped_frames),
+        capture_remaining_(capture_remaining),
+        backoff_level_(backoff_level) {}
 
   bool RequestOff() noexcept override {
-    if (!enabled_) {
+    if (!enabled_ && capture_remaining_ == 0u) {
       return true;
     }
     SensorRttTelemetryCommand cmd{};
@@ -38,6 +51,16 @@ class QueueSensorRttTelemetryControl final : public SensorRttTelemetryControlReq
     return queue_.Send(cmd, os::kNoWait);
   }
 
+  bool RequestObserveMask(std::uint32_t channel_mask, domain::sensors::SensorRttMode mode,
+                          ScanEncoding encoding) noexcept override {
+    SensorRttTelemetryCommand cmd{};
+    cmd.kind = SensorRttTelemetryCommandKind::kObserveMask;
+    cmd.channel_mask = channel_mask;
+    cmd.mode = mode;
+    cmd.encoding = encoding;
+    return queue_.Send(cmd, os::kNoWait);
+  }
+
   bool RequestSetPeriod(std::uint32_t period_ms) noexcept override {
     SensorRttTelemetryCommand cmd{};
     cmd.kind = SensorRttTelemetryCommandKind::kSetPeriod;
@@ -45,21 +68,39 @@ class QueueSensorRttTelemetryControl final : public SensorRttTelemetryControlReq
     return queue_.Send(cmd, os::kNoWait);
   }
 
+  bool RequestSendCapture() noexcept override {
+    SensorRttTelemetryCommand cmd{};
+    cmd.kind = SensorRttTelemetryCommandKind::kSendCapture;
+    return queue_.Send(cmd, os::kNoWait);
+  }
+
   SensorRttTelemetryStatus GetStatus() const noexcept override {
     SensorRttTelemetryStatus s{};
     s.enabled = enabled_;
     s.sensor_id = sensor_id_;
     s.mode = const_cast<domain::sensors::SensorRttMode&>(mode_);
     s.period_ms = period_ms_;
+    s.channel_mask = channel_mask_;
+    s.encoding = encoding_;
+    s.dropped_frames = dropped_frames_;
+    s.underruns = sender_.Underruns();
+    s.capture_remaining = capture_remaining_;
+    s.backoff_level = backoff_level_;
     return s;
   }
 
  private:
   os::Queue<SensorRttTelemetryCommand, 4>& queue_;
+  const TelemetrySenderRequirements& sender_;
   volatile bool& enabled_;
   volatile std::uint8_t& sensor_id_;
   volatile domain::sensors::SensorRttMode& mode_;
   volatile std::uint32_t& period_ms_;
+  volatile std::uint32_t& channel_mask_;
+  volatile ScanEncoding& encoding_;
+  volatile std::uint32_t& dropped_frames_;
+  volatile std::uint32_t& capture_remaining_;
+  volatile std::uint8_t& backoff_level_;
 };
 
 }  // namespace app::telemetry
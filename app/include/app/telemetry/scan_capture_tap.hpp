@@ -0,0 +1,160 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "app/config/analog_acquisition.hpp"
+#include "app/config/sensors.hpp"
+#include "app/telemetry/capture_control_requirements.hpp"
+#include "app/telemetry/sensor_sample_tap_requirements.hpp"
+#include "domain/sensors/sensor.hpp"
+#include "domain/sensors/sensor_registry.hpp"
+#include "domain/telemetry/capture_buffer_header.hpp"
+#include "domain/telemetry/trigger_capture.hpp"
+
+namespace app::telemetry {
+
+/**
+ * @brief Feeds a TriggerCapture with full raw scans assembled from the ADC sequences.
+ *
+ * The ADCs deliver their sequences separately, so the raw values of each sequence are staged
+ * until every fitted sensor has a value (or a sensor would be overwritten) and then pushed as
+ * one scan stamped with its first sequence's timestamp. Nothing is staged while the capture is
+ * idle or frozen.
+ *
+ * The buffer header in front of the storage is kept in step with the capture from the
+ * acquisition context (within one ADC sequence of a change), so a debugger dump of header and
+ * storage always describes itself.
+ */
+class ScanCaptureTap final : public SensorSampleTapRequirements,
+                             public CaptureControlRequirements {
+ public:
+  using Capture = domain::telemetry::TriggerCapture<app::config_sensors::kSensorCount>;
+
+  ScanCaptureTap(domain::sensors::SensorRegistry& registry,
+                 domain::telemetry::CaptureBufferHeader& header, CaptureScan* storage,
+                 std::size_t capacity) noexcept
+      : capture_(storage, capacity), header_(header) {
+    for (std::size_t i = 0; i < sensors_.size(); ++i) {
+      sensors_[i] = registry.FindById(static_cast<std::uint8_t>(i + 1u));
+      if (sensors_[i] != nullptr) {
+        fitted_mask_ |= 1u << i;
+      }
+    }
+    // The header may sit in memory the startup code does not initialize.
+    header_ = domain::telemetry::CaptureBufferHeader{};
+    header_.header_bytes = static_cast<std::uint16_t>(sizeof(header_));
+    header_.scan_bytes = static_cast<std::uint16_t>(sizeof(CaptureScan));
+    header_.channel_count = static_cast<std::uint8_t>(app::config_sensors::kSensorCount);
+    header_.channel_mask = fitted_mask_;
+    header_.capacity = static_cast<std::uint32_t>(capture_.capacity());
+    header_.ticks_per_second = app::config::ANALOG_TICKS_PER_SECOND;
+  }
+
+  void OnSequence(const std::uint8_t* sensor_ids, std::size_t count,
+                  std::uint32_t timestamp_ticks) noexcept override {
+    PublishHeader();
+    const domain::telemetry::CaptureState state = capture_.state();
+    if ((state != domain::telemetry::CaptureState::kArmed &&
+         state != domain::telemetry::CaptureState::kTriggered) ||
+        sensor_ids == nullptr) {
+      staged_mask_ = 0;
+      return;
+    }
+
+    std::uint32_t mask = 0;
+    for (std::size_t rank = 0; rank < count; ++rank) {
+      const std::uint8_t id = sensor_ids[rank];
+      if (id != 0u && id <= sensors_.size()) {
+        mask |= (1u << (id - 1u)) & fitted_mask_;
+      }
+    }
+    if ((staged_mask_ & mask) != 0u) {
+      Commit();
+    }
+    if (staged_mask_ == 0u) {
+      staged_.timestamp_ticks = timestamp_ticks;
+    }
+    for (std::size_t rank = 0; rank < count; ++rank) {
+      const std::uint8_t id = sensor_ids[rank];
+      if ((mask & (1u << (id - 1u))) != 0u) {
+        staged_.values[id - 1u] = sensors_[id - 1u]->last_raw_value();
+      }
+    }
+    staged_mask_ |= mask;
+    if (staged_mask_ == fitted_mask_) {
+      Commit();
+    }
+  }
+
+  bool Arm(const domain::telemetry::TriggerConfig& config) noexcept override {
+    if (!capture_.Arm(config)) {
+      return false;
+    }
+    arm_count_.fetch_add(1u, std::memory_order_relaxed);
+    return true;
+  }
+
+  void Disarm() noexcept override {
+    capture_.Disarm();
+  }
+
+  CaptureStatus GetStatus() const noexcept override {
+    CaptureStatus status{};
+    status.state = capture_.state();
+    status.config = capture_.config();
+    status.scan_count = static_cast<std::uint32_t>(capture_.size());
+    status.trigger_index = static_cast<std::uint32_t>(capture_.trigger_index());
+    status.trigger_timestamp_ticks = capture_.trigger_timestamp_ticks();
+    status.capacity = static_cast<std::uint32_t>(capture_.capacity());
+    return status;
+  }
+
+  bool ReadScan(std::size_t index, CaptureScan& out_scan) const noexcept override {
+    if (index >= capture_.size()) {
+      return false;
+    }
+    out_scan = capture_.scan(index);
+    return true;
+  }
+
+ private:
+  void Commit() noexcept {
+    capture_.Push(staged_);
+    staged_mask_ = 0;
+    PublishHeader();
+  }
+
+  void PublishHeader() noexcept {
+    const domain::telemetry::CaptureState state = capture_.state();
+    const std::uint32_t arm_count = arm_count_.load(std::memory_order_relaxed);
+    if (header_.state == static_cast<std::uint8_t>(state) && header_.capture_number == arm_count) {
+      return;
+    }
+    const domain::telemetry::TriggerConfig& config = capture_.config();
+    const bool frozen = state == domain::telemetry::CaptureState::kFrozen;
+    header_.pre_scans = config.pre_scans;
+    header_.post_scans = config.post_scans;
+    header_.trigger_channel = config.channel;
+    header_.trigger_slope = static_cast<std::uint8_t>(config.slope);
+    header_.trigger_threshold = config.threshold;
+    header_.scan_count = static_cast<std::uint32_t>(capture_.size());
+    header_.first_slot = frozen ? static_cast<std::uint32_t>(capture_.first_slot()) : 0u;
+    header_.trigger_index = static_cast<std::uint32_t>(capture_.trigger_index());
+    header_.trigger_timestamp_ticks = frozen ? capture_.trigger_timestamp_ticks() : 0u;
+    header_.capture_number = arm_count;
+    header_.state = static_cast<std::uint8_t>(state);
+  }
+
+  Capture capture_;
+  domain::telemetry::CaptureBufferHeader& header_;
+  std::atomic<std::uint32_t> arm_count_{0};
+  std::array<const domain::sensors::Sensor*, app::config_sensors::kSensorCount> sensors_{};
+  std::uint32_t fitted_mask_ = 0;
+  CaptureScan staged_{};
+  std::uint32_t staged_mask_ = 0;
+};
+
+}  // namespace app::telemetry
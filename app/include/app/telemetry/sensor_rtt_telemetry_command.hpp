@@ -6,10 +6,22 @@
 
 namespace app::telemetry {
 
+/** @brief How the scans of an observed channel set are sent. */
+enum class ScanEncoding : std::uint8_t {
+  /** @brief Every scan as a kSensorScan frame. */
+  kFull = 0,
+  /** @brief Delta-compressed blocks of scans (kSensorScanDelta frames). */
+  kDelta = 1,
+  /** @brief One min/max/mean envelope per telemetry period (kSensorScanEnvelope frames). */
+  kEnvelope = 2,
+};
+
 enum class SensorRttTelemetryCommandKind : std::uint8_t {
   kOff = 0,
   kObserve = 1,
   kSetPeriod = 2,
+  kObserveMask = 3,
+  kSendCapture = 4,
 };
 
 struct SensorRttTelemetryCommand {
@@ -17,6 +29,8 @@ struct SensorRttTelemetryCommand {
   std::uint8_t sensor_id{0};
   domain::sensors::SensorRttMode mode{domain::sensors::SensorRttMode::kRaw};
   std::uint32_t period_ms{0};
+  std::uint32_t channel_mask{0};
+  ScanEncoding encoding{ScanEncoding::kFull};
 };
 
 }  // namespace app::telemetry
@@ -2,6 +2,7 @@
 
 #include <cstdint>
 
+#include "app/telemetry/sensor_rtt_telemetry_command.hpp"
 #include "domain/sensors/sensor_rtt_mode.hpp"
 
 namespace app::telemetry {
@@ -11,6 +12,17 @@ struct SensorRttTelemetryStatus {
   std::uint8_t sensor_id{0};
   domain::sensors::SensorRttMode mode{domain::sensors::SensorRttMode::kRaw};
   std::uint32_t period_ms{0};
+  /** @brief Non-zero while streaming packed scan frames; bit n selects sensor id n + 1. */
+  std::uint32_t channel_mask{0};
+  ScanEncoding encoding{ScanEncoding::kFull};
+  /** @brief Scan frames lost because RTT could not keep up since the mask was selected. */
+  std::uint32_t dropped_frames{0};
+  /** @brief Times the telemetry line went idle while a frame was being queued (wraps). */
+  std::uint32_t underruns{0};
+  /** @brief Frozen capture scans still to be sent; streaming pauses until they are out. */
+  std::uint32_t capture_remaining{0};
+  /** @brief Steps the scan stream is backed off from the requested one because the host lags. */
+  std::uint8_t backoff_level{0};
 };
 
 class SensorRttTelemetryControlRequirements {
@@ -20,7 +32,10 @@ class SensorRttTelemetryControlRequirements {
   virtual bool RequestOff() noexcept = 0;
   virtual bool RequestObserve(std::uint8_t sensor_id,
                               domain::sensors::SensorRttMode mode) noexcept = 0;
+  virtual bool RequestObserveMask(std::uint32_t channel_mask, domain::sensors::SensorRttMode mode,
+                                  ScanEncoding encoding) noexcept = 0;
   virtual bool RequestSetPeriod(std::uint32_t period_ms) noexcept = 0;
+  virtual bool RequestSendCapture() noexcept = 0;
   virtual SensorRttTelemetryStatus GetStatus() const noexcept = 0;
 };
 
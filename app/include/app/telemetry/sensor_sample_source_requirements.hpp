@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdint>
+
+#include "app/config/sensors.hpp"
+#include "domain/sensors/sensor_rtt_mode.hpp"
+#include "domain/telemetry/scan_envelope.hpp"
+#include "domain/telemetry/sensor_scan_frame.hpp"
+
+namespace app::telemetry {
+
+using SensorScanEnvelope = domain::telemetry::ScanEnvelope<app::config_sensors::kSensorCount>;
+
+/**
+ * @brief Drain side of the sample tap (telemetry context): selects what the acquisition path
+ * queues and takes the queued scan records and envelopes off in order.
+ */
+class SensorSampleSourceRequirements {
+ public:
+  virtual ~SensorSampleSourceRequirements() = default;
+
+  // Selects the channels to queue (bit n = sensor id n + 1, 0 stops queuing) and their mode. A
+  // non-zero envelope_period_ticks queues one envelope per period instead of every sequence.
+  virtual void Observe(std::uint32_t channel_mask, domain::sensors::SensorRttMode mode,
+                       std::uint32_t envelope_period_ticks) noexcept = 0;
+
+  // Copies the oldest queued scan record without consuming it; false when none is queued.
+  virtual bool PeekSample(domain::telemetry::SensorScanSample& out_sample) const noexcept = 0;
+  // Consumes the oldest scan record; call only after a successful PeekSample().
+  virtual void PopSample() noexcept = 0;
+
+  virtual bool PeekEnvelope(SensorScanEnvelope& out_envelope) const noexcept = 0;
+  virtual void PopEnvelope() noexcept = 0;
+
+  // Records (scans and envelopes) lost because the drain fell behind; wraps.
+  virtual std::uint32_t DroppedRecords() const noexcept = 0;
+};
+
+}  // namespace app::telemetry
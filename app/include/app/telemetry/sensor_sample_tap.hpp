@@ -0,0 +1,198 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "app/config/config.hpp"
+#include "app/config/sensors.hpp"
+#include "app/telemetry/sensor_sample_source_requirements.hpp"
+#include "app/telemetry/sensor_sample_tap_requirements.hpp"
+#include "domain/sensors/sensor.hpp"
+#include "domain/sensors/sensor_registry.hpp"
+#include "domain/sensors/sensor_rtt_mode.hpp"
+#include "domain/telemetry/scan_envelope.hpp"
+#include "domain/telemetry/sensor_scan_frame.hpp"
+#include "domain/telemetry/spsc_ring.hpp"
+
+namespace app::telemetry {
+
+/**
+ * @brief Copies every sample of the observed channels from the acquisition path into a ring
+ * drained by the telemetry task, so each acquired sample is emitted exactly once with its
+ * timestamp. One ring record holds the observed channels of one acquisition scan.
+ *
+ * The ADCs deliver their sequences separately, so the values of each sequence are staged until
+ * every observed channel has one (or a channel would be overwritten) and then queued as one
+ * record stamped with its first sequence's timestamp, so a scan costs one frame header.
+ *
+ * In envelope mode the samples are folded into per-channel min/max/mean envelopes instead, and
+ * only the closed envelopes (one per period) are queued, on a ring of their own.
+ */
+class SensorSampleTap final : public SensorSampleTapRequirements,
+                              public SensorSampleSourceRequirements {
+ public:
+  using Ring = domain::telemetry::SpscRing<domain::telemetry::SensorScanSample,
+                                           app::config::RTT_TELEMETRY_SAMPLE_RING_CAPACITY>;
+  using Envelope = SensorScanEnvelope;
+  using EnvelopeRing =
+      domain::telemetry::SpscRing<Envelope, app::config::RTT_TELEMETRY_ENVELOPE_RING_CAPACITY>;
+
+  explicit SensorSampleTap(domain::sensors::SensorRegistry& registry) noexcept {
+    for (std::size_t i = 0; i < sensors_.size(); ++i) {
+      sensors_[i] = registry.FindById(static_cast<std::uint8_t>(i + 1u));
+      if (sensors_[i] != nullptr) {
+        fitted_mask_ |= 1u << i;
+      }
+    }
+  }
+
+  void Observe(std::uint32_t channel_mask, domain::sensors::SensorRttMode mode,
+               std::uint32_t envelope_period_ticks) noexcept override {
+    mode_.store(static_cast<std::uint8_t>(mode), std::memory_order_relaxed);
+    envelope_period_ticks_.store(envelope_period_ticks, std::memory_order_relaxed);
+    generation_.fetch_add(1u, std::memory_order_relaxed);
+    channel_mask_.store(channel_mask, std::memory_order_release);
+  }
+
+  void OnSequence(const std::uint8_t* sensor_ids, std::size_t count,
+                  std::uint32_t timestamp_ticks) noexcept override {
+    const std::uint32_t mask = channel_mask_.load(std::memory_order_acquire);
+    if (mask == 0u || sensor_ids == nullptr) {
+      return;
+    }
+    const bool raw = mode_.load(std::memory_order_relaxed) ==
+                     static_cast<std::uint8_t>(domain::sensors::SensorRttMode::kRaw);
+    const std::uint32_t envelope_period_ticks =
+        envelope_period_ticks_.load(std::memory_order_relaxed);
+    if (envelope_period_ticks != 0u) {
+      Accumulate(sensor_ids, count, timestamp_ticks, mask, raw, envelope_period_ticks);
+      return;
+    }
+
+    // A new selection drops the partial scan rather than mixing channels or modes.
+    const std::uint32_t generation = generation_.load(std::memory_order_relaxed);
+    if (generation != staged_generation_) {
+      staged_generation_ = generation;
+      staged_mask_ = 0;
+    }
+
+    const std::uint32_t observed = mask & fitted_mask_;
+    std::uint32_t sequence_mask = 0;
+    for (std::size_t rank = 0; rank < count; ++rank) {
+      const std::uint8_t id = sensor_ids[rank];
+      if (id != 0u && id <= sensors_.size()) {
+        sequence_mask |= (1u << (id - 1u)) & observed;
+      }
+    }
+    if ((staged_mask_ & sequence_mask) != 0u) {
+      Commit();
+    }
+    if (staged_mask_ == 0u) {
+      staged_timestamp_ticks_ = timestamp_ticks;
+    }
+    for (std::size_t rank = 0; rank < count; ++rank) {
+      const std::uint8_t id = sensor_ids[rank];
+      if (id == 0u || id > sensors_.size() || (sequence_mask & (1u << (id - 1u))) == 0u) {
+        continue;
+      }
+      const domain::sensors::Sensor& sensor = *sensors_[id - 1u];
+      staged_values_[id - 1u] =
+          raw ? sensor.last_raw_value()
+              : static_cast<std::uint16_t>(
+                    domain::telemetry::ScaleProcessedValue(sensor.last_processed_value()));
+    }
+    staged_mask_ |= sequence_mask;
+    if (staged_mask_ != 0u && staged_mask_ == observed) {
+      Commit();
+    }
+  }
+
+  bool PeekSample(domain::telemetry::SensorScanSample& out_sample) const noexcept override {
+    return ring_.Peek(out_sample);
+  }
+
+  void PopSample() noexcept override {
+    ring_.Pop();
+  }
+
+  bool PeekEnvelope(Envelope& out_envelope) const noexcept override {
+    return envelope_ring_.Peek(out_envelope);
+  }
+
+  void PopEnvelope() noexcept override {
+    envelope_ring_.Pop();
+  }
+
+  std::uint32_t DroppedRecords() const noexcept override {
+    return ring_.dropped_count() + envelope_ring_.dropped_count();
+  }
+
+  Ring& ring() noexcept {
+    return ring_;
+  }
+
+  EnvelopeRing& envelope_ring() noexcept {
+    return envelope_ring_;
+  }
+
+ private:
+  void Commit() noexcept {
+    // Frames carry values in ascending id order.
+    domain::telemetry::SensorScanSample sample{};
+    sample.timestamp_ticks = staged_timestamp_ticks_;
+    sample.channel_mask = staged_mask_;
+    for (std::size_t i = 0; i < staged_values_.size(); ++i) {
+      if ((staged_mask_ & (1u << i)) != 0u) {
+        sample.values[sample.count++] = staged_values_[i];
+      }
+    }
+    staged_mask_ = 0;
+    (void) ring_.TryPush(sample);
+  }
+
+  void Accumulate(const std::uint8_t* sensor_ids, std::size_t count,
+                  std::uint32_t timestamp_ticks, std::uint32_t mask, bool raw,
+                  std::uint32_t period_ticks) noexcept {
+    // A new selection restarts the envelope rather than mixing channels or periods.
+    const std::uint32_t generation = generation_.load(std::memory_order_relaxed);
+    if (generation != envelope_generation_) {
+      envelope_generation_ = generation;
+      envelope_.Reset(period_ticks);
+    }
+    if (envelope_.Advance(timestamp_ticks)) {
+      (void) envelope_ring_.TryPush(envelope_.closed());
+    }
+    for (std::size_t rank = 0; rank < count; ++rank) {
+      const std::uint8_t id = sensor_ids[rank];
+      if (id == 0u || id > sensors_.size() || (mask & (1u << (id - 1u))) == 0u ||
+          sensors_[id - 1u] == nullptr) {
+        continue;
+      }
+      const domain::sensors::Sensor& sensor = *sensors_[id - 1u];
+      envelope_.Add(id - 1u, raw ? static_cast<std::int32_t>(sensor.last_raw_value())
+                                 : domain::telemetry::ScaleProcessedValue(
+                                       sensor.last_processed_value()));
+    }
+  }
+
+  std::array<const domain::sensors::Sensor*, app::config_sensors::kSensorCount> sensors_{};
+  std::uint32_t fitted_mask_ = 0;
+  std::atomic<std::uint32_t> channel_mask_{0};
+  std::atomic<std::uint8_t> mode_{0};
+  std::atomic<std::uint32_t> envelope_period_ticks_{0};
+  std::atomic<std::uint32_t> generation_{0};
+  Ring ring_{};
+
+  // Acquisition context only.
+  std::uint32_t staged_generation_ = 0;
+  std::uint32_t staged_mask_ = 0;
+  std::uint32_t staged_timestamp_ticks_ = 0;
+  std::array<std::uint16_t, app::config_sensors::kSensorCount> staged_values_{};
+  std::uint32_t envelope_generation_ = 0;
+  domain::telemetry::ScanEnvelopeAccumulator<app::config_sensors::kSensorCount> envelope_{};
+  EnvelopeRing envelope_ring_{};
+};
+
+}  // namespace app::telemetry
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "app/telemetry/sensor_sample_tap_requirements.hpp"
+
+namespace app::telemetry {
+
+/** @brief Passes every ADC sequence to two taps, in order. */
+class SensorSampleTapFanout final : public SensorSampleTapRequirements {
+ public:
+  SensorSampleTapFanout(SensorSampleTapRequirements& first,
+                        SensorSampleTapRequirements& second) noexcept
+      : first_(first), second_(second) {}
+
+  void OnSequence(const std::uint8_t* sensor_ids, std::size_t count,
+                  std::uint32_t timestamp_ticks) noexcept override {
+    first_.OnSequence(sensor_ids, count, timestamp_ticks);
+    second_.OnSequence(sensor_ids, count, timestamp_ticks);
+  }
+
+ private:
+  SensorSampleTapRequirements& first_;
+  SensorSampleTapRequirements& second_;
+};
+
+}  // namespace app::telemetry
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace app::telemetry {
+
+class SensorSampleTapRequirements {
+ public:
+  virtual ~SensorSampleTapRequirements() = default;
+
+  // Queues the observed channels of the ADC sequence just applied to the sensors (acquisition
+  // context). sensor_ids lists the sequence's sensors in rank order.
+  virtual void OnSequence(const std::uint8_t* sensor_ids, std::size_t count,
+                          std::uint32_t timestamp_ticks) noexcept = 0;
+};
+
+}  // namespace app::telemetry
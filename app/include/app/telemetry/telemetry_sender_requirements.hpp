@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <span>
 
@@ -10,6 +11,15 @@ class TelemetrySenderRequirements {
   virtual ~TelemetrySenderRequirements() = default;
 
   virtual void Send(std::span<const std::uint8_t> data) noexcept = 0;
+  // Bytes that can be sent right now without being skipped.
+  virtual std::size_t WritableBytes() const noexcept = 0;
+  // What WritableBytes() returns once the host has read everything.
+  virtual std::size_t CapacityBytes() const noexcept = 0;
+  // Writes skipped so far because they did not fit; wraps.
+  virtual std::uint32_t DroppedWrites() const noexcept = 0;
+  // Times the line went idle while a write was still being copied in; wraps. Always 0 for
+  // senders that do not feed a transmit DMA.
+  virtual std::uint32_t Underruns() const noexcept = 0;
 
   template <typename T>
   void Send(const T& value) noexcept {
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstdint>
+
+namespace app::time {
+
+/**
+ * @brief One-shot alarm on the timestamp counter.
+ * A deadline already in the past fires as soon as possible.
+ */
+class AlarmRequirements {
+ public:
+  virtual ~AlarmRequirements() = default;
+
+  virtual void ArmAt(std::uint32_t deadline_ticks) noexcept = 0;
+  virtual void Disarm() noexcept = 0;
+};
+
+}  // namespace app::time
@@ -22,13 +22,28 @@ void Application::create_tasks() noexcept {
 
   app::composition::ConsoleContext console{console_stream};
 
-  app::composition::AdcControlContext adc_control = app::composition::CreateAnalogSubsystem();
+  app::composition::MusicEventsContext music_events = app::composition::CreateMusicEventsContext();
+  app::composition::AdcControlContext adc_control =
+      app::composition::CreateAnalogSubsystem(music_events);
   app::composition::AdcStateContext adc_state = app::composition::CreateAdcStateContext();
   app::composition::SensorsContext sensors = app::composition::CreateSensorsContext();
+  app::composition::SensorSamplesContext sensor_samples =
+      app::composition::CreateSensorSamplesContext();
+  app::composition::SensorCaptureContext sensor_capture =
+      app::composition::CreateSensorCaptureContext();
+  app::composition::SensorNoiseContext sensor_noise = app::composition::CreateSensorNoiseContext();
+  app::composition::SensorBaselineContext sensor_baseline =
+      app::composition::CreateSensorBaselineContext();
 
   app::composition::SensorRttTelemetryControlContext sensor_rtt =
-      app::composition::CreateSensorRttTelemetrySubsystem(sensors, adc_state);
-  app::composition::CreateShellSubsystem(console, adc_control, sensors, sensor_rtt);
+      app::composition::CreateSensorRttTelemetrySubsystem(sensors, adc_state, sensor_samples,
+                                                          sensor_capture);
+  app::composition::CanChainContext can_chain = app::composition::CreateCanChainSubsystem();
+  app::composition::MidiOutputControlContext midi_output =
+      app::composition::CreateMidiOutputSubsystem(music_events, can_chain);
+  app::composition::CreateShellSubsystem(console, adc_control, sensors, sensor_noise,
+                                         sensor_baseline, sensor_capture, sensor_rtt,
+                                         midi_output);
 }
 
 }  // namespace app
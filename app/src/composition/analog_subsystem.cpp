@@ -5,14 +5,25 @@
 
 #include "app/analog/queue_acquisition_control.hpp"
 #include "app/composition/subsystems.hpp"
+#include "app/config/music.hpp"
 #include "app/config/sensors.hpp"
 #include "app/config/sensors_validation.hpp"
+#include "app/config/signal_processing.hpp"
+#include "app/music/keyboard_scanner.hpp"
 #include "app/tasks/analog_acquisition_task.hpp"
+#include "app/telemetry/live_snapshot_tap.hpp"
+#include "app/telemetry/scan_capture_tap.hpp"
+#include "app/telemetry/sensor_sample_tap.hpp"
+#include "app/telemetry/sensor_sample_tap_fanout.hpp"
 #include "bsp/adc/adc_dma.hpp"
+#include "bsp/memory_sections.hpp"
 #include "bsp/pins.hpp"
 #include "bsp/time/tim2_timestamp_counter.hpp"
 #include "domain/sensors/processed_sensor_group.hpp"
+#include "domain/sensors/processor_baseline_view.hpp"
 #include "domain/sensors/sensor_registry.hpp"
+#include "domain/telemetry/capture_buffer_header.hpp"
+#include "domain/telemetry/live_snapshot.hpp"
 #include "os/queue.hpp"
 
 namespace app::composition {
@@ -57,10 +68,60 @@ domain::sensors::SensorRegistry& SensorsRegistry() noexcept {
   return registry;
 }
 
-using Processor = app::config::AnalogSensorProcessor;
-using ProcessedSensorGroup = domain::sensors::ProcessedSensorGroup<Processor>;
+app::telemetry::SensorSampleTap& SensorsSampleTap() noexcept {
+  static app::telemetry::SensorSampleTap tap(SensorsRegistry());
+  return tap;
+}
+
+app::telemetry::ScanCaptureTap& SensorsCaptureTap() noexcept {
+  // Header and scans form one block at the start of RAM_D2 that a debugger can dump as is.
+  alignas(32) BSP_D2_SRAM static domain::telemetry::CaptureBuffer<
+      app::config_sensors::kSensorCount, app::config::CAPTURE_SCAN_CAPACITY>
+      capture_buffer;
+  static app::telemetry::ScanCaptureTap tap(SensorsRegistry(), capture_buffer.header,
+                                            capture_buffer.scans,
+                                            app::config::CAPTURE_SCAN_CAPACITY);
+  return tap;
+}
+
+app::telemetry::LiveSnapshotTap& SensorsLiveSnapshotTap() noexcept {
+  // Fixed at the start of RAM_D3 (non-cacheable), where a debugger reads it in the background.
+  alignas(32) BSP_LIVE_SNAPSHOT static app::telemetry::LiveSnapshotTap::Snapshot live_snapshot;
+  static app::telemetry::LiveSnapshotTap tap(SensorsRegistry(), live_snapshot);
+  return tap;
+}
+
+app::telemetry::SensorSampleTapFanout& SensorsSampleTaps() noexcept {
+  static app::telemetry::SensorSampleTapFanout telemetry_taps(SensorsSampleTap(),
+                                                              SensorsCaptureTap());
+  static app::telemetry::SensorSampleTapFanout taps(telemetry_taps, SensorsLiveSnapshotTap());
+  return taps;
+}
+
+using Processor = app::Tasks::AnalogAcquisitionTask::Processor;
+using NoiseMonitor = app::Tasks::AnalogAcquisitionTask::NoiseMonitor;
+using ProcessedSensorGroup = app::Tasks::AnalogAcquisitionTask::ProcessedSensorGroup;
+using BaselineView =
+    domain::sensors::ProcessorBaselineView<Processor, app::config::AnalogSensorBaselineTracker>;
+
+NoiseMonitor& SensorsNoiseMonitor() noexcept {
+  static NoiseMonitor monitor;
+  return monitor;
+}
+
+std::array<Processor, app::config_sensors::kSensorCount>& SensorsProcessors() noexcept {
+  static std::array<Processor, app::config_sensors::kSensorCount> processors{};
+  return processors;
+}
 
-void StartAnalogAcquisitionTask(ProcessedSensorGroup& analog_group) noexcept {
+BaselineView& SensorsBaselineView() noexcept {
+  static BaselineView view(SensorsProcessors().data(), app::config_sensors::kSensorCount);
+  return view;
+}
+
+void StartAnalogAcquisitionTask(
+    ProcessedSensorGroup& analog_group,
+    app::music::KeyboardScannerRequirements& keyboard_scanner) noexcept {
   static os::Queue<bsp::adc::AdcFrameDescriptor, 8> adc_frame_queue;
   static bsp::adc::AdcDma adc_dma(adc_frame_queue);
   static bsp::time::TimestampCounter timestamp_counter = bsp::time::CreateTim2TimestampCounter();
@@ -72,7 +133,7 @@ void StartAnalogAcquisitionTask(ProcessedSensorGroup& analog_group) noexcept {
   if (!analog_constructed) {
     analog_task_ptr = new (analog_task_storage) app::Tasks::AnalogAcquisitionTask(
         adc_frame_queue, AdcControlQueue(), bsp::pins::TiaShutdown(), adc_dma, timestamp_counter,
-        AdcState(), analog_group);
+        AdcState(), analog_group, keyboard_scanner, SensorsSampleTaps());
     analog_constructed = true;
   } else {
     analog_task_ptr = reinterpret_cast<app::Tasks::AnalogAcquisitionTask*>(analog_task_storage);
@@ -92,7 +153,23 @@ SensorsContext CreateSensorsContext() noexcept {
   return SensorsContext{SensorsRegistry()};
 }
 
-AdcControlContext CreateAnalogSubsystem() noexcept {
+SensorSamplesContext CreateSensorSamplesContext() noexcept {
+  return SensorSamplesContext{SensorsSampleTap()};
+}
+
+SensorCaptureContext CreateSensorCaptureContext() noexcept {
+  return SensorCaptureContext{SensorsCaptureTap()};
+}
+
+SensorNoiseContext CreateSensorNoiseContext() noexcept {
+  return SensorNoiseContext{SensorsNoiseMonitor()};
+}
+
+SensorBaselineContext CreateSensorBaselineContext() noexcept {
+  return SensorBaselineContext{SensorsBaselineView()};
+}
+
+AdcControlContext CreateAnalogSubsystem(MusicEventsContext& music_events) noexcept {
   static_assert(app::config_sensors::kSensorCount > 0u, "Sensor count must be > 0");
   static_assert(app::config_sensors::kSensorCount == 22u, "Expected 22 sensors");
   static_assert(app::config_sensors::kAdc1RankCount == bsp::adc::AdcDma::kAdc1RanksPerSequence,
@@ -103,7 +180,7 @@ AdcControlContext CreateAnalogSubsystem() noexcept {
                 "ADC3 rank count must match AdcDma ranks");
 
   static domain::sensors::Sensor* sensors_ptrs[app::config_sensors::kSensorCount];
-  static std::array<Processor, app::config_sensors::kSensorCount> processors{};
+  std::array<Processor, app::config_sensors::kSensorCount>& processors = SensorsProcessors();
 
   domain::sensors::SensorRegistry& registry = SensorsRegistry();
   for (std::size_t i = 0; i < app::config_sensors::kSensorCount; ++i) {
@@ -111,9 +188,13 @@ AdcControlContext CreateAnalogSubsystem() noexcept {
   }
 
   static ProcessedSensorGroup analog_group(sensors_ptrs, processors.data(),
-                                           app::config_sensors::kSensorCount);
+                                           app::config_sensors::kSensorCount,
+                                           &SensorsNoiseMonitor());
+
+  static app::music::KeyboardScanner keyboard_scanner(sensors_ptrs, music_events.queue,
+                                                      app::config::MUSIC_PEDALS);
 
-  StartAnalogAcquisitionTask(analog_group);
+  StartAnalogAcquisitionTask(analog_group, keyboard_scanner);
   return AdcControlContext{AdcControl()};
 }
 
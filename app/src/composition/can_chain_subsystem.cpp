@@ -0,0 +1,48 @@
+#include <cstdint>
+#include <new>
+
+#include "app/can/can_chain_command.hpp"
+#include "app/can/queue_can_chain_control.hpp"
+#include "app/can/queue_can_chain_events.hpp"
+#include "app/composition/subsystems.hpp"
+#include "app/config/music.hpp"
+#include "app/tasks/can_chain_task.hpp"
+#include "bsp/can/fdcan1_bus.hpp"
+#include "bsp/time/tim2_timestamp_counter.hpp"
+#include "os/queue.hpp"
+
+namespace app::composition {
+
+CanChainContext CreateCanChainSubsystem() noexcept {
+  static os::Queue<app::can::CanChainCommand, 4> control_queue;
+  static volatile bool enabled = false;
+  static volatile app::can::CanChainStats stats{};
+  static app::can::QueueCanChainControl control(control_queue, enabled, stats);
+
+  // Local events from the MIDI output task, and the other boards' events back to it.
+  static app::config::MusicEventQueue local_events;
+  static app::config::MusicEventQueue remote_events;
+  static app::can::QueueCanChainEvents events(enabled, local_events, remote_events);
+
+  // Reads TIM2 only; the acquisition subsystem starts the counter.
+  static bsp::time::TimestampCounter timestamp_counter = bsp::time::CreateTim2TimestampCounter();
+  static bsp::can::Fdcan1Bus can_bus(timestamp_counter);
+  (void) can_bus.Init();
+
+  alignas(app::Tasks::CanChainTask) static std::uint8_t
+      task_storage[sizeof(app::Tasks::CanChainTask)];
+  static bool task_constructed = false;
+  app::Tasks::CanChainTask* task_ptr = nullptr;
+  if (!task_constructed) {
+    task_ptr = new (task_storage) app::Tasks::CanChainTask(
+        control_queue, local_events, remote_events, enabled, stats, timestamp_counter, can_bus);
+    task_constructed = true;
+  } else {
+    task_ptr = reinterpret_cast<app::Tasks::CanChainTask*>(task_storage);
+  }
+
+  (void) task_ptr->start();
+  return CanChainContext{events, control};
+}
+
+}  // namespace app::composition
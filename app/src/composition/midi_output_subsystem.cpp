@@ -0,0 +1,103 @@
+#include <cstdint>
+#include <new>
+
+#include "app/composition/subsystems.hpp"
+#include "app/config/config.hpp"
+#include "app/config/music.hpp"
+#include "app/midi/queue_midi_output_control.hpp"
+#include "app/tasks/midi_output_task.hpp"
+#include "bsp/memory_sections.hpp"
+#include "bsp/serial/midi_uarts.hpp"
+#include "bsp/serial/uart_stream.hpp"
+#include "bsp/time/tim2_alarm.hpp"
+#include "bsp/time/tim2_timestamp_counter.hpp"
+#include "domain/io/stream_requirements.hpp"
+#include "os/queue.hpp"
+
+namespace app::composition {
+namespace {
+
+using MidiUartStream = bsp::serial::UartStream<16, app::config::MIDI_UART_TX_FIFO_SIZE>;
+
+using MidiControlQueue = os::Queue<app::midi::MidiOutputCommand, 4>;
+
+// Stands in for USART3 while it carries the sensor telemetry.
+class DiscardStream final : public domain::io::WritableStreamRequirements {
+ public:
+  void Write(char) noexcept override {}
+  void Write(const char*) noexcept override {}
+};
+
+domain::io::WritableStreamRequirements& MidiUart3Stream() noexcept {
+  if constexpr (app::config::SENSOR_TELEMETRY_LINK == app::config::SensorTelemetryLink::kUsart3) {
+    static DiscardStream discard;
+    return discard;
+  } else {
+    alignas(32) BSP_AXI_SRAM_NOCACHE static MidiUartStream uart3_stream(
+        bsp::serial::MidiUart3());
+    return uart3_stream;
+  }
+}
+
+void WakeMidiOutputTask(void* ctx) noexcept {
+  app::midi::MidiOutputCommand cmd{};
+  cmd.kind = app::midi::MidiOutputCommandKind::kWake;
+  (void) static_cast<MidiControlQueue*>(ctx)->SendFromIsr(cmd);
+}
+
+app::config::MusicEventQueue& MusicEvents() noexcept {
+  static app::config::MusicEventQueue queue;
+  return queue;
+}
+
+}  // namespace
+
+MusicEventsContext CreateMusicEventsContext() noexcept {
+  return MusicEventsContext{MusicEvents()};
+}
+
+MidiOutputControlContext CreateMidiOutputSubsystem(MusicEventsContext& music_events,
+                                                   CanChainContext& can_chain) noexcept {
+  (void) bsp::serial::InitMidiUarts();
+
+  alignas(32) BSP_AXI_SRAM_NOCACHE static MidiUartStream uart2_stream(bsp::serial::MidiUart2());
+  domain::io::WritableStreamRequirements& uart3_stream = MidiUart3Stream();
+
+  static MidiControlQueue control_queue;
+  static volatile bool enabled = false;
+  static volatile app::midi::MidiRoute route = app::midi::MidiRoute::kUart2;
+  static volatile app::midi::MidiProtocol protocol = app::midi::MidiProtocol::kMidi1;
+  static volatile std::uint8_t channel = app::config::MIDI_DEFAULT_CHANNEL;
+  static volatile std::uint32_t message_count = 0;
+  static volatile std::uint32_t byte_count = 0;
+  static volatile app::midi::MidiOutputSchedulerStats scheduler_stats{};
+  static volatile app::midi::MidiOutputLatencyStats latency_stats{};
+  static app::midi::QueueMidiOutputControl control(control_queue, music_events.queue, enabled,
+                                                   route, protocol, channel, message_count,
+                                                   byte_count, scheduler_stats, latency_stats,
+                                                   can_chain.control);
+  // Reads TIM2 only; the acquisition subsystem starts the counter.
+  static bsp::time::TimestampCounter timestamp_counter = bsp::time::CreateTim2TimestampCounter();
+  static bsp::time::Tim2Alarm alarm(WakeMidiOutputTask, &control_queue);
+  (void) alarm.Init();
+
+  alignas(app::Tasks::MidiOutputTask) static std::uint8_t
+      task_storage[sizeof(app::Tasks::MidiOutputTask)];
+  static bool task_constructed = false;
+  app::Tasks::MidiOutputTask* task_ptr = nullptr;
+  if (!task_constructed) {
+    task_ptr = new (task_storage)
+        app::Tasks::MidiOutputTask(control_queue, music_events.queue, can_chain.events,
+                                   uart2_stream, uart3_stream, enabled, route, protocol, channel,
+                                   message_count, byte_count, scheduler_stats, latency_stats,
+                                   timestamp_counter, alarm);
+    task_constructed = true;
+  } else {
+    task_ptr = reinterpret_cast<app::Tasks::MidiOutputTask*>(task_storage);
+  }
+
+  (void) task_ptr->start();
+  return MidiOutputControlContext{control};
+}
+
+}  // namespace app::composition
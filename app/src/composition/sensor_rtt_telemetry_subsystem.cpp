@@ -5,25 +5,56 @@
 #include "app/config/config.hpp"
 #include "app/tasks/sensor_rtt_telemetry_task.hpp"
 #include "app/telemetry/queue_sensor_rtt_telemetry_control.hpp"
+#include "app/telemetry/telemetry_sender_requirements.hpp"
+#include "bsp/memory_sections.hpp"
 #include "bsp/rtt_telemetry_sender.hpp"
+#include "bsp/serial/midi_uarts.hpp"
+#include "bsp/serial/uart_dma_telemetry_sender.hpp"
 #include "os/queue.hpp"
 
 namespace app::composition {
+namespace {
+
+app::telemetry::TelemetrySenderRequirements& SensorTelemetrySender() noexcept {
+  if constexpr (app::config::SENSOR_TELEMETRY_LINK == app::config::SensorTelemetryLink::kUsart3) {
+    // Set up before the MIDI subsystem, whose InitMidiUarts() then leaves USART3 alone.
+    (void) bsp::serial::InitMidiUarts();
+    (void) bsp::serial::SetUartBaudRate(bsp::serial::MidiUart3(),
+                                        app::config::SENSOR_TELEMETRY_UART_BAUD_RATE);
+    alignas(32) BSP_AXI_SRAM_NOCACHE static bsp::serial::UartDmaTelemetrySender<
+        app::config::SENSOR_TELEMETRY_UART_BUFFER_BYTES>
+        telemetry(bsp::serial::MidiUart3());
+    return telemetry;
+  } else {
+    alignas(4) static std::uint8_t
+        telemetry_buffer[app::config::RTT_TELEMETRY_SENSOR_BUFFER_SIZE];
+    static bsp::RttTelemetrySender telemetry(app::config::RTT_TELEMETRY_SENSOR_CHANNEL,
+                                             "SensorTelemetry", telemetry_buffer,
+                                             static_cast<unsigned>(sizeof(telemetry_buffer)));
+    return telemetry;
+  }
+}
+
+}  // namespace
 
 SensorRttTelemetryControlContext CreateSensorRttTelemetrySubsystem(
-    SensorsContext& sensors, AdcStateContext& adc_state) noexcept {
-  alignas(4) static std::uint8_t telemetry_buffer[app::config::RTT_TELEMETRY_SENSOR_BUFFER_SIZE];
-  static bsp::RttTelemetrySender telemetry(app::config::RTT_TELEMETRY_SENSOR_CHANNEL,
-                                           "SensorTelemetry", telemetry_buffer,
-                                           static_cast<unsigned>(sizeof(telemetry_buffer)));
+    SensorsContext& sensors, AdcStateContext& adc_state, SensorSamplesContext& sensor_samples,
+    SensorCaptureContext& sensor_capture) noexcept {
+  app::telemetry::TelemetrySenderRequirements& telemetry = SensorTelemetrySender();
 
   static os::Queue<app::telemetry::SensorRttTelemetryCommand, 4> control_queue;
   static volatile bool enabled = false;
   static volatile std::uint8_t sensor_id = 0;
   static volatile domain::sensors::SensorRttMode mode = domain::sensors::SensorRttMode::kRaw;
   static volatile std::uint32_t period_ms = app::config::RTT_TELEMETRY_SENSOR_PERIOD_MS;
-  static app::telemetry::QueueSensorRttTelemetryControl control(control_queue, enabled, sensor_id,
-                                                                mode, period_ms);
+  static volatile std::uint32_t channel_mask = 0;
+  static volatile app::telemetry::ScanEncoding encoding = app::telemetry::ScanEncoding::kFull;
+  static volatile std::uint32_t dropped_frames = 0;
+  static volatile std::uint32_t capture_remaining = 0;
+  static volatile std::uint8_t backoff_level = 0;
+  static app::telemetry::QueueSensorRttTelemetryControl control(
+      control_queue, telemetry, enabled, sensor_id, mode, period_ms, channel_mask, encoding,
+      dropped_frames, capture_remaining, backoff_level);
 
   alignas(app::Tasks::SensorRttTelemetryTask) static std::uint8_t
       task_storage[sizeof(app::Tasks::SensorRttTelemetryTask)];
@@ -32,7 +63,10 @@ SensorRttTelemetryControlContext CreateSensorRttTelemetrySubsystem(
   if (!task_constructed) {
     task_ptr = new (task_storage)
         app::Tasks::SensorRttTelemetryTask(control_queue, sensors.registry, adc_state.state,
-                                           telemetry, enabled, sensor_id, mode, period_ms);
+                                           telemetry, sensor_samples.tap, sensor_capture.capture,
+                                           enabled, sensor_id, mode, period_ms, channel_mask,
+                                           encoding, dropped_frames, capture_remaining,
+                                           backoff_level);
     task_constructed = true;
   } else {
     task_ptr = reinterpret_cast<app::Tasks::SensorRttTelemetryTask*>(task_storage);
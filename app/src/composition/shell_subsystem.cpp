@@ -3,6 +3,11 @@
 
 #include "app/composition/subsystems.hpp"
 #include "app/shell/commands/adc_command.hpp"
+#include "app/shell/commands/baseline_command.hpp"
+#include "app/shell/commands/capture_command.hpp"
+#include "app/shell/commands/midi_command.hpp"
+#include "app/shell/commands/noise_command.hpp"
+#include "app/shell/commands/record_command.hpp"
 #include "app/shell/commands/sensor_rtt_command.hpp"
 #include "app/tasks/shell_task.hpp"
 #include "app/version.hpp"
@@ -11,8 +16,11 @@
 namespace app::composition {
 
 void CreateShellSubsystem(ConsoleContext& console, AdcControlContext& adc_control,
-                          SensorsContext& sensors,
-                          SensorRttTelemetryControlContext& sensor_rtt) noexcept {
+                          SensorsContext& sensors, SensorNoiseContext& sensor_noise,
+                          SensorBaselineContext& sensor_baseline,
+                          SensorCaptureContext& sensor_capture,
+                          SensorRttTelemetryControlContext& sensor_rtt,
+                          MidiOutputControlContext& midi_output) noexcept {
   static const ::shell::ShellConfig shell_config{"adc-board> "};
 
   alignas(
@@ -34,6 +42,23 @@ void CreateShellSubsystem(ConsoleContext& console, AdcControlContext& adc_contro
     static app::shell::commands::SensorRttCommand sensor_rtt_cmd(sensors.registry,
                                                                  sensor_rtt.control);
     shell_task_ptr->RegisterCommand(sensor_rtt_cmd);
+
+    static app::shell::commands::NoiseCommand noise_cmd(sensor_noise.stats);
+    shell_task_ptr->RegisterCommand(noise_cmd);
+
+    static app::shell::commands::BaselineCommand baseline_cmd(sensor_baseline.baselines);
+    shell_task_ptr->RegisterCommand(baseline_cmd);
+
+    static app::shell::commands::CaptureCommand capture_cmd(sensors.registry,
+                                                            sensor_capture.capture);
+    shell_task_ptr->RegisterCommand(capture_cmd);
+
+    static app::shell::commands::RecordCommand record_cmd(sensor_capture.capture,
+                                                          sensor_rtt.control);
+    shell_task_ptr->RegisterCommand(record_cmd);
+
+    static app::shell::commands::MidiCommand midi_cmd(midi_output.control);
+    shell_task_ptr->RegisterCommand(midi_cmd);
   } else {
     shell_task_ptr = reinterpret_cast<app::Tasks::ShellTask*>(shell_task_storage);
   }
@@ -0,0 +1,83 @@
+#include "app/shell/commands/baseline_command.hpp"
+
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <system_error>
+
+namespace app::shell::commands {
+namespace {
+
+constexpr std::size_t kIdColumnWidth = 3;
+constexpr std::size_t kBaselineColumnWidth = 12;
+
+void WritePadded(domain::io::WritableStreamRequirements& out, std::string_view text,
+                 std::size_t width) noexcept {
+  for (std::size_t i = text.size(); i < width; ++i) {
+    out.Write(' ');
+  }
+  out.Write(text);
+}
+
+void WriteUint32Column(domain::io::WritableStreamRequirements& out, std::uint32_t value,
+                       std::size_t width) noexcept {
+  char buf[16]{};
+  auto r = std::to_chars(buf, buf + sizeof(buf), value);
+  if (r.ec != std::errc()) {
+    return;
+  }
+  WritePadded(out, std::string_view(buf, static_cast<std::size_t>(r.ptr - buf)), width);
+}
+
+void WriteMicroColumn(domain::io::WritableStreamRequirements& out, float value,
+                      std::size_t width) noexcept {
+  const bool is_negative = value < 0.0f;
+  const std::uint32_t micro =
+      static_cast<std::uint32_t>(std::lround(std::fabs(static_cast<double>(value)) * 1e6));
+
+  char buf[32]{};
+  char* ptr = buf;
+  if (is_negative) {
+    *ptr++ = '-';
+  }
+  auto r = std::to_chars(ptr, buf + sizeof(buf) - 7, micro / 1'000'000u);
+  if (r.ec != std::errc()) {
+    return;
+  }
+  ptr = r.ptr;
+  *ptr++ = '.';
+  std::uint32_t fraction = micro % 1'000'000u;
+  for (std::uint32_t divisor = 100'000u; divisor > 0u; divisor /= 10u) {
+    *ptr++ = static_cast<char>('0' + fraction / divisor);
+    fraction %= divisor;
+  }
+  WritePadded(out, std::string_view(buf, static_cast<std::size_t>(ptr - buf)), width);
+}
+
+}  // namespace
+
+void BaselineCommand::Run(int argc, char** argv,
+                          domain::io::WritableStreamRequirements& out) noexcept {
+  if (argc > 1 && argv != nullptr) {
+    out.Write("usage: baseline\r\n");
+    return;
+  }
+
+  WritePadded(out, "id", kIdColumnWidth);
+  WritePadded(out, "baseline_ma", kBaselineColumnWidth);
+  out.Write("\r\n");
+  for (std::size_t index = 0; index < baselines_.channel_count(); ++index) {
+    WriteUint32Column(out, static_cast<std::uint32_t>(index + 1u), kIdColumnWidth);
+    float baseline = 0.0f;
+    if (baselines_.TryReadBaseline(index, baseline)) {
+      WriteMicroColumn(out, baseline, kBaselineColumnWidth);
+    } else {
+      WritePadded(out, "-", kBaselineColumnWidth);
+    }
+    out.Write("\r\n");
+  }
+}
+
+}  // namespace app::shell::commands
@@ -0,0 +1,226 @@
+#include "app/shell/commands/capture_command.hpp"
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <system_error>
+
+#include "app/config/config.hpp"
+
+namespace app::shell::commands {
+namespace {
+
+std::string_view Arg(int argc, char** argv, int index) noexcept {
+  if (argv == nullptr) {
+    return {};
+  }
+  if (index < 0 || index >= argc) {
+    return {};
+  }
+  if (argv[index] == nullptr) {
+    return {};
+  }
+  return std::string_view(argv[index]);
+}
+
+void WriteUsage(domain::io::WritableStreamRequirements& out) noexcept {
+  out.Write("usage: capture arm <id> <threshold> [falling|rising|either] [pre] [post]\r\n");
+  out.Write("       capture off\r\n");
+  out.Write("       capture status\r\n");
+  out.Write("       capture read [first] [count]\r\n");
+}
+
+bool ParseUint32(std::string_view text, std::uint32_t& out_value) noexcept {
+  if (text.empty()) {
+    return false;
+  }
+  std::uint32_t value = 0;
+  const char* begin = text.data();
+  const char* end = begin + text.size();
+  const auto r = std::from_chars(begin, end, value);
+  if (r.ec != std::errc() || r.ptr != end) {
+    return false;
+  }
+  out_value = value;
+  return true;
+}
+
+// An absent argument keeps out_value.
+bool ParseOptionalUint32(std::string_view text, std::uint32_t& out_value) noexcept {
+  return text.empty() || ParseUint32(text, out_value);
+}
+
+bool ParseSlope(std::string_view text, domain::telemetry::TriggerSlope& out_slope) noexcept {
+  if (text.empty() || text == "falling") {
+    out_slope = domain::telemetry::TriggerSlope::kFalling;
+    return true;
+  }
+  if (text == "rising") {
+    out_slope = domain::telemetry::TriggerSlope::kRising;
+    return true;
+  }
+  if (text == "either") {
+    out_slope = domain::telemetry::TriggerSlope::kEither;
+    return true;
+  }
+  return false;
+}
+
+void WriteUint32(domain::io::WritableStreamRequirements& out, std::uint32_t value) noexcept {
+  char buf[16]{};
+  auto r = std::to_chars(buf, buf + sizeof(buf), value);
+  if (r.ec != std::errc()) {
+    return;
+  }
+  out.Write(std::string_view(buf, static_cast<std::size_t>(r.ptr - buf)));
+}
+
+std::string_view StateName(domain::telemetry::CaptureState state) noexcept {
+  switch (state) {
+    case domain::telemetry::CaptureState::kIdle:
+      return "idle";
+    case domain::telemetry::CaptureState::kArmed:
+      return "armed";
+    case domain::telemetry::CaptureState::kTriggered:
+      return "triggered";
+    case domain::telemetry::CaptureState::kFrozen:
+      return "frozen";
+  }
+  return "?";
+}
+
+std::string_view SlopeName(domain::telemetry::TriggerSlope slope) noexcept {
+  switch (slope) {
+    case domain::telemetry::TriggerSlope::kRising:
+      return "rising";
+    case domain::telemetry::TriggerSlope::kFalling:
+      return "falling";
+    case domain::telemetry::TriggerSlope::kEither:
+      return "either";
+    case domain::telemetry::TriggerSlope::kImmediate:
+      return "immediate";
+  }
+  return "?";
+}
+
+void WriteStatus(domain::io::WritableStreamRequirements& out,
+                 const app::telemetry::CaptureStatus& status) noexcept {
+  out.Write(StateName(status.state));
+  if (status.state == domain::telemetry::CaptureState::kIdle) {
+    out.Write(" capacity=");
+    WriteUint32(out, status.capacity);
+    out.Write("\r\n");
+    return;
+  }
+  out.Write(" id=");
+  WriteUint32(out, status.config.channel + 1u);
+  out.Write(" threshold=");
+  WriteUint32(out, status.config.threshold);
+  out.Write(" slope=");
+  out.Write(SlopeName(status.config.slope));
+  out.Write(" pre=");
+  WriteUint32(out, status.config.pre_scans);
+  out.Write(" post=");
+  WriteUint32(out, status.config.post_scans);
+  if (status.state == domain::telemetry::CaptureState::kFrozen) {
+    out.Write(" scans=");
+    WriteUint32(out, status.scan_count);
+    out.Write(" trigger_t=");
+    WriteUint32(out, status.trigger_timestamp_ticks);
+  }
+  out.Write("\r\n");
+}
+
+// One CSV row per scan: index, timestamp, then the raw counts of sensor ids 1..N.
+void WriteScans(domain::io::WritableStreamRequirements& out,
+                const app::telemetry::CaptureControlRequirements& capture, std::uint32_t first,
+                std::uint32_t count) noexcept {
+  out.Write("index,timestamp_ticks");
+  for (std::uint32_t id = 1; id <= app::config_sensors::kSensorCount; ++id) {
+    out.Write(",s");
+    WriteUint32(out, id);
+  }
+  out.Write("\r\n");
+
+  app::telemetry::CaptureScan scan{};
+  for (std::uint32_t index = first; index - first < count && capture.ReadScan(index, scan);
+       ++index) {
+    WriteUint32(out, index);
+    out.Write(',');
+    WriteUint32(out, scan.timestamp_ticks);
+    for (const std::uint16_t value : scan.values) {
+      out.Write(',');
+      WriteUint32(out, value);
+    }
+    out.Write("\r\n");
+  }
+}
+
+}  // namespace
+
+void CaptureCommand::Run(int argc, char** argv,
+                         domain::io::WritableStreamRequirements& out) noexcept {
+  const std::string_view op = Arg(argc, argv, 1);
+
+  if (op == "status") {
+    WriteStatus(out, capture_.GetStatus());
+    return;
+  }
+
+  if (op == "off") {
+    capture_.Disarm();
+    out.Write("ok\r\n");
+    return;
+  }
+
+  if (op == "read") {
+    std::uint32_t first = 0;
+    std::uint32_t count = UINT32_MAX;
+    if (!ParseOptionalUint32(Arg(argc, argv, 2), first) ||
+        !ParseOptionalUint32(Arg(argc, argv, 3), count)) {
+      WriteUsage(out);
+      return;
+    }
+    const app::telemetry::CaptureStatus status = capture_.GetStatus();
+    if (status.state != domain::telemetry::CaptureState::kFrozen) {
+      out.Write("error: no frozen capture\r\n");
+      return;
+    }
+    WriteScans(out, capture_, first, count);
+    return;
+  }
+
+  if (op == "arm") {
+    std::uint32_t sensor_id = 0;
+    std::uint32_t threshold = 0;
+    domain::telemetry::TriggerConfig config{};
+    config.pre_scans = app::config::CAPTURE_DEFAULT_PRE_SCANS;
+    config.post_scans = app::config::CAPTURE_DEFAULT_POST_SCANS;
+    if (!ParseUint32(Arg(argc, argv, 2), sensor_id) ||
+        !ParseUint32(Arg(argc, argv, 3), threshold) || threshold > UINT16_MAX ||
+        !ParseSlope(Arg(argc, argv, 4), config.slope) ||
+        !ParseOptionalUint32(Arg(argc, argv, 5), config.pre_scans) ||
+        !ParseOptionalUint32(Arg(argc, argv, 6), config.post_scans)) {
+      WriteUsage(out);
+      return;
+    }
+    if (sensor_id == 0u || sensor_id > 255u ||
+        registry_.FindById(static_cast<std::uint8_t>(sensor_id)) == nullptr) {
+      out.Write("error: unknown sensor id\r\n");
+      return;
+    }
+    config.channel = static_cast<std::uint8_t>(sensor_id - 1u);
+    config.threshold = static_cast<std::uint16_t>(threshold);
+    if (!capture_.Arm(config)) {
+      out.Write("error: request rejected\r\n");
+      return;
+    }
+    out.Write("ok\r\n");
+    return;
+  }
+
+  WriteUsage(out);
+}
+
+}  // namespace app::shell::commands
@@ -0,0 +1,268 @@
+#include "app/shell/commands/midi_command.hpp"
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <system_error>
+
+#include "app/config/music.hpp"
+
+namespace app::shell::commands {
+namespace {
+
+std::string_view Arg(int argc, char** argv, int index) noexcept {
+  if (argv == nullptr) {
+    return {};
+  }
+  if (index < 0 || index >= argc) {
+    return {};
+  }
+  if (argv[index] == nullptr) {
+    return {};
+  }
+  return std::string_view(argv[index]);
+}
+
+void WriteUsage(domain::io::WritableStreamRequirements& out) noexcept {
+  out.Write("usage: midi [status]\r\n");
+  out.Write("       midi on|off\r\n");
+  out.Write("       midi route uart2|uart3|both\r\n");
+  out.Write("       midi channel <1-16>\r\n");
+  out.Write("       midi latency off|<us>\r\n");
+  out.Write("       midi protocol 1|2\r\n");
+  out.Write("       midi chain on|off\r\n");
+}
+
+void WriteRejected(domain::io::WritableStreamRequirements& out) noexcept {
+  out.Write("error: request rejected\r\n");
+}
+
+void WriteOk(domain::io::WritableStreamRequirements& out) noexcept {
+  out.Write("ok\r\n");
+}
+
+void WriteResult(domain::io::WritableStreamRequirements& out, bool accepted) noexcept {
+  if (accepted) {
+    WriteOk(out);
+  } else {
+    WriteRejected(out);
+  }
+}
+
+bool ParseUint32(std::string_view text, std::uint32_t& out_value) noexcept {
+  if (text.empty()) {
+    return false;
+  }
+  std::uint32_t value = 0;
+  const char* begin = text.data();
+  const char* end = begin + text.size();
+  const auto r = std::from_chars(begin, end, value);
+  if (r.ec != std::errc() || r.ptr != end) {
+    return false;
+  }
+  out_value = value;
+  return true;
+}
+
+bool ParseRoute(std::string_view text, app::midi::MidiRoute& out_route) noexcept {
+  if (text == "uart2") {
+    out_route = app::midi::MidiRoute::kUart2;
+  } else if (text == "uart3") {
+    out_route = app::midi::MidiRoute::kUart3;
+  } else if (text == "both") {
+    out_route = app::midi::MidiRoute::kBoth;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+void WriteUint32(domain::io::WritableStreamRequirements& out, std::uint32_t value) noexcept {
+  char buf[16]{};
+  auto r = std::to_chars(buf, buf + sizeof(buf), value);
+  if (r.ec != std::errc()) {
+    return;
+  }
+  out.Write(std::string_view(buf, static_cast<std::size_t>(r.ptr - buf)));
+}
+
+void WriteInt32(domain::io::WritableStreamRequirements& out, std::int32_t value) noexcept {
+  char buf[16]{};
+  auto r = std::to_chars(buf, buf + sizeof(buf), value);
+  if (r.ec != std::errc()) {
+    return;
+  }
+  out.Write(std::string_view(buf, static_cast<std::size_t>(r.ptr - buf)));
+}
+
+void WriteClockSync(domain::io::WritableStreamRequirements& out,
+                    const app::can::CanChainStats& chain) noexcept {
+  switch (chain.clock_sync) {
+    case app::can::CanClockSyncState::kMaster:
+      out.Write(" sync=master");
+      return;
+    case app::can::CanClockSyncState::kUnlocked:
+      out.Write(" sync=unlocked");
+      return;
+    case app::can::CanClockSyncState::kLocked:
+      out.Write(" sync=locked offset_us=");
+      WriteInt32(out, chain.clock_offset_ticks);
+      out.Write(" drift_ppb=");
+      WriteInt32(out, chain.clock_drift_ppb);
+      return;
+  }
+}
+
+void WriteStatus(domain::io::WritableStreamRequirements& out,
+                 const app::midi::MidiOutputStatus& status) noexcept {
+  out.Write(status.enabled ? "on" : "off");
+  out.Write(" route=");
+  switch (status.route) {
+    case app::midi::MidiRoute::kUart2:
+      out.Write("uart2");
+      break;
+    case app::midi::MidiRoute::kUart3:
+      out.Write("uart3");
+      break;
+    case app::midi::MidiRoute::kBoth:
+      out.Write("both");
+      break;
+  }
+  out.Write(status.protocol == app::midi::MidiProtocol::kMidi2 ? " protocol=2" : " protocol=1");
+  out.Write(" channel=");
+  WriteUint32(out, static_cast<std::uint32_t>(status.channel) + 1u);
+  out.Write(" messages=");
+  WriteUint32(out, status.message_count);
+  out.Write(" bytes=");
+  WriteUint32(out, status.byte_count);
+  out.Write(" note_drops=");
+  WriteUint32(out, status.dropped_note_count);
+  out.Write(" cc_drops=");
+  WriteUint32(out, status.dropped_controller_count);
+  out.Write("\r\n");
+
+  out.Write("note_delay_us mean=");
+  WriteUint32(out, status.scheduler.note_delay_mean_ticks);
+  out.Write(" max=");
+  WriteUint32(out, status.scheduler.note_delay_max_ticks);
+  out.Write(" cc_delay_us mean=");
+  WriteUint32(out, status.scheduler.controller_delay_mean_ticks);
+  out.Write(" max=");
+  WriteUint32(out, status.scheduler.controller_delay_max_ticks);
+  out.Write(" coalesced=");
+  WriteUint32(out, status.scheduler.coalesced_count);
+  out.Write("\r\n");
+
+  out.Write("latency_us=");
+  if (status.latency.latency_ticks == 0u) {
+    out.Write("off");
+  } else {
+    WriteUint32(out, status.latency.latency_ticks);
+  }
+  out.Write(" released=");
+  WriteUint32(out, status.latency.released_count);
+  out.Write(" late=");
+  WriteUint32(out, status.latency.late_count);
+  out.Write(" max_late_us=");
+  WriteUint32(out, status.latency.max_late_ticks);
+  out.Write(" overflows=");
+  WriteUint32(out, status.latency.overflow_count);
+  out.Write("\r\n");
+
+  out.Write(status.chain_enabled ? "chain=on" : "chain=off");
+  out.Write(" board=");
+  WriteUint32(out, status.chain.board_id);
+  out.Write(" tx_frames=");
+  WriteUint32(out, status.chain.frames_sent);
+  out.Write(" tx_drops=");
+  WriteUint32(out, status.chain.dropped_frame_count);
+  out.Write(" rx_frames=");
+  WriteUint32(out, status.chain.frames_received);
+  out.Write(" rx_events=");
+  WriteUint32(out, status.chain.events_received);
+  out.Write(" lost=");
+  WriteUint32(out, status.chain.lost_frame_count);
+  WriteClockSync(out, status.chain);
+  out.Write("\r\n");
+}
+
+}  // namespace
+
+void MidiCommand::Run(int argc, char** argv,
+                      domain::io::WritableStreamRequirements& out) noexcept {
+  const std::string_view op = Arg(argc, argv, 1);
+
+  if (op.empty() || op == "status") {
+    WriteStatus(out, control_.GetStatus());
+    return;
+  }
+
+  if (op == "on") {
+    WriteResult(out, control_.RequestEnable());
+    return;
+  }
+
+  if (op == "off") {
+    WriteResult(out, control_.RequestDisable());
+    return;
+  }
+
+  if (op == "route") {
+    app::midi::MidiRoute route{app::midi::MidiRoute::kUart2};
+    if (!ParseRoute(Arg(argc, argv, 2), route)) {
+      WriteUsage(out);
+      return;
+    }
+    WriteResult(out, control_.RequestRoute(route));
+    return;
+  }
+
+  if (op == "channel") {
+    std::uint32_t channel = 0;
+    if (!ParseUint32(Arg(argc, argv, 2), channel) || channel < 1u || channel > 16u) {
+      WriteUsage(out);
+      return;
+    }
+    WriteResult(out, control_.RequestChannel(static_cast<std::uint8_t>(channel - 1u)));
+    return;
+  }
+
+  if (op == "protocol") {
+    const std::string_view arg = Arg(argc, argv, 2);
+    if (arg != "1" && arg != "2") {
+      WriteUsage(out);
+      return;
+    }
+    WriteResult(out, control_.RequestProtocol(arg == "2" ? app::midi::MidiProtocol::kMidi2
+                                                         : app::midi::MidiProtocol::kMidi1));
+    return;
+  }
+
+  if (op == "chain") {
+    const std::string_view arg = Arg(argc, argv, 2);
+    if (arg != "on" && arg != "off") {
+      WriteUsage(out);
+      return;
+    }
+    WriteResult(out, control_.RequestChain(arg == "on"));
+    return;
+  }
+
+  if (op == "latency") {
+    const std::string_view arg = Arg(argc, argv, 2);
+    std::uint32_t latency_us = 0;
+    if (arg != "off" &&
+        (!ParseUint32(arg, latency_us) || latency_us > app::config::MIDI_MAX_LATENCY_TICKS)) {
+      WriteUsage(out);
+      return;
+    }
+    // Timestamp ticks are microseconds (TIM2 at 1 MHz).
+    WriteResult(out, control_.RequestLatency(latency_us));
+    return;
+  }
+
+  WriteUsage(out);
+}
+
+}  // namespace app::shell::commands
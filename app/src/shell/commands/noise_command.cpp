@@ -0,0 +1,136 @@
+#include "app/shell/commands/noise_command.hpp"
+
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <system_error>
+
+#include "domain/signal/statistics/running_stats.hpp"
+
+namespace app::shell::commands {
+namespace {
+
+constexpr std::size_t kIdColumnWidth = 3;
+constexpr std::size_t kCountColumnWidth = 10;
+constexpr std::size_t kValueColumnWidth = 10;
+
+std::string_view Arg(int argc, char** argv, int index) noexcept {
+  if (argv == nullptr) {
+    return {};
+  }
+  if (index < 0 || index >= argc) {
+    return {};
+  }
+  if (argv[index] == nullptr) {
+    return {};
+  }
+  return std::string_view(argv[index]);
+}
+
+void WriteUsage(domain::io::WritableStreamRequirements& out) noexcept {
+  out.Write("usage: noise [reset]\r\n");
+}
+
+void WritePadded(domain::io::WritableStreamRequirements& out, std::string_view text,
+                 std::size_t width) noexcept {
+  for (std::size_t i = text.size(); i < width; ++i) {
+    out.Write(' ');
+  }
+  out.Write(text);
+}
+
+void WriteUint32Column(domain::io::WritableStreamRequirements& out, std::uint32_t value,
+                       std::size_t width) noexcept {
+  char buf[16]{};
+  auto r = std::to_chars(buf, buf + sizeof(buf), value);
+  if (r.ec != std::errc()) {
+    return;
+  }
+  WritePadded(out, std::string_view(buf, static_cast<std::size_t>(r.ptr - buf)), width);
+}
+
+void WriteCentiColumn(domain::io::WritableStreamRequirements& out, double value,
+                      std::size_t width) noexcept {
+  const bool is_negative = value < 0.0;
+  const std::uint64_t centi = static_cast<std::uint64_t>(std::llround(std::fabs(value) * 100.0));
+
+  char buf[32]{};
+  char* ptr = buf;
+  if (is_negative) {
+    *ptr++ = '-';
+  }
+  auto r = std::to_chars(ptr, buf + sizeof(buf) - 3, centi / 100u);
+  if (r.ec != std::errc()) {
+    return;
+  }
+  ptr = r.ptr;
+  const std::uint32_t fraction = static_cast<std::uint32_t>(centi % 100u);
+  *ptr++ = '.';
+  *ptr++ = static_cast<char>('0' + fraction / 10u);
+  *ptr++ = static_cast<char>('0' + fraction % 10u);
+  WritePadded(out, std::string_view(buf, static_cast<std::size_t>(ptr - buf)), width);
+}
+
+void WriteHeader(domain::io::WritableStreamRequirements& out) noexcept {
+  WritePadded(out, "id", kIdColumnWidth);
+  WritePadded(out, "n", kCountColumnWidth);
+  WritePadded(out, "mean", kValueColumnWidth);
+  WritePadded(out, "rms", kValueColumnWidth);
+  WritePadded(out, "min", kValueColumnWidth);
+  WritePadded(out, "max", kValueColumnWidth);
+  WritePadded(out, "p2p", kValueColumnWidth);
+  out.Write("\r\n");
+}
+
+void WriteRow(domain::io::WritableStreamRequirements& out, std::uint32_t sensor_id,
+              const domain::signal::statistics::RunningStats& stats) noexcept {
+  WriteUint32Column(out, sensor_id, kIdColumnWidth);
+  WriteUint32Column(out, stats.count(), kCountColumnWidth);
+  if (stats.count() == 0u) {
+    for (std::size_t column = 0; column < 5u; ++column) {
+      WritePadded(out, "-", kValueColumnWidth);
+    }
+    out.Write("\r\n");
+    return;
+  }
+  WriteCentiColumn(out, stats.mean(), kValueColumnWidth);
+  WriteCentiColumn(out, stats.stddev(), kValueColumnWidth);
+  WriteCentiColumn(out, stats.min(), kValueColumnWidth);
+  WriteCentiColumn(out, stats.max(), kValueColumnWidth);
+  WriteCentiColumn(out, stats.peak_to_peak(), kValueColumnWidth);
+  out.Write("\r\n");
+}
+
+}  // namespace
+
+void NoiseCommand::Run(int argc, char** argv,
+                       domain::io::WritableStreamRequirements& out) noexcept {
+  const std::string_view op = Arg(argc, argv, 1);
+
+  if (op == "reset") {
+    stats_.RequestReset();
+    out.Write("ok\r\n");
+    return;
+  }
+
+  if (!op.empty()) {
+    WriteUsage(out);
+    return;
+  }
+
+  WriteHeader(out);
+  for (std::size_t index = 0; index < stats_.channel_count(); ++index) {
+    const std::uint32_t sensor_id = static_cast<std::uint32_t>(index + 1u);
+    domain::signal::statistics::RunningStats stats{};
+    if (!stats_.TryRead(index, stats)) {
+      WriteUint32Column(out, sensor_id, kIdColumnWidth);
+      out.Write(" error: busy\r\n");
+      continue;
+    }
+    WriteRow(out, sensor_id, stats);
+  }
+}
+
+}  // namespace app::shell::commands
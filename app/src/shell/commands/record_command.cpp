@@ -0,0 +1,93 @@
+#include "app/shell/commands/record_command.hpp"
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <system_error>
+
+#include "app/config/analog_acquisition.hpp"
+
+namespace app::shell::commands {
+namespace {
+
+std::string_view Arg(int argc, char** argv, int index) noexcept {
+  if (argv == nullptr) {
+    return {};
+  }
+  if (index < 0 || index >= argc) {
+    return {};
+  }
+  if (argv[index] == nullptr) {
+    return {};
+  }
+  return std::string_view(argv[index]);
+}
+
+void WriteUsage(domain::io::WritableStreamRequirements& out) noexcept {
+  out.Write("usage: record <seconds>\r\n");
+}
+
+bool ParseUint32(std::string_view text, std::uint32_t& out_value) noexcept {
+  if (text.empty()) {
+    return false;
+  }
+  std::uint32_t value = 0;
+  const char* begin = text.data();
+  const char* end = begin + text.size();
+  const auto r = std::from_chars(begin, end, value);
+  if (r.ec != std::errc() || r.ptr != end) {
+    return false;
+  }
+  out_value = value;
+  return true;
+}
+
+void WriteUint32(domain::io::WritableStreamRequirements& out, std::uint32_t value) noexcept {
+  char buf[16]{};
+  auto r = std::to_chars(buf, buf + sizeof(buf), value);
+  if (r.ec != std::errc()) {
+    return;
+  }
+  out.Write(std::string_view(buf, static_cast<std::size_t>(r.ptr - buf)));
+}
+
+}  // namespace
+
+void RecordCommand::Run(int argc, char** argv,
+                        domain::io::WritableStreamRequirements& out) noexcept {
+  std::uint32_t seconds = 0;
+  if (argc != 2 || !ParseUint32(Arg(argc, argv, 1), seconds) || seconds == 0u) {
+    WriteUsage(out);
+    return;
+  }
+
+  const std::uint32_t max_seconds =
+      capture_.GetStatus().capacity / app::config::ANALOG_ACQUISITION_CHANNEL_RATE_HZ;
+  if (seconds > max_seconds) {
+    out.Write("error: at most ");
+    WriteUint32(out, max_seconds);
+    out.Write(" s fit the buffer\r\n");
+    return;
+  }
+
+  // An immediate trigger without pre-trigger scans records into the buffer from its first slot.
+  const std::uint32_t scans = seconds * app::config::ANALOG_ACQUISITION_CHANNEL_RATE_HZ;
+  domain::telemetry::TriggerConfig config{};
+  config.slope = domain::telemetry::TriggerSlope::kImmediate;
+  config.pre_scans = 0;
+  config.post_scans = scans - 1u;
+  if (!capture_.Arm(config)) {
+    out.Write("error: request rejected\r\n");
+    return;
+  }
+  if (!telemetry_.RequestSendCapture()) {
+    out.Write("error: drain rejected, send it with 'sensor_rtt capture' once recorded\r\n");
+    return;
+  }
+  out.Write("ok scans=");
+  WriteUint32(out, scans);
+  out.Write("\r\n");
+}
+
+}  // namespace app::shell::commands
@@ -24,6 +24,8 @@ std::string_view Arg(int argc, char** argv, int index) noexcept {
 
 void WriteUsage(domain::io::WritableStreamRequirements& out) noexcept {
   out.Write("usage: sensor_rtt <id> [raw|processed]\r\n");
+  out.Write("       sensor_rtt scan all|<mask> [raw|processed] [delta|envelope]\r\n");
+  out.Write("       sensor_rtt capture\r\n");
   out.Write("       sensor_rtt freq [value]\r\n");
   out.Write("       sensor_rtt off\r\n");
   out.Write("       sensor_rtt status\r\n");
@@ -55,6 +57,71 @@ bool ParseUint32(std::string_view text, std::uint32_t& out_value) noexcept {
   out_value = value;
   return true;
 }
+
+// Accepts "all" or a channel mask in decimal or 0x-prefixed hex (bit n = sensor id n + 1).
+bool ParseChannelMask(std::string_view text, std::uint32_t& out_mask) noexcept {
+  if (text == "all") {
+    out_mask = 0xFFFFFFFFu;
+    return true;
+  }
+  if (text.size() > 2u && text[0] == '0' && (text[1] == 'x' || text[1] == 'X')) {
+    std::uint32_t value = 0;
+    const char* begin = text.data() + 2;
+    const char* end = text.data() + text.size();
+    const auto r = std::from_chars(begin, end, value, 16);
+    if (r.ec != std::errc() || r.ptr != end) {
+      return false;
+    }
+    out_mask = value;
+    return true;
+  }
+  return ParseUint32(text, out_mask);
+}
+
+bool ParseMode(std::string_view text, domain::sensors::SensorRttMode& out_mode) noexcept {
+  if (text.empty() || text == "processed" || text == "p") {
+    out_mode = domain::sensors::SensorRttMode::kProcessed;
+    return true;
+  }
+  if (text == "raw") {
+    out_mode = domain::sensors::SensorRttMode::kRaw;
+    return true;
+  }
+  return false;
+}
+
+bool ParseEncoding(std::string_view text, app::telemetry::ScanEncoding& out_encoding) noexcept {
+  if (text == "delta") {
+    out_encoding = app::telemetry::ScanEncoding::kDelta;
+    return true;
+  }
+  if (text == "envelope") {
+    out_encoding = app::telemetry::ScanEncoding::kEnvelope;
+    return true;
+  }
+  return false;
+}
+
+// Mode and encoding may follow the mask in either order, each at most once.
+bool ParseScanOptions(int argc, char** argv, domain::sensors::SensorRttMode& out_mode,
+                      app::telemetry::ScanEncoding& out_encoding) noexcept {
+  bool has_mode = false;
+  bool has_encoding = false;
+  out_encoding = app::telemetry::ScanEncoding::kFull;
+  out_mode = domain::sensors::SensorRttMode::kProcessed;
+  for (int index = 3; index < argc; ++index) {
+    const std::string_view arg = Arg(argc, argv, index);
+    if (!has_encoding && ParseEncoding(arg, out_encoding)) {
+      has_encoding = true;
+    } else if (!has_mode && !arg.empty() && ParseMode(arg, out_mode)) {
+      has_mode = true;
+    } else {
+      return false;
+    }
+  }
+  return true;
+}
+
 bool ParsePeriodMsFromHzArg(std::string_view arg, std::uint32_t& out_period_ms) noexcept {
   if (arg.empty()) {
     return false;
@@ -80,6 +147,15 @@ void WriteUint32(domain::io::WritableStreamRequirements& out, std::uint32_t valu
   out.Write(std::string_view(buf, static_cast<std::size_t>(r.ptr - buf)));
 }
 
+void WriteHex32(domain::io::WritableStreamRequirements& out, std::uint32_t value) noexcept {
+  constexpr char kDigits[] = "0123456789ABCDEF";
+  char buf[10] = {'0', 'x'};
+  for (std::size_t i = 0; i < 8u; ++i) {
+    buf[2u + i] = kDigits[(value >> (28u - 4u * i)) & 0x0Fu];
+  }
+  out.Write(std::string_view(buf, sizeof(buf)));
+}
+
 struct SensorRttParsedCommand {
   enum class Kind : std::uint8_t {
     kOff = 0,
@@ -87,22 +163,41 @@ struct SensorRttParsedCommand {
     kObserve = 2,
     kGetFreq = 3,
     kSetFreq = 4,
+    kObserveMask = 5,
+    kSendCapture = 6,
   };
 
   Kind kind{Kind::kStatus};
   std::uint8_t sensor_id{0};
   domain::sensors::SensorRttMode mode{domain::sensors::SensorRttMode::kRaw};
   std::uint32_t period_ms{0};
+  std::uint32_t channel_mask{0};
+  app::telemetry::ScanEncoding encoding{app::telemetry::ScanEncoding::kFull};
 };
 
+void WriteCaptureRemaining(domain::io::WritableStreamRequirements& out,
+                           const app::telemetry::SensorRttTelemetryStatus& status) noexcept {
+  if (status.capture_remaining != 0u) {
+    out.Write(" capture=");
+    WriteUint32(out, status.capture_remaining);
+  }
+}
+
 void WriteStatus(domain::io::WritableStreamRequirements& out,
                  const app::telemetry::SensorRttTelemetryStatus& status) noexcept {
   if (!status.enabled) {
-    out.Write("off\r\n");
+    out.Write("off");
+    WriteCaptureRemaining(out, status);
+    out.Write("\r\n");
     return;
   }
-  out.Write("on id=");
-  WriteUint32(out, status.sensor_id);
+  if (status.channel_mask != 0u) {
+    out.Write("on mask=");
+    WriteHex32(out, status.channel_mask);
+  } else {
+    out.Write("on id=");
+    WriteUint32(out, status.sensor_id);
+  }
   out.Write(" mode=");
   switch (status.mode) {
     case domain::sensors::SensorRttMode::kRaw:
@@ -112,8 +207,31 @@ void WriteStatus(domain::io::WritableStreamRequirements& out,
       out.Write("processed");
       break;
   }
+  if (status.channel_mask != 0u) {
+    switch (status.encoding) {
+      case app::telemetry::ScanEncoding::kFull:
+        break;
+      case app::telemetry::ScanEncoding::kDelta:
+        out.Write(" delta");
+        break;
+      case app::telemetry::ScanEncoding::kEnvelope:
+        out.Write(" envelope");
+        break;
+    }
+  }
   out.Write(" period_ms=");
   WriteUint32(out, status.period_ms);
+  if (status.channel_mask != 0u) {
+    out.Write(" dropped=");
+    WriteUint32(out, status.dropped_frames);
+    out.Write(" underruns=");
+    WriteUint32(out, status.underruns);
+    if (status.backoff_level != 0u) {
+      out.Write(" backoff=");
+      WriteUint32(out, status.backoff_level);
+    }
+  }
+  WriteCaptureRemaining(out, status);
   out.Write("\r\n");
 }
 
@@ -135,6 +253,11 @@ bool TryParseCommand(int argc, char** argv, SensorRttParsedCommand& parsed,
     return true;
   }
 
+  if (op == "capture") {
+    parsed.kind = SensorRttParsedCommand::Kind::kSendCapture;
+    return true;
+  }
+
   if (op == "freq") {
     const std::string_view freq_arg = Arg(argc, argv, 2);
     if (freq_arg.empty()) {
@@ -149,6 +272,16 @@ bool TryParseCommand(int argc, char** argv, SensorRttParsedCommand& parsed,
     return true;
   }
 
+  if (op == "scan") {
+    if (!ParseChannelMask(Arg(argc, argv, 2), parsed.channel_mask) ||
+        !ParseScanOptions(argc, argv, parsed.mode, parsed.encoding)) {
+      WriteUsage(out);
+      return false;
+    }
+    parsed.kind = SensorRttParsedCommand::Kind::kObserveMask;
+    return true;
+  }
+
   std::uint32_t sensor_id_u32 = 0;
   if (!ParseUint32(op, sensor_id_u32) || sensor_id_u32 > 255u) {
     WriteUsage(out);
@@ -158,12 +291,7 @@ bool TryParseCommand(int argc, char** argv, SensorRttParsedCommand& parsed,
   parsed.kind = SensorRttParsedCommand::Kind::kObserve;
   parsed.sensor_id = static_cast<std::uint8_t>(sensor_id_u32);
 
-  const std::string_view mode_arg = Arg(argc, argv, 2);
-  if (mode_arg.empty() || mode_arg == "processed" || mode_arg == "p") {
-    parsed.mode = domain::sensors::SensorRttMode::kProcessed;
-  } else if (mode_arg == "raw") {
-    parsed.mode = domain::sensors::SensorRttMode::kRaw;
-  } else {
+  if (!ParseMode(Arg(argc, argv, 2), parsed.mode)) {
     WriteUsage(out);
     return false;
   }
@@ -194,6 +322,15 @@ void SensorRttCommand::Run(int argc, char** argv,
     return;
   }
 
+  if (parsed.kind == SensorRttParsedCommand::Kind::kSendCapture) {
+    if (!control_.RequestSendCapture()) {
+      WriteRejected(out);
+      return;
+    }
+    WriteOk(out);
+    return;
+  }
+
   if (parsed.kind == SensorRttParsedCommand::Kind::kGetFreq) {
     const auto status = control_.GetStatus();
     if (status.period_ms > 0) {
@@ -214,6 +351,26 @@ void SensorRttCommand::Run(int argc, char** argv,
     return;
   }
 
+  if (parsed.kind == SensorRttParsedCommand::Kind::kObserveMask) {
+    std::uint32_t fitted = 0;
+    for (std::uint8_t id = 1; id <= 32u; ++id) {
+      if (registry_.FindById(id) != nullptr) {
+        fitted |= 1u << (id - 1u);
+      }
+    }
+    if ((parsed.channel_mask & fitted) == 0u) {
+      WriteUnknownSensorId(out);
+      return;
+    }
+    if (!control_.RequestObserveMask(parsed.channel_mask & fitted, parsed.mode,
+                                     parsed.encoding)) {
+      WriteRejected(out);
+      return;
+    }
+    WriteOk(out);
+    return;
+  }
+
   if (registry_.FindById(parsed.sensor_id) == nullptr) {
     WriteUnknownSensorId(out);
     return;
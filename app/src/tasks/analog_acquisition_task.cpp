@@ -93,14 +93,18 @@ AnalogAcquisitionTask::AnalogAcquisitionTask(
     os::Queue<app::analog::AcquisitionCommand, 4>& control_queue,
     bsp::GpioRequirements& tia_shutdown, bsp::adc::AdcDma& adc_dma,
     app::time::TimestampCounterRequirements& timestamp_counter,
-    volatile app::analog::AcquisitionState& state, ProcessedSensorGroup& analog_group) noexcept
+    volatile app::analog::AcquisitionState& state, ProcessedSensorGroup& analog_group,
+    app::music::KeyboardScannerRequirements& keyboard_scanner,
+    app::telemetry::SensorSampleTapRequirements& sample_tap) noexcept
     : queue_(queue),
       control_queue_(control_queue),
       tia_shutdown_(tia_shutdown),
       adc_dma_(adc_dma),
       timestamp_counter_(timestamp_counter),
       state_(state),
-      analog_group_(analog_group) {}
+      analog_group_(analog_group),
+      keyboard_scanner_(keyboard_scanner),
+      sample_tap_(sample_tap) {}
 
 void AnalogAcquisitionTask::entry(void* ctx) noexcept {
   if (ctx == nullptr) {
@@ -135,6 +139,7 @@ void AnalogAcquisitionTask::EnterDisabledState() noexcept {
   adc_dma_.Stop();
   DrainFrameQueue();
   ResetDecodingState();
+  keyboard_scanner_.ReleaseAll(timestamp_counter_.NowTicks());
   state_ = app::analog::AcquisitionState::kDisabled;
 }
 
@@ -187,6 +192,8 @@ void AnalogAcquisitionTask::ProcessAdc1Frame(const bsp::adc::AdcFrameDescriptor&
       [this](const std::uint16_t* seq_ptr, std::uint32_t ts) noexcept {
         decoder_.ApplySequence(seq_ptr, bsp::adc::AdcDma::kAdc1RanksPerSequence,
                                ::app::config_sensors::kAdc1SensorIdByRank, analog_group_, ts);
+        sample_tap_.OnSequence(::app::config_sensors::kAdc1SensorIdByRank,
+                               ::app::config_sensors::kAdc1RankCount, ts);
       });
 }
 
@@ -203,6 +210,8 @@ void AnalogAcquisitionTask::ProcessAdc2Frame(const bsp::adc::AdcFrameDescriptor&
       [this](const std::uint16_t* seq_ptr, std::uint32_t ts) noexcept {
         decoder_.ApplySequence(seq_ptr, bsp::adc::AdcDma::kAdc2RanksPerSequence,
                                ::app::config_sensors::kAdc2SensorIdByRank, analog_group_, ts);
+        sample_tap_.OnSequence(::app::config_sensors::kAdc2SensorIdByRank,
+                               ::app::config_sensors::kAdc2RankCount, ts);
       });
 }
 
@@ -219,6 +228,8 @@ void AnalogAcquisitionTask::ProcessAdc3Frame(const bsp::adc::AdcFrameDescriptor&
       [this](const std::uint16_t* seq_ptr, std::uint32_t ts) noexcept {
         decoder_.ApplySequence(seq_ptr, bsp::adc::AdcDma::kAdc3RanksPerSequence,
                                ::app::config_sensors::kAdc3SensorIdByRank, analog_group_, ts);
+        sample_tap_.OnSequence(::app::config_sensors::kAdc3SensorIdByRank,
+                               ::app::config_sensors::kAdc3RankCount, ts);
       });
 }
 
@@ -246,6 +257,7 @@ void AnalogAcquisitionTask::HandleEnabledState() noexcept {
     return;
   }
   ProcessFrame(desc);
+  keyboard_scanner_.Scan();
 }
 
 void AnalogAcquisitionTask::run() noexcept {
@@ -0,0 +1,94 @@
+#include "app/tasks/can_chain_task.hpp"
+
+#include <cstdint>
+
+#include "app/config/config.hpp"
+#include "domain/music/music_event.hpp"
+#include "os/task.hpp"
+
+namespace app::Tasks {
+
+CanChainTask::CanChainTask(os::Queue<app::can::CanChainCommand, 4>& control_queue,
+                           app::config::MusicEventQueue& local_events,
+                           app::config::MusicEventQueue& remote_events, volatile bool& enabled,
+                           volatile app::can::CanChainStats& stats,
+                           const app::time::TimestampCounterRequirements& timestamp_counter,
+                           app::can::CanBusRequirements& can_bus) noexcept
+    : control_queue_(control_queue),
+      local_events_(local_events),
+      enabled_(enabled),
+      stats_(stats),
+      timestamp_counter_(timestamp_counter),
+      chain_(app::config::CAN_BOARD_ID, can_bus, remote_events) {}
+
+void CanChainTask::entry(void* ctx) noexcept {
+  if (ctx == nullptr) {
+    return;
+  }
+  static_cast<CanChainTask*>(ctx)->run();
+}
+
+void CanChainTask::ApplyCommand(const app::can::CanChainCommand& cmd) noexcept {
+  switch (cmd.kind) {
+    case app::can::CanChainCommandKind::kEnable:
+      if (!enabled_) {
+        chain_.Start(timestamp_counter_.NowTicks());
+      }
+      enabled_ = true;
+      break;
+    case app::can::CanChainCommandKind::kDisable:
+      chain_.Flush();
+      enabled_ = false;
+      break;
+  }
+}
+
+void CanChainTask::PublishStats() noexcept {
+  const app::can::CanChainStats stats = chain_.stats();
+  stats_.board_id = stats.board_id;
+  stats_.frames_sent = stats.frames_sent;
+  stats_.dropped_frame_count = stats.dropped_frame_count;
+  stats_.frames_received = stats.frames_received;
+  stats_.events_received = stats.events_received;
+  stats_.lost_frame_count = stats.lost_frame_count;
+  stats_.clock_sync = stats.clock_sync;
+  stats_.clock_offset_ticks = stats.clock_offset_ticks;
+  stats_.clock_drift_ppb = stats.clock_drift_ppb;
+}
+
+void CanChainTask::Poll() noexcept {
+  const bool enabled = enabled_;
+  domain::music::MusicEvent event{};
+  while (local_events_.TryPop(event)) {
+    if (enabled) {
+      (void) chain_.Forward(event);
+    }
+  }
+  if (!enabled) {
+    return;
+  }
+  chain_.Service(timestamp_counter_.NowTicks());
+  PublishStats();
+}
+
+void CanChainTask::run() noexcept {
+  enabled_ = false;
+  chain_.Reset();
+  PublishStats();
+
+  for (;;) {
+    app::can::CanChainCommand cmd{};
+    if (control_queue_.Receive(cmd, app::config::CAN_CHAIN_POLL_PERIOD_MS)) {
+      ApplyCommand(cmd);
+    }
+    Poll();
+  }
+}
+
+bool CanChainTask::start() noexcept {
+  return os::Task::create("CanChain", CanChainTask::entry, this,
+                          app::config::CAN_CHAIN_TASK_STACK_BYTES,
+                          app::config::CAN_CHAIN_TASK_PRIORITY);
+}
+
+}  // namespace app::Tasks
@@ -0,0 +1,219 @@
+#include "app/tasks/midi_output_task.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "app/config/config.hpp"
+#include "os/task.hpp"
+
+namespace app::Tasks {
+
+MidiOutputTask::MidiOutputTask(
+    os::Queue<app::midi::MidiOutputCommand, 4>& control_queue,
+    app::config::MusicEventQueue& events, app::can::CanChainEventsRequirements& chain,
+    domain::io::WritableStreamRequirements& uart2, domain::io::WritableStreamRequirements& uart3,
+    volatile bool& enabled, volatile app::midi::MidiRoute& route,
+    volatile app::midi::MidiProtocol& protocol, volatile std::uint8_t& channel,
+    volatile std::uint32_t& message_count, volatile std::uint32_t& byte_count,
+    volatile app::midi::MidiOutputSchedulerStats& scheduler_stats,
+    volatile app::midi::MidiOutputLatencyStats& latency_stats,
+    const app::time::TimestampCounterRequirements& timestamp_counter,
+    app::time::AlarmRequirements& alarm) noexcept
+    : control_queue_(control_queue),
+      events_(events),
+      chain_(chain),
+      uart2_(uart2),
+      uart3_(uart3),
+      enabled_(enabled),
+      route_(route),
+      protocol_(protocol),
+      channel_(channel),
+      message_count_(message_count),
+      byte_count_(byte_count),
+      scheduler_stats_(scheduler_stats),
+      latency_stats_(latency_stats),
+      timestamp_counter_(timestamp_counter),
+      alarm_(alarm) {}
+
+void MidiOutputTask::entry(void* ctx) noexcept {
+  if (ctx == nullptr) {
+    return;
+  }
+  static_cast<MidiOutputTask*>(ctx)->run();
+}
+
+void MidiOutputTask::ApplyCommand(const app::midi::MidiOutputCommand& cmd) noexcept {
+  switch (cmd.kind) {
+    case app::midi::MidiOutputCommandKind::kEnable:
+      if (!enabled_) {
+        jitter_buffer_.Reset();
+        scheduler_.Reset();
+      }
+      enabled_ = true;
+      break;
+    case app::midi::MidiOutputCommandKind::kDisable:
+      enabled_ = false;
+      alarm_.Disarm();
+      break;
+    case app::midi::MidiOutputCommandKind::kSetRoute:
+      route_ = cmd.route;
+      break;
+    case app::midi::MidiOutputCommandKind::kSetChannel:
+      channel_ = static_cast<std::uint8_t>(cmd.channel & 0x0Fu);
+      uart2_encoder_.SetChannel(channel_);
+      uart3_encoder_.SetChannel(channel_);
+      ump_encoder_.SetChannel(channel_);
+      break;
+    case app::midi::MidiOutputCommandKind::kSetProtocol:
+      protocol_ = cmd.protocol;
+      break;
+    case app::midi::MidiOutputCommandKind::kSetLatency:
+      (void) jitter_buffer_.Flush(*this);
+      jitter_buffer_.SetLatency(cmd.latency_ticks);
+      break;
+    case app::midi::MidiOutputCommandKind::kWake:
+      // Only wakes the task; the due events are released by DrainEvents().
+      return;
+  }
+  // The receivers may have missed or misattributed the last status byte.
+  uart2_encoder_.ResetRunningStatus();
+  uart3_encoder_.ResetRunningStatus();
+}
+
+std::size_t MidiOutputTask::EncodeUmp(const domain::music::MusicEvent& event,
+                                      std::uint8_t* out) const noexcept {
+  std::uint32_t words[domain::midi::kUmpMaxEncodedWords]{};
+  const std::size_t word_count = ump_encoder_.Encode(event, words);
+  for (std::size_t i = 0; i < word_count; ++i) {
+    out[4u * i + 0u] = static_cast<std::uint8_t>(words[i] >> 24u);
+    out[4u * i + 1u] = static_cast<std::uint8_t>(words[i] >> 16u);
+    out[4u * i + 2u] = static_cast<std::uint8_t>(words[i] >> 8u);
+    out[4u * i + 3u] = static_cast<std::uint8_t>(words[i]);
+  }
+  return 4u * word_count;
+}
+
+std::uint32_t MidiOutputTask::SendTo(domain::midi::Midi1Encoder& encoder,
+                                     domain::io::WritableStreamRequirements& stream,
+                                     const domain::music::MusicEvent& event) noexcept {
+  static_assert(4u * domain::midi::kUmpMaxEncodedWords >= domain::midi::kMidi1MaxEncodedBytes,
+                "buffer must fit both encodings");
+  std::uint8_t bytes[4u * domain::midi::kUmpMaxEncodedWords]{};
+  const std::size_t length = protocol_ == app::midi::MidiProtocol::kMidi2
+                                 ? EncodeUmp(event, bytes)
+                                 : encoder.Encode(event, bytes);
+  stream.Write(std::string_view(reinterpret_cast<const char*>(bytes), length));
+  return static_cast<std::uint32_t>(length);
+}
+
+std::size_t MidiOutputTask::OnScheduledEvent(const domain::music::MusicEvent& event) noexcept {
+  std::uint32_t uart2_length = 0;
+  std::uint32_t uart3_length = 0;
+  const app::midi::MidiRoute route = route_;
+  if (route == app::midi::MidiRoute::kUart2 || route == app::midi::MidiRoute::kBoth) {
+    uart2_length = SendTo(uart2_encoder_, uart2_, event);
+  }
+  if (route == app::midi::MidiRoute::kUart3 || route == app::midi::MidiRoute::kBoth) {
+    uart3_length = SendTo(uart3_encoder_, uart3_, event);
+  }
+  message_count_ = message_count_ + 1u;
+  byte_count_ = byte_count_ + uart2_length + uart3_length;
+  // Both links run in parallel, the slower one sets the budget.
+  return uart2_length > uart3_length ? uart2_length : uart3_length;
+}
+
+void MidiOutputTask::OnReleasedEvent(const domain::music::MusicEvent& event) noexcept {
+  (void) scheduler_.Push(event);
+}
+
+void MidiOutputTask::ArmNextDeadline() noexcept {
+  std::uint32_t due_ticks = 0;
+  if (jitter_buffer_.next_due_ticks(due_ticks)) {
+    alarm_.ArmAt(due_ticks);
+  } else {
+    alarm_.Disarm();
+  }
+}
+
+void MidiOutputTask::PublishSchedulerStats() noexcept {
+  scheduler_stats_.note_delay_mean_ticks = scheduler_.note_delay().mean_ticks();
+  scheduler_stats_.note_delay_max_ticks = scheduler_.note_delay().max_ticks;
+  scheduler_stats_.controller_delay_mean_ticks = scheduler_.controller_delay().mean_ticks();
+  scheduler_stats_.controller_delay_max_ticks = scheduler_.controller_delay().max_ticks;
+  scheduler_stats_.coalesced_count = scheduler_.coalesced_count();
+  scheduler_stats_.dropped_note_count = scheduler_.dropped_note_count();
+}
+
+void MidiOutputTask::PublishLatencyStats() noexcept {
+  const domain::midi::JitterBufferStats& stats = jitter_buffer_.stats();
+  latency_stats_.latency_ticks = jitter_buffer_.latency_ticks();
+  latency_stats_.released_count = stats.released_count;
+  latency_stats_.late_count = stats.late_count;
+  latency_stats_.max_late_ticks = stats.max_late_ticks;
+  latency_stats_.overflow_count = stats.overflow_count;
+}
+
+void MidiOutputTask::Dispatch(const domain::music::MusicEvent& event) noexcept {
+  // A full jitter buffer sends the event right away rather than losing it.
+  if (jitter_buffer_.latency_ticks() == 0u || !jitter_buffer_.Push(event)) {
+    (void) scheduler_.Push(event);
+  }
+}
+
+void MidiOutputTask::DrainEvents() noexcept {
+  domain::music::MusicEvent event{};
+  while (events_.TryPop(event)) {
+    chain_.Forward(event);
+    if (enabled_) {
+      Dispatch(event);
+    }
+  }
+  while (chain_.TryPopRemote(event)) {
+    if (enabled_) {
+      Dispatch(event);
+    }
+  }
+  if (!enabled_) {
+    return;
+  }
+
+  const std::uint32_t now_ticks = timestamp_counter_.NowTicks();
+  (void) jitter_buffer_.Release(now_ticks, *this);
+  (void) scheduler_.Service(now_ticks, *this);
+  ArmNextDeadline();
+  PublishSchedulerStats();
+  PublishLatencyStats();
+}
+
+void MidiOutputTask::run() noexcept {
+  enabled_ = false;
+  route_ = app::midi::MidiRoute::kUart2;
+  protocol_ = app::midi::MidiProtocol::kMidi1;
+  channel_ = app::config::MIDI_DEFAULT_CHANNEL;
+  message_count_ = 0;
+  byte_count_ = 0;
+  jitter_buffer_.Reset();
+  scheduler_.Reset();
+  PublishSchedulerStats();
+  PublishLatencyStats();
+  uart2_encoder_.SetChannel(channel_);
+  uart3_encoder_.SetChannel(channel_);
+  ump_encoder_.SetChannel(channel_);
+
+  for (;;) {
+    app::midi::MidiOutputCommand cmd{};
+    if (control_queue_.Receive(cmd, app::config::MIDI_OUTPUT_POLL_PERIOD_MS)) {
+      ApplyCommand(cmd);
+    }
+    DrainEvents();
+  }
+}
+
+bool MidiOutputTask::start() noexcept {
+  return os::Task::create("MidiOut", MidiOutputTask::entry, this,
+                          app::config::MIDI_OUTPUT_TASK_STACK_BYTES,
+                          app::config::MIDI_OUTPUT_TASK_PRIORITY);
+}
+
+}  // namespace app::Tasks
@@ -1,8 +1,13 @@
 #include "app/tasks/sensor_rtt_telemetry_task.hpp"
 
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <span>
 
+#include "app/config/analog_acquisition.hpp"
 #include "app/config/config.hpp"
+#include "app/config/sensors.hpp"
 #include "os/task.hpp"
 
 namespace app::Tasks {
@@ -20,22 +25,79 @@ constexpr std::uint32_t ClampPeriodMs(std::uint32_t period_ms) noexcept {
   return period_ms;
 }
 
+constexpr std::uint32_t ChannelBit(std::uint8_t sensor_id) noexcept {
+  return 1u << (sensor_id - 1u);
+}
+
+constexpr std::uint32_t kCapturePollMs = 1;
+constexpr std::uint32_t kTicksPerMs = app::config::ANALOG_TICKS_PER_SECOND / 1000u;
+constexpr std::uint32_t kBackoffEnvelopeFactor = 5;
+
+struct ScanStep {
+  app::telemetry::ScanEncoding encoding;
+  std::uint32_t period_ms;
+};
+
+// Each level trades detail for bandwidth: full scans, delta blocks, then envelopes over ever
+// longer periods. A stream never becomes less compact than what was requested.
+constexpr ScanStep BackedOffStep(app::telemetry::ScanEncoding encoding, std::uint32_t period_ms,
+                                 std::uint8_t level) noexcept {
+  ScanStep step{encoding, period_ms};
+  for (std::uint8_t i = 0; i < level; ++i) {
+    switch (step.encoding) {
+      case app::telemetry::ScanEncoding::kFull:
+        step.encoding = app::telemetry::ScanEncoding::kDelta;
+        break;
+      case app::telemetry::ScanEncoding::kDelta:
+        step.encoding = app::telemetry::ScanEncoding::kEnvelope;
+        if (step.period_ms < app::config::RTT_TELEMETRY_BACKOFF_ENVELOPE_MS) {
+          step.period_ms = app::config::RTT_TELEMETRY_BACKOFF_ENVELOPE_MS;
+        }
+        break;
+      case app::telemetry::ScanEncoding::kEnvelope:
+        step.period_ms = ClampPeriodMs(step.period_ms * kBackoffEnvelopeFactor);
+        break;
+    }
+  }
+  return step;
+}
+
+constexpr std::size_t kCaptureInfoBytes = 16;
+
+void WriteU32(std::uint8_t* out, std::uint32_t value) noexcept {
+  for (std::size_t i = 0; i < 4u; ++i) {
+    out[i] = static_cast<std::uint8_t>(value >> (8u * i));
+  }
+}
+
 }  // namespace
 
 SensorRttTelemetryTask::SensorRttTelemetryTask(
-    os::Queue<app::telemetry::SensorRttTelemetryCommand, 4>& control_queue,
+    os::QueueRequirements<app::telemetry::SensorRttTelemetryCommand>& control_queue,
     domain::sensors::SensorRegistry& registry, app::analog::AcquisitionStateRequirements& adc_state,
-    app::telemetry::TelemetrySenderRequirements& telemetry_sender, volatile bool& enabled,
-    volatile std::uint8_t& sensor_id, volatile domain::sensors::SensorRttMode& mode,
-    volatile std::uint32_t& period_ms) noexcept
+    app::telemetry::TelemetrySenderRequirements& telemetry_sender,
+    app::telemetry::SensorSampleSourceRequirements& samples,
+    app::telemetry::CaptureControlRequirements& capture,
+    volatile bool& enabled, volatile std::uint8_t& sensor_id,
+    volatile domain::sensors::SensorRttMode& mode, volatile std::uint32_t& period_ms,
+    volatile std::uint32_t& channel_mask, volatile app::telemetry::ScanEncoding& encoding,
+    volatile std::uint32_t& dropped_frames, volatile std::uint32_t& capture_remaining,
+    volatile std::uint8_t& backoff_level) noexcept
     : control_queue_(control_queue),
       registry_(registry),
       adc_state_(adc_state),
       telemetry_sender_(telemetry_sender),
+      samples_(samples),
+      capture_(capture),
       enabled_(enabled),
       sensor_id_(sensor_id),
       mode_(mode),
-      period_ms_(period_ms) {}
+      period_ms_(period_ms),
+      channel_mask_(channel_mask),
+      encoding_(encoding),
+      dropped_frames_(dropped_frames),
+      capture_remaining_(capture_remaining),
+      backoff_level_(backoff_level) {}
 
 void SensorRttTelemetryTask::entry(void* ctx) noexcept {
   if (ctx == nullptr) {
@@ -47,12 +109,30 @@ void SensorRttTelemetryTask::entry(void* ctx) noexcept {
 void SensorRttTelemetryTask::ApplyCommand(
     const app::telemetry::SensorRttTelemetryCommand& cmd) noexcept {
   if (cmd.kind == app::telemetry::SensorRttTelemetryCommandKind::kOff) {
+    samples_.Observe(0, mode_, 0);
+    DiscardSamples();
     enabled_ = false;
     sensor_id_ = 0;
+    channel_mask_ = 0;
+    encoding_ = app::telemetry::ScanEncoding::kFull;
+    active_encoding_ = encoding_;
+    backoff_level_ = 0;
+    capture_remaining_ = 0;
+    return;
+  }
+
+  if (cmd.kind == app::telemetry::SensorRttTelemetryCommandKind::kSendCapture) {
+    BeginCaptureReadout();
     return;
   }
 
   if (cmd.kind == app::telemetry::SensorRttTelemetryCommandKind::kObserve) {
+    samples_.Observe(0, mode_, 0);
+    DiscardSamples();
+    channel_mask_ = 0;
+    encoding_ = app::telemetry::ScanEncoding::kFull;
+    active_encoding_ = encoding_;
+    backoff_level_ = 0;
     const domain::sensors::Sensor* sensor = registry_.FindById(cmd.sensor_id);
     if (sensor == nullptr) {
       enabled_ = false;
@@ -66,54 +146,449 @@ void SensorRttTelemetryTask::ApplyCommand(
     return;
   }
 
+  if (cmd.kind == app::telemetry::SensorRttTelemetryCommandKind::kObserveMask) {
+    // Drop bits of sensors that are not fitted so the host can size frames from the mask.
+    std::uint32_t mask = 0;
+    for (std::uint8_t id = 1; id <= domain::telemetry::kScanFrameMaxChannels; ++id) {
+      if ((cmd.channel_mask & ChannelBit(id)) != 0u && registry_.FindById(id) != nullptr) {
+        mask |= ChannelBit(id);
+      }
+    }
+    // Frames queued for the previous selection are dropped so the stream switches cleanly.
+    samples_.Observe(0, cmd.mode, 0);
+    DiscardSamples();
+    sensor_id_ = 0;
+    channel_mask_ = mask;
+    encoding_ = cmd.encoding;
+    enabled_ = mask != 0u;
+    mode_ = cmd.mode;
+    // The host decoder may have missed earlier blocks: start over from key records.
+    delta_block_.Reset();
+    dropped_base_ = QueuedDrops();
+    dropped_frames_ = 0;
+    rate_.Reset(QueuedDrops() + telemetry_sender_.DroppedWrites());
+    backoff_level_ = 0;
+    active_encoding_ = encoding_;
+    active_period_ms_ = period_ms_;
+    ObserveMask(mask, cmd.mode);
+    return;
+  }
+
   if (cmd.kind == app::telemetry::SensorRttTelemetryCommandKind::kSetPeriod) {
     period_ms_ = ClampPeriodMs(cmd.period_ms);
+    if (channel_mask_ != 0u) {
+      ApplyBackoff();
+    } else {
+      active_period_ms_ = period_ms_;
+    }
+    return;
+  }
+}
+
+void SensorRttTelemetryTask::ObserveMask(std::uint32_t mask,
+                                         domain::sensors::SensorRttMode mode) noexcept {
+  if (capture_remaining_ != 0u) {
+    // Nothing is queued during a readout; EndCaptureReadout() observes again.
+    return;
+  }
+  // Envelopes span the telemetry period, so each frame sent covers every sample in between.
+  const std::uint32_t envelope_period_ticks =
+      active_encoding_ == app::telemetry::ScanEncoding::kEnvelope ? active_period_ms_ * kTicksPerMs
+                                                                  : 0u;
+  samples_.Observe(mask, mode, envelope_period_ticks);
+}
+
+std::uint32_t SensorRttTelemetryTask::QueuedDrops() noexcept {
+  return samples_.DroppedRecords();
+}
+
+void SensorRttTelemetryTask::AdaptRate(std::uint32_t elapsed_ms) noexcept {
+  if constexpr (!app::config::RTT_TELEMETRY_ADAPTIVE_RATE) {
+    return;
+  }
+  // Drains only take what fits, so a host that lags leaves the buffer full after them.
+  const std::size_t capacity = telemetry_sender_.CapacityBytes();
+  const std::size_t writable = telemetry_sender_.WritableBytes();
+  const std::size_t used = writable < capacity ? capacity - writable : 0u;
+  if (rate_.Update(elapsed_ms, used, capacity,
+                   QueuedDrops() + telemetry_sender_.DroppedWrites())) {
+    ApplyBackoff();
+  }
+}
+
+void SensorRttTelemetryTask::ApplyBackoff() noexcept {
+  const ScanStep step = BackedOffStep(encoding_, period_ms_, rate_.level());
+  backoff_level_ = rate_.level();
+  const bool was_envelope = active_encoding_ == app::telemetry::ScanEncoding::kEnvelope;
+  const bool envelope = step.encoding == app::telemetry::ScanEncoding::kEnvelope;
+  if (step.encoding == active_encoding_ && (!envelope || step.period_ms == active_period_ms_)) {
+    active_period_ms_ = step.period_ms;
+    return;
+  }
+
+  // Full scans and delta blocks share the sample ring, so only the open block needs sending;
+  // records queued for the encoding left behind are dropped.
+  if (active_encoding_ == app::telemetry::ScanEncoding::kDelta) {
+    FlushDeltaBlock();
+  }
+  delta_block_.Reset();
+  active_encoding_ = step.encoding;
+  active_period_ms_ = step.period_ms;
+  ObserveMask(channel_mask_, mode_);
+  if (envelope && !was_envelope) {
+    DiscardScans();
+  } else if (!envelope && was_envelope) {
+    DiscardEnvelopes();
+  }
+}
+
+void SensorRttTelemetryTask::SendSingle(const domain::sensors::Sensor& sensor) noexcept {
+  float value = 0.0f;
+  switch (mode_) {
+    case domain::sensors::SensorRttMode::kRaw:
+      value = static_cast<float>(sensor.last_raw_value());
+      break;
+    case domain::sensors::SensorRttMode::kProcessed:
+      value = sensor.last_processed_value() * 1000.0f;
+      break;
+  }
+
+  std::uint8_t payload[1u + sizeof(float)]{};
+  payload[0] = sensor.id();
+  std::memcpy(&payload[1], &value, sizeof(value));
+  std::uint8_t frame[domain::telemetry::kTelemetryFrameOverheadBytes + sizeof(payload)]{};
+  const std::size_t size =
+      frame_encoder_.Encode(domain::telemetry::TelemetryFrameType::kSensorValue,
+                            sensor.last_timestamp_ticks(), payload, sizeof(payload), frame,
+                            sizeof(frame));
+  telemetry_sender_.Send(std::span<const std::uint8_t>(frame, size));
+}
+
+void SensorRttTelemetryTask::DrainSamples() noexcept {
+  // Frames are gathered into batches and only taken off the ring once RTT has room for them, so
+  // a slow host shows up as ring drops rather than as frames skipped mid-stream.
+  std::size_t writable = telemetry_sender_.WritableBytes();
+  for (;;) {
+    std::size_t batched = 0;
+    const std::size_t limit = writable < batch_.size() ? writable : batch_.size();
+    while (samples_.PeekSample(sample_)) {
+      scan_frame_.Build(sample_);
+      const std::size_t size = frame_encoder_.Encode(
+          domain::telemetry::TelemetryFrameType::kSensorScan, sample_.timestamp_ticks,
+          scan_frame_.data(), scan_frame_.size(), batch_.data() + batched, limit - batched);
+      if (size == 0u) {
+        break;
+      }
+      batched += size;
+      samples_.PopSample();
+    }
+    if (batched == 0u) {
+      break;
+    }
+    telemetry_sender_.Send(std::span<const std::uint8_t>(batch_.data(), batched));
+    writable -= batched;
+  }
+  dropped_frames_ = QueuedDrops() - dropped_base_;
+}
+
+void SensorRttTelemetryTask::DrainDeltaBlocks() noexcept {
+  // Records accumulate in one block across periods; it is sent once full or once it spans
+  // RTT_TELEMETRY_DELTA_BLOCK_TICKS, and stays pending while RTT has no room for it.
+  std::size_t writable = telemetry_sender_.WritableBytes();
+  const bool idle = adc_state_.GetState() != app::analog::AcquisitionState::kEnabled;
+  for (;;) {
+    bool ready = false;
+    while (!ready && samples_.PeekSample(sample_)) {
+      if (!delta_block_.Append(sample_)) {
+        ready = true;
+        break;
+      }
+      samples_.PopSample();
+      ready = delta_block_.last_timestamp_ticks() - delta_block_.first_timestamp_ticks() >=
+              app::config::RTT_TELEMETRY_DELTA_BLOCK_TICKS;
+    }
+    if (delta_block_.empty() || !(ready || idle)) {
+      break;
+    }
+    const std::size_t limit = writable < batch_.size() ? writable : batch_.size();
+    const std::size_t size = frame_encoder_.Encode(
+        domain::telemetry::TelemetryFrameType::kSensorScanDelta,
+        delta_block_.first_timestamp_ticks(), delta_block_.data(), delta_block_.size(),
+        batch_.data(), limit);
+    if (size == 0u) {
+      break;
+    }
+    telemetry_sender_.Send(std::span<const std::uint8_t>(batch_.data(), size));
+    writable -= size;
+    delta_block_.Clear();
+  }
+  dropped_frames_ = QueuedDrops() - dropped_base_;
+}
+
+void SensorRttTelemetryTask::FlushDeltaBlock() noexcept {
+  if (delta_block_.empty()) {
+    return;
+  }
+  const std::size_t writable = telemetry_sender_.WritableBytes();
+  const std::size_t size = frame_encoder_.Encode(
+      domain::telemetry::TelemetryFrameType::kSensorScanDelta,
+      delta_block_.first_timestamp_ticks(), delta_block_.data(), delta_block_.size(),
+      batch_.data(), writable < batch_.size() ? writable : batch_.size());
+  if (size != 0u) {
+    telemetry_sender_.Send(std::span<const std::uint8_t>(batch_.data(), size));
+  }
+  delta_block_.Clear();
+}
+
+void SensorRttTelemetryTask::DrainEnvelopes() noexcept {
+  std::size_t writable = telemetry_sender_.WritableBytes();
+  for (;;) {
+    std::size_t batched = 0;
+    const std::size_t limit = writable < batch_.size() ? writable : batch_.size();
+    while (samples_.PeekEnvelope(envelope_)) {
+      envelope_frame_.Build(envelope_);
+      const std::size_t size = frame_encoder_.Encode(
+          domain::telemetry::TelemetryFrameType::kSensorScanEnvelope,
+          envelope_.first_timestamp_ticks, envelope_frame_.data(), envelope_frame_.size(),
+          batch_.data() + batched, limit - batched);
+      if (size == 0u) {
+        break;
+      }
+      batched += size;
+      samples_.PopEnvelope();
+    }
+    if (batched == 0u) {
+      break;
+    }
+    telemetry_sender_.Send(std::span<const std::uint8_t>(batch_.data(), batched));
+    writable -= batched;
+  }
+  dropped_frames_ = QueuedDrops() - dropped_base_;
+}
+
+void SensorRttTelemetryTask::DiscardSamples() noexcept {
+  DiscardScans();
+  DiscardEnvelopes();
+}
+
+void SensorRttTelemetryTask::DiscardScans() noexcept {
+  while (samples_.PeekSample(sample_)) {
+    samples_.PopSample();
+  }
+}
+
+void SensorRttTelemetryTask::DiscardEnvelopes() noexcept {
+  while (samples_.PeekEnvelope(envelope_)) {
+    samples_.PopEnvelope();
+  }
+}
+
+void SensorRttTelemetryTask::BeginCaptureReadout() noexcept {
+  capture_status_ = capture_.GetStatus();
+  capture_next_ = 0;
+  capture_info_sent_ = false;
+  capture_waiting_ = false;
+  switch (capture_status_.state) {
+    case domain::telemetry::CaptureState::kFrozen:
+      capture_remaining_ = static_cast<std::uint32_t>(capture_status_.scan_count);
+      break;
+    case domain::telemetry::CaptureState::kArmed:
+    case domain::telemetry::CaptureState::kTriggered:
+      // A capture or recording in progress is sent as soon as it freezes.
+      capture_waiting_ = true;
+      capture_remaining_ =
+          capture_status_.config.pre_scans + 1u + capture_status_.config.post_scans;
+      break;
+    case domain::telemetry::CaptureState::kIdle:
+      capture_remaining_ = 0;
+      return;
+  }
+  // Streaming pauses: the tap would only fill its ring with scans that are stale once the
+  // readout is done.
+  samples_.Observe(0, mode_, 0);
+  DiscardSamples();
+  capture_mask_ = 0;
+  for (std::uint8_t id = 1; id <= app::config_sensors::kSensorCount; ++id) {
+    if (registry_.FindById(id) != nullptr) {
+      capture_mask_ |= ChannelBit(id);
+    }
+  }
+}
+
+void SensorRttTelemetryTask::EndCaptureReadout() noexcept {
+  // The host did not lag during the pause, so streaming resumes at the requested rate and the
+  // rate controller starts a fresh window instead of judging the link on the pause.
+  rate_.Reset(QueuedDrops() + telemetry_sender_.DroppedWrites());
+  if (channel_mask_ != 0u) {
+    ApplyBackoff();
+  }
+  ObserveMask(channel_mask_, mode_);
+  dropped_base_ = QueuedDrops() - dropped_frames_;
+}
+
+bool SensorRttTelemetryTask::CaptureStillFrozen() noexcept {
+  const app::telemetry::CaptureStatus status = capture_.GetStatus();
+  if (capture_waiting_) {
+    if (status.state == domain::telemetry::CaptureState::kArmed ||
+        status.state == domain::telemetry::CaptureState::kTriggered) {
+      return false;
+    }
+    if (status.state != domain::telemetry::CaptureState::kFrozen) {
+      capture_remaining_ = 0;
+      return false;
+    }
+    capture_waiting_ = false;
+    capture_status_ = status;
+    return true;
+  }
+  if (status.state != domain::telemetry::CaptureState::kFrozen ||
+      status.scan_count != capture_status_.scan_count ||
+      status.trigger_timestamp_ticks != capture_status_.trigger_timestamp_ticks) {
+    capture_remaining_ = 0;
+    return false;
+  }
+  return true;
+}
+
+std::size_t SensorRttTelemetryTask::EncodeCaptureInfo(std::uint8_t* out,
+                                                      std::size_t capacity) noexcept {
+  const domain::telemetry::TriggerConfig& config = capture_status_.config;
+  std::uint8_t payload[kCaptureInfoBytes]{};
+  WriteU32(&payload[0], capture_mask_);
+  WriteU32(&payload[4], static_cast<std::uint32_t>(capture_status_.scan_count));
+  WriteU32(&payload[8], static_cast<std::uint32_t>(capture_status_.trigger_index));
+  payload[12] = static_cast<std::uint8_t>(config.channel + 1u);
+  payload[13] = static_cast<std::uint8_t>(config.slope);
+  payload[14] = static_cast<std::uint8_t>(config.threshold);
+  payload[15] = static_cast<std::uint8_t>(config.threshold >> 8u);
+  return frame_encoder_.Encode(domain::telemetry::TelemetryFrameType::kCaptureInfo,
+                               capture_status_.trigger_timestamp_ticks, payload, sizeof(payload),
+                               out, capacity);
+}
+
+void SensorRttTelemetryTask::SendCaptureScans() noexcept {
+  // Like DrainSamples(), frames only go out once RTT has room for them; the capture stays frozen
+  // in D2 SRAM, so a slow host only makes the readout take longer.
+  if (!CaptureStillFrozen()) {
     return;
   }
+
+  std::size_t writable = telemetry_sender_.WritableBytes();
+  app::telemetry::CaptureScan scan{};
+  for (;;) {
+    const std::size_t limit = writable < batch_.size() ? writable : batch_.size();
+    std::size_t batched = 0;
+    if (!capture_info_sent_) {
+      batched = EncodeCaptureInfo(batch_.data(), limit);
+      if (batched == 0u) {
+        break;
+      }
+      capture_info_sent_ = true;
+    }
+    while (capture_next_ < capture_status_.scan_count && capture_.ReadScan(capture_next_, scan)) {
+      scan_frame_.Begin(capture_mask_);
+      for (std::uint8_t id = 1; id <= app::config_sensors::kSensorCount; ++id) {
+        if ((capture_mask_ & ChannelBit(id)) != 0u) {
+          scan_frame_.Append(scan.values[id - 1u]);
+        }
+      }
+      const std::size_t size = frame_encoder_.Encode(
+          domain::telemetry::TelemetryFrameType::kSensorScan, scan.timestamp_ticks,
+          scan_frame_.data(), scan_frame_.size(), batch_.data() + batched, limit - batched);
+      if (size == 0u) {
+        break;
+      }
+      batched += size;
+      ++capture_next_;
+    }
+    if (batched == 0u) {
+      break;
+    }
+    telemetry_sender_.Send(std::span<const std::uint8_t>(batch_.data(), batched));
+    writable -= batched;
+  }
+  capture_remaining_ = static_cast<std::uint32_t>(capture_status_.scan_count - capture_next_);
 }
 
 void SensorRttTelemetryTask::run() noexcept {
   enabled_ = false;
   sensor_id_ = 0;
+  channel_mask_ = 0;
+  encoding_ = app::telemetry::ScanEncoding::kFull;
+  dropped_frames_ = 0;
+  capture_remaining_ = 0;
   mode_ = domain::sensors::SensorRttMode::kRaw;
   period_ms_ = app::config::RTT_TELEMETRY_SENSOR_PERIOD_MS;
+  active_encoding_ = app::telemetry::ScanEncoding::kFull;
+  active_period_ms_ = period_ms_;
+  backoff_level_ = 0;
 
   for (;;) {
-    if (!enabled_) {
-      app::telemetry::SensorRttTelemetryCommand cmd{};
-      if (control_queue_.Receive(cmd, os::kWaitForever)) {
-        ApplyCommand(cmd);
-      }
-      continue;
-    }
+    Step();
+  }
+}
 
-    const std::uint8_t id = sensor_id_;
-    domain::sensors::Sensor* sensor = registry_.FindById(id);
-    if (sensor == nullptr) {
-      enabled_ = false;
-      sensor_id_ = 0;
-      continue;
+void SensorRttTelemetryTask::Step() noexcept {
+  if (capture_remaining_ != 0u) {
+    app::telemetry::SensorRttTelemetryCommand cmd{};
+    if (control_queue_.Receive(cmd, kCapturePollMs)) {
+      ApplyCommand(cmd);
+    } else {
+      SendCaptureScans();
+    }
+    if (capture_remaining_ == 0u) {
+      EndCaptureReadout();
     }
+    return;
+  }
 
+  if (!enabled_) {
     app::telemetry::SensorRttTelemetryCommand cmd{};
-    if (control_queue_.Receive(cmd, period_ms_)) {
+    if (control_queue_.Receive(cmd, os::kWaitForever)) {
       ApplyCommand(cmd);
-      continue;
     }
+    return;
+  }
 
-    if (adc_state_.GetState() != app::analog::AcquisitionState::kEnabled) {
-      continue;
+  const bool scanning = channel_mask_ != 0u;
+  domain::sensors::Sensor* sensor = nullptr;
+  if (!scanning) {
+    sensor = registry_.FindById(sensor_id_);
+    if (sensor == nullptr) {
+      enabled_ = false;
+      sensor_id_ = 0;
+      return;
     }
+  }
 
-    switch (mode_) {
-      case domain::sensors::SensorRttMode::kRaw:
-        telemetry_sender_.Send(static_cast<float>(sensor->last_raw_value()));
+  app::telemetry::SensorRttTelemetryCommand cmd{};
+  const std::uint32_t wait_ms = scanning ? active_period_ms_ : period_ms_;
+  if (control_queue_.Receive(cmd, wait_ms)) {
+    ApplyCommand(cmd);
+    return;
+  }
+
+  if (scanning) {
+    switch (active_encoding_) {
+      case app::telemetry::ScanEncoding::kFull:
+        DrainSamples();
         break;
-      case domain::sensors::SensorRttMode::kProcessed:
-        telemetry_sender_.Send(sensor->last_processed_value() * 1000.0f);
+      case app::telemetry::ScanEncoding::kDelta:
+        DrainDeltaBlocks();
+        break;
+      case app::telemetry::ScanEncoding::kEnvelope:
+        DrainEnvelopes();
         break;
     }
+    AdaptRate(wait_ms);
+    return;
   }
+
+  if (adc_state_.GetState() != app::analog::AcquisitionState::kEnabled) {
+    return;
+  }
+
+  SendSingle(*sensor);
 }
 
 bool SensorRttTelemetryTask::start() noexcept {
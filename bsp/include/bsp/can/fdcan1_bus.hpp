@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "app/can/can_bus_requirements.hpp"
+#include "app/time/timestamp_counter_requirements.hpp"
+#include "domain/can/can_frame.hpp"
+
+namespace bsp::can {
+
+/**
+ * @brief FDCAN1 (PA11 RX, PA12 TX, TJA1042) as a CAN-FD bus with bit rate switching.
+ *
+ * CubeMX sets FDCAN1 up as classic CAN with 8-byte elements; Init() reconfigures it for 64-byte
+ * FD frames, 500 kbit/s arbitration and 2 Mbit/s data phase. The TX buffer runs in queue mode
+ * so the lowest identifier pending on this board is sent first. Event frames are accepted into
+ * RX FIFO 0, which is polled; everything else is rejected by the filter.
+ *
+ * Clock sync frames go to RX FIFO 1, whose new-message interrupt stamps them with the timestamp
+ * counter: the FDCAN's own timestamp counter has no constant time base in FD mode, and polling
+ * would add up to a poll period of jitter. Only one instance may exist since it owns
+ * FDCAN1_IT0_IRQHandler.
+ */
+class Fdcan1Bus final : public app::can::CanBusRequirements {
+ public:
+  explicit Fdcan1Bus(const app::time::TimestampCounterRequirements& timestamp_counter) noexcept;
+
+  bool Init() noexcept;
+
+  bool Send(const domain::can::CanFrame& frame) noexcept override;
+  /** @brief Sync frames first, then event frames stamped with the time they were read. */
+  bool Receive(domain::can::CanFrame& out_frame) noexcept override;
+
+  void HandleIrq() noexcept;
+
+ private:
+  static constexpr std::size_t kSyncFifoDepth = 4;
+
+  const app::time::TimestampCounterRequirements& timestamp_counter_;
+  bool initialized_ = false;
+  // Written by the interrupt, read by Receive(): one stamp per FIFO 1 element, in order.
+  volatile std::uint32_t sync_stamps_[kSyncFifoDepth]{};
+  volatile std::uint32_t sync_stamp_head_ = 0;
+  std::uint32_t sync_stamp_tail_ = 0;
+};
+
+}  // namespace bsp::can
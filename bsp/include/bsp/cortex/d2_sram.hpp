@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstdint>
+
+namespace bsp::cortex {
+
+// SRAM1..3 of the D2 domain (RAM_D2 in the linker script), used for large capture buffers.
+// The region is mapped write-through so memory always holds what the CPU wrote: a debugger
+// dump (which bypasses the D-cache) and DMA reads see the captured data without cache
+// maintenance, while CPU reads stay cached.
+class D2Sram {
+ public:
+  static void EnableClocks() noexcept;
+  static void ConfigureWriteThroughRegion() noexcept;
+  static constexpr std::uintptr_t kBaseAddress = 0x30000000UL;
+  static constexpr std::size_t kSizeBytes = 288U * 1024U;
+};
+
+}  // namespace bsp::cortex
@@ -4,6 +4,14 @@
 #define BSP_AXI_SRAM_NOCACHE __attribute__((section(".axi_sram_nocache")))
 #endif
 
+#ifndef BSP_D2_SRAM
+#define BSP_D2_SRAM __attribute__((section(".d2_sram")))
+#endif
+
 #ifndef BSP_D3_SRAM_NOCACHE
 #define BSP_D3_SRAM_NOCACHE __attribute__((section(".d3_sram_nocache")))
 #endif
+
+#ifndef BSP_LIVE_SNAPSHOT
+#define BSP_LIVE_SNAPSHOT __attribute__((section(".live_snapshot")))
+#endif
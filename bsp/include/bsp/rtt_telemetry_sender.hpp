@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <span>
 
@@ -12,9 +13,15 @@ class RttTelemetrySender final : public app::telemetry::TelemetrySenderRequireme
   RttTelemetrySender(unsigned channel, const char* name, void* buffer, unsigned size) noexcept;
 
   void Send(std::span<const std::uint8_t> data) noexcept override;
+  std::size_t WritableBytes() const noexcept override;
+  std::size_t CapacityBytes() const noexcept override;
+  std::uint32_t DroppedWrites() const noexcept override;
+  std::uint32_t Underruns() const noexcept override;
 
  private:
   unsigned _channel;
+  unsigned _size;
+  std::uint32_t _dropped_writes = 0;
 };
 
 }  // namespace bsp
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+
+#include "stm32h7xx_hal.h"
+
+namespace bsp::serial {
+
+inline constexpr std::uint32_t kMidiBaudRate = 31250;
+
+/**
+ * @brief USART2 (PD5 TX) and USART3 (PD8 TX) set up as MIDI outputs: 31250 baud 8N1, TX DMA
+ * (DMA1 stream 4/5) and interrupts.
+ *
+ * CubeMX only routes the pins for these UARTs, so the peripherals are initialized here and
+ * Core stays generated code. Must be called once before a UartStream is started on them.
+ */
+bool InitMidiUarts() noexcept;
+
+UART_HandleTypeDef& MidiUart2() noexcept;
+UART_HandleTypeDef& MidiUart3() noexcept;
+
+/**
+ * @brief Re-initializes one of the UARTs at another baud rate, e.g. to carry telemetry instead
+ * of MIDI. Rates above 7.5 Mbaud (kernel clock / 16) switch to 8x oversampling, which reaches
+ * 15 Mbaud with the 120 MHz D2 APB1 clock.
+ */
+bool SetUartBaudRate(UART_HandleTypeDef& huart, std::uint32_t baud_rate) noexcept;
+
+}  // namespace bsp::serial
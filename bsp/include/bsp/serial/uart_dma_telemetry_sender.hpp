@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+
+#include "app/telemetry/telemetry_sender_requirements.hpp"
+#include "bsp/serial/uart_stream.hpp"
+#include "domain/telemetry/double_buffer_tx.hpp"
+#include "stm32h7xx_hal.h"
+
+namespace bsp::serial {
+
+/**
+ * @class UartDmaTelemetrySender
+ * @brief Sends framed telemetry over a UART TX DMA from two ping-pong buffers, for boards
+ * without a debugger attached.
+ *
+ * Send() copies into the fill buffer and starts a transfer straight from it when the DMA is
+ * idle; the transfer-complete interrupt hands over the other buffer. Only the reservation and
+ * the commit run with interrupts disabled, not the copy itself. Writes that do not fit are
+ * refused whole and counted, so WritableBytes() pacing works as with RTT.
+ * @warning MEMORY COHERENCY CRITICAL: the DMA reads the buffers held by this object, so it MUST
+ * be placed in non-cacheable memory with BSP_AXI_SRAM_NOCACHE, like UartStream.
+ */
+template <std::size_t kBufferBytes>
+class UartDmaTelemetrySender final : public app::telemetry::TelemetrySenderRequirements,
+                                     public UartStreamBase {
+  static_assert(kBufferBytes <= UINT16_MAX, "one DMA transfer is at most 65535 bytes");
+
+ public:
+  explicit UartDmaTelemetrySender(UART_HandleTypeDef& huart) noexcept : huart_(huart) {
+    RegisterUartStream(*this);
+  }
+
+  void Send(std::span<const std::uint8_t> data) noexcept override {
+    if (data.empty()) {
+      return;
+    }
+    __disable_irq();
+    std::uint8_t* space = tx_.BeginWrite(data.size());
+    __enable_irq();
+    if (space == nullptr) {
+      return;
+    }
+    std::memcpy(space, data.data(), data.size());
+    __disable_irq();
+    tx_.CommitWrite();
+    __enable_irq();
+    StartNextTransfer();
+  }
+
+  std::size_t WritableBytes() const noexcept override {
+    __disable_irq();
+    const std::size_t writable = tx_.WritableBytes();
+    __enable_irq();
+    return writable;
+  }
+
+  std::size_t CapacityBytes() const noexcept override {
+    return kBufferBytes;
+  }
+
+  std::uint32_t DroppedWrites() const noexcept override {
+    return stats().overflow_count;
+  }
+
+  std::uint32_t Underruns() const noexcept override {
+    return stats().underrun_count;
+  }
+
+  domain::telemetry::DoubleBufferTxStats stats() const noexcept {
+    __disable_irq();
+    const domain::telemetry::DoubleBufferTxStats stats = tx_.stats();
+    __enable_irq();
+    return stats;
+  }
+
+  UART_HandleTypeDef* handle() noexcept override {
+    return &huart_;
+  }
+
+  void HandleUartIrq() noexcept override {}
+
+  void HandleTxCompleteIrq() noexcept override {
+    __disable_irq();
+    tx_.OnTransferComplete();
+    __enable_irq();
+    StartNextTransfer();
+  }
+
+ private:
+  void StartNextTransfer() noexcept {
+    const std::uint8_t* data = nullptr;
+    std::size_t length = 0;
+    __disable_irq();
+    const bool submit = tx_.TakeSubmission(data, length);
+    __enable_irq();
+    if (!submit) {
+      return;
+    }
+    if (HAL_UART_Transmit_DMA(&huart_, data, static_cast<std::uint16_t>(length)) != HAL_OK) {
+      __disable_irq();
+      tx_.AbortSubmission();
+      __enable_irq();
+    }
+  }
+
+  UART_HandleTypeDef& huart_;
+  domain::telemetry::DoubleBufferTx<kBufferBytes> tx_{};
+};
+
+}  // namespace bsp::serial
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstdint>
+
+#include "app/time/alarm_requirements.hpp"
+
+namespace bsp::time {
+
+using AlarmCallback = void (*)(void* ctx) noexcept;
+
+/**
+ * @brief One-shot alarm on TIM2 capture/compare channel 1 (timing mode, no pin).
+ * The callback runs in the TIM2 interrupt. Only one instance may exist since it owns
+ * TIM2_IRQHandler; TIM2 itself is started by the timestamp counter.
+ */
+class Tim2Alarm final : public app::time::AlarmRequirements {
+ public:
+  Tim2Alarm(AlarmCallback callback, void* ctx) noexcept;
+
+  bool Init() noexcept;
+
+  void ArmAt(std::uint32_t deadline_ticks) noexcept override;
+  void Disarm() noexcept override;
+
+  void HandleIrq() noexcept;
+
+ private:
+  AlarmCallback callback_ = nullptr;
+  void* ctx_ = nullptr;
+};
+
+}  // namespace bsp::time
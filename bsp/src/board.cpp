@@ -1,6 +1,7 @@
 #include "bsp/board.hpp"
 
 #include "bsp/cortex/axi_sram_nocache_mpu.hpp"
+#include "bsp/cortex/d2_sram.hpp"
 #include "bsp/cortex/d3_sram_nocache_mpu.hpp"
 
 namespace bsp {
@@ -8,6 +9,8 @@ namespace bsp {
 void Board::init() noexcept {
   bsp::cortex::AxiSramNoCacheMpu::ConfigureRegion();
   bsp::cortex::D3SramNoCacheMpu::ConfigureRegion();
+  bsp::cortex::D2Sram::EnableClocks();
+  bsp::cortex::D2Sram::ConfigureWriteThroughRegion();
 }
 
 
@@ -0,0 +1,190 @@
+#include "bsp/can/fdcan1_bus.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+#include "domain/can/can_event_frame.hpp"
+#include "domain/can/clock_sync.hpp"
+#include "fdcan.h"
+
+namespace bsp::can {
+namespace {
+
+Fdcan1Bus* g_fdcan1_bus = nullptr;
+
+constexpr std::uint32_t kFdcanIrqPriority = 5;
+
+// Payload sizes indexed by DLC code (FDCAN_DLC_BYTES_x are the plain codes on H7).
+constexpr std::uint8_t kDlcToLength[16] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24, 32, 48, 64};
+
+std::uint32_t LengthToDlc(std::uint8_t length) noexcept {
+  for (std::uint32_t dlc = 0; dlc < 16u; ++dlc) {
+    if (kDlcToLength[dlc] >= length) {
+      return dlc;
+    }
+  }
+  return FDCAN_DLC_BYTES_64;
+}
+
+void ConfigureFdMode(FDCAN_HandleTypeDef& hfdcan) noexcept {
+  // fdcan_ker_ck is PLL1Q (80 MHz): /10 and 16 tq give 500 kbit/s, /2 and 20 tq 2 Mbit/s.
+  hfdcan.Init.FrameFormat = FDCAN_FRAME_FD_BRS;
+  hfdcan.Init.Mode = FDCAN_MODE_NORMAL;
+  hfdcan.Init.AutoRetransmission = ENABLE;
+  hfdcan.Init.TransmitPause = ENABLE;
+  hfdcan.Init.NominalPrescaler = 10;
+  hfdcan.Init.NominalSyncJumpWidth = 3;
+  hfdcan.Init.NominalTimeSeg1 = 12;
+  hfdcan.Init.NominalTimeSeg2 = 3;
+  hfdcan.Init.DataPrescaler = 2;
+  hfdcan.Init.DataSyncJumpWidth = 4;
+  hfdcan.Init.DataTimeSeg1 = 15;
+  hfdcan.Init.DataTimeSeg2 = 4;
+  hfdcan.Init.StdFiltersNbr = 2;
+  hfdcan.Init.ExtFiltersNbr = 0;
+  hfdcan.Init.RxFifo0ElmtsNbr = 32;
+  hfdcan.Init.RxFifo0ElmtSize = FDCAN_DATA_BYTES_64;
+  hfdcan.Init.RxFifo1ElmtsNbr = 4;
+  hfdcan.Init.RxFifo1ElmtSize = FDCAN_DATA_BYTES_8;
+  hfdcan.Init.RxBuffersNbr = 0;
+  hfdcan.Init.TxEventsNbr = 0;
+  hfdcan.Init.TxBuffersNbr = 0;
+  hfdcan.Init.TxFifoQueueElmtsNbr = 32;
+  hfdcan.Init.TxFifoQueueMode = FDCAN_TX_QUEUE_OPERATION;
+  hfdcan.Init.TxElmtSize = FDCAN_DATA_BYTES_64;
+}
+
+bool ConfigureFilters(FDCAN_HandleTypeDef& hfdcan) noexcept {
+  FDCAN_FilterTypeDef filter{};
+  filter.IdType = FDCAN_STANDARD_ID;
+  filter.FilterIndex = 0;
+  filter.FilterType = FDCAN_FILTER_RANGE;
+  filter.FilterConfig = FDCAN_FILTER_TO_RXFIFO0;
+  filter.FilterID1 = domain::can::MakeCanEventId(domain::can::CanTrafficClass::kNote, 0);
+  filter.FilterID2 = domain::can::MakeCanEventId(domain::can::CanTrafficClass::kController,
+                                                 domain::can::kCanMaxBoards - 1u);
+  if (HAL_FDCAN_ConfigFilter(&hfdcan, &filter) != HAL_OK) {
+    return false;
+  }
+  filter.FilterIndex = 1;
+  filter.FilterConfig = FDCAN_FILTER_TO_RXFIFO1;
+  filter.FilterID1 = domain::can::kCanClockSyncId;
+  filter.FilterID2 = domain::can::kCanClockSyncId;
+  if (HAL_FDCAN_ConfigFilter(&hfdcan, &filter) != HAL_OK) {
+    return false;
+  }
+  return HAL_FDCAN_ConfigGlobalFilter(&hfdcan, FDCAN_REJECT, FDCAN_REJECT, FDCAN_REJECT_REMOTE,
+                                      FDCAN_REJECT_REMOTE) == HAL_OK;
+}
+
+bool ReadFrame(std::uint32_t fifo, domain::can::CanFrame& out_frame) noexcept {
+  FDCAN_RxHeaderTypeDef header{};
+  if (HAL_FDCAN_GetRxMessage(&hfdcan1, fifo, &header, out_frame.data.data()) != HAL_OK) {
+    return false;
+  }
+  out_frame.id = header.Identifier;
+  out_frame.length = kDlcToLength[header.DataLength & 0x0Fu];
+  return true;
+}
+
+}  // namespace
+
+Fdcan1Bus::Fdcan1Bus(const app::time::TimestampCounterRequirements& timestamp_counter) noexcept
+    : timestamp_counter_(timestamp_counter) {
+  g_fdcan1_bus = this;
+}
+
+bool Fdcan1Bus::Init() noexcept {
+  if (initialized_) {
+    return true;
+  }
+
+  if (HAL_FDCAN_DeInit(&hfdcan1) != HAL_OK) {
+    return false;
+  }
+  ConfigureFdMode(hfdcan1);
+  if (HAL_FDCAN_Init(&hfdcan1) != HAL_OK) {
+    return false;
+  }
+  if (!ConfigureFilters(hfdcan1)) {
+    return false;
+  }
+  // The transceiver loop delay exceeds a 2 Mbit/s bit time: sample own bits at the data SP.
+  const std::uint32_t tdc_offset = hfdcan1.Init.DataPrescaler * hfdcan1.Init.DataTimeSeg1;
+  if (HAL_FDCAN_ConfigTxDelayCompensation(&hfdcan1, tdc_offset, 0) != HAL_OK ||
+      HAL_FDCAN_EnableTxDelayCompensation(&hfdcan1) != HAL_OK) {
+    return false;
+  }
+  if (HAL_FDCAN_ActivateNotification(&hfdcan1, FDCAN_IT_RX_FIFO1_NEW_MESSAGE, 0) != HAL_OK) {
+    return false;
+  }
+  HAL_NVIC_SetPriority(FDCAN1_IT0_IRQn, kFdcanIrqPriority, 0);
+  HAL_NVIC_EnableIRQ(FDCAN1_IT0_IRQn);
+  if (HAL_FDCAN_Start(&hfdcan1) != HAL_OK) {
+    return false;
+  }
+
+  initialized_ = true;
+  return true;
+}
+
+bool Fdcan1Bus::Send(const domain::can::CanFrame& frame) noexcept {
+  if (!initialized_ || HAL_FDCAN_GetTxFifoFreeLevel(&hfdcan1) == 0u) {
+    return false;
+  }
+
+  FDCAN_TxHeaderTypeDef header{};
+  header.Identifier = frame.id & domain::can::kCanStandardIdMask;
+  header.IdType = FDCAN_STANDARD_ID;
+  header.TxFrameType = FDCAN_DATA_FRAME;
+  header.DataLength = LengthToDlc(frame.length);
+  header.ErrorStateIndicator = FDCAN_ESI_ACTIVE;
+  header.BitRateSwitch = FDCAN_BRS_ON;
+  header.FDFormat = FDCAN_FD_CAN;
+  header.TxEventFifoControl = FDCAN_NO_TX_EVENTS;
+  header.MessageMarker = 0;
+  return HAL_FDCAN_AddMessageToTxFifoQ(&hfdcan1, &header, frame.data.data()) == HAL_OK;
+}
+
+bool Fdcan1Bus::Receive(domain::can::CanFrame& out_frame) noexcept {
+  if (!initialized_) {
+    return false;
+  }
+
+  if (HAL_FDCAN_GetRxFifoFillLevel(&hfdcan1, FDCAN_RX_FIFO1) != 0u) {
+    const bool stamped = sync_stamp_tail_ != sync_stamp_head_;
+    out_frame.timestamp_ticks = stamped ? sync_stamps_[sync_stamp_tail_ % kSyncFifoDepth]
+                                        : timestamp_counter_.NowTicks();
+    if (stamped) {
+      ++sync_stamp_tail_;
+    }
+    return ReadFrame(FDCAN_RX_FIFO1, out_frame);
+  }
+
+  if (HAL_FDCAN_GetRxFifoFillLevel(&hfdcan1, FDCAN_RX_FIFO0) == 0u) {
+    return false;
+  }
+  out_frame.timestamp_ticks = timestamp_counter_.NowTicks();
+  return ReadFrame(FDCAN_RX_FIFO0, out_frame);
+}
+
+void Fdcan1Bus::HandleIrq() noexcept {
+  const std::uint32_t now_ticks = timestamp_counter_.NowTicks();
+  if (__HAL_FDCAN_GET_FLAG(&hfdcan1, FDCAN_FLAG_RX_FIFO1_NEW_MESSAGE) == 0u) {
+    return;
+  }
+  __HAL_FDCAN_CLEAR_FLAG(&hfdcan1, FDCAN_FLAG_RX_FIFO1_NEW_MESSAGE);
+  // A full stamp ring means the task fell behind: the frames left unstamped get the read time.
+  if (sync_stamp_head_ - sync_stamp_tail_ < kSyncFifoDepth) {
+    sync_stamps_[sync_stamp_head_ % kSyncFifoDepth] = now_ticks;
+    sync_stamp_head_ = sync_stamp_head_ + 1u;
+  }
+}
+
+}  // namespace bsp::can
+
+extern "C" void FDCAN1_IT0_IRQHandler(void) {
+  if (bsp::can::g_fdcan1_bus != nullptr) {
+    bsp::can::g_fdcan1_bus->HandleIrq();
+  }
+}
@@ -0,0 +1,34 @@
+#include "bsp/cortex/d2_sram.hpp"
+
+#include "stm32h7xx_hal.h"
+
+namespace bsp::cortex {
+
+void D2Sram::EnableClocks() noexcept {
+  __HAL_RCC_D2SRAM1_CLK_ENABLE();
+  __HAL_RCC_D2SRAM2_CLK_ENABLE();
+  __HAL_RCC_D2SRAM3_CLK_ENABLE();
+}
+
+void D2Sram::ConfigureWriteThroughRegion() noexcept {
+  HAL_MPU_Disable();
+
+  // 512 KB is the smallest power of two covering the 288 KB; the rest of it is unmapped.
+  MPU_Region_InitTypeDef region = {};
+  region.Enable = MPU_REGION_ENABLE;
+  region.Number = MPU_REGION_NUMBER3;
+  region.BaseAddress = kBaseAddress;
+  region.Size = MPU_REGION_SIZE_512KB;
+  region.SubRegionDisable = 0x00;
+  region.TypeExtField = MPU_TEX_LEVEL0;
+  region.AccessPermission = MPU_REGION_FULL_ACCESS;
+  region.DisableExec = MPU_INSTRUCTION_ACCESS_DISABLE;
+  region.IsShareable = MPU_ACCESS_NOT_SHAREABLE;
+  region.IsCacheable = MPU_ACCESS_CACHEABLE;
+  region.IsBufferable = MPU_ACCESS_NOT_BUFFERABLE;
+  HAL_MPU_ConfigRegion(&region);
+
+  HAL_MPU_Enable(MPU_PRIVILEGED_DEFAULT);
+}
+
+}  // namespace bsp::cortex
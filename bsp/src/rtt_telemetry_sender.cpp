@@ -6,13 +6,33 @@ namespace bsp {
 
 RttTelemetrySender::RttTelemetrySender(unsigned channel, const char* name, void* buffer,
                                        unsigned size) noexcept
-    : _channel(channel) {
+    : _channel(channel), _size(size) {
   SEGGER_RTT_Init();
   (void) SEGGER_RTT_ConfigUpBuffer(_channel, name, buffer, size, SEGGER_RTT_MODE_NO_BLOCK_SKIP);
 }
 
 void RttTelemetrySender::Send(std::span<const std::uint8_t> data) noexcept {
-  (void) SEGGER_RTT_Write(_channel, data.data(), data.size());
+  if (SEGGER_RTT_Write(_channel, data.data(), data.size()) < data.size()) {
+    ++_dropped_writes;
+  }
+}
+
+std::size_t RttTelemetrySender::WritableBytes() const noexcept {
+  return SEGGER_RTT_GetAvailWriteSpace(_channel);
+}
+
+std::size_t RttTelemetrySender::CapacityBytes() const noexcept {
+  // One byte of the ring always stays free to tell full from empty.
+  return _size - 1u;
+}
+
+std::uint32_t RttTelemetrySender::DroppedWrites() const noexcept {
+  return _dropped_writes;
+}
+
+std::uint32_t RttTelemetrySender::Underruns() const noexcept {
+  // The host drains the RTT ring; the target never waits on a transmitter.
+  return 0;
 }
 
 }  // namespace bsp
@@ -0,0 +1,142 @@
+#include "bsp/serial/midi_uarts.hpp"
+
+#include <cstdint>
+
+#include "bsp/serial/uart_stream_irq_bridge.h"
+
+namespace {
+
+UART_HandleTypeDef g_midi_uart2{};
+UART_HandleTypeDef g_midi_uart3{};
+DMA_HandleTypeDef g_midi_uart2_tx_dma{};
+DMA_HandleTypeDef g_midi_uart3_tx_dma{};
+
+constexpr std::uint32_t kMidiIrqPriority = 5;
+
+bool ConfigureKernelClock() noexcept {
+  RCC_PeriphCLKInitTypeDef clock_init{};
+  clock_init.PeriphClockSelection = RCC_PERIPHCLK_USART234578;
+  clock_init.Usart234578ClockSelection = RCC_USART234578CLKSOURCE_D2PCLK1;
+  return HAL_RCCEx_PeriphCLKConfig(&clock_init) == HAL_OK;
+}
+
+bool InitTxDma(UART_HandleTypeDef& huart, DMA_HandleTypeDef& hdma, DMA_Stream_TypeDef* stream,
+               std::uint32_t request, IRQn_Type dma_irq) noexcept {
+  hdma.Instance = stream;
+  hdma.Init.Request = request;
+  hdma.Init.Direction = DMA_MEMORY_TO_PERIPH;
+  hdma.Init.PeriphInc = DMA_PINC_DISABLE;
+  hdma.Init.MemInc = DMA_MINC_ENABLE;
+  hdma.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+  hdma.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+  hdma.Init.Mode = DMA_NORMAL;
+  hdma.Init.Priority = DMA_PRIORITY_MEDIUM;
+  hdma.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+  if (HAL_DMA_Init(&hdma) != HAL_OK) {
+    return false;
+  }
+  __HAL_LINKDMA(&huart, hdmatx, hdma);
+
+  HAL_NVIC_SetPriority(dma_irq, kMidiIrqPriority, 0);
+  HAL_NVIC_EnableIRQ(dma_irq);
+  return true;
+}
+
+bool InitMidiUart(UART_HandleTypeDef& huart, USART_TypeDef* instance, IRQn_Type uart_irq) noexcept {
+  huart.Instance = instance;
+  huart.Init.BaudRate = bsp::serial::kMidiBaudRate;
+  huart.Init.WordLength = UART_WORDLENGTH_8B;
+  huart.Init.StopBits = UART_STOPBITS_1;
+  huart.Init.Parity = UART_PARITY_NONE;
+  huart.Init.Mode = UART_MODE_TX;
+  huart.Init.HwFlowCtl = UART_HWCONTROL_NONE;
+  huart.Init.OverSampling = UART_OVERSAMPLING_16;
+  huart.Init.OneBitSampling = UART_ONE_BIT_SAMPLE_DISABLE;
+  huart.Init.ClockPrescaler = UART_PRESCALER_DIV1;
+  huart.AdvancedInit.AdvFeatureInit = UART_ADVFEATURE_NO_INIT;
+  if (HAL_UART_Init(&huart) != HAL_OK) {
+    return false;
+  }
+  if (HAL_UARTEx_DisableFifoMode(&huart) != HAL_OK) {
+    return false;
+  }
+
+  HAL_NVIC_SetPriority(uart_irq, kMidiIrqPriority, 0);
+  HAL_NVIC_EnableIRQ(uart_irq);
+  return true;
+}
+
+}  // namespace
+
+extern "C" void USART2_IRQHandler(void) {
+  BspUartStream_HandleUartIrq(&g_midi_uart2);
+  HAL_UART_IRQHandler(&g_midi_uart2);
+}
+
+extern "C" void USART3_IRQHandler(void) {
+  BspUartStream_HandleUartIrq(&g_midi_uart3);
+  HAL_UART_IRQHandler(&g_midi_uart3);
+}
+
+extern "C" void DMA1_Stream4_IRQHandler(void) {
+  HAL_DMA_IRQHandler(&g_midi_uart2_tx_dma);
+}
+
+extern "C" void DMA1_Stream5_IRQHandler(void) {
+  HAL_DMA_IRQHandler(&g_midi_uart3_tx_dma);
+}
+
+namespace bsp::serial {
+
+bool InitMidiUarts() noexcept {
+  static bool initialized = false;
+  if (initialized) {
+    return true;
+  }
+
+  if (!ConfigureKernelClock()) {
+    return false;
+  }
+  __HAL_RCC_USART2_CLK_ENABLE();
+  __HAL_RCC_USART3_CLK_ENABLE();
+  __HAL_RCC_DMA1_CLK_ENABLE();
+
+  // The HAL MSP hook in Core only knows USART1: DMA and NVIC are set up before HAL_UART_Init().
+  if (!InitTxDma(g_midi_uart2, g_midi_uart2_tx_dma, DMA1_Stream4, DMA_REQUEST_USART2_TX,
+                 DMA1_Stream4_IRQn) ||
+      !InitTxDma(g_midi_uart3, g_midi_uart3_tx_dma, DMA1_Stream5, DMA_REQUEST_USART3_TX,
+                 DMA1_Stream5_IRQn)) {
+    return false;
+  }
+  if (!InitMidiUart(g_midi_uart2, USART2, USART2_IRQn) ||
+      !InitMidiUart(g_midi_uart3, USART3, USART3_IRQn)) {
+    return false;
+  }
+
+  initialized = true;
+  return true;
+}
+
+UART_HandleTypeDef& MidiUart2() noexcept {
+  return g_midi_uart2;
+}
+
+UART_HandleTypeDef& MidiUart3() noexcept {
+  return g_midi_uart3;
+}
+
+bool SetUartBaudRate(UART_HandleTypeDef& huart, std::uint32_t baud_rate) noexcept {
+  const std::uint32_t kernel_clock_hz = HAL_RCC_GetPCLK1Freq();
+  if (baud_rate == 0u || baud_rate > kernel_clock_hz / 8u) {
+    return false;
+  }
+  huart.Init.BaudRate = baud_rate;
+  huart.Init.OverSampling =
+      baud_rate > kernel_clock_hz / 16u ? UART_OVERSAMPLING_8 : UART_OVERSAMPLING_16;
+  if (HAL_UART_Init(&huart) != HAL_OK) {
+    return false;
+  }
+  return HAL_UARTEx_DisableFifoMode(&huart) == HAL_OK;
+}
+
+}  // namespace bsp::serial
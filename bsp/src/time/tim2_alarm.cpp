@@ -0,0 +1,72 @@
+#include "bsp/time/tim2_alarm.hpp"
+
+#include "stm32h7xx_hal.h"
+#include "tim.h"
+
+namespace bsp::time {
+namespace {
+
+Tim2Alarm* g_tim2_alarm = nullptr;
+
+constexpr std::uint32_t kTim2IrqPriority = 5;
+
+bool IsDue(std::uint32_t deadline_ticks) noexcept {
+  const std::uint32_t now = __HAL_TIM_GET_COUNTER(&htim2);
+  return static_cast<std::int32_t>(deadline_ticks - now) <= 0;
+}
+
+}  // namespace
+
+Tim2Alarm::Tim2Alarm(AlarmCallback callback, void* ctx) noexcept
+    : callback_(callback), ctx_(ctx) {
+  g_tim2_alarm = this;
+}
+
+bool Tim2Alarm::Init() noexcept {
+  __HAL_TIM_DISABLE_IT(&htim2, TIM_IT_CC1);
+  __HAL_TIM_CLEAR_FLAG(&htim2, TIM_FLAG_CC1);
+  HAL_NVIC_SetPriority(TIM2_IRQn, kTim2IrqPriority, 0);
+  HAL_NVIC_EnableIRQ(TIM2_IRQn);
+  return true;
+}
+
+void Tim2Alarm::ArmAt(std::uint32_t deadline_ticks) noexcept {
+  __HAL_TIM_DISABLE_IT(&htim2, TIM_IT_CC1);
+  __HAL_TIM_SET_COMPARE(&htim2, TIM_CHANNEL_1, deadline_ticks);
+  __HAL_TIM_CLEAR_FLAG(&htim2, TIM_FLAG_CC1);
+  __HAL_TIM_ENABLE_IT(&htim2, TIM_IT_CC1);
+
+  // The compare only matches on equality: a deadline that passed while arming would otherwise
+  // wait for the counter to wrap.
+  if (IsDue(deadline_ticks)) {
+    HAL_NVIC_SetPendingIRQ(TIM2_IRQn);
+  }
+}
+
+void Tim2Alarm::Disarm() noexcept {
+  __HAL_TIM_DISABLE_IT(&htim2, TIM_IT_CC1);
+  __HAL_TIM_CLEAR_FLAG(&htim2, TIM_FLAG_CC1);
+}
+
+void Tim2Alarm::HandleIrq() noexcept {
+  if (__HAL_TIM_GET_IT_SOURCE(&htim2, TIM_IT_CC1) == RESET) {
+    return;
+  }
+  const bool matched = __HAL_TIM_GET_FLAG(&htim2, TIM_FLAG_CC1) != RESET;
+  if (!matched && !IsDue(__HAL_TIM_GET_COMPARE(&htim2, TIM_CHANNEL_1))) {
+    return;
+  }
+
+  Disarm();
+  if (callback_ != nullptr) {
+    callback_(ctx_);
+  }
+}
+
+}  // namespace bsp::time
+
+extern "C" void TIM2_IRQHandler(void) {
+  if (bsp::time::g_tim2_alarm != nullptr) {
+    bsp::time::g_tim2_alarm->HandleIrq();
+  }
+}
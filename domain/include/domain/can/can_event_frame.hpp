@@ -0,0 +1,251 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "domain/can/can_frame.hpp"
+#include "domain/music/music_event.hpp"
+
+namespace domain::can {
+
+/**
+ * @brief Event frame layout: sequence number, event count, then 8-byte little-endian records
+ * (timestamp u32, type u8, number u8, value u16), padded to a valid CAN-FD length.
+ */
+inline constexpr std::size_t kCanEventHeaderBytes = 2;
+inline constexpr std::size_t kCanEventRecordBytes = 8;
+inline constexpr std::size_t kCanEventsPerFrame =
+    (kCanFdMaxPayloadBytes - kCanEventHeaderBytes) / kCanEventRecordBytes;
+inline constexpr std::uint8_t kCanMaxBoards = 16;
+
+/**
+ * @brief Top bits of the identifier. A lower identifier wins arbitration, so note frames from
+ * any board go before controller frames; the board id in the low bits keeps identifiers unique.
+ */
+enum class CanTrafficClass : std::uint8_t {
+  kNote = 1,
+  kController = 2,
+};
+
+constexpr std::uint32_t MakeCanEventId(CanTrafficClass traffic_class,
+                                       std::uint8_t board_id) noexcept {
+  return (static_cast<std::uint32_t>(traffic_class) << 8u) |
+         static_cast<std::uint32_t>(board_id & (kCanMaxBoards - 1u));
+}
+
+/**
+ * @brief Splits an event frame identifier; false for identifiers outside the event classes.
+ */
+constexpr bool ParseCanEventId(std::uint32_t id, CanTrafficClass& out_class,
+                               std::uint8_t& out_board_id) noexcept {
+  const std::uint32_t traffic_class = (id & kCanStandardIdMask) >> 8u;
+  if (traffic_class != static_cast<std::uint32_t>(CanTrafficClass::kNote) &&
+      traffic_class != static_cast<std::uint32_t>(CanTrafficClass::kController)) {
+    return false;
+  }
+  if ((id & 0xF0u) != 0u) {
+    return false;
+  }
+  out_class = static_cast<CanTrafficClass>(traffic_class);
+  out_board_id = static_cast<std::uint8_t>(id & (kCanMaxBoards - 1u));
+  return true;
+}
+
+struct CanEventPackerStats {
+  std::uint32_t frames_sent = 0;
+  std::uint32_t events_sent = 0;
+  /** @brief Frames the bus refused (TX FIFO full); their events are lost. */
+  std::uint32_t dropped_frame_count = 0;
+  std::uint32_t dropped_event_count = 0;
+};
+
+/**
+ * @brief Batches local music events into CAN-FD frames, one open frame per traffic class.
+ *
+ * A frame is handed to the sink as soon as it is full and otherwise on Flush(), which the
+ * output task calls once per poll so an event never waits more than one poll period. Notes are
+ * flushed before controllers. SinkT must provide bool OnCanFrame(const CanFrame&), returning
+ * false when the TX FIFO has no room.
+ */
+class CanEventPacker {
+ public:
+  explicit CanEventPacker(std::uint8_t board_id = 0) noexcept : board_id_(board_id) {}
+
+  void Reset() noexcept {
+    for (Batch& batch : batches_) {
+      batch.count = 0;
+      batch.sequence = 0;
+    }
+    stats_ = {};
+  }
+
+  std::uint8_t board_id() const noexcept {
+    return board_id_;
+  }
+
+  template <typename SinkT>
+  void Push(const domain::music::MusicEvent& event, SinkT& sink) {
+    const CanTrafficClass traffic_class = domain::music::IsNoteEvent(event.type)
+                                              ? CanTrafficClass::kNote
+                                              : CanTrafficClass::kController;
+    Batch& batch = BatchFor(traffic_class);
+    batch.events[batch.count++] = event;
+    if (batch.count == kCanEventsPerFrame) {
+      Send(traffic_class, sink);
+    }
+  }
+
+  template <typename SinkT>
+  void Flush(SinkT& sink) {
+    Send(CanTrafficClass::kNote, sink);
+    Send(CanTrafficClass::kController, sink);
+  }
+
+  std::size_t pending_event_count() const noexcept {
+    return batches_[0].count + batches_[1].count;
+  }
+
+  const CanEventPackerStats& stats() const noexcept {
+    return stats_;
+  }
+
+ private:
+  struct Batch {
+    std::array<domain::music::MusicEvent, kCanEventsPerFrame> events{};
+    std::size_t count = 0;
+    std::uint8_t sequence = 0;
+  };
+
+  Batch& BatchFor(CanTrafficClass traffic_class) noexcept {
+    return batches_[traffic_class == CanTrafficClass::kNote ? 0u : 1u];
+  }
+
+  template <typename SinkT>
+  void Send(CanTrafficClass traffic_class, SinkT& sink) {
+    Batch& batch = BatchFor(traffic_class);
+    if (batch.count == 0u) {
+      return;
+    }
+
+    CanFrame frame{};
+    frame.id = MakeCanEventId(traffic_class, board_id_);
+    frame.data[0] = batch.sequence++;
+    frame.data[1] = static_cast<std::uint8_t>(batch.count);
+    for (std::size_t i = 0; i < batch.count; ++i) {
+      WriteRecord(batch.events[i], &frame.data[kCanEventHeaderBytes + i * kCanEventRecordBytes]);
+    }
+    frame.length = CanFdPaddedLength(kCanEventHeaderBytes + batch.count * kCanEventRecordBytes);
+
+    if (sink.OnCanFrame(frame)) {
+      ++stats_.frames_sent;
+      stats_.events_sent += static_cast<std::uint32_t>(batch.count);
+    } else {
+      ++stats_.dropped_frame_count;
+      stats_.dropped_event_count += static_cast<std::uint32_t>(batch.count);
+    }
+    batch.count = 0;
+  }
+
+  static void WriteRecord(const domain::music::MusicEvent& event, std::uint8_t* out) noexcept {
+    out[0] = static_cast<std::uint8_t>(event.timestamp_ticks);
+    out[1] = static_cast<std::uint8_t>(event.timestamp_ticks >> 8u);
+    out[2] = static_cast<std::uint8_t>(event.timestamp_ticks >> 16u);
+    out[3] = static_cast<std::uint8_t>(event.timestamp_ticks >> 24u);
+    out[4] = static_cast<std::uint8_t>(event.type);
+    out[5] = event.number;
+    out[6] = static_cast<std::uint8_t>(event.value);
+    out[7] = static_cast<std::uint8_t>(event.value >> 8u);
+  }
+
+  std::uint8_t board_id_ = 0;
+  std::array<Batch, 2> batches_{};
+  CanEventPackerStats stats_{};
+};
+
+struct CanEventUnpackerStats {
+  std::uint32_t frames_received = 0;
+  std::uint32_t events_received = 0;
+  /** @brief Frames missing from a board's sequence (bus errors or a full RX FIFO). */
+  std::uint32_t lost_frame_count = 0;
+  std::uint32_t malformed_frame_count = 0;
+};
+
+/**
+ * @brief Decodes event frames from the other boards. SinkT must provide
+ * void OnRemoteEvent(std::uint8_t board_id, const MusicEvent&). Frames from this board and
+ * non-event identifiers are ignored, so the receiver can share the bus with other traffic.
+ */
+class CanEventUnpacker {
+ public:
+  explicit CanEventUnpacker(std::uint8_t board_id = 0) noexcept : board_id_(board_id) {}
+
+  void Reset() noexcept {
+    for (Source& source : sources_) {
+      source = {};
+    }
+    stats_ = {};
+  }
+
+  /**
+   * @brief Passes the frame's events to the sink in order; returns how many.
+   */
+  template <typename SinkT>
+  std::size_t Unpack(const CanFrame& frame, SinkT& sink) {
+    CanTrafficClass traffic_class = CanTrafficClass::kNote;
+    std::uint8_t board_id = 0;
+    if (!ParseCanEventId(frame.id, traffic_class, board_id) || board_id == board_id_) {
+      return 0;
+    }
+    const std::size_t count = frame.data[1];
+    if (count == 0u || count > kCanEventsPerFrame ||
+        frame.length < kCanEventHeaderBytes + count * kCanEventRecordBytes) {
+      ++stats_.malformed_frame_count;
+      return 0;
+    }
+
+    Source& source = sources_[board_id * 2u + (traffic_class == CanTrafficClass::kNote ? 0u : 1u)];
+    const std::uint8_t sequence = frame.data[0];
+    if (source.seen) {
+      stats_.lost_frame_count += static_cast<std::uint8_t>(sequence - source.next_sequence);
+    }
+    source.seen = true;
+    source.next_sequence = static_cast<std::uint8_t>(sequence + 1u);
+
+    for (std::size_t i = 0; i < count; ++i) {
+      sink.OnRemoteEvent(board_id,
+                         ReadRecord(&frame.data[kCanEventHeaderBytes + i * kCanEventRecordBytes]));
+    }
+    ++stats_.frames_received;
+    stats_.events_received += static_cast<std::uint32_t>(count);
+    return count;
+  }
+
+  const CanEventUnpackerStats& stats() const noexcept {
+    return stats_;
+  }
+
+ private:
+  struct Source {
+    bool seen = false;
+    std::uint8_t next_sequence = 0;
+  };
+
+  static domain::music::MusicEvent ReadRecord(const std::uint8_t* in) noexcept {
+    domain::music::MusicEvent event{};
+    event.timestamp_ticks = static_cast<std::uint32_t>(in[0]) |
+                            (static_cast<std::uint32_t>(in[1]) << 8u) |
+                            (static_cast<std::uint32_t>(in[2]) << 16u) |
+                            (static_cast<std::uint32_t>(in[3]) << 24u);
+    event.type = static_cast<domain::music::MusicEventType>(in[4]);
+    event.number = in[5];
+    event.value = static_cast<std::uint16_t>(in[6] | (in[7] << 8u));
+    return event;
+  }
+
+  std::uint8_t board_id_ = 0;
+  std::array<Source, kCanMaxBoards * 2u> sources_{};
+  CanEventUnpackerStats stats_{};
+};
+
+}  // namespace domain::can
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace domain::can {
+
+inline constexpr std::size_t kCanFdMaxPayloadBytes = 64;
+inline constexpr std::uint32_t kCanStandardIdMask = 0x7FFu;
+
+/**
+ * @brief CAN-FD frame with an 11-bit identifier. length is one of the valid FD payload sizes.
+ * timestamp_ticks is the local time a received frame arrived; unused when sending.
+ */
+struct CanFrame {
+  std::uint32_t id{0};
+  std::uint8_t length{0};
+  std::array<std::uint8_t, kCanFdMaxPayloadBytes> data{};
+  std::uint32_t timestamp_ticks{0};
+};
+
+/**
+ * @brief Smallest CAN-FD payload size (0-8, 12, 16, 20, 24, 32, 48, 64) that holds length bytes.
+ */
+constexpr std::uint8_t CanFdPaddedLength(std::size_t length) noexcept {
+  if (length <= 8u) {
+    return static_cast<std::uint8_t>(length);
+  }
+  if (length <= 24u) {
+    return static_cast<std::uint8_t>((length + 3u) / 4u * 4u);
+  }
+  if (length <= 32u) {
+    return 32u;
+  }
+  if (length <= 48u) {
+    return 48u;
+  }
+  return static_cast<std::uint8_t>(kCanFdMaxPayloadBytes);
+}
+
+static_assert(CanFdPaddedLength(9) == 12u);
+static_assert(CanFdPaddedLength(25) == 32u);
+static_assert(CanFdPaddedLength(58) == 64u);
+
+}  // namespace domain::can
@@ -0,0 +1,208 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "domain/can/can_frame.hpp"
+
+namespace domain::can {
+
+/**
+ * @brief Sync frames use the highest-priority identifier on the bus so they only ever wait for
+ * the frame already in progress. Payload: sequence number, then the master timestamp (u32 LE)
+ * taken just before the frame was queued.
+ */
+inline constexpr std::uint32_t kCanClockSyncId = 0x080u;
+inline constexpr std::uint8_t kCanClockSyncLength = 8;
+
+inline CanFrame MakeClockSyncFrame(std::uint8_t sequence, std::uint32_t master_ticks) noexcept {
+  CanFrame frame{};
+  frame.id = kCanClockSyncId;
+  frame.length = kCanClockSyncLength;
+  frame.data[0] = sequence;
+  frame.data[2] = static_cast<std::uint8_t>(master_ticks);
+  frame.data[3] = static_cast<std::uint8_t>(master_ticks >> 8u);
+  frame.data[4] = static_cast<std::uint8_t>(master_ticks >> 16u);
+  frame.data[5] = static_cast<std::uint8_t>(master_ticks >> 24u);
+  return frame;
+}
+
+/**
+ * @brief Extracts the master timestamp; false if the frame is not a sync frame.
+ */
+inline bool ParseClockSyncFrame(const CanFrame& frame, std::uint32_t& out_master_ticks) noexcept {
+  if ((frame.id & kCanStandardIdMask) != kCanClockSyncId || frame.length < kCanClockSyncLength) {
+    return false;
+  }
+  out_master_ticks = static_cast<std::uint32_t>(frame.data[2]) |
+                     (static_cast<std::uint32_t>(frame.data[3]) << 8u) |
+                     (static_cast<std::uint32_t>(frame.data[4]) << 16u) |
+                     (static_cast<std::uint32_t>(frame.data[5]) << 24u);
+  return true;
+}
+
+struct ClockSyncConfig {
+  /** @brief Syncs per window; the least delayed sync of each window becomes a fit point. */
+  std::size_t window_syncs = 4;
+  /** @brief A fit point this far off the model means the master restarted: start over. */
+  std::uint32_t max_residual_ticks = 5000;
+};
+
+/**
+ * @brief Estimates the master clock from sync frames: master = local + offset + drift * dt.
+ *
+ * A sync is stamped by the master when queued and by this board when its reception starts, so
+ * the observed offset (master - local) is the true offset minus the frame's queueing delay. The
+ * delay is never negative, so the largest observed offset of each window is the least delayed
+ * one. Those points go through a least-squares line fit over the last kHistory windows, which
+ * gives the offset and the drift of this board's clock. Times are compared modulo 2^32, so the
+ * history must span less than half the counter period.
+ */
+template <std::size_t kHistory = 8>
+class ClockSyncEstimator {
+  static_assert(kHistory >= 2u, "kHistory must hold at least two fit points");
+
+ public:
+  explicit ClockSyncEstimator(const ClockSyncConfig& config = {}) noexcept : config_(config) {}
+
+  void Reset() noexcept {
+    count_ = 0;
+    head_ = 0;
+    window_count_ = 0;
+    ref_offset_ = 0;
+    intercept_ticks_ = 0.0;
+    drift_ = 0.0;
+    sync_count_ = 0;
+    restart_count_ = 0;
+  }
+
+  void OnSync(std::uint32_t master_ticks, std::uint32_t local_ticks) noexcept {
+    ++sync_count_;
+    const std::uint32_t observed = master_ticks - local_ticks;
+    if (window_count_ == 0u ||
+        static_cast<std::int32_t>(observed - window_best_.offset_ticks) > 0) {
+      window_best_ = Point{local_ticks, observed};
+    }
+    if (++window_count_ < config_.window_syncs) {
+      return;
+    }
+    window_count_ = 0;
+    AddPoint(window_best_);
+  }
+
+  /** @brief True once the first window is complete; the drift needs two. */
+  bool locked() const noexcept {
+    return count_ != 0u;
+  }
+
+  /** @brief Converts a local timestamp to the master timebase; unchanged while not locked. */
+  std::uint32_t ToMaster(std::uint32_t local_ticks) const noexcept {
+    if (!locked()) {
+      return local_ticks;
+    }
+    return local_ticks + OffsetAt(local_ticks);
+  }
+
+  /** @brief Current master - local offset (modulo 2^32). */
+  std::int32_t offset_ticks() const noexcept {
+    return static_cast<std::int32_t>(OffsetAt(ref_local_));
+  }
+
+  /** @brief Rate of the master clock relative to this one, in parts per billion. */
+  std::int32_t drift_ppb() const noexcept {
+    return Round(drift_ * 1e9);
+  }
+
+  std::uint32_t sync_count() const noexcept {
+    return sync_count_;
+  }
+
+  std::uint32_t restart_count() const noexcept {
+    return restart_count_;
+  }
+
+ private:
+  struct Point {
+    std::uint32_t local_ticks = 0;
+    std::uint32_t offset_ticks = 0;
+  };
+
+  static std::int32_t Round(double value) noexcept {
+    return static_cast<std::int32_t>(value >= 0.0 ? value + 0.5 : value - 0.5);
+  }
+
+  std::uint32_t OffsetAt(std::uint32_t local_ticks) const noexcept {
+    const double dt = static_cast<double>(static_cast<std::int32_t>(local_ticks - ref_local_));
+    return ref_offset_ + static_cast<std::uint32_t>(Round(intercept_ticks_ + drift_ * dt));
+  }
+
+  void AddPoint(const Point& point) noexcept {
+    if (locked()) {
+      const std::int32_t residual =
+          static_cast<std::int32_t>(point.offset_ticks - OffsetAt(point.local_ticks));
+      const std::uint32_t magnitude = static_cast<std::uint32_t>(residual < 0 ? -residual
+                                                                              : residual);
+      if (magnitude > config_.max_residual_ticks) {
+        count_ = 0;
+        head_ = 0;
+        ++restart_count_;
+      }
+    }
+    history_[head_] = point;
+    head_ = (head_ + 1u) % kHistory;
+    if (count_ < kHistory) {
+      ++count_;
+    }
+    Fit(point);
+  }
+
+  /** @brief Least-squares line through the history, relative to the newest point. */
+  void Fit(const Point& newest) noexcept {
+    ref_local_ = newest.local_ticks;
+    ref_offset_ = newest.offset_ticks;
+    intercept_ticks_ = 0.0;
+    drift_ = 0.0;
+    if (count_ < 2u) {
+      return;
+    }
+
+    double sum_x = 0.0;
+    double sum_y = 0.0;
+    double sum_xx = 0.0;
+    double sum_xy = 0.0;
+    for (std::size_t i = 0; i < count_; ++i) {
+      const Point& p = history_[i];
+      const double x = static_cast<double>(static_cast<std::int32_t>(p.local_ticks - ref_local_));
+      const double y = static_cast<double>(static_cast<std::int32_t>(p.offset_ticks - ref_offset_));
+      sum_x += x;
+      sum_y += y;
+      sum_xx += x * x;
+      sum_xy += x * y;
+    }
+    const double n = static_cast<double>(count_);
+    const double denominator = n * sum_xx - sum_x * sum_x;
+    if (denominator <= 0.0) {
+      return;
+    }
+    drift_ = (n * sum_xy - sum_x * sum_y) / denominator;
+    intercept_ticks_ = (sum_y - drift_ * sum_x) / n;
+  }
+
+  ClockSyncConfig config_{};
+  std::array<Point, kHistory> history_{};
+  std::size_t count_ = 0;
+  std::size_t head_ = 0;
+
+  Point window_best_{};
+  std::size_t window_count_ = 0;
+
+  std::uint32_t ref_local_ = 0;
+  std::uint32_t ref_offset_ = 0;
+  double intercept_ticks_ = 0.0;
+  double drift_ = 0.0;
+  std::uint32_t sync_count_ = 0;
+  std::uint32_t restart_count_ = 0;
+};
+
+}  // namespace domain::can
@@ -0,0 +1,154 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "domain/music/music_event.hpp"
+
+namespace domain::midi {
+
+struct JitterBufferConfig {
+  /** @brief Constant delay added to every event timestamp, in timestamp ticks. */
+  std::uint32_t latency_ticks = 3000;
+  /** @brief Releases later than due + tolerance are counted as late. */
+  std::uint32_t late_tolerance_ticks = 100;
+};
+
+struct JitterBufferStats {
+  std::uint32_t released_count = 0;
+  std::uint32_t late_count = 0;
+  std::uint32_t max_late_ticks = 0;
+  std::uint32_t overflow_count = 0;
+};
+
+/**
+ * @brief Holds music events until timestamp + latency so they leave with a constant delay.
+ *
+ * Processing and DMA batching make the time between a strike and its event reaching the output
+ * vary; releasing every event at a fixed offset from its own timestamp trades that variation for
+ * a small constant latency. Events are kept sorted by due time (they normally arrive in order,
+ * so insertion is O(1)). An event released after due + late_tolerance_ticks arrived too late for
+ * its slot and is counted in the statistics.
+ */
+template <std::size_t kCapacity>
+class JitterBuffer {
+  static_assert(kCapacity > 0u, "kCapacity must be > 0");
+
+ public:
+  explicit JitterBuffer(const JitterBufferConfig& config = {}) noexcept : config_(config) {}
+
+  void Reset() noexcept {
+    count_ = 0;
+    stats_ = {};
+  }
+
+  void SetLatency(std::uint32_t latency_ticks) noexcept {
+    config_.latency_ticks = latency_ticks;
+  }
+
+  std::uint32_t latency_ticks() const noexcept {
+    return config_.latency_ticks;
+  }
+
+  /**
+   * @brief Buffers an event; returns false (and counts an overflow) when the buffer is full.
+   */
+  bool Push(const domain::music::MusicEvent& event) noexcept {
+    if (count_ >= kCapacity) {
+      ++stats_.overflow_count;
+      return false;
+    }
+    const std::uint32_t due_ticks = event.timestamp_ticks + config_.latency_ticks;
+    std::size_t index = count_;
+    while (index > 0u && IsBefore(due_ticks, DueTicks(events_[index - 1u]))) {
+      events_[index] = events_[index - 1u];
+      --index;
+    }
+    events_[index] = event;
+    ++count_;
+    return true;
+  }
+
+  /**
+   * @brief Passes every event due at now_ticks to sink.OnReleasedEvent(); returns how many.
+   */
+  template <typename SinkT>
+  std::size_t Release(std::uint32_t now_ticks,
+                      SinkT& sink) noexcept(noexcept(sink.OnReleasedEvent(events_[0]))) {
+    std::size_t released = 0;
+    while (released < count_ && !IsBefore(now_ticks, DueTicks(events_[released]))) {
+      const std::uint32_t late_ticks = now_ticks - DueTicks(events_[released]);
+      if (late_ticks > config_.late_tolerance_ticks) {
+        ++stats_.late_count;
+      }
+      if (late_ticks > stats_.max_late_ticks) {
+        stats_.max_late_ticks = late_ticks;
+      }
+      sink.OnReleasedEvent(events_[released]);
+      ++released;
+    }
+    Discard(released);
+    stats_.released_count += static_cast<std::uint32_t>(released);
+    return released;
+  }
+
+  /**
+   * @brief Passes every buffered event to the sink regardless of its due time.
+   */
+  template <typename SinkT>
+  std::size_t Flush(SinkT& sink) noexcept(noexcept(sink.OnReleasedEvent(events_[0]))) {
+    const std::size_t released = count_;
+    for (std::size_t i = 0; i < count_; ++i) {
+      sink.OnReleasedEvent(events_[i]);
+    }
+    count_ = 0;
+    stats_.released_count += static_cast<std::uint32_t>(released);
+    return released;
+  }
+
+  /**
+   * @brief Due time of the earliest buffered event; false when empty.
+   */
+  bool next_due_ticks(std::uint32_t& out_due_ticks) const noexcept {
+    if (count_ == 0u) {
+      return false;
+    }
+    out_due_ticks = DueTicks(events_[0]);
+    return true;
+  }
+
+  std::size_t size() const noexcept {
+    return count_;
+  }
+
+  const JitterBufferStats& stats() const noexcept {
+    return stats_;
+  }
+
+ private:
+  static bool IsBefore(std::uint32_t a, std::uint32_t b) noexcept {
+    return static_cast<std::int32_t>(a - b) < 0;
+  }
+
+  std::uint32_t DueTicks(const domain::music::MusicEvent& event) const noexcept {
+    return event.timestamp_ticks + config_.latency_ticks;
+  }
+
+  void Discard(std::size_t released) noexcept {
+    if (released == 0u) {
+      return;
+    }
+    for (std::size_t i = released; i < count_; ++i) {
+      events_[i - released] = events_[i];
+    }
+    count_ -= released;
+  }
+
+  JitterBufferConfig config_{};
+  std::array<domain::music::MusicEvent, kCapacity> events_{};
+  std::size_t count_ = 0;
+  JitterBufferStats stats_{};
+};
+
+}  // namespace domain::midi
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "domain/music/music_event.hpp"
+#include "domain/music/value_scaling.hpp"
+
+namespace domain::midi {
+
+// A 14-bit controller change is the largest message: status, MSB pair, LSB pair.
+inline constexpr std::size_t kMidi1MaxEncodedBytes = 5;
+
+inline constexpr std::uint8_t kMidi1NoteOffStatus = 0x80;
+inline constexpr std::uint8_t kMidi1NoteOnStatus = 0x90;
+inline constexpr std::uint8_t kMidi1PolyPressureStatus = 0xA0;
+inline constexpr std::uint8_t kMidi1ControlChangeStatus = 0xB0;
+
+struct Midi1EncoderConfig {
+  std::uint8_t channel = 0;
+  bool use_running_status = true;
+  bool note_off_as_note_on = true;
+};
+
+/**
+ * @brief Encodes MusicEvent into MIDI 1.0 channel voice messages for one serial link.
+ *
+ * With running status, the status byte is omitted when it equals the previous one, so a chord
+ * costs 2 bytes per note after the first. The 16-bit note-on velocity is narrowed to its top 7
+ * bits (never 0, which would read as a note-off). Note-off is sent as note-on with velocity 0 by
+ * default, which lets releases share the note-on status. A 14-bit controller (number < 32) is
+ * sent as the MSB on the controller and the LSB on controller + 32; for other numbers only the
+ * MSB is sent.
+ * ResetRunningStatus() must be called whenever the receiver may have lost the stream state
+ * (link enabled, rerouted, bytes dropped).
+ */
+class Midi1Encoder {
+ public:
+  explicit Midi1Encoder(const Midi1EncoderConfig& config = Midi1EncoderConfig{}) noexcept
+      : config_(config) {}
+
+  void ResetRunningStatus() noexcept {
+    running_status_ = 0;
+  }
+
+  void SetChannel(std::uint8_t channel) noexcept {
+    config_.channel = channel;
+    ResetRunningStatus();
+  }
+
+  std::uint8_t channel() const noexcept {
+    return config_.channel;
+  }
+
+  /**
+   * @brief Writes the message bytes to out (at least kMidi1MaxEncodedBytes long) and returns
+   * their count, 0 for an unknown event type.
+   */
+  std::size_t Encode(const domain::music::MusicEvent& event, std::uint8_t* out) noexcept {
+    if (out == nullptr) {
+      return 0;
+    }
+    std::size_t length = 0;
+    const std::uint8_t number = DataByte(event.number);
+
+    switch (event.type) {
+      case domain::music::MusicEventType::kNoteOn:
+        WriteStatus(kMidi1NoteOnStatus, out, length);
+        out[length++] = number;
+        out[length++] = NoteOnVelocity(event.value);
+        break;
+
+      case domain::music::MusicEventType::kNoteOff:
+        if (config_.note_off_as_note_on) {
+          WriteStatus(kMidi1NoteOnStatus, out, length);
+          out[length++] = number;
+          out[length++] = 0u;
+        } else {
+          WriteStatus(kMidi1NoteOffStatus, out, length);
+          out[length++] = number;
+          out[length++] = 0x40u;
+        }
+        break;
+
+      case domain::music::MusicEventType::kPolyPressure:
+        WriteStatus(kMidi1PolyPressureStatus, out, length);
+        out[length++] = number;
+        out[length++] = DataByte(event.value);
+        break;
+
+      case domain::music::MusicEventType::kControlChange:
+        WriteStatus(kMidi1ControlChangeStatus, out, length);
+        out[length++] = number;
+        out[length++] = DataByte(event.value);
+        break;
+
+      case domain::music::MusicEventType::kControlChange14Bit:
+        WriteStatus(kMidi1ControlChangeStatus, out, length);
+        out[length++] = number;
+        out[length++] = DataByte(static_cast<std::uint16_t>(event.value >> 7u));
+        if (number < 32u) {
+          out[length++] = static_cast<std::uint8_t>(number + 32u);
+          out[length++] = DataByte(event.value);
+        }
+        break;
+    }
+    return length;
+  }
+
+ private:
+  static std::uint8_t DataByte(std::uint16_t value) noexcept {
+    return static_cast<std::uint8_t>(value & 0x7Fu);
+  }
+
+  static std::uint8_t NoteOnVelocity(std::uint16_t velocity) noexcept {
+    const std::uint32_t narrowed = domain::music::ScaleDown(velocity, 16u, 7u);
+    return narrowed == 0u ? 1u : static_cast<std::uint8_t>(narrowed);
+  }
+
+  void WriteStatus(std::uint8_t message_status, std::uint8_t* out, std::size_t& length) noexcept {
+    const std::uint8_t status =
+        static_cast<std::uint8_t>(message_status | (config_.channel & 0x0Fu));
+    if (config_.use_running_status && status == running_status_) {
+      return;
+    }
+    out[length++] = status;
+    running_status_ = status;
+  }
+
+  Midi1EncoderConfig config_{};
+  std::uint8_t running_status_ = 0;
+};
+
+}  // namespace domain::midi
@@ -0,0 +1,221 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "domain/music/music_event.hpp"
+
+namespace domain::midi {
+
+/**
+ * @brief Link model of the scheduler, in timestamp ticks.
+ * The defaults describe a 31250 baud MIDI 1.0 link (10 bits per byte) with 1 MHz ticks, polled
+ * every millisecond.
+ */
+struct MidiOutputSchedulerConfig {
+  std::uint32_t ticks_per_byte = 320;
+  /** @brief How far ahead of the wire bytes may be handed to the UART. */
+  std::uint32_t max_backlog_ticks = 1000;
+};
+
+/**
+ * @brief Delay between an event's timestamp and the moment its first byte reaches the wire.
+ */
+struct MidiQueueDelayStats {
+  std::uint32_t count = 0;
+  std::uint32_t max_ticks = 0;
+  std::uint64_t total_ticks = 0;
+
+  void Add(std::uint32_t delay_ticks) noexcept {
+    ++count;
+    total_ticks += delay_ticks;
+    if (delay_ticks > max_ticks) {
+      max_ticks = delay_ticks;
+    }
+  }
+
+  std::uint32_t mean_ticks() const noexcept {
+    if (count == 0u) {
+      return 0;
+    }
+    return static_cast<std::uint32_t>(total_ticks / count);
+  }
+};
+
+/**
+ * @brief Orders music events for a bandwidth-limited MIDI link.
+ *
+ * Note on/off events wait in a lossless FIFO and always go first. Controller and pressure
+ * events are coalesced: each controller number and each key holds only its latest pending value,
+ * and the pending slots are served in order of first arrival.
+ *
+ * Service() models the link as a byte budget: events are handed to the sink only while the
+ * bytes already sent finish within max_backlog_ticks, so the UART never holds a long backlog
+ * of controller traffic in front of a note. The sink reports how many bytes each event took.
+ */
+template <std::size_t kNoteCapacity>
+class MidiOutputScheduler {
+  static_assert(kNoteCapacity > 0u, "kNoteCapacity must be > 0");
+
+ public:
+  explicit MidiOutputScheduler(const MidiOutputSchedulerConfig& config = {}) noexcept
+      : config_(config) {}
+
+  void Reset() noexcept {
+    note_head_ = 0;
+    note_count_ = 0;
+    order_head_ = 0;
+    order_count_ = 0;
+    for (auto& slot : slots_) {
+      slot.pending = false;
+    }
+    link_started_ = false;
+    link_free_at_ticks_ = 0;
+    note_delay_ = {};
+    controller_delay_ = {};
+    coalesced_count_ = 0;
+    dropped_note_count_ = 0;
+  }
+
+  /**
+   * @brief Queues an event; returns false if a note was dropped because the note FIFO is full.
+   */
+  bool Push(const domain::music::MusicEvent& event) noexcept {
+    if (domain::music::IsNoteEvent(event.type)) {
+      if (note_count_ >= kNoteCapacity) {
+        ++dropped_note_count_;
+        return false;
+      }
+      notes_[(note_head_ + note_count_) % kNoteCapacity] = event;
+      ++note_count_;
+      return true;
+    }
+
+    const std::size_t index = SlotIndex(event);
+    Slot& slot = slots_[index];
+    if (slot.pending) {
+      ++coalesced_count_;
+    } else {
+      slot.pending = true;
+      order_[(order_head_ + order_count_) % kSlotCount] = static_cast<std::uint8_t>(index);
+      ++order_count_;
+    }
+    slot.event = event;
+    return true;
+  }
+
+  /**
+   * @brief Sends pending events that fit the link budget at now_ticks; returns how many.
+   * SinkT must provide std::size_t OnScheduledEvent(const MusicEvent&) returning the bytes sent.
+   */
+  template <typename SinkT>
+  std::size_t Service(std::uint32_t now_ticks, SinkT& sink) {
+    if (!link_started_ || static_cast<std::int32_t>(link_free_at_ticks_ - now_ticks) < 0) {
+      link_free_at_ticks_ = now_ticks;
+      link_started_ = true;
+    }
+
+    std::size_t sent = 0;
+    domain::music::MusicEvent event{};
+    while (link_free_at_ticks_ - now_ticks <= config_.max_backlog_ticks && PopNext(event)) {
+      const std::int32_t delay_ticks =
+          static_cast<std::int32_t>(link_free_at_ticks_ - event.timestamp_ticks);
+      const std::uint32_t delay = delay_ticks > 0 ? static_cast<std::uint32_t>(delay_ticks) : 0u;
+      if (domain::music::IsNoteEvent(event.type)) {
+        note_delay_.Add(delay);
+      } else {
+        controller_delay_.Add(delay);
+      }
+
+      const std::size_t bytes = sink.OnScheduledEvent(event);
+      link_free_at_ticks_ += static_cast<std::uint32_t>(bytes) * config_.ticks_per_byte;
+      ++sent;
+    }
+    return sent;
+  }
+
+  bool has_pending() const noexcept {
+    return note_count_ != 0u || order_count_ != 0u;
+  }
+
+  std::size_t pending_note_count() const noexcept {
+    return note_count_;
+  }
+
+  std::size_t pending_controller_count() const noexcept {
+    return order_count_;
+  }
+
+  const MidiQueueDelayStats& note_delay() const noexcept {
+    return note_delay_;
+  }
+
+  const MidiQueueDelayStats& controller_delay() const noexcept {
+    return controller_delay_;
+  }
+
+  std::uint32_t coalesced_count() const noexcept {
+    return coalesced_count_;
+  }
+
+  std::uint32_t dropped_note_count() const noexcept {
+    return dropped_note_count_;
+  }
+
+ private:
+  static constexpr std::size_t kControllerSlots = 128u;
+  static constexpr std::size_t kSlotCount = kControllerSlots + 128u;
+
+  struct Slot {
+    domain::music::MusicEvent event{};
+    bool pending = false;
+  };
+
+  static std::size_t SlotIndex(const domain::music::MusicEvent& event) noexcept {
+    const std::size_t number = event.number & 0x7Fu;
+    if (event.type == domain::music::MusicEventType::kPolyPressure) {
+      return kControllerSlots + number;
+    }
+    return number;
+  }
+
+  bool PopNext(domain::music::MusicEvent& out_event) noexcept {
+    if (note_count_ != 0u) {
+      out_event = notes_[note_head_];
+      note_head_ = (note_head_ + 1u) % kNoteCapacity;
+      --note_count_;
+      return true;
+    }
+    if (order_count_ != 0u) {
+      Slot& slot = slots_[order_[order_head_]];
+      order_head_ = (order_head_ + 1u) % kSlotCount;
+      --order_count_;
+      out_event = slot.event;
+      slot.pending = false;
+      return true;
+    }
+    return false;
+  }
+
+  MidiOutputSchedulerConfig config_{};
+
+  std::array<domain::music::MusicEvent, kNoteCapacity> notes_{};
+  std::size_t note_head_ = 0;
+  std::size_t note_count_ = 0;
+
+  std::array<Slot, kSlotCount> slots_{};
+  std::array<std::uint8_t, kSlotCount> order_{};
+  std::size_t order_head_ = 0;
+  std::size_t order_count_ = 0;
+
+  bool link_started_ = false;
+  std::uint32_t link_free_at_ticks_ = 0;
+
+  MidiQueueDelayStats note_delay_{};
+  MidiQueueDelayStats controller_delay_{};
+  std::uint32_t coalesced_count_ = 0;
+  std::uint32_t dropped_note_count_ = 0;
+};
+
+}  // namespace domain::midi
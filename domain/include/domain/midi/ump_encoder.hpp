@@ -0,0 +1,163 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "domain/music/music_event.hpp"
+#include "domain/music/value_scaling.hpp"
+
+namespace domain::midi {
+
+// A JR timestamp (1 word) followed by a MIDI 2.0 channel voice message (2 words).
+inline constexpr std::size_t kUmpMaxEncodedWords = 3;
+
+inline constexpr std::uint8_t kUmpUtilityMessageType = 0x0;
+inline constexpr std::uint8_t kUmpMidi2ChannelVoiceMessageType = 0x4;
+inline constexpr std::uint8_t kUmpJrTimestampStatus = 0x2;
+
+inline constexpr std::uint8_t kMidi2NoteOffStatus = 0x8;
+inline constexpr std::uint8_t kMidi2NoteOnStatus = 0x9;
+inline constexpr std::uint8_t kMidi2PolyPressureStatus = 0xA;
+inline constexpr std::uint8_t kMidi2ControlChangeStatus = 0xB;
+
+/**
+ * @brief JR timestamps count 1/31250 s periods: 32 ticks of the 1 MHz timestamp counter.
+ */
+struct UmpEncoderConfig {
+  std::uint8_t group = 0;
+  std::uint8_t channel = 0;
+  bool emit_jr_timestamps = true;
+  std::uint32_t ticks_per_jr_tick = 32;
+};
+
+/**
+ * @brief Encodes MusicEvent into Universal MIDI Packets (MIDI 2.0 protocol).
+ *
+ * Notes carry their 16-bit velocity unchanged; 7-bit pressure and controllers and 14-bit
+ * controllers are widened to 32 bits with the min-center-max rule. Each message is optionally
+ * preceded by a JR timestamp (groupless utility message) holding the low 16 bits of the event
+ * time in 1/31250 s units. Output is host-order 32-bit words, written most significant byte
+ * first when sent on a byte link.
+ */
+class UmpEncoder {
+ public:
+  explicit UmpEncoder(const UmpEncoderConfig& config = UmpEncoderConfig{}) noexcept
+      : config_(config) {}
+
+  void SetChannel(std::uint8_t channel) noexcept {
+    config_.channel = channel;
+  }
+
+  std::uint8_t channel() const noexcept {
+    return config_.channel;
+  }
+
+  /**
+   * @brief Writes the packet words to out (at least kUmpMaxEncodedWords long) and returns their
+   * count, 0 for an unknown event type.
+   */
+  std::size_t Encode(const domain::music::MusicEvent& event, std::uint32_t* out) const noexcept {
+    if (out == nullptr) {
+      return 0;
+    }
+
+    std::uint8_t status = 0;
+    std::uint32_t data = 0;
+    const std::uint8_t index = static_cast<std::uint8_t>(event.number & 0x7Fu);
+    switch (event.type) {
+      case domain::music::MusicEventType::kNoteOn:
+        status = kMidi2NoteOnStatus;
+        data = static_cast<std::uint32_t>(event.value) << 16u;
+        break;
+      case domain::music::MusicEventType::kNoteOff:
+        status = kMidi2NoteOffStatus;
+        data = static_cast<std::uint32_t>(event.value) << 16u;
+        break;
+      case domain::music::MusicEventType::kPolyPressure:
+        status = kMidi2PolyPressureStatus;
+        data = domain::music::ScaleUp(event.value, 7u, 32u);
+        break;
+      case domain::music::MusicEventType::kControlChange:
+        status = kMidi2ControlChangeStatus;
+        data = domain::music::ScaleUp(event.value, 7u, 32u);
+        break;
+      case domain::music::MusicEventType::kControlChange14Bit:
+        status = kMidi2ControlChangeStatus;
+        data = domain::music::ScaleUp(event.value, 14u, 32u);
+        break;
+      default:
+        return 0;
+    }
+
+    std::size_t length = 0;
+    if (config_.emit_jr_timestamps) {
+      out[length++] = JrTimestamp(event.timestamp_ticks);
+    }
+    // Notes: byte 4 is the attribute type (0, none); word 2 low half the attribute data.
+    out[length++] = (static_cast<std::uint32_t>(kUmpMidi2ChannelVoiceMessageType) << 28u) |
+                    (static_cast<std::uint32_t>(config_.group & 0x0Fu) << 24u) |
+                    (static_cast<std::uint32_t>(status) << 20u) |
+                    (static_cast<std::uint32_t>(config_.channel & 0x0Fu) << 16u) |
+                    (static_cast<std::uint32_t>(index) << 8u);
+    out[length++] = data;
+    return length;
+  }
+
+  std::uint32_t JrTimestamp(std::uint32_t timestamp_ticks) const noexcept {
+    const std::uint32_t jr_ticks =
+        config_.ticks_per_jr_tick == 0u ? timestamp_ticks
+                                        : timestamp_ticks / config_.ticks_per_jr_tick;
+    return (static_cast<std::uint32_t>(kUmpUtilityMessageType) << 28u) |
+           (static_cast<std::uint32_t>(kUmpJrTimestampStatus) << 20u) | (jr_ticks & 0xFFFFu);
+  }
+
+ private:
+  UmpEncoderConfig config_{};
+};
+
+/**
+ * @brief Fixed-capacity, word-aligned packet buffer that can be handed to a DMA as is.
+ * Packets are appended whole or not at all.
+ */
+template <std::size_t kCapacityWords>
+class UmpWordBuffer {
+  static_assert(kCapacityWords >= kUmpMaxEncodedWords,
+                "kCapacityWords must hold at least one encoded event");
+
+ public:
+  bool Append(const UmpEncoder& encoder, const domain::music::MusicEvent& event) noexcept {
+    std::uint32_t packet[kUmpMaxEncodedWords]{};
+    const std::size_t length = encoder.Encode(event, packet);
+    if (length == 0u || size_ + length > kCapacityWords) {
+      return false;
+    }
+    for (std::size_t i = 0; i < length; ++i) {
+      words_[size_ + i] = packet[i];
+    }
+    size_ += length;
+    return true;
+  }
+
+  void Clear() noexcept {
+    size_ = 0;
+  }
+
+  const std::uint32_t* data() const noexcept {
+    return words_.data();
+  }
+
+  std::size_t size() const noexcept {
+    return size_;
+  }
+
+  std::size_t size_bytes() const noexcept {
+    return size_ * sizeof(std::uint32_t);
+  }
+
+ private:
+  std::array<std::uint32_t, kCapacityWords> words_{};
+  std::size_t size_ = 0;
+};
+
+}  // namespace domain::midi
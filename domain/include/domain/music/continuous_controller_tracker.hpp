@@ -0,0 +1,124 @@
+#pragma once
+
+#include <cstdint>
+
+#include "domain/music/controller_event.hpp"
+#include "domain/music/types.hpp"
+
+namespace domain::music {
+
+struct ContinuousControllerConfig {
+  ControllerNumber controller = kControllerSustainPedal;
+  ControllerResolution resolution = ControllerResolution::k7Bit;
+  float input_at_minimum = 0.0f;
+  float input_at_maximum = 0.4f;
+  float deadband_steps = 0.5f;
+  std::uint32_t min_update_interval_ticks = 5'000;
+  std::uint32_t max_update_interval_ticks = 0;
+};
+
+/**
+ * @brief Maps a sensor value to a 7-bit or 14-bit controller value and emits only meaningful
+ * changes.
+ *
+ * The value is scaled linearly from [input_at_minimum, input_at_maximum] to the controller range
+ * (either bound may be the larger one). A new value is emitted when the scaled input moves more
+ * than deadband_steps beyond the rounding boundary of the last emitted value, or reaches either
+ * end of the range, and at most once per min_update_interval_ticks. When max_update_interval_ticks
+ * is not 0, the last value is re-sent after that long without any emission.
+ * SinkT must provide OnControllerEvent(const ControllerEvent&).
+ */
+class ContinuousControllerTracker {
+ public:
+  explicit ContinuousControllerTracker(const ContinuousControllerConfig& config) noexcept
+      : config_(config),
+        max_value_(config.resolution == ControllerResolution::k14Bit ? 16383.0f : 127.0f) {}
+
+  void Reset() noexcept {
+    has_value_ = false;
+    value_ = 0;
+    last_emit_timestamp_ticks_ = 0;
+  }
+
+  bool has_value() const noexcept {
+    return has_value_;
+  }
+
+  std::uint16_t value() const noexcept {
+    return value_;
+  }
+
+  template <typename SinkT>
+  void Update(float input, std::uint32_t timestamp_ticks, SinkT& sink) noexcept {
+    const float level = ScaleToControllerRange(input);
+    const std::uint16_t quantized_value = static_cast<std::uint16_t>(level + 0.5f);
+
+    if (!has_value_) {
+      Emit(quantized_value, timestamp_ticks, sink);
+      return;
+    }
+
+    const std::uint32_t elapsed_ticks =
+        static_cast<std::uint32_t>(timestamp_ticks - last_emit_timestamp_ticks_);
+    if (elapsed_ticks < config_.min_update_interval_ticks) {
+      return;
+    }
+
+    if (quantized_value != value_ && IsOutsideDeadband(level, quantized_value)) {
+      Emit(quantized_value, timestamp_ticks, sink);
+      return;
+    }
+
+    if (config_.max_update_interval_ticks != 0u &&
+        elapsed_ticks >= config_.max_update_interval_ticks) {
+      Emit(value_, timestamp_ticks, sink);
+    }
+  }
+
+ private:
+  float ScaleToControllerRange(float input) const noexcept {
+    const float span = config_.input_at_maximum - config_.input_at_minimum;
+    if (span == 0.0f) {
+      return 0.0f;
+    }
+    const float normalized = (input - config_.input_at_minimum) / span;
+    if (normalized <= 0.0f) {
+      return 0.0f;
+    }
+    if (normalized >= 1.0f) {
+      return max_value_;
+    }
+    return normalized * max_value_;
+  }
+
+  bool IsOutsideDeadband(float level, std::uint16_t quantized_value) const noexcept {
+    if (quantized_value == 0u || static_cast<float>(quantized_value) == max_value_) {
+      return true;
+    }
+    const float distance = level - static_cast<float>(value_);
+    const float magnitude = distance < 0.0f ? -distance : distance;
+    return magnitude >= 0.5f + config_.deadband_steps;
+  }
+
+  template <typename SinkT>
+  void Emit(std::uint16_t value, std::uint32_t timestamp_ticks, SinkT& sink) noexcept {
+    value_ = value;
+    has_value_ = true;
+    last_emit_timestamp_ticks_ = timestamp_ticks;
+
+    ControllerEvent event{};
+    event.controller = config_.controller;
+    event.resolution = config_.resolution;
+    event.value = value;
+    event.timestamp_ticks = timestamp_ticks;
+    sink.OnControllerEvent(event);
+  }
+
+  ContinuousControllerConfig config_{};
+  float max_value_ = 127.0f;
+  bool has_value_ = false;
+  std::uint16_t value_ = 0;
+  std::uint32_t last_emit_timestamp_ticks_ = 0;
+};
+
+}  // namespace domain::music
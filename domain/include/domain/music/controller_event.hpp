@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstdint>
+
+#include "domain/music/types.hpp"
+
+namespace domain::music {
+
+enum class ControllerResolution : std::uint8_t {
+  k7Bit = 0,
+  k14Bit = 1,
+};
+
+/**
+ * @brief Controller value change. For 14-bit controllers, value holds MSB << 7 | LSB and the
+ * LSB is sent on controller + 32.
+ */
+struct ControllerEvent {
+  ControllerNumber controller{0};
+  ControllerResolution resolution{ControllerResolution::k7Bit};
+  std::uint16_t value{0};
+  std::uint32_t timestamp_ticks{0};
+};
+
+}  // namespace domain::music
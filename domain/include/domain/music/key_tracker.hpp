@@ -0,0 +1,222 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "domain/music/note_event.hpp"
+#include "domain/music/types.hpp"
+#include "domain/music/velocity_curve.hpp"
+#include "domain/signal/detectors/crossing_detector.hpp"
+
+namespace domain::music {
+
+enum class KeyState : std::uint8_t {
+  kRest = 0,
+  kTravelling = 1,
+  kStruck = 2,
+  kReleased = 3,
+};
+
+/**
+ * @brief Key positions (in processed signal units, 0 at rest) and velocity timing.
+ *
+ * travel < repetition < strike. Velocity is derived from the time taken to go from travel to
+ * strike (or from repetition to strike for a re-strike, scaled to the full distance).
+ */
+struct KeyTrackerConfig {
+  float travel_threshold = 0.05f;
+  float repetition_threshold = 0.2f;
+  float strike_threshold = 0.35f;
+  float hysteresis = 0.01f;
+};
+
+inline constexpr std::size_t kDefaultVelocityCurveEntryCount = 256;
+inline constexpr VelocityCurve<kDefaultVelocityCurveEntryCount> kDefaultVelocityCurve(
+    2'000.0f, 100'000.0f,
+    MakeLinearVelocityTable<kDefaultVelocityCurveEntryCount>(2'000.0, 100'000.0));
+
+/**
+ * @brief Per-key action state machine turning key positions into note events.
+ *
+ * rest -> travelling (travel threshold crossed) -> struck (strike threshold crossed, note-on)
+ * -> released (key back above the repetition threshold, note still sounding). From released, a
+ * new descent through repetition then strike re-strikes the note (note-off + note-on) without
+ * going back to rest; going back above the travel threshold emits the note-off.
+ * Each Update() is O(1) and allocation-free; SinkT must provide OnNoteEvent(const NoteEvent&).
+ * The velocity curve is referenced, not copied, so it can be reloaded at runtime.
+ */
+template <std::size_t kKeyCount,
+          typename VelocityCurveT = VelocityCurve<kDefaultVelocityCurveEntryCount>>
+class KeyTracker {
+  static_assert(kKeyCount > 0u, "kKeyCount must be > 0");
+
+ public:
+  KeyTracker(const KeyTrackerConfig& config, const VelocityCurveT& velocity_curve,
+             NoteNumber first_note) noexcept
+      : config_(config), velocity_curve_(velocity_curve), first_note_(first_note) {
+    Reset();
+  }
+
+  void Reset() noexcept {
+    for (Key& key : keys_) {
+      key = Key(config_);
+    }
+  }
+
+  KeyState state(std::size_t key_index) const noexcept {
+    if (key_index >= kKeyCount) {
+      return KeyState::kRest;
+    }
+    return keys_[key_index].state;
+  }
+
+  template <typename SinkT>
+  void Update(std::size_t key_index, float position, std::uint32_t timestamp_ticks,
+              SinkT& sink) noexcept {
+    if (key_index >= kKeyCount) {
+      return;
+    }
+    Key& key = keys_[key_index];
+    const NoteNumber note = static_cast<NoteNumber>(first_note_ + key_index);
+
+    signal::detectors::CrossingEvent travel_event{};
+    signal::detectors::CrossingEvent repetition_event{};
+    signal::detectors::CrossingEvent strike_event{};
+    const bool travel_crossed = key.travel.Update(position, timestamp_ticks, travel_event);
+    const bool repetition_crossed =
+        key.repetition.Update(position, timestamp_ticks, repetition_event);
+    const bool strike_crossed = key.strike.Update(position, timestamp_ticks, strike_event);
+
+    const bool travel_rising = travel_crossed && IsRising(travel_event);
+    const bool travel_falling = travel_crossed && !IsRising(travel_event);
+    const bool repetition_rising = repetition_crossed && IsRising(repetition_event);
+    const bool repetition_falling = repetition_crossed && !IsRising(repetition_event);
+    const bool strike_rising = strike_crossed && IsRising(strike_event);
+
+    switch (key.state) {
+      case KeyState::kRest:
+        if (travel_rising) {
+          key.travel_start = travel_event.time;
+          key.state = KeyState::kTravelling;
+          if (strike_rising) {
+            Strike(key, note, strike_event, full_distance(), sink);
+          }
+        }
+        break;
+
+      case KeyState::kTravelling:
+        if (strike_rising) {
+          Strike(key, note, strike_event, full_distance(), sink);
+        } else if (travel_falling) {
+          key.state = KeyState::kRest;
+        }
+        break;
+
+      case KeyState::kStruck:
+        if (travel_falling) {
+          Release(key, note, travel_event, sink);
+        } else if (repetition_falling) {
+          key.state = KeyState::kReleased;
+          key.has_repetition_start = false;
+        }
+        break;
+
+      case KeyState::kReleased:
+        if (travel_falling) {
+          Release(key, note, travel_event, sink);
+          break;
+        }
+        if (repetition_rising) {
+          key.travel_start = repetition_event.time;
+          key.has_repetition_start = true;
+        }
+        if (strike_rising && key.has_repetition_start) {
+          EmitNoteOff(note, strike_event.time.ticks, sink);
+          Strike(key, note, strike_event, repetition_distance(), sink);
+        }
+        break;
+    }
+  }
+
+  template <typename SinkT>
+  void Scan(const float* positions, const std::uint32_t* timestamps_ticks, SinkT& sink) noexcept {
+    if (positions == nullptr || timestamps_ticks == nullptr) {
+      return;
+    }
+    for (std::size_t key_index = 0; key_index < kKeyCount; ++key_index) {
+      Update(key_index, positions[key_index], timestamps_ticks[key_index], sink);
+    }
+  }
+
+ private:
+  struct Key {
+    Key() noexcept : Key(KeyTrackerConfig{}) {}
+
+    explicit Key(const KeyTrackerConfig& config) noexcept
+        : travel(config.travel_threshold, config.travel_threshold - config.hysteresis),
+          repetition(config.repetition_threshold, config.repetition_threshold - config.hysteresis),
+          strike(config.strike_threshold, config.strike_threshold - config.hysteresis) {}
+
+    signal::detectors::CrossingDetector travel;
+    signal::detectors::CrossingDetector repetition;
+    signal::detectors::CrossingDetector strike;
+    signal::detectors::CrossingTime travel_start{};
+    bool has_repetition_start = false;
+    KeyState state = KeyState::kRest;
+  };
+
+  static bool IsRising(const signal::detectors::CrossingEvent& event) noexcept {
+    return event.direction == signal::detectors::CrossingDirection::kRising;
+  }
+
+  float full_distance() const noexcept {
+    return config_.strike_threshold - config_.travel_threshold;
+  }
+
+  float repetition_distance() const noexcept {
+    return config_.strike_threshold - config_.repetition_threshold;
+  }
+
+  template <typename SinkT>
+  void Strike(Key& key, NoteNumber note, const signal::detectors::CrossingEvent& strike_event,
+              float travelled_distance, SinkT& sink) noexcept {
+    const float travel_ticks = signal::detectors::ElapsedTicks(key.travel_start, strike_event.time);
+    const float full_distance_travel_ticks =
+        travelled_distance > 0.0f ? travel_ticks * full_distance() / travelled_distance
+                                  : travel_ticks;
+    NoteEvent event{};
+    event.type = NoteEventType::kNoteOn;
+    event.note = note;
+    event.velocity = velocity_curve_.Lookup(full_distance_travel_ticks);
+    event.velocity_high_resolution =
+        velocity_curve_.LookupHighResolution(full_distance_travel_ticks);
+    event.timestamp_ticks = strike_event.time.ticks;
+    sink.OnNoteEvent(event);
+    key.state = KeyState::kStruck;
+  }
+
+  template <typename SinkT>
+  void Release(Key& key, NoteNumber note, const signal::detectors::CrossingEvent& travel_event,
+               SinkT& sink) noexcept {
+    EmitNoteOff(note, travel_event.time.ticks, sink);
+    key.state = KeyState::kRest;
+    key.has_repetition_start = false;
+  }
+
+  template <typename SinkT>
+  static void EmitNoteOff(NoteNumber note, std::uint32_t timestamp_ticks, SinkT& sink) noexcept {
+    NoteEvent event{};
+    event.type = NoteEventType::kNoteOff;
+    event.note = note;
+    event.velocity = 0;
+    event.timestamp_ticks = timestamp_ticks;
+    sink.OnNoteEvent(event);
+  }
+
+  KeyTrackerConfig config_{};
+  const VelocityCurveT& velocity_curve_;
+  NoteNumber first_note_ = 0;
+  Key keys_[kKeyCount]{};
+};
+
+}  // namespace domain::music
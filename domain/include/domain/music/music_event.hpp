@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstdint>
+
+#include "domain/music/controller_event.hpp"
+#include "domain/music/note_event.hpp"
+#include "domain/music/pressure_event.hpp"
+#include "domain/music/types.hpp"
+
+namespace domain::music {
+
+enum class MusicEventType : std::uint8_t {
+  kNoteOn = 0,
+  kNoteOff = 1,
+  kControlChange = 2,
+  kControlChange14Bit = 3,
+  kPolyPressure = 4,
+};
+
+/**
+ * @brief Compact (8 bytes) timestamped event passed from the detection context to the output.
+ * number is the note or controller number, value the velocity (HighResolutionVelocity, 16 bits),
+ * controller value (7 or 14 bits) or pressure (7 bits).
+ */
+struct MusicEvent {
+  std::uint32_t timestamp_ticks{0};
+  MusicEventType type{MusicEventType::kNoteOn};
+  std::uint8_t number{0};
+  std::uint16_t value{0};
+};
+
+static_assert(sizeof(MusicEvent) == 8u, "MusicEvent must stay 8 bytes");
+
+inline bool IsNoteEvent(MusicEventType type) noexcept {
+  return type == MusicEventType::kNoteOn || type == MusicEventType::kNoteOff;
+}
+
+inline MusicEvent ToMusicEvent(const NoteEvent& event) noexcept {
+  MusicEvent out{};
+  out.timestamp_ticks = event.timestamp_ticks;
+  out.type = event.type == NoteEventType::kNoteOn ? MusicEventType::kNoteOn
+                                                  : MusicEventType::kNoteOff;
+  out.number = event.note;
+  out.value = event.velocity_high_resolution;
+  return out;
+}
+
+inline MusicEvent ToMusicEvent(const ControllerEvent& event) noexcept {
+  MusicEvent out{};
+  out.timestamp_ticks = event.timestamp_ticks;
+  out.type = event.resolution == ControllerResolution::k14Bit ? MusicEventType::kControlChange14Bit
+                                                              : MusicEventType::kControlChange;
+  out.number = event.controller;
+  out.value = event.value;
+  return out;
+}
+
+inline MusicEvent ToMusicEvent(const PressureEvent& event) noexcept {
+  MusicEvent out{};
+  out.timestamp_ticks = event.timestamp_ticks;
+  out.type = MusicEventType::kPolyPressure;
+  out.number = event.note;
+  out.value = event.pressure;
+  return out;
+}
+
+}  // namespace domain::music
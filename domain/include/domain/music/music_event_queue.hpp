@@ -0,0 +1,211 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "domain/music/controller_event.hpp"
+#include "domain/music/music_event.hpp"
+#include "domain/music/note_event.hpp"
+#include "domain/music/pressure_event.hpp"
+
+namespace domain::music {
+
+/**
+ * @brief Wait-free single-producer / single-consumer queue of MusicEvent.
+ *
+ * Note events and controller/pressure events go to separate rings so that controller traffic can
+ * never push a note out:
+ * - the note ring is lossless while it has room; a note pushed into a full ring is dropped;
+ * - the controller ring overwrites its oldest entry when full. Each slot carries a sequence number
+ *   so the consumer detects entries overwritten before or while it reads them and skips them.
+ * TryPop() returns the oldest event (by timestamp) of the two ring heads, notes first on ties.
+ * Push() and the On*Event() sink adapters run in the producer context only, TryPop() in the
+ * consumer context only; both are allocation-free and complete in a bounded number of steps.
+ */
+template <std::size_t kNoteCapacity, std::size_t kControllerCapacity>
+class MusicEventQueue {
+  static_assert(kNoteCapacity > 0u && (kNoteCapacity & (kNoteCapacity - 1u)) == 0u,
+                "kNoteCapacity must be a power of two");
+  static_assert(kControllerCapacity > 0u &&
+                    (kControllerCapacity & (kControllerCapacity - 1u)) == 0u,
+                "kControllerCapacity must be a power of two");
+
+ public:
+  bool Push(const MusicEvent& event) noexcept {
+    if (IsNoteEvent(event.type)) {
+      return PushNote(event);
+    }
+    PushController(event);
+    return true;
+  }
+
+  void OnNoteEvent(const NoteEvent& event) noexcept {
+    Push(ToMusicEvent(event));
+  }
+
+  void OnControllerEvent(const ControllerEvent& event) noexcept {
+    Push(ToMusicEvent(event));
+  }
+
+  void OnPressureEvent(const PressureEvent& event) noexcept {
+    Push(ToMusicEvent(event));
+  }
+
+  bool TryPop(MusicEvent& out) noexcept {
+    MusicEvent note{};
+    MusicEvent controller{};
+    const bool has_note = PeekNote(note);
+    const bool has_controller = PeekController(controller);
+
+    if (has_note && (!has_controller || !IsBefore(controller, note))) {
+      note_tail_.store(note_tail_.load(std::memory_order_relaxed) + 1u,
+                       std::memory_order_release);
+      out = note;
+      return true;
+    }
+    if (has_controller) {
+      ++controller_tail_;
+      out = controller;
+      return true;
+    }
+    return false;
+  }
+
+  /**
+   * @brief Notes rejected because the note ring was full (counted by the producer).
+   */
+  std::uint32_t dropped_note_count() const noexcept {
+    return dropped_note_count_.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Controller/pressure events overwritten before being read (counted by the consumer when
+   * it reaches them).
+   */
+  std::uint32_t dropped_controller_count() const noexcept {
+    return dropped_controller_count_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  static constexpr std::uint32_t kNoteMask = static_cast<std::uint32_t>(kNoteCapacity - 1u);
+  static constexpr std::uint32_t kControllerMask =
+      static_cast<std::uint32_t>(kControllerCapacity - 1u);
+
+  // The event is stored as two words so that a slot can be read while being overwritten without
+  // a data race; the sequence number tells whether the copy is consistent.
+  struct Slot {
+    std::atomic<std::uint32_t> sequence{0};
+    std::atomic<std::uint32_t> timestamp_ticks{0};
+    std::atomic<std::uint32_t> payload{0};
+  };
+
+  static std::uint32_t PackPayload(const MusicEvent& event) noexcept {
+    return static_cast<std::uint32_t>(event.type) |
+           (static_cast<std::uint32_t>(event.number) << 8u) |
+           (static_cast<std::uint32_t>(event.value) << 16u);
+  }
+
+  static MusicEvent UnpackEvent(std::uint32_t timestamp_ticks, std::uint32_t payload) noexcept {
+    MusicEvent event{};
+    event.timestamp_ticks = timestamp_ticks;
+    event.type = static_cast<MusicEventType>(payload & 0xFFu);
+    event.number = static_cast<std::uint8_t>((payload >> 8u) & 0xFFu);
+    event.value = static_cast<std::uint16_t>(payload >> 16u);
+    return event;
+  }
+
+  static bool IsBefore(const MusicEvent& lhs, const MusicEvent& rhs) noexcept {
+    return static_cast<std::int32_t>(lhs.timestamp_ticks - rhs.timestamp_ticks) < 0;
+  }
+
+  static std::uint32_t CommittedSequence(std::uint32_t index) noexcept {
+    return 2u * index + 2u;
+  }
+
+  bool PushNote(const MusicEvent& event) noexcept {
+    const std::uint32_t head = note_head_.load(std::memory_order_relaxed);
+    const std::uint32_t tail = note_tail_.load(std::memory_order_acquire);
+    if (head - tail >= kNoteCapacity) {
+      dropped_note_count_.store(dropped_note_count_.load(std::memory_order_relaxed) + 1u,
+                                std::memory_order_relaxed);
+      return false;
+    }
+    Slot& slot = note_slots_[head & kNoteMask];
+    slot.timestamp_ticks.store(event.timestamp_ticks, std::memory_order_relaxed);
+    slot.payload.store(PackPayload(event), std::memory_order_relaxed);
+    note_head_.store(head + 1u, std::memory_order_release);
+    return true;
+  }
+
+  void PushController(const MusicEvent& event) noexcept {
+    const std::uint32_t head = controller_head_.load(std::memory_order_relaxed);
+    Slot& slot = controller_slots_[head & kControllerMask];
+    slot.sequence.store(CommittedSequence(head) - 1u, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.timestamp_ticks.store(event.timestamp_ticks, std::memory_order_relaxed);
+    slot.payload.store(PackPayload(event), std::memory_order_relaxed);
+    slot.sequence.store(CommittedSequence(head), std::memory_order_release);
+    controller_head_.store(head + 1u, std::memory_order_release);
+  }
+
+  bool PeekNote(MusicEvent& out) const noexcept {
+    const std::uint32_t tail = note_tail_.load(std::memory_order_relaxed);
+    if (tail == note_head_.load(std::memory_order_acquire)) {
+      return false;
+    }
+    const Slot& slot = note_slots_[tail & kNoteMask];
+    out = UnpackEvent(slot.timestamp_ticks.load(std::memory_order_relaxed),
+                      slot.payload.load(std::memory_order_relaxed));
+    return true;
+  }
+
+  // Skips (and counts) the entries overwritten since the consumer last caught up, then returns a
+  // consistent copy of the oldest remaining one without consuming it.
+  bool PeekController(MusicEvent& out) noexcept {
+    const std::uint32_t head = controller_head_.load(std::memory_order_acquire);
+    std::uint32_t skipped = 0;
+    if (head - controller_tail_ > kControllerCapacity) {
+      const std::uint32_t oldest_kept = head - static_cast<std::uint32_t>(kControllerCapacity);
+      skipped = oldest_kept - controller_tail_;
+      controller_tail_ = oldest_kept;
+    }
+
+    bool has_event = false;
+    while (controller_tail_ != head) {
+      const Slot& slot = controller_slots_[controller_tail_ & kControllerMask];
+      const std::uint32_t expected_sequence = CommittedSequence(controller_tail_);
+      if (slot.sequence.load(std::memory_order_acquire) == expected_sequence) {
+        const std::uint32_t timestamp_ticks = slot.timestamp_ticks.load(std::memory_order_relaxed);
+        const std::uint32_t payload = slot.payload.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.sequence.load(std::memory_order_relaxed) == expected_sequence) {
+          out = UnpackEvent(timestamp_ticks, payload);
+          has_event = true;
+          break;
+        }
+      }
+      ++controller_tail_;
+      ++skipped;
+    }
+
+    if (skipped != 0u) {
+      dropped_controller_count_.store(
+          dropped_controller_count_.load(std::memory_order_relaxed) + skipped,
+          std::memory_order_relaxed);
+    }
+    return has_event;
+  }
+
+  Slot note_slots_[kNoteCapacity]{};
+  std::atomic<std::uint32_t> note_head_{0};
+  std::atomic<std::uint32_t> note_tail_{0};
+  std::atomic<std::uint32_t> dropped_note_count_{0};
+
+  Slot controller_slots_[kControllerCapacity]{};
+  std::atomic<std::uint32_t> controller_head_{0};
+  std::uint32_t controller_tail_ = 0;
+  std::atomic<std::uint32_t> dropped_controller_count_{0};
+};
+
+}  // namespace domain::music
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstdint>
+
+#include "domain/music/types.hpp"
+
+namespace domain::music {
+
+enum class NoteEventType : std::uint8_t {
+  kNoteOn = 0,
+  kNoteOff = 1,
+};
+
+struct NoteEvent {
+  NoteEventType type{NoteEventType::kNoteOn};
+  NoteNumber note{0};
+  Velocity velocity{0};
+  HighResolutionVelocity velocity_high_resolution{0};
+  std::uint32_t timestamp_ticks{0};
+};
+
+}  // namespace domain::music
@@ -0,0 +1,160 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "domain/music/key_tracker.hpp"
+#include "domain/music/pressure_event.hpp"
+#include "domain/music/types.hpp"
+
+namespace domain::music {
+
+/**
+ * @brief Key depth range mapped to pressure 0-127 (same units as KeyTrackerConfig), and output
+ * bounding: deadband in pressure steps and minimum interval between two events of the same key.
+ */
+struct PolyPressureConfig {
+  float pressure_start_position = 0.45f;
+  float pressure_full_position = 0.55f;
+  float deadband_steps = 1.0f;
+  std::uint32_t min_update_interval_ticks = 10'000;
+};
+
+/**
+ * @brief Turns key depth past the strike point into polyphonic key pressure events.
+ *
+ * Pressure is only generated while the key state (from KeyTracker) is kStruck. A pressure change
+ * is emitted when the depth moves more than deadband_steps beyond the last emitted value (or
+ * reaches 0 / 127), at most once per min_update_interval_ticks per key, so a full chord produces
+ * at most kKeyCount events per interval. When the key leaves kStruck, a pressure of 0 is sent if
+ * a non-zero pressure is pending on the synth side.
+ * SinkT must provide OnPressureEvent(const PressureEvent&).
+ */
+template <std::size_t kKeyCount>
+class PolyPressureGenerator {
+  static_assert(kKeyCount > 0u, "kKeyCount must be > 0");
+
+ public:
+  PolyPressureGenerator(const PolyPressureConfig& config, NoteNumber first_note) noexcept
+      : config_(config), first_note_(first_note) {}
+
+  void Reset() noexcept {
+    for (Key& key : keys_) {
+      key = Key{};
+    }
+  }
+
+  std::uint8_t pressure(std::size_t key_index) const noexcept {
+    if (key_index >= kKeyCount) {
+      return 0;
+    }
+    return keys_[key_index].pressure;
+  }
+
+  template <typename SinkT>
+  void Update(std::size_t key_index, KeyState key_state, float position,
+              std::uint32_t timestamp_ticks, SinkT& sink) noexcept {
+    if (key_index >= kKeyCount) {
+      return;
+    }
+    Key& key = keys_[key_index];
+    const NoteNumber note = static_cast<NoteNumber>(first_note_ + key_index);
+
+    if (key_state != KeyState::kStruck) {
+      if (key.pressure != 0u) {
+        Emit(key, note, 0u, timestamp_ticks, sink);
+      }
+      key.is_pressed = false;
+      return;
+    }
+
+    const float level = ScaleToPressureRange(position);
+    const std::uint8_t quantized_pressure = static_cast<std::uint8_t>(level + 0.5f);
+
+    if (!key.is_pressed) {
+      key.is_pressed = true;
+      key.has_emitted = false;
+    }
+    if (quantized_pressure == key.pressure) {
+      return;
+    }
+    if (key.has_emitted && static_cast<std::uint32_t>(timestamp_ticks - key.last_emit_ticks) <
+                               config_.min_update_interval_ticks) {
+      return;
+    }
+    if (IsOutsideDeadband(key, level, quantized_pressure)) {
+      Emit(key, note, quantized_pressure, timestamp_ticks, sink);
+    }
+  }
+
+  /**
+   * @brief Updates every key from one acquisition scan; KeyStatesT provides state(key_index),
+   * typically the KeyTracker fed with the same scan.
+   */
+  template <typename KeyStatesT, typename SinkT>
+  void Scan(const KeyStatesT& key_states, const float* positions,
+            const std::uint32_t* timestamps_ticks, SinkT& sink) noexcept {
+    if (positions == nullptr || timestamps_ticks == nullptr) {
+      return;
+    }
+    for (std::size_t key_index = 0; key_index < kKeyCount; ++key_index) {
+      Update(key_index, key_states.state(key_index), positions[key_index],
+             timestamps_ticks[key_index], sink);
+    }
+  }
+
+ private:
+  static constexpr float kMaxPressure = 127.0f;
+
+  struct Key {
+    std::uint8_t pressure = 0;
+    bool is_pressed = false;
+    bool has_emitted = false;
+    std::uint32_t last_emit_ticks = 0;
+  };
+
+  float ScaleToPressureRange(float position) const noexcept {
+    const float span = config_.pressure_full_position - config_.pressure_start_position;
+    if (span <= 0.0f) {
+      return position >= config_.pressure_full_position ? kMaxPressure : 0.0f;
+    }
+    const float normalized = (position - config_.pressure_start_position) / span;
+    if (normalized <= 0.0f) {
+      return 0.0f;
+    }
+    if (normalized >= 1.0f) {
+      return kMaxPressure;
+    }
+    return normalized * kMaxPressure;
+  }
+
+  bool IsOutsideDeadband(const Key& key, float level,
+                         std::uint8_t quantized_pressure) const noexcept {
+    if (quantized_pressure == 0u || static_cast<float>(quantized_pressure) == kMaxPressure) {
+      return true;
+    }
+    const float distance = level - static_cast<float>(key.pressure);
+    const float magnitude = distance < 0.0f ? -distance : distance;
+    return magnitude >= 0.5f + config_.deadband_steps;
+  }
+
+  template <typename SinkT>
+  static void Emit(Key& key, NoteNumber note, std::uint8_t pressure, std::uint32_t timestamp_ticks,
+                   SinkT& sink) noexcept {
+    key.pressure = pressure;
+    key.has_emitted = true;
+    key.last_emit_ticks = timestamp_ticks;
+
+    PressureEvent event{};
+    event.note = note;
+    event.pressure = pressure;
+    event.timestamp_ticks = timestamp_ticks;
+    sink.OnPressureEvent(event);
+  }
+
+  PolyPressureConfig config_{};
+  NoteNumber first_note_ = 0;
+  Key keys_[kKeyCount]{};
+};
+
+}  // namespace domain::music
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstdint>
+
+#include "domain/music/types.hpp"
+
+namespace domain::music {
+
+/**
+ * @brief Polyphonic key pressure (aftertouch) change, pressure in 0-127.
+ */
+struct PressureEvent {
+  NoteNumber note{0};
+  std::uint8_t pressure{0};
+  std::uint32_t timestamp_ticks{0};
+};
+
+}  // namespace domain::music
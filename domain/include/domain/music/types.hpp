@@ -15,5 +15,16 @@ inline constexpr NoteNumber kNoteC4 = 60;
  */
 using Velocity = uint8_t;
 
+/**
+ * @brief Velocity at MIDI 2.0 resolution (0-65535); the 7-bit velocity is its top 7 bits.
+ */
+using HighResolutionVelocity = uint16_t;
+
+/**
+ * @brief MIDI continuous controller number (0-127).
+ */
+using ControllerNumber = uint8_t;
+inline constexpr ControllerNumber kControllerSustainPedal = 64;
+inline constexpr ControllerNumber kControllerSoftPedal = 67;
 
 }  // namespace domain::music
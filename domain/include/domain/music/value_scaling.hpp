@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+
+namespace domain::music {
+
+/**
+ * @brief Widens a value from src_bits to dst_bits with the MIDI 2.0 min-center-max rule.
+ * 0 stays 0, the center (1 << (src_bits - 1)) maps to the destination center and the maximum to
+ * the destination maximum; above the center the low bits are filled by repeating the source
+ * bits. src_bits must be in [2, dst_bits] and dst_bits <= 32.
+ */
+constexpr std::uint32_t ScaleUp(std::uint32_t value, unsigned src_bits,
+                                unsigned dst_bits) noexcept {
+  const unsigned scale_bits = dst_bits - src_bits;
+  const std::uint32_t src_max =
+      src_bits >= 32u ? 0xFFFFFFFFu : static_cast<std::uint32_t>((1ull << src_bits) - 1u);
+  value &= src_max;
+  std::uint32_t scaled = static_cast<std::uint32_t>(static_cast<std::uint64_t>(value)
+                                                    << scale_bits);
+  const std::uint32_t center = 1u << (src_bits - 1u);
+  if (value <= center || scale_bits == 0u) {
+    return scaled;
+  }
+
+  const unsigned repeat_bits = src_bits - 1u;
+  std::uint32_t repeat = value & (center - 1u);
+  if (scale_bits > repeat_bits) {
+    repeat <<= scale_bits - repeat_bits;
+  } else {
+    repeat >>= repeat_bits - scale_bits;
+  }
+  while (repeat != 0u) {
+    scaled |= repeat;
+    repeat >>= repeat_bits;
+  }
+  return scaled;
+}
+
+/**
+ * @brief Narrows a value from src_bits to dst_bits by dropping the low bits (MIDI 2.0 rule).
+ */
+constexpr std::uint32_t ScaleDown(std::uint32_t value, unsigned src_bits,
+                                  unsigned dst_bits) noexcept {
+  return value >> (src_bits - dst_bits);
+}
+
+static_assert(ScaleUp(0, 7, 16) == 0x0000u);
+static_assert(ScaleUp(64, 7, 16) == 0x8000u);
+static_assert(ScaleUp(127, 7, 16) == 0xFFFFu);
+static_assert(ScaleUp(127, 7, 32) == 0xFFFFFFFFu);
+static_assert(ScaleUp(0x3FFF, 14, 32) == 0xFFFFFFFFu);
+static_assert(ScaleDown(ScaleUp(100, 7, 16), 16, 7) == 100u);
+
+}  // namespace domain::music
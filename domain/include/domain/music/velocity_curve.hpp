@@ -0,0 +1,293 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "domain/music/types.hpp"
+#include "domain/music/value_scaling.hpp"
+
+namespace domain::music {
+
+namespace velocity_curve_detail {
+
+inline constexpr double kLn2 = 0.69314718055994530942;
+
+constexpr double Exp(double x) noexcept {
+  const int halvings = static_cast<int>(x / kLn2 + (x >= 0.0 ? 0.5 : -0.5));
+  const double remainder = x - static_cast<double>(halvings) * kLn2;
+  double term = 1.0;
+  double sum = 1.0;
+  for (int n = 1; n < 24; ++n) {
+    term *= remainder / static_cast<double>(n);
+    sum += term;
+  }
+  for (int i = 0; i < halvings; ++i) {
+    sum *= 2.0;
+  }
+  for (int i = 0; i > halvings; --i) {
+    sum /= 2.0;
+  }
+  return sum;
+}
+
+constexpr double Log(double x) noexcept {
+  int exponent = 0;
+  while (x >= 2.0) {
+    x /= 2.0;
+    ++exponent;
+  }
+  while (x < 1.0) {
+    x *= 2.0;
+    --exponent;
+  }
+  const double y = (x - 1.0) / (x + 1.0);
+  const double y_squared = y * y;
+  double term = y;
+  double sum = 0.0;
+  for (int n = 0; n < 32; ++n) {
+    sum += term / static_cast<double>(2 * n + 1);
+    term *= y_squared;
+  }
+  return 2.0 * sum + static_cast<double>(exponent) * kLn2;
+}
+
+constexpr double Pow(double base, double exponent) noexcept {
+  if (base <= 0.0) {
+    return 0.0;
+  }
+  return Exp(exponent * Log(base));
+}
+
+constexpr Velocity ToVelocity(double strength) noexcept {
+  constexpr double kMinVelocity = 1.0;
+  constexpr double kMaxVelocity = 127.0;
+  if (strength <= 0.0) {
+    return static_cast<Velocity>(kMinVelocity);
+  }
+  if (strength >= 1.0) {
+    return static_cast<Velocity>(kMaxVelocity);
+  }
+  return static_cast<Velocity>(kMinVelocity + strength * (kMaxVelocity - kMinVelocity) + 0.5);
+}
+
+/**
+ * @brief Piecewise linear log2: exponent + (mantissa - 1) for x = mantissa * 2^exponent. Exact
+ * at powers of two and monotonic, and a float gets it from its bits without a log call.
+ */
+constexpr double Log2Approx(double x) noexcept {
+  int exponent = 0;
+  while (x >= 2.0) {
+    x /= 2.0;
+    ++exponent;
+  }
+  while (x < 1.0) {
+    x *= 2.0;
+    --exponent;
+  }
+  return static_cast<double>(exponent) + (x - 1.0);
+}
+
+constexpr float Log2Approx(float x) noexcept {
+  const std::uint32_t bits = std::bit_cast<std::uint32_t>(x);
+  constexpr float kMantissaScale = 1.0f / static_cast<float>(1u << 23u);
+  return static_cast<float>(static_cast<std::int32_t>(bits >> 23u) - 127) +
+         static_cast<float>(bits & 0x7FFFFFu) * kMantissaScale;
+}
+
+/** @brief Inverse of Log2Approx(). */
+constexpr double Exp2Approx(double y) noexcept {
+  int exponent = static_cast<int>(y);
+  if (static_cast<double>(exponent) > y) {
+    --exponent;
+  }
+  double x = 1.0 + (y - static_cast<double>(exponent));
+  for (int i = 0; i < exponent; ++i) {
+    x *= 2.0;
+  }
+  for (int i = 0; i > exponent; --i) {
+    x /= 2.0;
+  }
+  return x;
+}
+
+/** @brief Travel time of entry index: entries are evenly spaced in Log2Approx(travel time). */
+template <std::size_t kEntryCount>
+constexpr double EntryTravelTicks(std::size_t index, double fastest_travel_ticks,
+                                  double slowest_travel_ticks) noexcept {
+  const double log_fastest = Log2Approx(fastest_travel_ticks);
+  const double log_slowest = Log2Approx(slowest_travel_ticks);
+  return Exp2Approx(log_fastest + (log_slowest - log_fastest) * static_cast<double>(index) /
+                                      static_cast<double>(kEntryCount - 1u));
+}
+
+/** @brief Travel time of entry index mapped to 0 (fastest) .. 1 (slowest). */
+template <std::size_t kEntryCount>
+constexpr double EntrySlowness(std::size_t index, double fastest_travel_ticks,
+                               double slowest_travel_ticks) noexcept {
+  return (EntryTravelTicks<kEntryCount>(index, fastest_travel_ticks, slowest_travel_ticks) -
+          fastest_travel_ticks) /
+         (slowest_travel_ticks - fastest_travel_ticks);
+}
+
+}  // namespace velocity_curve_detail
+
+template <std::size_t kEntryCount>
+using VelocityTable = std::array<Velocity, kEntryCount>;
+
+/**
+ * @brief Strength decreasing linearly with travel time: fastest -> 127, slowest -> 1.
+ */
+template <std::size_t kEntryCount>
+constexpr VelocityTable<kEntryCount> MakeLinearVelocityTable(
+    double fastest_travel_ticks, double slowest_travel_ticks) noexcept {
+  VelocityTable<kEntryCount> table{};
+  for (std::size_t i = 0; i < kEntryCount; ++i) {
+    table[i] = velocity_curve_detail::ToVelocity(
+        1.0 - velocity_curve_detail::EntrySlowness<kEntryCount>(i, fastest_travel_ticks,
+                                                                slowest_travel_ticks));
+  }
+  return table;
+}
+
+/**
+ * @brief Strength proportional to log(slowest / t) / log(slowest / fastest).
+ * Spends more of the velocity range on fast strikes, where travel times are close together.
+ */
+template <std::size_t kEntryCount>
+constexpr VelocityTable<kEntryCount> MakeLogarithmicVelocityTable(
+    double fastest_travel_ticks, double slowest_travel_ticks) noexcept {
+  VelocityTable<kEntryCount> table{};
+  const double full_range =
+      velocity_curve_detail::Log(slowest_travel_ticks / fastest_travel_ticks);
+  for (std::size_t i = 0; i < kEntryCount; ++i) {
+    const double travel_ticks = velocity_curve_detail::EntryTravelTicks<kEntryCount>(
+        i, fastest_travel_ticks, slowest_travel_ticks);
+    table[i] = velocity_curve_detail::ToVelocity(
+        velocity_curve_detail::Log(slowest_travel_ticks / travel_ticks) / full_range);
+  }
+  return table;
+}
+
+/**
+ * @brief Strength = (1 - normalized travel time) ^ exponent.
+ * exponent < 1 makes the keyboard feel lighter, exponent > 1 heavier.
+ */
+template <std::size_t kEntryCount>
+constexpr VelocityTable<kEntryCount> MakePowerVelocityTable(double fastest_travel_ticks,
+                                                            double slowest_travel_ticks,
+                                                            double exponent) noexcept {
+  VelocityTable<kEntryCount> table{};
+  for (std::size_t i = 0; i < kEntryCount; ++i) {
+    const double slowness = velocity_curve_detail::EntrySlowness<kEntryCount>(
+        i, fastest_travel_ticks, slowest_travel_ticks);
+    table[i] =
+        velocity_curve_detail::ToVelocity(velocity_curve_detail::Pow(1.0 - slowness, exponent));
+  }
+  return table;
+}
+
+/**
+ * @brief Maps a strike travel time to a MIDI velocity through a precomputed table.
+ *
+ * Entries are evenly spaced in log travel time between fastest and slowest (see
+ * velocity_curve_detail::EntryTravelTicks()), so fast strikes, whose travel times are close
+ * together, get as many entries per velocity step as slow ones. Times outside
+ * [fastest, slowest] are clamped to the first/last entry.
+ *
+ * LoadTable() fills the table not in use and then switches to it, so a lookup that preempts it
+ * reads one whole table or the other. A lookup must not be preempted by two LoadTable() calls.
+ */
+template <std::size_t kEntryCount>
+class VelocityCurve {
+  static_assert(kEntryCount >= 2u, "kEntryCount must be >= 2");
+
+ public:
+  constexpr VelocityCurve(float fastest_travel_ticks, float slowest_travel_ticks,
+                          const VelocityTable<kEntryCount>& table) noexcept
+      : fastest_travel_ticks_(fastest_travel_ticks),
+        slowest_travel_ticks_(slowest_travel_ticks),
+        log_fastest_(velocity_curve_detail::Log2Approx(fastest_travel_ticks)),
+        entries_per_log_(static_cast<float>(kEntryCount - 1u) /
+                         (velocity_curve_detail::Log2Approx(slowest_travel_ticks) - log_fastest_)),
+        tables_{table, table} {}
+
+  constexpr Velocity Lookup(float travel_ticks) const noexcept {
+    const VelocityTable<kEntryCount>& table = ActiveTable();
+    if (!(travel_ticks > fastest_travel_ticks_)) {
+      return table[0];
+    }
+    if (travel_ticks >= slowest_travel_ticks_) {
+      return table[kEntryCount - 1u];
+    }
+    const float position = Position(travel_ticks) + 0.5f;
+    if (position >= static_cast<float>(kEntryCount - 1u)) {
+      return table[kEntryCount - 1u];
+    }
+    return table[static_cast<std::size_t>(position)];
+  }
+
+  /**
+   * @brief 16-bit velocity interpolated between the two entries around travel_ticks.
+   * Equals the widened table entry at the exact entry times.
+   */
+  constexpr HighResolutionVelocity LookupHighResolution(float travel_ticks) const noexcept {
+    const VelocityTable<kEntryCount>& table = ActiveTable();
+    if (!(travel_ticks > fastest_travel_ticks_)) {
+      return Widen(table[0]);
+    }
+    if (travel_ticks >= slowest_travel_ticks_) {
+      return Widen(table[kEntryCount - 1u]);
+    }
+    const float position = Position(travel_ticks);
+    if (position >= static_cast<float>(kEntryCount - 1u)) {
+      return Widen(table[kEntryCount - 1u]);
+    }
+    const std::size_t index = static_cast<std::size_t>(position);
+    const float fraction = position - static_cast<float>(index);
+    const float low = static_cast<float>(Widen(table[index]));
+    const float high = static_cast<float>(Widen(table[index + 1u]));
+    return static_cast<HighResolutionVelocity>(low + (high - low) * fraction + 0.5f);
+  }
+
+  void LoadTable(const VelocityTable<kEntryCount>& table) noexcept {
+    const std::uint8_t inactive = static_cast<std::uint8_t>(active_ ^ 1u);
+    tables_[inactive] = table;
+    std::atomic_signal_fence(std::memory_order_release);
+    static_cast<volatile std::uint8_t&>(active_) = inactive;
+  }
+
+  constexpr const VelocityTable<kEntryCount>& table() const noexcept {
+    return ActiveTable();
+  }
+
+ private:
+  static constexpr HighResolutionVelocity Widen(Velocity velocity) noexcept {
+    return static_cast<HighResolutionVelocity>(ScaleUp(velocity, 7u, 16u));
+  }
+
+  constexpr float Position(float travel_ticks) const noexcept {
+    return (velocity_curve_detail::Log2Approx(travel_ticks) - log_fastest_) * entries_per_log_;
+  }
+
+  constexpr const VelocityTable<kEntryCount>& ActiveTable() const noexcept {
+    if (std::is_constant_evaluated()) {
+      return tables_[active_];
+    }
+    const std::uint8_t active = static_cast<const volatile std::uint8_t&>(active_);
+    std::atomic_signal_fence(std::memory_order_acquire);
+    return tables_[active];
+  }
+
+  float fastest_travel_ticks_ = 0.0f;
+  float slowest_travel_ticks_ = 0.0f;
+  float log_fastest_ = 0.0f;
+  float entries_per_log_ = 0.0f;
+  std::array<VelocityTable<kEntryCount>, 2> tables_{};
+  std::uint8_t active_ = 0;
+};
+
+}  // namespace domain::music
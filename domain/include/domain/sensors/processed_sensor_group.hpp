@@ -9,15 +9,19 @@
 
 namespace domain::sensors {
 
-template <typename ProcessorT>
+struct NoSampleMonitor {
+  void Observe(std::size_t, std::uint16_t) noexcept {}
+};
+
+template <typename ProcessorT, typename MonitorT = NoSampleMonitor>
 class ProcessedSensorGroup {
  public:
   static_assert(domain::signal::is_signal_processor<ProcessorT>::value,
                 "ProcessorT must satisfy SignalProcessor");
 
-  ProcessedSensorGroup(Sensor* const* sensors, ProcessorT* processors,
-                       std::size_t sensor_count) noexcept
-      : sensors_(sensors), processors_(processors), sensor_count_(sensor_count) {
+  ProcessedSensorGroup(Sensor* const* sensors, ProcessorT* processors, std::size_t sensor_count,
+                       MonitorT* monitor = nullptr) noexcept
+      : sensors_(sensors), processors_(processors), sensor_count_(sensor_count), monitor_(monitor) {
     if (sensors_ != nullptr) {
       for (std::size_t i = 0; i < sensor_count_; ++i) {
         assert(sensors_[i] != nullptr);
@@ -40,9 +44,11 @@ class ProcessedSensorGroup {
     }
 
     ProcessorT& processor = processors_[index];
-    const float raw_float = static_cast<float>(raw_value);
+    if (monitor_ != nullptr) {
+      monitor_->Observe(index, raw_value);
+    }
 
-    const float processed_value = processor.Process(raw_float);
+    const float processed_value = processor.Process(static_cast<float>(raw_value));
 
     s->Update(raw_value, processed_value, timestamp_ticks);
   }
@@ -51,6 +57,7 @@ class ProcessedSensorGroup {
   Sensor* const* sensors_ = nullptr;
   ProcessorT* processors_ = nullptr;
   std::size_t sensor_count_ = 0;
+  MonitorT* monitor_ = nullptr;
 };
 
 }  // namespace domain::sensors
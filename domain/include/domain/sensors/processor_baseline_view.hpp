@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+
+#include "domain/sensors/sensor_baseline_requirements.hpp"
+
+namespace domain::sensors {
+
+/**
+ * @brief Exposes the baseline of the TrackerT stage of each per-channel processor.
+ *
+ * The baseline is a single aligned float written by the acquisition context, so it can be read
+ * from a lower priority task without additional synchronization.
+ */
+template <typename ProcessorT, typename TrackerT>
+class ProcessorBaselineView final : public SensorBaselineRequirements {
+ public:
+  ProcessorBaselineView(const ProcessorT* processors, std::size_t processor_count) noexcept
+      : processors_(processors), processor_count_(processor_count) {}
+
+  std::size_t channel_count() const noexcept override {
+    return processor_count_;
+  }
+
+  bool TryReadBaseline(std::size_t index, float& out_baseline) const noexcept override {
+    if (processors_ == nullptr || index >= processor_count_) {
+      return false;
+    }
+    const TrackerT& tracker = processors_[index].template stage<TrackerT>();
+    if (!tracker.has_baseline()) {
+      return false;
+    }
+    out_baseline = tracker.baseline();
+    return true;
+  }
+
+ private:
+  const ProcessorT* processors_ = nullptr;
+  std::size_t processor_count_ = 0;
+};
+
+}  // namespace domain::sensors
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <cstddef>
+
+namespace domain::sensors {
+
+class SensorBaselineRequirements {
+ public:
+  virtual ~SensorBaselineRequirements() = default;
+
+  virtual std::size_t channel_count() const noexcept = 0;
+  virtual bool TryReadBaseline(std::size_t index, float& out_baseline) const noexcept = 0;
+};
+
+}  // namespace domain::sensors
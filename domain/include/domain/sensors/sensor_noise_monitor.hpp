@@ -0,0 +1,88 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "domain/sensors/sensor_stats_requirements.hpp"
+#include "domain/signal/statistics/running_stats.hpp"
+
+namespace domain::sensors {
+
+/**
+ * @brief Per-channel RunningStats fed with the raw samples, in parallel with the main pipeline.
+ *
+ * Observe() runs in the acquisition context. TryRead() and RequestReset() may be called from a
+ * lower priority task on the same core: each channel is guarded by a sequence counter (odd while
+ * an update is in progress) and resets are applied by the writer on the next sample of each
+ * channel, so readers never see a torn or half-reset accumulator.
+ */
+template <std::size_t kChannelCount>
+class SensorNoiseMonitor final : public SensorStatsRequirements {
+  static_assert(kChannelCount > 0u, "kChannelCount must be > 0");
+
+ public:
+  void Observe(std::size_t index, std::uint16_t sample) noexcept {
+    if (index >= kChannelCount) {
+      return;
+    }
+    Channel& channel = channels_[index];
+    const std::uint32_t reset_generation = reset_generation_;
+
+    channel.sequence = channel.sequence + 1u;
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+    if (channel.applied_reset_generation != reset_generation) {
+      channel.stats.Reset();
+      channel.applied_reset_generation = reset_generation;
+    }
+    channel.stats.Update(sample);
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+    channel.sequence = channel.sequence + 1u;
+  }
+
+  std::size_t channel_count() const noexcept override {
+    return kChannelCount;
+  }
+
+  bool TryRead(std::size_t index,
+               domain::signal::statistics::RunningStats& out) const noexcept override {
+    if (index >= kChannelCount) {
+      return false;
+    }
+    const Channel& channel = channels_[index];
+    for (std::size_t attempt = 0; attempt < kMaxReadAttempts; ++attempt) {
+      const std::uint32_t sequence_before = channel.sequence;
+      if ((sequence_before & 1u) != 0u) {
+        continue;
+      }
+      std::atomic_signal_fence(std::memory_order_seq_cst);
+      const domain::signal::statistics::RunningStats copy = channel.stats;
+      const bool is_reset_pending = channel.applied_reset_generation != reset_generation_;
+      std::atomic_signal_fence(std::memory_order_seq_cst);
+      if (channel.sequence != sequence_before) {
+        continue;
+      }
+      out = is_reset_pending ? domain::signal::statistics::RunningStats{} : copy;
+      return true;
+    }
+    return false;
+  }
+
+  void RequestReset() noexcept override {
+    reset_generation_ = reset_generation_ + 1u;
+  }
+
+ private:
+  static constexpr std::size_t kMaxReadAttempts = 8;
+
+  struct Channel {
+    volatile std::uint32_t sequence = 0;
+    std::uint32_t applied_reset_generation = 0;
+    domain::signal::statistics::RunningStats stats{};
+  };
+
+  Channel channels_[kChannelCount]{};
+  volatile std::uint32_t reset_generation_ = 0;
+};
+
+}  // namespace domain::sensors
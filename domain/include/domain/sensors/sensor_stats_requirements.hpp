@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstddef>
+
+#include "domain/signal/statistics/running_stats.hpp"
+
+namespace domain::sensors {
+
+class SensorStatsRequirements {
+ public:
+  virtual ~SensorStatsRequirements() = default;
+
+  virtual std::size_t channel_count() const noexcept = 0;
+  virtual bool TryRead(std::size_t index,
+                       domain::signal::statistics::RunningStats& out) const noexcept = 0;
+  virtual void RequestReset() noexcept = 0;
+};
+
+}  // namespace domain::sensors
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <cstdint>
+
+namespace domain::signal::detectors {
+
+enum class CrossingDirection : std::uint8_t {
+  kRising = 0,
+  kFalling = 1,
+};
+
+/**
+ * @brief Crossing instant with sub-tick resolution.
+ * The instant is ticks + fraction / 65536 (fraction of one timestamp tick).
+ */
+struct CrossingTime {
+  std::uint32_t ticks = 0;
+  std::uint16_t fraction = 0;
+};
+
+struct CrossingEvent {
+  CrossingDirection direction{CrossingDirection::kRising};
+  CrossingTime time{};
+};
+
+/**
+ * @brief Returns to - from in (fractional) ticks, wrap-around safe for intervals < 2^31 ticks.
+ */
+inline float ElapsedTicks(const CrossingTime& from, const CrossingTime& to) noexcept {
+  const std::int32_t whole_ticks = static_cast<std::int32_t>(to.ticks - from.ticks);
+  const std::int32_t fraction_delta =
+      static_cast<std::int32_t>(to.fraction) - static_cast<std::int32_t>(from.fraction);
+  return static_cast<float>(whole_ticks) + static_cast<float>(fraction_delta) / 65536.0f;
+}
+
+/**
+ * @brief Schmitt-trigger crossing detector with linear interpolation between samples.
+ *
+ * A rising crossing is reported when the signal reaches rising_threshold while low, a falling
+ * crossing when it drops below falling_threshold while high (falling_threshold <=
+ * rising_threshold gives the hysteresis). The crossing instant is interpolated between the two
+ * samples bracketing the threshold using their timestamps, so its resolution is not limited to
+ * the sample period.
+ */
+class CrossingDetector {
+ public:
+  CrossingDetector(float rising_threshold, float falling_threshold) noexcept
+      : rising_threshold_(rising_threshold),
+        falling_threshold_(falling_threshold < rising_threshold ? falling_threshold
+                                                                : rising_threshold) {}
+
+  void Reset() noexcept {
+    has_previous_ = false;
+    is_high_ = false;
+    previous_value_ = 0.0f;
+    previous_timestamp_ticks_ = 0;
+  }
+
+  bool is_high() const noexcept {
+    return is_high_;
+  }
+
+  bool Update(float value, std::uint32_t timestamp_ticks, CrossingEvent& out_event) noexcept {
+    if (!has_previous_) {
+      is_high_ = value >= rising_threshold_;
+      Remember(value, timestamp_ticks);
+      return false;
+    }
+
+    bool did_cross = false;
+    if (!is_high_ && value >= rising_threshold_) {
+      is_high_ = true;
+      out_event.direction = CrossingDirection::kRising;
+      out_event.time = Interpolate(rising_threshold_, value, timestamp_ticks);
+      did_cross = true;
+    } else if (is_high_ && value < falling_threshold_) {
+      is_high_ = false;
+      out_event.direction = CrossingDirection::kFalling;
+      out_event.time = Interpolate(falling_threshold_, value, timestamp_ticks);
+      did_cross = true;
+    }
+
+    Remember(value, timestamp_ticks);
+    return did_cross;
+  }
+
+ private:
+  void Remember(float value, std::uint32_t timestamp_ticks) noexcept {
+    previous_value_ = value;
+    previous_timestamp_ticks_ = timestamp_ticks;
+    has_previous_ = true;
+  }
+
+  CrossingTime Interpolate(float threshold, float value,
+                           std::uint32_t timestamp_ticks) const noexcept {
+    const std::uint32_t interval_ticks =
+        static_cast<std::uint32_t>(timestamp_ticks - previous_timestamp_ticks_);
+    const float value_delta = value - previous_value_;
+
+    float ratio = 1.0f;
+    if (value_delta != 0.0f) {
+      ratio = (threshold - previous_value_) / value_delta;
+      if (ratio < 0.0f) {
+        ratio = 0.0f;
+      } else if (ratio > 1.0f) {
+        ratio = 1.0f;
+      }
+    }
+
+    const float offset_ticks = ratio * static_cast<float>(interval_ticks);
+    const std::uint32_t whole_ticks = static_cast<std::uint32_t>(offset_ticks);
+    const float fraction = offset_ticks - static_cast<float>(whole_ticks);
+
+    CrossingTime time{};
+    time.ticks = static_cast<std::uint32_t>(previous_timestamp_ticks_ + whole_ticks);
+    time.fraction = static_cast<std::uint16_t>(fraction * 65536.0f);
+    return time;
+  }
+
+  float rising_threshold_ = 0.0f;
+  float falling_threshold_ = 0.0f;
+  bool has_previous_ = false;
+  bool is_high_ = false;
+  float previous_value_ = 0.0f;
+  std::uint32_t previous_timestamp_ticks_ = 0;
+};
+
+}  // namespace domain::signal::detectors
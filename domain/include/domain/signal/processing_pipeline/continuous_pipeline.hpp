@@ -19,6 +19,11 @@ class ContinuousPipeline {
     return detail::ProcessAll(stages_, input, std::make_index_sequence<sizeof...(StageTs)>{});
   }
 
+  template <typename StageT>
+  const StageT& stage() const noexcept {
+    return std::get<StageT>(stages_);
+  }
+
  private:
   std::tuple<StageTs...> stages_{};
 };
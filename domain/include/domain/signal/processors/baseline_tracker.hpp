@@ -0,0 +1,98 @@
+#pragma once
+
+#include <cstdint>
+
+#include "domain/signal/signal_processor_concepts.hpp"
+
+namespace domain::signal::processors {
+
+/**
+ * @brief Tracks the resting level of a sensor and subtracts it from the signal.
+ *
+ * The baseline follows the input with a very slow EMA (alpha = kAlphaNumerator /
+ * kAlphaDenominator) only while the input stays within the gate (kGateNumerator /
+ * kGateDenominator, in input units) around it, so it freezes while the key is moving. The signal
+ * is expected to rise when the key is pressed: an input below the baseline by more than the gate
+ * means the resting level itself dropped, and the baseline is re-seeded on it.
+ *
+ * A rise of the resting level beyond the gate looks like a pressed key. It is told apart only by
+ * lasting: once the input has stayed above the gate and within one gate width of where it
+ * settled for kRecoverySamples samples in a row, the baseline is re-seeded there. Keys held
+ * that still for that long read as released. 0 disables the recovery.
+ */
+template <std::int32_t kAlphaNumerator, std::int32_t kAlphaDenominator,
+          std::int32_t kGateNumerator, std::int32_t kGateDenominator,
+          std::uint32_t kRecoverySamples>
+class BaselineTracker {
+  static_assert(kAlphaDenominator > 0, "kAlphaDenominator must be > 0");
+  static_assert(kAlphaNumerator >= 0, "kAlphaNumerator must be >= 0");
+  static_assert(kAlphaNumerator <= kAlphaDenominator,
+                "kAlphaNumerator must be <= kAlphaDenominator");
+  static_assert(kGateDenominator > 0, "kGateDenominator must be > 0");
+  static_assert(kGateNumerator >= 0, "kGateNumerator must be >= 0");
+
+  static constexpr float kAlpha =
+      static_cast<float>(kAlphaNumerator) / static_cast<float>(kAlphaDenominator);
+  static constexpr float kGate =
+      static_cast<float>(kGateNumerator) / static_cast<float>(kGateDenominator);
+
+ public:
+  void Reset() noexcept {
+    has_baseline_ = false;
+    baseline_ = 0.0f;
+    settled_samples_ = 0;
+    settled_level_ = 0.0f;
+  }
+
+  float Process(float sample) noexcept {
+    if (!has_baseline_) {
+      baseline_ = sample;
+      has_baseline_ = true;
+      return 0.0f;
+    }
+
+    const float deviation = sample - baseline_;
+    if (deviation < -kGate) {
+      baseline_ = sample;
+      settled_samples_ = 0;
+      return 0.0f;
+    }
+    if (deviation <= kGate) {
+      baseline_ = baseline_ + kAlpha * deviation;
+      settled_samples_ = 0;
+      return sample - baseline_;
+    }
+
+    if constexpr (kRecoverySamples > 0u) {
+      const float drift = sample - settled_level_;
+      if (settled_samples_ == 0u || drift > kGate || drift < -kGate) {
+        settled_level_ = sample;
+        settled_samples_ = 1;
+      } else if (++settled_samples_ >= kRecoverySamples) {
+        baseline_ = sample;
+        settled_samples_ = 0;
+        return 0.0f;
+      }
+    }
+    return deviation;
+  }
+
+  bool has_baseline() const noexcept {
+    return has_baseline_;
+  }
+
+  float baseline() const noexcept {
+    return baseline_;
+  }
+
+ private:
+  bool has_baseline_ = false;
+  float baseline_ = 0.0f;
+  std::uint32_t settled_samples_ = 0;
+  float settled_level_ = 0.0f;
+};
+
+static_assert(domain::signal::is_signal_processor<BaselineTracker<1, 4096, 1, 100, 30000>>::value,
+              "BaselineTracker must satisfy SignalProcessor concept");
+
+}  // namespace domain::signal::processors
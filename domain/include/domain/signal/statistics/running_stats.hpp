@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+namespace domain::signal::statistics {
+
+/**
+ * @brief Streaming mean/variance/min/max accumulator over raw ADC counts.
+ *
+ * Update() only does integer work (a subtract, a multiply-accumulate and 64-bit adds), since it
+ * runs for every channel at the acquisition rate and the FPU has no double precision. Samples
+ * are summed as offsets from the first one, so the sums stay exact over the whole count range
+ * and the variance of a few counts of noise on a ~50000 counts offset does not cancel out when
+ * converted to double by the readers. Variance is the population variance, so stddev() is the
+ * RMS noise around the mean.
+ */
+class RunningStats {
+ public:
+  void Reset() noexcept {
+    count_ = 0;
+    origin_ = 0;
+    sum_ = 0;
+    sum_squares_ = 0;
+    min_ = 0;
+    max_ = 0;
+  }
+
+  void Update(std::uint16_t sample) noexcept {
+    if (count_ == std::numeric_limits<std::uint32_t>::max()) {
+      return;
+    }
+    if (count_ == 0u) {
+      origin_ = sample;
+      min_ = sample;
+      max_ = sample;
+    } else if (sample < min_) {
+      min_ = sample;
+    } else if (sample > max_) {
+      max_ = sample;
+    }
+
+    ++count_;
+    // |offset| < 2^16 and count_ < 2^32, so neither sum can overflow.
+    const std::int32_t offset = static_cast<std::int32_t>(sample) - origin_;
+    sum_ += offset;
+    sum_squares_ += static_cast<std::uint64_t>(static_cast<std::int64_t>(offset) * offset);
+  }
+
+  std::uint32_t count() const noexcept {
+    return count_;
+  }
+
+  double mean() const noexcept {
+    if (count_ == 0u) {
+      return 0.0;
+    }
+    return static_cast<double>(origin_) + static_cast<double>(sum_) / count_;
+  }
+
+  double variance() const noexcept {
+    if (count_ == 0u) {
+      return 0.0;
+    }
+    const double offset_mean = static_cast<double>(sum_) / count_;
+    const double variance =
+        static_cast<double>(sum_squares_) / count_ - offset_mean * offset_mean;
+    return variance > 0.0 ? variance : 0.0;
+  }
+
+  double stddev() const noexcept {
+    return std::sqrt(variance());
+  }
+
+  std::uint16_t min() const noexcept {
+    return min_;
+  }
+
+  std::uint16_t max() const noexcept {
+    return max_;
+  }
+
+  std::uint16_t peak_to_peak() const noexcept {
+    return static_cast<std::uint16_t>(max_ - min_);
+  }
+
+ private:
+  std::uint32_t count_ = 0;
+  std::int32_t origin_ = 0;
+  std::int64_t sum_ = 0;
+  std::uint64_t sum_squares_ = 0;
+  std::uint16_t min_ = 0;
+  std::uint16_t max_ = 0;
+};
+
+}  // namespace domain::signal::statistics
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "domain/telemetry/trigger_capture.hpp"
+
+namespace domain::telemetry {
+
+inline constexpr std::uint32_t kCaptureBufferMagic = 0x5041434Bu;  // "KCAP"
+inline constexpr std::uint16_t kCaptureBufferVersion = 1;
+
+/**
+ * @brief Self-describing header placed right before the capture scans, so a raw debugger dump
+ * of the buffer can be decoded without the firmware (tools/capture_dump.py). All fields are
+ * little endian:
+ *
+ *   offset  0  magic u32 ("KCAP")        offset 28  scan_count u32
+ *   offset  4  version u16               offset 32  first_slot u32
+ *   offset  6  header_bytes u16          offset 36  trigger_index u32
+ *   offset  8  scan_bytes u16            offset 40  trigger_timestamp_ticks u32
+ *   offset 10  channel_count u8          offset 44  ticks_per_second u32
+ *   offset 11  state u8 (CaptureState)   offset 48  capture_number u32
+ *   offset 12  channel_mask u32          offset 52  trigger: channel u8, slope u8,
+ *   offset 16  capacity u32                          threshold u16
+ *   offset 20  pre_scans u32             offset 56  reserved
+ *   offset 24  post_scans u32
+ *
+ * capacity scans of scan_bytes follow the header: timestamp u32, then channel_count raw u16
+ * values, index = sensor id - 1 (bit n of channel_mask marks sensor id n + 1 as fitted). Once
+ * state is kFrozen, scan i of the capture (i < scan_count) sits in slot
+ * (first_slot + i) % capacity. Recordings (immediate slope, no pre-trigger scans) start in
+ * slot 0. capture_number counts Arm() calls so two dumps can be told apart.
+ */
+struct CaptureBufferHeader {
+  std::uint32_t magic = kCaptureBufferMagic;
+  std::uint16_t version = kCaptureBufferVersion;
+  std::uint16_t header_bytes = 0;
+  std::uint16_t scan_bytes = 0;
+  std::uint8_t channel_count = 0;
+  std::uint8_t state = 0;
+  std::uint32_t channel_mask = 0;
+  std::uint32_t capacity = 0;
+  std::uint32_t pre_scans = 0;
+  std::uint32_t post_scans = 0;
+  std::uint32_t scan_count = 0;
+  std::uint32_t first_slot = 0;
+  std::uint32_t trigger_index = 0;
+  std::uint32_t trigger_timestamp_ticks = 0;
+  std::uint32_t ticks_per_second = 0;
+  std::uint32_t capture_number = 0;
+  std::uint8_t trigger_channel = 0;
+  std::uint8_t trigger_slope = 0;
+  std::uint16_t trigger_threshold = 0;
+  std::uint32_t reserved[2]{};
+};
+
+static_assert(sizeof(CaptureBufferHeader) == 64u, "CaptureBufferHeader layout is documented");
+static_assert(offsetof(CaptureBufferHeader, channel_mask) == 12u,
+              "CaptureBufferHeader layout is documented");
+static_assert(offsetof(CaptureBufferHeader, trigger_channel) == 52u,
+              "CaptureBufferHeader layout is documented");
+
+/**
+ * @brief Capture header followed by its scan storage, as one dumpable block.
+ */
+template <std::size_t kChannels, std::size_t kCapacity>
+struct CaptureBuffer {
+  static_assert(offsetof(CaptureScan<kChannels>, values) == 4u,
+                "scan values must follow the timestamp");
+
+  CaptureBufferHeader header{};
+  CaptureScan<kChannels> scans[kCapacity];
+};
+
+}  // namespace domain::telemetry
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace domain::telemetry {
+
+struct DoubleBufferTxStats {
+  std::uint32_t submitted_buffers = 0;
+  std::uint32_t sent_bytes = 0;
+  /** @brief Writes refused whole because the fill buffer had no room for them. */
+  std::uint32_t overflow_count = 0;
+  std::uint32_t dropped_bytes = 0;
+  /**
+   * @brief Transfers that completed while a write was still being copied in: the line went
+   * idle although data was on its way. A line that idles because nothing was written is not
+   * an underrun.
+   */
+  std::uint32_t underrun_count = 0;
+};
+
+/**
+ * @brief Ping-pong buffers in front of a DMA transmitter.
+ *
+ * Writes are copied into the fill buffer; whenever the transmitter is idle the fill buffer is
+ * handed to it as is (the DMA reads it in place) and the other buffer becomes the fill buffer.
+ * A write that does not fit the fill buffer is refused whole, like RTT's skip mode, so framed
+ * data never reaches the line cut in half; WritableBytes() tells how much fits.
+ *
+ * Write() may also be split into BeginWrite(), a copy into the returned space and
+ * CommitWrite(), so the copy can run with interrupts enabled. The fill buffer is not handed out
+ * while such a write is open.
+ *
+ * The class holds no lock: the methods must be serialized by the caller (the transfer-complete
+ * interrupt runs TakeSubmission() and OnTransferComplete()); only the copy between BeginWrite()
+ * and CommitWrite() may overlap them.
+ */
+template <std::size_t kBufferBytes>
+class DoubleBufferTx {
+  static_assert(kBufferBytes > 0u, "kBufferBytes must be > 0");
+
+ public:
+  bool Write(const std::uint8_t* data, std::size_t length) noexcept {
+    if (length == 0u) {
+      return true;
+    }
+    if (data == nullptr) {
+      CountDropped(length);
+      return false;
+    }
+    std::uint8_t* space = BeginWrite(length);
+    if (space == nullptr) {
+      return false;
+    }
+    std::memcpy(space, data, length);
+    CommitWrite();
+    return true;
+  }
+
+  /**
+   * @brief Reserves length bytes at the end of the fill buffer; nullptr (and the write counted
+   * as dropped) when they do not fit or a write is already open.
+   */
+  std::uint8_t* BeginWrite(std::size_t length) noexcept {
+    if (open_size_ != 0u || length == 0u || length > kBufferBytes - fill_size_) {
+      CountDropped(length);
+      return nullptr;
+    }
+    open_size_ = length;
+    return buffers_[fill_].data() + fill_size_;
+  }
+
+  /** @brief Queues the bytes reserved by the last BeginWrite(). */
+  void CommitWrite() noexcept {
+    fill_size_ += open_size_;
+    open_size_ = 0;
+  }
+
+  /**
+   * @brief Hands the fill buffer to an idle transmitter; false when it is busy, nothing is
+   * queued or a write is still open. The buffer stays untouched until OnTransferComplete().
+   */
+  bool TakeSubmission(const std::uint8_t*& out_data, std::size_t& out_length) noexcept {
+    if (in_flight_ || fill_size_ == 0u || open_size_ != 0u) {
+      return false;
+    }
+    out_data = buffers_[fill_].data();
+    out_length = fill_size_;
+    in_flight_ = true;
+    in_flight_size_ = fill_size_;
+    fill_ ^= 1u;
+    fill_size_ = 0;
+    ++stats_.submitted_buffers;
+    return true;
+  }
+
+  void OnTransferComplete() noexcept {
+    if (!in_flight_) {
+      return;
+    }
+    in_flight_ = false;
+    stats_.sent_bytes += static_cast<std::uint32_t>(in_flight_size_);
+    in_flight_size_ = 0;
+    if (open_size_ != 0u) {
+      ++stats_.underrun_count;
+    }
+  }
+
+  /** @brief Drops a submission the transmitter refused; its bytes count as dropped. */
+  void AbortSubmission() noexcept {
+    if (!in_flight_) {
+      return;
+    }
+    in_flight_ = false;
+    stats_.dropped_bytes += static_cast<std::uint32_t>(in_flight_size_);
+    in_flight_size_ = 0;
+  }
+
+  std::size_t WritableBytes() const noexcept {
+    return open_size_ != 0u ? 0u : kBufferBytes - fill_size_;
+  }
+
+  bool busy() const noexcept {
+    return in_flight_;
+  }
+
+  const DoubleBufferTxStats& stats() const noexcept {
+    return stats_;
+  }
+
+ private:
+  void CountDropped(std::size_t length) noexcept {
+    ++stats_.overflow_count;
+    stats_.dropped_bytes += static_cast<std::uint32_t>(length);
+  }
+
+  std::array<std::array<std::uint8_t, kBufferBytes>, 2> buffers_{};
+  std::size_t fill_ = 0;
+  std::size_t fill_size_ = 0;
+  std::size_t open_size_ = 0;
+  bool in_flight_ = false;
+  std::size_t in_flight_size_ = 0;
+  DoubleBufferTxStats stats_{};
+};
+
+}  // namespace domain::telemetry
@@ -0,0 +1,179 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace domain::telemetry {
+
+inline constexpr std::uint32_t kLiveSnapshotMagic = 0x4556494Cu;  // "LIVE"
+inline constexpr std::uint16_t kLiveSnapshotVersion = 1;
+inline constexpr std::size_t kLiveSnapshotHeaderBytes = 32;
+inline constexpr std::size_t kLiveSnapshotSlotHeaderBytes = 16;
+inline constexpr std::size_t kLiveSnapshotChannelBytes = 12;
+inline constexpr std::size_t kLiveSnapshotSlotCount = 2;
+
+/** @brief Latest state of one sensor; channel i holds sensor id i + 1. */
+struct LiveSnapshotChannel {
+  std::uint16_t raw = 0;
+  std::uint16_t reserved = 0;
+  float processed = 0.0f;
+  std::uint32_t timestamp_ticks = 0;
+};
+
+template <std::size_t kChannels>
+struct LiveSnapshotSlot {
+  /** @brief Odd while the slot is being written; +2 per publish. */
+  std::atomic<std::uint32_t> sequence{0};
+  std::uint32_t timestamp_ticks = 0;
+  std::uint32_t publish_count = 0;
+  std::uint32_t channel_mask = 0;
+  LiveSnapshotChannel channels[kChannels]{};
+};
+
+/**
+ * @brief Sensor values kept at a fixed address for a debugger to read in the background, with
+ * no target code involved (tools/live_snapshot.py). All fields are little endian:
+ *
+ *   offset  0  magic u32 ("LIVE")        offset 11  slot_count u8
+ *   offset  4  version u16               offset 12  ticks_per_second u32
+ *   offset  6  header_bytes u16          offset 16  latest_slot u32
+ *   offset  8  slot_bytes u16            offset 20  reserved
+ *   offset 10  channel_count u8
+ *
+ * slot_count slots of slot_bytes follow the header: sequence u32, timestamp_ticks u32,
+ * publish_count u32, channel_mask u32 (bit n = sensor id n + 1 fitted), then per channel raw
+ * u16, reserved u16, processed f32, timestamp_ticks u32.
+ *
+ * Publishes alternate between the slots, so a reader has a whole publish period to copy the
+ * slot named by latest_slot. The copy is consistent if the slot's sequence was even and had
+ * not changed once the copy was done; otherwise read again.
+ */
+template <std::size_t kChannels>
+struct LiveSnapshot {
+  static_assert(kChannels > 0u && kChannels <= 32u, "kChannels must fit a channel mask");
+
+  std::uint32_t magic = 0;
+  std::uint16_t version = 0;
+  std::uint16_t header_bytes = 0;
+  std::uint16_t slot_bytes = 0;
+  std::uint8_t channel_count = 0;
+  std::uint8_t slot_count = 0;
+  std::uint32_t ticks_per_second = 0;
+  std::atomic<std::uint32_t> latest_slot{0};
+  std::uint32_t reserved[3]{};
+  LiveSnapshotSlot<kChannels> slots[kLiveSnapshotSlotCount];
+};
+
+static_assert(sizeof(std::atomic<std::uint32_t>) == 4u, "sequence words must be plain u32");
+static_assert(sizeof(LiveSnapshotChannel) == kLiveSnapshotChannelBytes,
+              "LiveSnapshotChannel layout is documented");
+static_assert(offsetof(LiveSnapshotChannel, processed) == 4u,
+              "LiveSnapshotChannel layout is documented");
+static_assert(offsetof(LiveSnapshotSlot<1>, channels) == kLiveSnapshotSlotHeaderBytes,
+              "LiveSnapshotSlot layout is documented");
+static_assert(offsetof(LiveSnapshot<1>, latest_slot) == 16u, "LiveSnapshot layout is documented");
+static_assert(offsetof(LiveSnapshot<1>, slots) == kLiveSnapshotHeaderBytes,
+              "LiveSnapshot layout is documented");
+
+/**
+ * @brief Single writer of a LiveSnapshot (acquisition context). The snapshot may sit in a
+ * NOLOAD section, so the constructor fills in the whole header.
+ */
+template <std::size_t kChannels>
+class LiveSnapshotPublisher {
+ public:
+  using Snapshot = LiveSnapshot<kChannels>;
+  using Slot = LiveSnapshotSlot<kChannels>;
+
+  static_assert(sizeof(Slot) ==
+                    kLiveSnapshotSlotHeaderBytes + kChannels * kLiveSnapshotChannelBytes,
+                "LiveSnapshotSlot layout is documented");
+
+  LiveSnapshotPublisher(Snapshot& snapshot, std::uint32_t ticks_per_second) noexcept
+      : snapshot_(snapshot) {
+    snapshot_.magic = 0;
+    std::atomic_thread_fence(std::memory_order_release);
+    snapshot_.version = kLiveSnapshotVersion;
+    snapshot_.header_bytes = static_cast<std::uint16_t>(offsetof(Snapshot, slots));
+    snapshot_.slot_bytes = static_cast<std::uint16_t>(sizeof(Slot));
+    snapshot_.channel_count = static_cast<std::uint8_t>(kChannels);
+    snapshot_.slot_count = static_cast<std::uint8_t>(kLiveSnapshotSlotCount);
+    snapshot_.ticks_per_second = ticks_per_second;
+    snapshot_.latest_slot.store(0, std::memory_order_relaxed);
+    for (Slot& slot : snapshot_.slots) {
+      slot.sequence.store(0, std::memory_order_relaxed);
+      slot.timestamp_ticks = 0;
+      slot.publish_count = 0;
+      slot.channel_mask = 0;
+      for (LiveSnapshotChannel& channel : slot.channels) {
+        channel = LiveSnapshotChannel{};
+      }
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+    snapshot_.magic = kLiveSnapshotMagic;
+  }
+
+  /**
+   * @brief Writes the next slot through fill(LiveSnapshotChannel* channels) and makes it the
+   * latest. fill() sees the slot as last written two publishes ago.
+   */
+  template <typename FillFn>
+  void Publish(std::uint32_t timestamp_ticks, std::uint32_t channel_mask, FillFn&& fill) noexcept {
+    const std::uint32_t index =
+        (snapshot_.latest_slot.load(std::memory_order_relaxed) + 1u) % kLiveSnapshotSlotCount;
+    Slot& slot = snapshot_.slots[index];
+    const std::uint32_t sequence = slot.sequence.load(std::memory_order_relaxed);
+    slot.sequence.store(sequence + 1u, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    slot.timestamp_ticks = timestamp_ticks;
+    slot.publish_count = ++publish_count_;
+    slot.channel_mask = channel_mask;
+    fill(slot.channels);
+
+    slot.sequence.store(sequence + 2u, std::memory_order_release);
+    snapshot_.latest_slot.store(index, std::memory_order_release);
+  }
+
+  std::uint32_t publish_count() const noexcept {
+    return publish_count_;
+  }
+
+ private:
+  Snapshot& snapshot_;
+  std::uint32_t publish_count_ = 0;
+};
+
+/**
+ * @brief Reader side of the protocol, as tools/live_snapshot.py implements it; false when the
+ * snapshot is not initialized or the slot changed during the copy.
+ */
+template <std::size_t kChannels>
+bool TryReadLiveSnapshot(const LiveSnapshot<kChannels>& snapshot,
+                         LiveSnapshotSlot<kChannels>& out) noexcept {
+  if (snapshot.magic != kLiveSnapshotMagic) {
+    return false;
+  }
+  const std::uint32_t index =
+      snapshot.latest_slot.load(std::memory_order_acquire) % kLiveSnapshotSlotCount;
+  const LiveSnapshotSlot<kChannels>& slot = snapshot.slots[index];
+  const std::uint32_t before = slot.sequence.load(std::memory_order_acquire);
+  if ((before & 1u) != 0u) {
+    return false;
+  }
+  out.timestamp_ticks = slot.timestamp_ticks;
+  out.publish_count = slot.publish_count;
+  out.channel_mask = slot.channel_mask;
+  for (std::size_t i = 0; i < kChannels; ++i) {
+    out.channels[i] = slot.channels[i];
+  }
+  std::atomic_thread_fence(std::memory_order_acquire);
+  if (slot.sequence.load(std::memory_order_relaxed) != before) {
+    return false;
+  }
+  out.sequence.store(before, std::memory_order_relaxed);
+  return true;
+}
+
+}  // namespace domain::telemetry
@@ -0,0 +1,380 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "domain/telemetry/sensor_scan_frame.hpp"
+#include "domain/telemetry/telemetry_frame.hpp"
+
+namespace domain::telemetry {
+
+/**
+ * @brief Compressed scan block layout (payload of a kSensorScanDelta frame). The frame header
+ * timestamp is the first record's; then, repeated to the end of the payload:
+ *
+ *   header u8 (bit 7: key record, bits 0-6: mask slot, 0x7F: new mask u32 follows) |
+ *   varint timestamp delta from the previous record (0 for the first) |
+ *   per channel in ascending id order: key record u16, otherwise varint zig-zag delta from that
+ *   channel's previous value (mod 2^16)
+ *
+ * Mask slots are numbered in order of first use within the block, so every block decodes on its
+ * own apart from the channel references, which key records refresh.
+ */
+inline constexpr std::uint8_t kScanDeltaKeyFlag = 0x80;
+inline constexpr std::uint8_t kScanDeltaNewMask = 0x7F;
+inline constexpr std::size_t kScanDeltaMaxMasks = 16;
+inline constexpr std::size_t kScanDeltaMaxChannels = 32;
+inline constexpr std::size_t kVarintMaxBytes = 5;
+
+constexpr std::uint16_t ZigZagEncode16(std::int16_t value) noexcept {
+  return static_cast<std::uint16_t>((static_cast<std::uint16_t>(value) << 1u) ^
+                                    static_cast<std::uint16_t>(value < 0 ? 0xFFFFu : 0u));
+}
+
+constexpr std::int16_t ZigZagDecode16(std::uint16_t value) noexcept {
+  return static_cast<std::int16_t>((value >> 1u) ^ static_cast<std::uint16_t>(0u - (value & 1u)));
+}
+
+/** @brief LEB128; returns the bytes written, 0 when out_capacity is too small. */
+constexpr std::size_t WriteVarint(std::uint32_t value, std::uint8_t* out,
+                                  std::size_t out_capacity) noexcept {
+  std::size_t length = 0;
+  do {
+    if (length >= out_capacity) {
+      return 0;
+    }
+    std::uint8_t byte = static_cast<std::uint8_t>(value & 0x7Fu);
+    value >>= 7u;
+    if (value != 0u) {
+      byte |= 0x80u;
+    }
+    out[length++] = byte;
+  } while (value != 0u);
+  return length;
+}
+
+/** @brief Returns the bytes read, 0 for a truncated or over-long varint. */
+constexpr std::size_t ReadVarint(const std::uint8_t* in, std::size_t length,
+                                 std::uint32_t& out_value) noexcept {
+  std::uint32_t value = 0;
+  for (std::size_t i = 0; i < length && i < kVarintMaxBytes; ++i) {
+    value |= static_cast<std::uint32_t>(in[i] & 0x7Fu) << (7u * i);
+    if ((in[i] & 0x80u) == 0u) {
+      out_value = value;
+      return i + 1u;
+    }
+  }
+  return 0;
+}
+
+struct ScanDeltaConfig {
+  /** @brief Records per channel between key records, so a receiver recovers after a loss. */
+  std::uint32_t keyframe_interval = 100;
+};
+
+/**
+ * @brief Packs consecutive SensorScanSample records into one compressed scan block.
+ *
+ * A record is a key record when one of its channels has no reference yet or has gone
+ * keyframe_interval records since its last key. Resting keys move by a few counts per scan, so
+ * delta records carry one byte per channel instead of two and many records share one frame
+ * header.
+ */
+template <std::size_t kCapacity = kTelemetryMaxPayloadBytes>
+class ScanDeltaEncoder {
+ public:
+  explicit ScanDeltaEncoder(const ScanDeltaConfig& config = {}) noexcept : config_(config) {}
+
+  /** @brief Starts a new block and forgets every reference: the next records are keys. */
+  void Reset() noexcept {
+    Clear();
+    has_reference_ = 0;
+  }
+
+  /** @brief Starts a new block; channel references are kept. */
+  void Clear() noexcept {
+    size_ = 0;
+    mask_count_ = 0;
+    record_count_ = 0;
+  }
+
+  /**
+   * @brief Adds one record; false (block unchanged) when it does not fit, the block must then
+   * be sent and cleared.
+   */
+  bool Append(const SensorScanSample& sample) noexcept {
+    std::uint8_t record[1u + 4u + kVarintMaxBytes + 3u * kScanFrameMaxChannels]{};
+    std::size_t length = 1;
+
+    bool key = false;
+    for (std::uint32_t bits = sample.channel_mask; bits != 0u; bits &= bits - 1u) {
+      const std::size_t channel = LowestBit(bits);
+      if ((has_reference_ & (1u << channel)) == 0u ||
+          since_key_[channel] >= config_.keyframe_interval) {
+        key = true;
+      }
+    }
+
+    std::size_t slot = FindMask(sample.channel_mask);
+    if (slot == mask_count_) {
+      if (mask_count_ >= kScanDeltaMaxMasks) {
+        return false;
+      }
+      record[0] = kScanDeltaNewMask;
+      for (std::size_t i = 0; i < 4u; ++i) {
+        record[length++] = static_cast<std::uint8_t>(sample.channel_mask >> (8u * i));
+      }
+    } else {
+      record[0] = static_cast<std::uint8_t>(slot);
+    }
+    if (key) {
+      record[0] |= kScanDeltaKeyFlag;
+    }
+
+    const std::uint32_t timestamp_delta =
+        record_count_ == 0u ? 0u : sample.timestamp_ticks - last_timestamp_ticks_;
+    length += WriteVarint(timestamp_delta, record + length, kVarintMaxBytes);
+
+    std::size_t index = 0;
+    for (std::uint32_t bits = sample.channel_mask; bits != 0u && index < sample.count;
+         bits &= bits - 1u, ++index) {
+      const std::uint16_t value = sample.values[index];
+      if (key) {
+        record[length++] = static_cast<std::uint8_t>(value);
+        record[length++] = static_cast<std::uint8_t>(value >> 8u);
+      } else {
+        const std::uint16_t reference = references_[LowestBit(bits)];
+        const std::int16_t delta =
+            static_cast<std::int16_t>(static_cast<std::uint16_t>(value - reference));
+        length += WriteVarint(ZigZagEncode16(delta), record + length, 3u);
+      }
+    }
+
+    if (size_ + length > kCapacity) {
+      return false;
+    }
+    for (std::size_t i = 0; i < length; ++i) {
+      bytes_[size_ + i] = record[i];
+    }
+    size_ += length;
+
+    if (slot == mask_count_) {
+      masks_[mask_count_++] = sample.channel_mask;
+    }
+    index = 0;
+    for (std::uint32_t bits = sample.channel_mask; bits != 0u && index < sample.count;
+         bits &= bits - 1u, ++index) {
+      const std::size_t channel = LowestBit(bits);
+      references_[channel] = sample.values[index];
+      has_reference_ |= 1u << channel;
+      since_key_[channel] = key ? 0u : since_key_[channel] + 1u;
+    }
+    if (record_count_ == 0u) {
+      first_timestamp_ticks_ = sample.timestamp_ticks;
+    }
+    last_timestamp_ticks_ = sample.timestamp_ticks;
+    ++record_count_;
+    return true;
+  }
+
+  const std::uint8_t* data() const noexcept {
+    return bytes_.data();
+  }
+
+  std::size_t size() const noexcept {
+    return size_;
+  }
+
+  bool empty() const noexcept {
+    return record_count_ == 0u;
+  }
+
+  std::size_t record_count() const noexcept {
+    return record_count_;
+  }
+
+  std::uint32_t first_timestamp_ticks() const noexcept {
+    return first_timestamp_ticks_;
+  }
+
+  std::uint32_t last_timestamp_ticks() const noexcept {
+    return last_timestamp_ticks_;
+  }
+
+ private:
+  static std::size_t LowestBit(std::uint32_t bits) noexcept {
+    std::size_t bit = 0;
+    while ((bits & 1u) == 0u) {
+      bits >>= 1u;
+      ++bit;
+    }
+    return bit;
+  }
+
+  std::size_t FindMask(std::uint32_t mask) const noexcept {
+    for (std::size_t i = 0; i < mask_count_; ++i) {
+      if (masks_[i] == mask) {
+        return i;
+      }
+    }
+    return mask_count_;
+  }
+
+  ScanDeltaConfig config_{};
+  std::array<std::uint16_t, kScanDeltaMaxChannels> references_{};
+  std::array<std::uint32_t, kScanDeltaMaxChannels> since_key_{};
+  std::uint32_t has_reference_ = 0;
+
+  std::array<std::uint32_t, kScanDeltaMaxMasks> masks_{};
+  std::size_t mask_count_ = 0;
+  std::array<std::uint8_t, kCapacity> bytes_{};
+  std::size_t size_ = 0;
+  std::size_t record_count_ = 0;
+  std::uint32_t first_timestamp_ticks_ = 0;
+  std::uint32_t last_timestamp_ticks_ = 0;
+};
+
+struct ScanDeltaDecoderStats {
+  std::uint32_t record_count = 0;
+  /** @brief Delta records skipped because a channel had no reference after a loss. */
+  std::uint32_t unreferenced_record_count = 0;
+  std::uint32_t malformed_frame_count = 0;
+};
+
+/**
+ * @brief Expands compressed scan blocks back into SensorScanSample records.
+ *
+ * Pass every frame of the stream: a gap in frame sequence numbers drops all channel references,
+ * and delta records are skipped until key records restore them.
+ */
+class ScanDeltaDecoder {
+ public:
+  void Reset() noexcept {
+    has_reference_ = 0;
+    has_sequence_ = false;
+    stats_ = {};
+  }
+
+  /**
+   * @brief Passes the frame's records to sink.OnScanSample(const SensorScanSample&); ignores
+   * other frame types apart from their sequence number. Returns false for a malformed block;
+   * the records before the damage are still delivered.
+   */
+  template <typename SinkT>
+  bool Decode(const TelemetryFrameView& frame, SinkT& sink) {
+    if (has_sequence_ && frame.sequence != next_sequence_) {
+      has_reference_ = 0;
+    }
+    has_sequence_ = true;
+    next_sequence_ = static_cast<std::uint16_t>(frame.sequence + 1u);
+    if (frame.type != TelemetryFrameType::kSensorScanDelta) {
+      return true;
+    }
+
+    std::array<std::uint32_t, kScanDeltaMaxMasks> masks{};
+    std::size_t mask_count = 0;
+    std::uint32_t timestamp_ticks = frame.timestamp_ticks;
+    const std::uint8_t* in = frame.payload;
+    const std::uint8_t* const end = frame.payload + frame.payload_length;
+    while (in < end) {
+      const std::uint8_t header = *in++;
+      const bool key = (header & kScanDeltaKeyFlag) != 0u;
+      const std::size_t slot = header & kScanDeltaNewMask;
+      std::uint32_t mask = 0;
+      if (slot == kScanDeltaNewMask) {
+        if (end - in < 4 || mask_count >= kScanDeltaMaxMasks) {
+          return Malformed();
+        }
+        mask = static_cast<std::uint32_t>(in[0]) | (static_cast<std::uint32_t>(in[1]) << 8u) |
+               (static_cast<std::uint32_t>(in[2]) << 16u) |
+               (static_cast<std::uint32_t>(in[3]) << 24u);
+        in += 4;
+        masks[mask_count++] = mask;
+      } else if (slot < mask_count) {
+        mask = masks[slot];
+      } else {
+        return Malformed();
+      }
+      std::uint32_t timestamp_delta = 0;
+      const std::size_t used = ReadVarint(in, static_cast<std::size_t>(end - in),
+                                          timestamp_delta);
+      if (used == 0u) {
+        return Malformed();
+      }
+      in += used;
+      timestamp_ticks += timestamp_delta;
+
+      SensorScanSample sample{};
+      sample.timestamp_ticks = timestamp_ticks;
+      sample.channel_mask = mask;
+      bool referenced = true;
+      for (std::uint32_t bits = mask; bits != 0u; bits &= bits - 1u) {
+        const std::uint32_t channel_bit = bits & (0u - bits);
+        std::uint16_t value = 0;
+        if (key) {
+          if (end - in < 2) {
+            return Malformed();
+          }
+          value = static_cast<std::uint16_t>(in[0] | (in[1] << 8u));
+          in += 2;
+        } else {
+          std::uint32_t encoded = 0;
+          const std::size_t delta_used =
+              ReadVarint(in, static_cast<std::size_t>(end - in), encoded);
+          if (delta_used == 0u || encoded > 0xFFFFu) {
+            return Malformed();
+          }
+          in += delta_used;
+          referenced = referenced && (has_reference_ & channel_bit) != 0u;
+          value = static_cast<std::uint16_t>(
+              references_[BitIndex(channel_bit)] +
+              static_cast<std::uint16_t>(ZigZagDecode16(static_cast<std::uint16_t>(encoded))));
+        }
+        sample.values[sample.count++] = value;
+      }
+
+      if (!referenced) {
+        ++stats_.unreferenced_record_count;
+        continue;
+      }
+      std::size_t index = 0;
+      for (std::uint32_t bits = mask; bits != 0u; bits &= bits - 1u, ++index) {
+        const std::uint32_t channel_bit = bits & (0u - bits);
+        references_[BitIndex(channel_bit)] = sample.values[index];
+        has_reference_ |= channel_bit;
+      }
+      ++stats_.record_count;
+      sink.OnScanSample(sample);
+    }
+    return true;
+  }
+
+  const ScanDeltaDecoderStats& stats() const noexcept {
+    return stats_;
+  }
+
+ private:
+  static std::size_t BitIndex(std::uint32_t single_bit) noexcept {
+    std::size_t index = 0;
+    while (single_bit > 1u) {
+      single_bit >>= 1u;
+      ++index;
+    }
+    return index;
+  }
+
+  bool Malformed() noexcept {
+    ++stats_.malformed_frame_count;
+    has_reference_ = 0;
+    return false;
+  }
+
+  std::array<std::uint16_t, kScanDeltaMaxChannels> references_{};
+  std::uint32_t has_reference_ = 0;
+  bool has_sequence_ = false;
+  std::uint16_t next_sequence_ = 0;
+  ScanDeltaDecoderStats stats_{};
+};
+
+}  // namespace domain::telemetry
@@ -0,0 +1,178 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "domain/telemetry/sensor_scan_frame.hpp"
+
+namespace domain::telemetry {
+
+inline constexpr std::size_t kScanEnvelopeHeaderBytes = 10;
+inline constexpr std::size_t kScanEnvelopeChannelBytes = 6;
+inline constexpr std::size_t kScanEnvelopeMaxBytes =
+    kScanEnvelopeHeaderBytes + kScanEnvelopeChannelBytes * kScanFrameMaxChannels;
+
+/**
+ * @brief Minimum, maximum and sum of every sample of each channel over one telemetry period.
+ * Values are raw counts or ScaleProcessedValue() results widened to int32, so both order
+ * correctly; channel i holds sensor id i + 1.
+ */
+template <std::size_t kChannels>
+struct ScanEnvelope {
+  static_assert(kChannels > 0u && kChannels <= kScanFrameMaxChannels,
+                "kChannels must fit a channel mask");
+
+  std::uint32_t first_timestamp_ticks = 0;
+  std::uint32_t last_timestamp_ticks = 0;
+  std::uint32_t channel_mask = 0;
+  std::array<std::int32_t, kChannels> min{};
+  std::array<std::int32_t, kChannels> max{};
+  std::array<std::int64_t, kChannels> sum{};
+  std::array<std::uint16_t, kChannels> count{};
+
+  /** @brief Mean rounded half away from zero; 0 for a channel without samples. */
+  std::int32_t mean(std::size_t channel) const noexcept {
+    if (count[channel] == 0u) {
+      return 0;
+    }
+    const std::int64_t n = count[channel];
+    const std::int64_t total = sum[channel];
+    return static_cast<std::int32_t>(total >= 0 ? (total + n / 2) / n : (total - n / 2) / n);
+  }
+};
+
+/**
+ * @brief Folds every sample into per-channel envelopes closed once they span period_ticks.
+ *
+ * Runs in the acquisition path: Add() is two compares and an add per value, and closing a
+ * period copies one envelope. Decimating this way keeps short excursions that sampling once per
+ * period would miss.
+ */
+template <std::size_t kChannels>
+class ScanEnvelopeAccumulator {
+ public:
+  using Envelope = ScanEnvelope<kChannels>;
+
+  /** @brief Drops the open envelope; the next Advance() starts a fresh one. */
+  void Reset(std::uint32_t period_ticks) noexcept {
+    period_ticks_ = period_ticks;
+    open_ = false;
+  }
+
+  /**
+   * @brief Starts the period containing timestamp_ticks. Returns true when that closed the
+   * previous envelope, which closed() then holds.
+   */
+  bool Advance(std::uint32_t timestamp_ticks) noexcept {
+    if (!open_) {
+      Start(timestamp_ticks);
+      return false;
+    }
+    if (timestamp_ticks - current_.first_timestamp_ticks < period_ticks_) {
+      current_.last_timestamp_ticks = timestamp_ticks;
+      return false;
+    }
+    closed_ = current_;
+    Start(timestamp_ticks);
+    return true;
+  }
+
+  void Add(std::size_t channel, std::int32_t value) noexcept {
+    if (channel >= kChannels) {
+      return;
+    }
+    if (current_.count[channel] == UINT16_MAX) {
+      return;
+    }
+    if (current_.count[channel] == 0u) {
+      current_.min[channel] = value;
+      current_.max[channel] = value;
+      current_.sum[channel] = 0;
+      current_.channel_mask |= 1u << channel;
+    } else if (value < current_.min[channel]) {
+      current_.min[channel] = value;
+    } else if (value > current_.max[channel]) {
+      current_.max[channel] = value;
+    }
+    current_.sum[channel] += value;
+    ++current_.count[channel];
+  }
+
+  const Envelope& current() const noexcept {
+    return current_;
+  }
+
+  const Envelope& closed() const noexcept {
+    return closed_;
+  }
+
+ private:
+  void Start(std::uint32_t timestamp_ticks) noexcept {
+    current_.first_timestamp_ticks = timestamp_ticks;
+    current_.last_timestamp_ticks = timestamp_ticks;
+    current_.channel_mask = 0;
+    current_.count.fill(0);
+    open_ = true;
+  }
+
+  std::uint32_t period_ticks_ = 0;
+  bool open_ = false;
+  Envelope current_{};
+  Envelope closed_{};
+};
+
+/**
+ * @brief Packs one envelope: channel mask u32 (bit n = sensor id n + 1), span u32 (ticks from
+ * the first to the last sample), samples u16 (most per channel), then min, max and mean as
+ * 16-bit values per set bit in ascending id order, all little endian. The first sample's
+ * timestamp travels in the telemetry frame header. 22 channels take 142 bytes.
+ */
+class ScanEnvelopeFrameBuilder {
+ public:
+  template <std::size_t kChannels>
+  void Build(const ScanEnvelope<kChannels>& envelope) noexcept {
+    size_ = 0;
+    std::uint16_t samples = 0;
+    for (std::size_t i = 0; i < kChannels; ++i) {
+      if ((envelope.channel_mask & (1u << i)) != 0u && envelope.count[i] > samples) {
+        samples = envelope.count[i];
+      }
+    }
+    WriteU32(envelope.channel_mask);
+    WriteU32(envelope.last_timestamp_ticks - envelope.first_timestamp_ticks);
+    WriteU16(samples);
+    for (std::size_t i = 0; i < kChannels; ++i) {
+      if ((envelope.channel_mask & (1u << i)) == 0u) {
+        continue;
+      }
+      WriteU16(static_cast<std::uint16_t>(envelope.min[i]));
+      WriteU16(static_cast<std::uint16_t>(envelope.max[i]));
+      WriteU16(static_cast<std::uint16_t>(envelope.mean(i)));
+    }
+  }
+
+  const std::uint8_t* data() const noexcept {
+    return bytes_.data();
+  }
+
+  std::size_t size() const noexcept {
+    return size_;
+  }
+
+ private:
+  void WriteU16(std::uint16_t value) noexcept {
+    bytes_[size_++] = static_cast<std::uint8_t>(value);
+    bytes_[size_++] = static_cast<std::uint8_t>(value >> 8u);
+  }
+
+  void WriteU32(std::uint32_t value) noexcept {
+    WriteU16(static_cast<std::uint16_t>(value));
+    WriteU16(static_cast<std::uint16_t>(value >> 16u));
+  }
+
+  std::array<std::uint8_t, kScanEnvelopeMaxBytes> bytes_{};
+  std::size_t size_ = 0;
+};
+
+}  // namespace domain::telemetry
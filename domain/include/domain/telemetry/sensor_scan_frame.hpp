@@ -0,0 +1,104 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace domain::telemetry {
+
+inline constexpr std::size_t kScanFrameMaxChannels = 32;
+inline constexpr std::size_t kScanFrameHeaderBytes = 4;
+inline constexpr std::size_t kScanFrameMaxBytes =
+    kScanFrameHeaderBytes + 2u * kScanFrameMaxChannels;
+
+/** @brief Processed values (mA) are sent as int16 microamps, saturated to +/-32.767 mA. */
+inline constexpr float kScanProcessedScale = 1000.0f;
+
+constexpr std::size_t ScanChannelCount(std::uint32_t channel_mask) noexcept {
+  std::size_t count = 0;
+  for (; channel_mask != 0u; channel_mask &= channel_mask - 1u) {
+    ++count;
+  }
+  return count;
+}
+
+constexpr std::size_t ScanFrameSize(std::uint32_t channel_mask) noexcept {
+  return kScanFrameHeaderBytes + 2u * ScanChannelCount(channel_mask);
+}
+
+constexpr std::int16_t ScaleProcessedValue(float value) noexcept {
+  const float scaled = value * kScanProcessedScale;
+  if (scaled >= 32767.0f) {
+    return 32767;
+  }
+  if (scaled <= -32768.0f) {
+    return -32768;
+  }
+  return static_cast<std::int16_t>(scaled >= 0.0f ? scaled + 0.5f : scaled - 0.5f);
+}
+
+/**
+ * @brief The observed channels of one acquisition scan, values in ascending id order, as queued
+ * between the acquisition and telemetry tasks.
+ */
+struct SensorScanSample {
+  std::uint32_t timestamp_ticks = 0;
+  std::uint32_t channel_mask = 0;
+  std::uint8_t count = 0;
+  std::array<std::uint16_t, kScanFrameMaxChannels> values{};
+};
+
+/**
+ * @brief Packs one acquisition scan of a channel set: channel mask (u32, bit n = sensor id
+ * n + 1), then one 16-bit value per set bit in ascending id order, all little endian. Values are
+ * raw ADC counts or ScaleProcessedValue() results, per the stream's mode. The scan timestamp
+ * travels in the telemetry frame header. 22 channels take 48 bytes where one float per channel
+ * would take 88.
+ */
+class SensorScanFrameBuilder {
+ public:
+  void Begin(std::uint32_t channel_mask) noexcept {
+    size_ = 0;
+    WriteU32(channel_mask);
+  }
+
+  void Build(const SensorScanSample& sample) noexcept {
+    Begin(sample.channel_mask);
+    for (std::size_t i = 0; i < sample.count && i < sample.values.size(); ++i) {
+      Append(sample.values[i]);
+    }
+  }
+
+  /** @brief Appends the next channel's value; ignored once the frame is full. */
+  void Append(std::uint16_t value) noexcept {
+    if (size_ + 2u > bytes_.size()) {
+      return;
+    }
+    bytes_[size_++] = static_cast<std::uint8_t>(value);
+    bytes_[size_++] = static_cast<std::uint8_t>(value >> 8u);
+  }
+
+  void Append(std::int16_t value) noexcept {
+    Append(static_cast<std::uint16_t>(value));
+  }
+
+  const std::uint8_t* data() const noexcept {
+    return bytes_.data();
+  }
+
+  std::size_t size() const noexcept {
+    return size_;
+  }
+
+ private:
+  void WriteU32(std::uint32_t value) noexcept {
+    for (std::size_t i = 0; i < 4u; ++i) {
+      bytes_[size_++] = static_cast<std::uint8_t>(value >> (8u * i));
+    }
+  }
+
+  std::array<std::uint8_t, kScanFrameMaxBytes> bytes_{};
+  std::size_t size_ = 0;
+};
+
+}  // namespace domain::telemetry
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace domain::telemetry {
+
+/**
+ * @brief Lossless single-producer / single-consumer ring of trivially copyable records.
+ *
+ * A record pushed into a full ring is dropped and counted, so what the consumer reads is always
+ * an exact, in-order subsequence of what was produced and the drop count says how much is
+ * missing. TryPush() runs in the producer context only; Peek(), Pop() and TryPop() in the
+ * consumer context only. Indices are published with release/acquire ordering, so a record is
+ * complete before the other side can see it.
+ */
+template <typename T, std::size_t kCapacity>
+class SpscRing {
+  static_assert(kCapacity > 0u && (kCapacity & (kCapacity - 1u)) == 0u,
+                "kCapacity must be a power of two");
+
+ public:
+  bool TryPush(const T& record) noexcept {
+    const std::uint32_t head = head_.load(std::memory_order_relaxed);
+    const std::uint32_t tail = tail_.load(std::memory_order_acquire);
+    if (head - tail >= kCapacity) {
+      dropped_count_.store(dropped_count_.load(std::memory_order_relaxed) + 1u,
+                           std::memory_order_relaxed);
+      return false;
+    }
+    records_[head & kMask] = record;
+    head_.store(head + 1u, std::memory_order_release);
+    return true;
+  }
+
+  /** @brief Copies the oldest record without consuming it; false when empty. */
+  bool Peek(T& out) const noexcept {
+    const std::uint32_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail == head_.load(std::memory_order_acquire)) {
+      return false;
+    }
+    out = records_[tail & kMask];
+    return true;
+  }
+
+  /** @brief Consumes the oldest record; call only after a successful Peek(). */
+  void Pop() noexcept {
+    tail_.store(tail_.load(std::memory_order_relaxed) + 1u, std::memory_order_release);
+  }
+
+  bool TryPop(T& out) noexcept {
+    if (!Peek(out)) {
+      return false;
+    }
+    Pop();
+    return true;
+  }
+
+  std::size_t size() const noexcept {
+    return static_cast<std::size_t>(head_.load(std::memory_order_acquire) -
+                                    tail_.load(std::memory_order_acquire));
+  }
+
+  static constexpr std::size_t capacity() noexcept {
+    return kCapacity;
+  }
+
+  /** @brief Records rejected because the ring was full (counted by the producer). */
+  std::uint32_t dropped_count() const noexcept {
+    return dropped_count_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  static constexpr std::uint32_t kMask = static_cast<std::uint32_t>(kCapacity - 1u);
+
+  T records_[kCapacity]{};
+  std::atomic<std::uint32_t> head_{0};
+  std::atomic<std::uint32_t> tail_{0};
+  std::atomic<std::uint32_t> dropped_count_{0};
+};
+
+}  // namespace domain::telemetry
@@ -0,0 +1,248 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace domain::telemetry {
+
+/**
+ * @brief Telemetry frame layout, all fields little endian:
+ *
+ *   sync (0xA5 0x5A) | type u8 | sequence u16 | timestamp u32 | payload length u16 |
+ *   payload | CRC16
+ *
+ * The CRC (CCITT-FALSE: poly 0x1021, init 0xFFFF) covers type through payload. The sequence
+ * counts every frame the encoder produced, so a receiver sees frames the link skipped as a gap.
+ * tools/telemetry_frames.py implements the same format for the host.
+ */
+inline constexpr std::uint8_t kTelemetrySync0 = 0xA5;
+inline constexpr std::uint8_t kTelemetrySync1 = 0x5A;
+inline constexpr std::size_t kTelemetryFrameHeaderBytes = 11;
+inline constexpr std::size_t kTelemetryFrameCrcBytes = 2;
+inline constexpr std::size_t kTelemetryFrameOverheadBytes =
+    kTelemetryFrameHeaderBytes + kTelemetryFrameCrcBytes;
+inline constexpr std::size_t kTelemetryMaxPayloadBytes = 256;
+
+enum class TelemetryFrameType : std::uint8_t {
+  /** @brief One sensor value: sensor id u8, float32. */
+  kSensorValue = 1,
+  /** @brief One scan of a channel set: SensorScanFrameBuilder payload. */
+  kSensorScan = 2,
+  /** @brief Consecutive scans, delta compressed: ScanDeltaEncoder payload. */
+  kSensorScanDelta = 3,
+  /**
+   * @brief Header of a frozen capture readout, timestamped at the trigger: channel mask u32,
+   * scan count u32, trigger index u32, trigger sensor id u8, slope u8, threshold u16. The scans
+   * follow as kSensorScan frames in chronological order.
+   */
+  kCaptureInfo = 4,
+  /** @brief Min/max/mean of a channel set over one period: ScanEnvelopeFrameBuilder payload. */
+  kSensorScanEnvelope = 5,
+};
+
+namespace detail {
+
+constexpr std::array<std::uint16_t, 256> MakeCrc16Table() noexcept {
+  std::array<std::uint16_t, 256> table{};
+  for (std::size_t i = 0; i < table.size(); ++i) {
+    std::uint16_t crc = static_cast<std::uint16_t>(i << 8u);
+    for (int bit = 0; bit < 8; ++bit) {
+      crc = static_cast<std::uint16_t>((crc & 0x8000u) != 0u ? (crc << 1u) ^ 0x1021u : crc << 1u);
+    }
+    table[i] = crc;
+  }
+  return table;
+}
+
+inline constexpr std::array<std::uint16_t, 256> kCrc16Table = MakeCrc16Table();
+
+}  // namespace detail
+
+constexpr std::uint16_t Crc16Update(std::uint16_t crc, const std::uint8_t* data,
+                                    std::size_t length) noexcept {
+  for (std::size_t i = 0; i < length; ++i) {
+    crc = static_cast<std::uint16_t>((crc << 8u) ^
+                                     detail::kCrc16Table[((crc >> 8u) ^ data[i]) & 0xFFu]);
+  }
+  return crc;
+}
+
+constexpr std::uint16_t Crc16(const std::uint8_t* data, std::size_t length) noexcept {
+  return Crc16Update(0xFFFFu, data, length);
+}
+
+struct TelemetryFrameView {
+  TelemetryFrameType type = TelemetryFrameType::kSensorValue;
+  std::uint16_t sequence = 0;
+  std::uint32_t timestamp_ticks = 0;
+  const std::uint8_t* payload = nullptr;
+  std::size_t payload_length = 0;
+};
+
+class TelemetryFrameEncoder {
+ public:
+  /**
+   * @brief Writes one frame to out and returns its size; 0 (sequence unchanged) when the payload
+   * exceeds kTelemetryMaxPayloadBytes or the frame does not fit out_capacity.
+   */
+  std::size_t Encode(TelemetryFrameType type, std::uint32_t timestamp_ticks,
+                     const std::uint8_t* payload, std::size_t payload_length, std::uint8_t* out,
+                     std::size_t out_capacity) noexcept {
+    const std::size_t size = kTelemetryFrameOverheadBytes + payload_length;
+    if (out == nullptr || payload_length > kTelemetryMaxPayloadBytes || size > out_capacity ||
+        (payload == nullptr && payload_length != 0u)) {
+      return 0;
+    }
+    out[0] = kTelemetrySync0;
+    out[1] = kTelemetrySync1;
+    out[2] = static_cast<std::uint8_t>(type);
+    out[3] = static_cast<std::uint8_t>(sequence_);
+    out[4] = static_cast<std::uint8_t>(sequence_ >> 8u);
+    for (std::size_t i = 0; i < 4u; ++i) {
+      out[5u + i] = static_cast<std::uint8_t>(timestamp_ticks >> (8u * i));
+    }
+    out[9] = static_cast<std::uint8_t>(payload_length);
+    out[10] = static_cast<std::uint8_t>(payload_length >> 8u);
+    for (std::size_t i = 0; i < payload_length; ++i) {
+      out[kTelemetryFrameHeaderBytes + i] = payload[i];
+    }
+    const std::uint16_t crc = Crc16(out + 2, kTelemetryFrameHeaderBytes - 2u + payload_length);
+    out[kTelemetryFrameHeaderBytes + payload_length] = static_cast<std::uint8_t>(crc);
+    out[kTelemetryFrameHeaderBytes + payload_length + 1u] = static_cast<std::uint8_t>(crc >> 8u);
+    ++sequence_;
+    return size;
+  }
+
+  std::uint16_t next_sequence() const noexcept {
+    return sequence_;
+  }
+
+ private:
+  std::uint16_t sequence_ = 0;
+};
+
+struct TelemetryDecoderStats {
+  std::uint32_t frame_count = 0;
+  /** @brief Frames whose sequence number says they were produced but never received. */
+  std::uint32_t lost_frame_count = 0;
+  std::uint32_t crc_error_count = 0;
+  /** @brief Bytes discarded while searching for the next valid frame. */
+  std::uint32_t skipped_byte_count = 0;
+};
+
+/**
+ * @brief Byte-stream decoder that finds frames at any offset and recovers from corruption.
+ *
+ * Bytes are buffered until a complete frame can be checked. A bad sync, an impossible length or
+ * a CRC mismatch discards one byte and the search resumes from the next, so a frame that starts
+ * inside a damaged or truncated one is still found. Frames larger than kMaxPayload are treated
+ * as corrupt.
+ */
+template <std::size_t kMaxPayload = kTelemetryMaxPayloadBytes>
+class TelemetryFrameDecoder {
+ public:
+  void Reset() noexcept {
+    size_ = 0;
+    has_sequence_ = false;
+    stats_ = {};
+  }
+
+  /**
+   * @brief Consumes bytes, passing each valid frame to sink.OnTelemetryFrame(const
+   * TelemetryFrameView&); returns the number of frames decoded. The view is valid during the
+   * call only.
+   */
+  template <typename SinkT>
+  std::size_t Feed(const std::uint8_t* data, std::size_t length, SinkT& sink) {
+    std::size_t decoded = 0;
+    if (data == nullptr) {
+      return 0;
+    }
+    for (std::size_t i = 0; i < length; ++i) {
+      buffer_[size_++] = data[i];
+      decoded += Parse(sink);
+    }
+    return decoded;
+  }
+
+  const TelemetryDecoderStats& stats() const noexcept {
+    return stats_;
+  }
+
+ private:
+  template <typename SinkT>
+  std::size_t Parse(SinkT& sink) {
+    std::size_t decoded = 0;
+    for (;;) {
+      if (size_ >= 1u && buffer_[0] != kTelemetrySync0) {
+        Skip();
+        continue;
+      }
+      if (size_ >= 2u && buffer_[1] != kTelemetrySync1) {
+        Skip();
+        continue;
+      }
+      if (size_ < kTelemetryFrameHeaderBytes) {
+        return decoded;
+      }
+      const std::size_t payload_length =
+          static_cast<std::size_t>(buffer_[9]) | (static_cast<std::size_t>(buffer_[10]) << 8u);
+      if (payload_length > kMaxPayload) {
+        Skip();
+        continue;
+      }
+      const std::size_t frame_size = kTelemetryFrameOverheadBytes + payload_length;
+      if (size_ < frame_size) {
+        return decoded;
+      }
+      const std::uint16_t crc = Crc16(buffer_.data() + 2, frame_size - 4u);
+      const std::uint16_t received =
+          static_cast<std::uint16_t>(buffer_[frame_size - 2u] | (buffer_[frame_size - 1u] << 8u));
+      if (crc != received) {
+        ++stats_.crc_error_count;
+        Skip();
+        continue;
+      }
+
+      TelemetryFrameView view{};
+      view.type = static_cast<TelemetryFrameType>(buffer_[2]);
+      view.sequence = static_cast<std::uint16_t>(buffer_[3] | (buffer_[4] << 8u));
+      view.timestamp_ticks = static_cast<std::uint32_t>(buffer_[5]) |
+                             (static_cast<std::uint32_t>(buffer_[6]) << 8u) |
+                             (static_cast<std::uint32_t>(buffer_[7]) << 16u) |
+                             (static_cast<std::uint32_t>(buffer_[8]) << 24u);
+      view.payload = buffer_.data() + kTelemetryFrameHeaderBytes;
+      view.payload_length = payload_length;
+      if (has_sequence_) {
+        stats_.lost_frame_count += static_cast<std::uint16_t>(view.sequence - next_sequence_);
+      }
+      has_sequence_ = true;
+      next_sequence_ = static_cast<std::uint16_t>(view.sequence + 1u);
+      ++stats_.frame_count;
+      sink.OnTelemetryFrame(view);
+      ++decoded;
+      Discard(frame_size);
+    }
+  }
+
+  void Skip() noexcept {
+    ++stats_.skipped_byte_count;
+    Discard(1);
+  }
+
+  void Discard(std::size_t count) noexcept {
+    for (std::size_t i = count; i < size_; ++i) {
+      buffer_[i - count] = buffer_[i];
+    }
+    size_ -= count;
+  }
+
+  std::array<std::uint8_t, kTelemetryFrameOverheadBytes + kMaxPayload> buffer_{};
+  std::size_t size_ = 0;
+  bool has_sequence_ = false;
+  std::uint16_t next_sequence_ = 0;
+  TelemetryDecoderStats stats_{};
+};
+
+}  // namespace domain::telemetry
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace domain::telemetry {
+
+struct TelemetryRateControllerConfig {
+  /** @brief The link is judged once per window, on its peak fill and any loss within it. */
+  std::uint32_t window_ms = 100;
+  /** @brief A window peaking at or above this fill (or losing data) steps down one level. */
+  std::uint32_t high_fill_percent = 50;
+  /** @brief Windows that all peak below this fill step back up, raise_windows at a time. */
+  std::uint32_t low_fill_percent = 15;
+  std::uint32_t raise_windows = 20;
+  /** @brief Most compact level; 0 is the rate the host asked for. */
+  std::uint8_t max_level = 5;
+};
+
+struct TelemetryRateControllerStats {
+  std::uint32_t step_down_count = 0;
+  std::uint32_t step_up_count = 0;
+  /** @brief Windows in which frames were lost, whatever the level. */
+  std::uint32_t lossy_windows = 0;
+};
+
+/**
+ * @brief Picks how far telemetry backs off from the requested rate from the link's buffer fill
+ * and loss counts.
+ *
+ * Level 0 is the requested stream; each level up is cheaper on the link, and what a level means
+ * is up to the caller. Stepping down is quick (one level per lossy or congested window) so the
+ * buffer drains before frames are lost; stepping up needs raise_windows calm windows in a row,
+ * so a host that only just keeps up is not pushed back into losses every few windows.
+ */
+class TelemetryRateController {
+ public:
+  explicit TelemetryRateController(const TelemetryRateControllerConfig& config = {}) noexcept
+      : config_(config) {}
+
+  /** @brief Back to level 0; lost_total is the current cumulative loss count. */
+  void Reset(std::uint32_t lost_total) noexcept {
+    level_ = 0;
+    calm_windows_ = 0;
+    ResetWindow(lost_total);
+  }
+
+  /**
+   * @brief Feeds one observation after elapsed_ms. lost_total counts every frame or write lost
+   * so far (it may wrap). Returns true when the level changed.
+   */
+  bool Update(std::uint32_t elapsed_ms, std::size_t used_bytes, std::size_t capacity_bytes,
+              std::uint32_t lost_total) noexcept {
+    const std::uint32_t fill_percent =
+        capacity_bytes == 0u
+            ? 0u
+            : static_cast<std::uint32_t>((used_bytes * 100u + capacity_bytes - 1u) /
+                                         capacity_bytes);
+    if (fill_percent > peak_fill_percent_) {
+      peak_fill_percent_ = fill_percent;
+    }
+    window_elapsed_ms_ += elapsed_ms;
+    if (window_elapsed_ms_ < config_.window_ms) {
+      return false;
+    }
+
+    const bool lossy = lost_total != window_lost_base_;
+    const std::uint32_t peak = peak_fill_percent_;
+    ResetWindow(lost_total);
+    if (lossy) {
+      ++stats_.lossy_windows;
+    }
+
+    if (lossy || peak >= config_.high_fill_percent) {
+      calm_windows_ = 0;
+      if (level_ >= config_.max_level) {
+        return false;
+      }
+      ++level_;
+      ++stats_.step_down_count;
+      return true;
+    }
+
+    if (peak >= config_.low_fill_percent) {
+      calm_windows_ = 0;
+      return false;
+    }
+    if (level_ == 0u || ++calm_windows_ < config_.raise_windows) {
+      return false;
+    }
+    calm_windows_ = 0;
+    --level_;
+    ++stats_.step_up_count;
+    return true;
+  }
+
+  std::uint8_t level() const noexcept {
+    return level_;
+  }
+
+  const TelemetryRateControllerStats& stats() const noexcept {
+    return stats_;
+  }
+
+ private:
+  void ResetWindow(std::uint32_t lost_total) noexcept {
+    window_elapsed_ms_ = 0;
+    peak_fill_percent_ = 0;
+    window_lost_base_ = lost_total;
+  }
+
+  TelemetryRateControllerConfig config_{};
+  std::uint8_t level_ = 0;
+  std::uint32_t calm_windows_ = 0;
+  std::uint32_t window_elapsed_ms_ = 0;
+  std::uint32_t peak_fill_percent_ = 0;
+  std::uint32_t window_lost_base_ = 0;
+  TelemetryRateControllerStats stats_{};
+};
+
+}  // namespace domain::telemetry
@@ -0,0 +1,210 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace domain::telemetry {
+
+/** @brief One scan of every channel: raw counts indexed by channel (sensor id - 1). */
+template <std::size_t kChannels>
+struct CaptureScan {
+  std::uint32_t timestamp_ticks = 0;
+  std::array<std::uint16_t, kChannels> values{};
+};
+
+enum class TriggerSlope : std::uint8_t {
+  kRising = 0,
+  kFalling = 1,
+  kEither = 2,
+  /**
+   * @brief Fires as soon as pre_scans scans are recorded. With pre_scans = 0 the capture is a
+   * plain recording of post_scans + 1 scans laid out from the start of the storage.
+   */
+  kImmediate = 3,
+};
+
+enum class CaptureState : std::uint8_t {
+  kIdle = 0,
+  /** @brief Recording into the ring and waiting for the trigger. */
+  kArmed = 1,
+  /** @brief Trigger seen, recording the post-trigger scans. */
+  kTriggered = 2,
+  /** @brief Capture complete; the ring holds it until the next Arm(). */
+  kFrozen = 3,
+};
+
+struct TriggerConfig {
+  std::uint8_t channel = 0;
+  std::uint16_t threshold = 0;
+  /** @brief A pressed key pulls its counts down, so a strike crosses the threshold falling. */
+  TriggerSlope slope = TriggerSlope::kFalling;
+  std::uint32_t pre_scans = 0;
+  std::uint32_t post_scans = 0;
+};
+
+/**
+ * @brief Pre/post trigger capture over a caller-provided ring of scans.
+ *
+ * Once armed, every pushed scan is written into the ring. The trigger fires when the trigger
+ * channel crosses the threshold between two consecutive scans with the configured slope, but
+ * only after pre_scans scans are recorded, so a capture always holds pre_scans + 1 + post_scans
+ * scans. After the last post-trigger scan the capture freezes: Push() ignores further scans and
+ * the capture can be read at leisure.
+ *
+ * Push() runs in the acquisition context; Arm(), Disarm() and the readout accessors in one other
+ * task. The state is published with release/acquire ordering: the configuration is in place
+ * before Push() sees kArmed and the scans are complete before a reader sees kFrozen.
+ */
+template <std::size_t kChannels>
+class TriggerCapture {
+ public:
+  using Scan = CaptureScan<kChannels>;
+
+  TriggerCapture(Scan* storage, std::size_t capacity) noexcept
+      : storage_(storage), capacity_(storage == nullptr ? 0u : capacity) {}
+
+  /**
+   * @brief Starts a new capture; false (nothing changed) while a capture is in progress or when
+   * the channel or the scan counts do not fit.
+   */
+  bool Arm(const TriggerConfig& config) noexcept {
+    const CaptureState state = this->state();
+    if (state == CaptureState::kArmed || state == CaptureState::kTriggered ||
+        config.channel >= kChannels || config.pre_scans >= capacity_ ||
+        config.post_scans >= capacity_ - config.pre_scans) {
+      return false;
+    }
+    config_ = config;
+    write_ = 0;
+    filled_ = 0;
+    has_previous_ = false;
+    state_.store(CaptureState::kArmed, std::memory_order_release);
+    return true;
+  }
+
+  void Disarm() noexcept {
+    state_.store(CaptureState::kIdle, std::memory_order_release);
+  }
+
+  void Push(const Scan& scan) noexcept {
+    const CaptureState state = state_.load(std::memory_order_acquire);
+    if (state != CaptureState::kArmed && state != CaptureState::kTriggered) {
+      return;
+    }
+    const std::size_t position = write_;
+    storage_[position] = scan;
+    write_ = position + 1u == capacity_ ? 0u : position + 1u;
+    if (filled_ < capacity_) {
+      ++filled_;
+    }
+
+    if (state == CaptureState::kTriggered) {
+      if (--remaining_ == 0u) {
+        Transition(CaptureState::kTriggered, CaptureState::kFrozen);
+      }
+      return;
+    }
+
+    const std::uint16_t value = scan.values[config_.channel];
+    const bool fired =
+        filled_ > config_.pre_scans &&
+        (config_.slope == TriggerSlope::kImmediate || (has_previous_ && Crossed(previous_, value)));
+    previous_ = value;
+    has_previous_ = true;
+    if (!fired) {
+      return;
+    }
+    trigger_position_ = position;
+    trigger_timestamp_ticks_ = scan.timestamp_ticks;
+    remaining_ = config_.post_scans;
+    Transition(CaptureState::kArmed,
+               remaining_ == 0u ? CaptureState::kFrozen : CaptureState::kTriggered);
+  }
+
+  CaptureState state() const noexcept {
+    return state_.load(std::memory_order_acquire);
+  }
+
+  const TriggerConfig& config() const noexcept {
+    return config_;
+  }
+
+  /** @brief Scans held by a frozen capture, 0 otherwise. */
+  std::size_t size() const noexcept {
+    if (state() != CaptureState::kFrozen) {
+      return 0;
+    }
+    return config_.pre_scans + 1u + config_.post_scans;
+  }
+
+  /** @brief Index of the trigger scan within the capture. */
+  std::size_t trigger_index() const noexcept {
+    return config_.pre_scans;
+  }
+
+  std::uint32_t trigger_timestamp_ticks() const noexcept {
+    return trigger_timestamp_ticks_;
+  }
+
+  /** @brief Storage slot of the oldest scan of a frozen capture; the capture wraps from there. */
+  std::size_t first_slot() const noexcept {
+    std::size_t position = trigger_position_ + capacity_ - config_.pre_scans;
+    while (position >= capacity_) {
+      position -= capacity_;
+    }
+    return position;
+  }
+
+  /** @brief Scan index (0 = oldest) of a frozen capture; index must be below size(). */
+  const Scan& scan(std::size_t index) const noexcept {
+    std::size_t position = first_slot() + index;
+    while (position >= capacity_) {
+      position -= capacity_;
+    }
+    return storage_[position];
+  }
+
+  std::size_t capacity() const noexcept {
+    return capacity_;
+  }
+
+ private:
+  bool Crossed(std::uint16_t previous, std::uint16_t value) const noexcept {
+    const bool rising = previous < config_.threshold && value >= config_.threshold;
+    const bool falling = previous > config_.threshold && value <= config_.threshold;
+    switch (config_.slope) {
+      case TriggerSlope::kRising:
+        return rising;
+      case TriggerSlope::kFalling:
+        return falling;
+      case TriggerSlope::kEither:
+        return rising || falling;
+      case TriggerSlope::kImmediate:
+        return true;
+    }
+    return false;
+  }
+
+  // A concurrent Disarm() wins over the acquisition side's own transitions.
+  void Transition(CaptureState from, CaptureState to) noexcept {
+    (void) state_.compare_exchange_strong(from, to, std::memory_order_release,
+                                          std::memory_order_relaxed);
+  }
+
+  Scan* storage_ = nullptr;
+  std::size_t capacity_ = 0;
+  TriggerConfig config_{};
+  std::atomic<CaptureState> state_{CaptureState::kIdle};
+
+  std::size_t write_ = 0;
+  std::size_t filled_ = 0;
+  std::size_t remaining_ = 0;
+  std::size_t trigger_position_ = 0;
+  std::uint32_t trigger_timestamp_ticks_ = 0;
+  std::uint16_t previous_ = 0;
+  bool has_previous_ = false;
+};
+
+}  // namespace domain::telemetry
@@ -0,0 +1,170 @@
+#if defined(UNIT_TESTS)
+
+#include "app/can/can_chain.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "app/can/can_bus_requirements.hpp"
+#include "app/config/music.hpp"
+#include "domain/can/can_event_frame.hpp"
+#include "domain/can/can_frame.hpp"
+#include "domain/can/clock_sync.hpp"
+#include "domain/music/music_event.hpp"
+
+namespace {
+
+class FakeCanBus final : public app::can::CanBusRequirements {
+ public:
+  bool Send(const domain::can::CanFrame& frame) noexcept override {
+    sent.push_back(frame);
+    return true;
+  }
+
+  bool Receive(domain::can::CanFrame& out_frame) noexcept override {
+    if (next_received == received.size()) {
+      return false;
+    }
+    out_frame = received[next_received++];
+    return true;
+  }
+
+  std::vector<domain::can::CanFrame> sent;
+  std::vector<domain::can::CanFrame> received;
+  std::size_t next_received = 0;
+};
+
+/** @brief Collects the frames of another board's packer. */
+struct FrameCollector {
+  bool OnCanFrame(const domain::can::CanFrame& frame) {
+    frames.push_back(frame);
+    return true;
+  }
+
+  std::vector<domain::can::CanFrame> frames;
+};
+
+domain::music::MusicEvent NoteOn(std::uint8_t note, std::uint32_t timestamp_ticks) {
+  domain::music::MusicEvent event{};
+  event.type = domain::music::MusicEventType::kNoteOn;
+  event.number = note;
+  event.value = 100;
+  event.timestamp_ticks = timestamp_ticks;
+  return event;
+}
+
+std::size_t CountClockSyncFrames(const std::vector<domain::can::CanFrame>& frames) {
+  std::size_t count = 0;
+  for (const domain::can::CanFrame& frame : frames) {
+    std::uint32_t master_ticks = 0;
+    count += domain::can::ParseClockSyncFrame(frame, master_ticks) ? 1u : 0u;
+  }
+  return count;
+}
+
+}  // namespace
+
+TEST_CASE("The CanChain class", "[app][can]") {
+  FakeCanBus bus;
+  app::config::MusicEventQueue remote_events;
+
+  SECTION("On the master board") {
+    app::can::CanChain chain(app::config::CAN_MASTER_BOARD_ID, bus, remote_events);
+    chain.Reset();
+    chain.Start(1000);
+
+    SECTION("Should send a clock sync on start and then once per period") {
+      chain.Service(1000);
+      chain.Service(1000 + app::config::CAN_CLOCK_SYNC_PERIOD_TICKS - 1u);
+
+      REQUIRE(CountClockSyncFrames(bus.sent) == 1u);
+
+      chain.Service(1000 + app::config::CAN_CLOCK_SYNC_PERIOD_TICKS);
+
+      REQUIRE(CountClockSyncFrames(bus.sent) == 2u);
+      REQUIRE(chain.stats().clock_sync == app::can::CanClockSyncState::kMaster);
+    }
+
+    SECTION("Should forward local events unchanged in one frame per poll") {
+      chain.Forward(NoteOn(60, 5000));
+      chain.Forward(NoteOn(61, 5100));
+      chain.Service(1000);
+
+      FakeCanBus remote_bus;
+      app::config::MusicEventQueue received;
+      app::can::CanChain remote(3, remote_bus, received);
+      remote_bus.received = bus.sent;
+      remote.Service(1000);
+
+      domain::music::MusicEvent event{};
+      REQUIRE(received.TryPop(event));
+      REQUIRE(event.number == 60);
+      REQUIRE(event.timestamp_ticks == 5000u);
+      REQUIRE(received.TryPop(event));
+      REQUIRE(event.number == 61);
+      REQUIRE_FALSE(received.TryPop(event));
+      REQUIRE(chain.stats().frames_sent == 1u);
+    }
+
+    SECTION("Should push the other boards' events to the remote queue") {
+      domain::can::CanEventPacker other_board(2);
+      FrameCollector collector;
+      other_board.Push(NoteOn(72, 9000), collector);
+      other_board.Flush(collector);
+      bus.received = collector.frames;
+
+      chain.Service(1000);
+
+      domain::music::MusicEvent event{};
+      REQUIRE(remote_events.TryPop(event));
+      REQUIRE(event.number == 72);
+      REQUIRE(event.timestamp_ticks == 9000u);
+      REQUIRE(chain.stats().events_received == 1u);
+    }
+  }
+
+  SECTION("On a slave board") {
+    app::can::CanChain chain(3, bus, remote_events);
+    chain.Reset();
+    chain.Start(1000);
+
+    SECTION("Should not forward local events while the clock sync is unlocked") {
+      REQUIRE_FALSE(chain.Forward(NoteOn(60, 5000)));
+      chain.Service(1000);
+
+      REQUIRE(bus.sent.empty());
+      REQUIRE(chain.stats().clock_sync == app::can::CanClockSyncState::kUnlocked);
+      REQUIRE(chain.stats().frames_sent == 0u);
+    }
+
+    SECTION("Should forward in the master's timebase once locked") {
+      constexpr std::uint32_t kMasterAhead = 50000;
+      for (std::uint32_t i = 0; i < app::config::CAN_CLOCK_SYNC_CONFIG.window_syncs; ++i) {
+        const std::uint32_t local_ticks = 1000 + i * app::config::CAN_CLOCK_SYNC_PERIOD_TICKS;
+        domain::can::CanFrame sync = domain::can::MakeClockSyncFrame(
+            static_cast<std::uint8_t>(i), local_ticks + kMasterAhead);
+        sync.timestamp_ticks = local_ticks + app::config::CAN_CLOCK_SYNC_TRANSIT_TICKS;
+        bus.received.push_back(sync);
+      }
+      chain.Service(1000);
+      REQUIRE(chain.stats().clock_sync == app::can::CanClockSyncState::kLocked);
+
+      REQUIRE(chain.Forward(NoteOn(60, 5000)));
+      chain.Service(2000);
+
+      FakeCanBus master_bus;
+      app::config::MusicEventQueue received;
+      app::can::CanChain master(app::config::CAN_MASTER_BOARD_ID, master_bus, received);
+      master_bus.received = bus.sent;
+      master.Service(2000);
+
+      domain::music::MusicEvent event{};
+      REQUIRE(received.TryPop(event));
+      REQUIRE(event.timestamp_ticks == 5000u + kMasterAhead);
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,139 @@
+#if defined(UNIT_TESTS)
+
+#include "app/music/keyboard_scanner.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "app/config/music.hpp"
+#include "domain/music/controller_event.hpp"
+#include "domain/music/music_event.hpp"
+#include "domain/music/types.hpp"
+#include "domain/sensors/sensor.hpp"
+
+namespace {
+
+using domain::music::MusicEvent;
+using domain::music::MusicEventType;
+
+constexpr std::size_t kKeyCount = app::music::KeyboardScanner::kKeyCount;
+constexpr std::uint8_t kSustainSensorId = 22;
+constexpr std::uint8_t kSoftSensorId = 21;
+
+app::config::MusicPedalConfigs MakePedals() {
+  app::config::MusicPedalConfigs pedals{};
+  pedals[0].sensor_id = kSustainSensorId;
+  pedals[0].controller.controller = domain::music::kControllerSustainPedal;
+  pedals[0].controller.input_at_maximum = 0.4f;
+  pedals[0].controller.min_update_interval_ticks = 0;
+  pedals[1].sensor_id = kSoftSensorId;
+  pedals[1].controller.controller = domain::music::kControllerSoftPedal;
+  pedals[1].controller.resolution = domain::music::ControllerResolution::k14Bit;
+  pedals[1].controller.input_at_maximum = 0.4f;
+  pedals[1].controller.min_update_interval_ticks = 0;
+  return pedals;
+}
+
+std::vector<MusicEvent> Drain(app::config::MusicEventQueue& queue) {
+  std::vector<MusicEvent> events;
+  MusicEvent event{};
+  while (queue.TryPop(event)) {
+    events.push_back(event);
+  }
+  return events;
+}
+
+}  // namespace
+
+TEST_CASE("The KeyboardScanner class", "[app][music]") {
+  std::vector<domain::sensors::Sensor> sensors;
+  sensors.reserve(kKeyCount);
+  domain::sensors::Sensor* sensor_ptrs[kKeyCount]{};
+  for (std::size_t i = 0; i < kKeyCount; ++i) {
+    sensors.emplace_back(static_cast<std::uint8_t>(i + 1u));
+    sensor_ptrs[i] = &sensors[i];
+  }
+  app::config::MusicEventQueue queue;
+  app::music::KeyboardScanner scanner(sensor_ptrs, queue, MakePedals());
+
+  SECTION("The Scan() method") {
+    SECTION("When a pedal sensor is pressed") {
+      sensors[kSoftSensorId - 1u].Update(0, 0.2f, 1000);
+      constexpr float kPositions[] = {0.0f, 0.1f, 0.2f, 0.3f, 0.4f, 0.5f};
+      std::uint32_t timestamp_ticks = 0;
+      for (const float position : kPositions) {
+        timestamp_ticks += 1000u;
+        sensors[kSustainSensorId - 1u].Update(0, position, timestamp_ticks);
+        scanner.Scan();
+      }
+      const std::vector<MusicEvent> events = Drain(queue);
+
+      SECTION("Should send its controller instead of a note") {
+        REQUIRE_FALSE(events.empty());
+        MusicEvent last_sustain{};
+        std::size_t soft_events = 0;
+        for (const MusicEvent& event : events) {
+          REQUIRE_FALSE(domain::music::IsNoteEvent(event.type));
+          if (event.number == domain::music::kControllerSustainPedal) {
+            REQUIRE(event.type == MusicEventType::kControlChange);
+            last_sustain = event;
+          } else {
+            REQUIRE(event.type == MusicEventType::kControlChange14Bit);
+            REQUIRE(event.number == domain::music::kControllerSoftPedal);
+            REQUIRE(event.value == 8192u);
+            ++soft_events;
+          }
+        }
+        REQUIRE(last_sustain.value == 127u);
+        REQUIRE(soft_events == 1u);
+      }
+    }
+
+    SECTION("When a key is struck") {
+      constexpr float kPositions[] = {0.0f, 0.1f, 0.2f, 0.3f, 0.4f, 0.5f};
+      std::uint32_t timestamp_ticks = 0;
+      for (const float position : kPositions) {
+        timestamp_ticks += 1000u;
+        sensors[0].Update(0, position, timestamp_ticks);
+        scanner.Scan();
+      }
+      const std::vector<MusicEvent> events = Drain(queue);
+
+      SECTION("Should play its note while the pedals stay at rest") {
+        REQUIRE_FALSE(events.empty());
+        std::size_t note_ons = 0;
+        for (const MusicEvent& event : events) {
+          if (event.type == MusicEventType::kNoteOn) {
+            REQUIRE(event.number == app::config::MUSIC_FIRST_NOTE);
+            ++note_ons;
+          } else if (event.type == MusicEventType::kControlChange) {
+            REQUIRE(event.value == 0u);
+          }
+        }
+        REQUIRE(note_ons == 1u);
+      }
+    }
+  }
+
+  SECTION("The ReleaseAll() method") {
+    SECTION("When the sustain pedal is down") {
+      sensors[kSustainSensorId - 1u].Update(0, 0.4f, 1000);
+      scanner.Scan();
+      (void) Drain(queue);
+
+      scanner.ReleaseAll(2000);
+      const std::vector<MusicEvent> events = Drain(queue);
+
+      SECTION("Should lift it") {
+        REQUIRE(events.size() == 1u);
+        REQUIRE(events[0].number == domain::music::kControllerSustainPedal);
+        REQUIRE(events[0].value == 0u);
+        REQUIRE(events[0].timestamp_ticks == 2000u);
+      }
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,78 @@
+#include "app/shell/commands/baseline_command.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+
+#include "domain/io/stream_requirements.hpp"
+#include "domain/sensors/sensor_baseline_requirements.hpp"
+
+namespace {
+
+class StreamStub : public domain::io::StreamRequirements {
+ public:
+  domain::io::ReadResult Read(std::uint8_t&) noexcept override {
+    return domain::io::ReadResult::kNoData;
+  }
+  void Write(char c) noexcept override {
+    output_ += c;
+  }
+  void Write(const char* str) noexcept override {
+    output_ += str;
+  }
+  const std::string& GetOutput() const {
+    return output_;
+  }
+
+ private:
+  std::string output_;
+};
+
+class BaselinesStub : public domain::sensors::SensorBaselineRequirements {
+ public:
+  std::size_t channel_count() const noexcept override {
+    return 2;
+  }
+  bool TryReadBaseline(std::size_t index, float& out_baseline) const noexcept override {
+    if (index != 0u) {
+      return false;
+    }
+    out_baseline = 0.235125f;
+    return true;
+  }
+};
+
+}  // namespace
+
+TEST_CASE("The BaselineCommand class", "[app][shell][commands]") {
+  BaselinesStub baselines;
+  app::shell::commands::BaselineCommand cmd(baselines);
+  StreamStub stream;
+
+  SECTION("The Name() method") {
+    SECTION("Should return 'baseline'") {
+      REQUIRE(cmd.Name() == "baseline");
+    }
+  }
+
+  SECTION("The Run() method") {
+    SECTION("When called without arguments") {
+      SECTION("Should print one row per channel and '-' for unseeded channels") {
+        char* argv[] = {const_cast<char*>("baseline")};
+        cmd.Run(1, argv, stream);
+
+        REQUIRE(stream.GetOutput() ==
+                " id baseline_ma\r\n"
+                "  1    0.235125\r\n"
+                "  2           -\r\n");
+      }
+    }
+
+    SECTION("When called with an argument") {
+      SECTION("Should display usage") {
+        char* argv[] = {const_cast<char*>("baseline"), const_cast<char*>("now")};
+        cmd.Run(2, argv, stream);
+        REQUIRE(stream.GetOutput() == "usage: baseline\r\n");
+      }
+    }
+  }
+}
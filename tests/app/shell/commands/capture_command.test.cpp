@@ -0,0 +1,202 @@
+#include "app/shell/commands/capture_command.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "app/config/config.hpp"
+#include "app/telemetry/capture_control_requirements.hpp"
+#include "domain/io/stream_requirements.hpp"
+#include "domain/sensors/sensor.hpp"
+#include "domain/sensors/sensor_registry.hpp"
+
+namespace {
+
+class StreamStub : public domain::io::StreamRequirements {
+ public:
+  domain::io::ReadResult Read(std::uint8_t&) noexcept override {
+    return domain::io::ReadResult::kNoData;
+  }
+  void Write(char c) noexcept override {
+    output_ += c;
+  }
+  void Write(const char* str) noexcept override {
+    output_ += str;
+  }
+  const std::string& GetOutput() const {
+    return output_;
+  }
+
+ private:
+  std::string output_;
+};
+
+class CaptureMock : public app::telemetry::CaptureControlRequirements {
+ public:
+  bool Arm(const domain::telemetry::TriggerConfig& config) noexcept override {
+    last_config = config;
+    arm_requested = true;
+    return arm_result;
+  }
+  void Disarm() noexcept override {
+    disarm_requested = true;
+  }
+  app::telemetry::CaptureStatus GetStatus() const noexcept override {
+    return status;
+  }
+  bool ReadScan(std::size_t index, app::telemetry::CaptureScan& out_scan) const noexcept override {
+    if (index >= status.scan_count) {
+      return false;
+    }
+    out_scan = {};
+    out_scan.timestamp_ticks = 1000u * static_cast<std::uint32_t>(index);
+    out_scan.values[0] = static_cast<std::uint16_t>(index);
+    return true;
+  }
+
+  app::telemetry::CaptureStatus status{};
+  domain::telemetry::TriggerConfig last_config{};
+  bool arm_result = true;
+  bool arm_requested = false;
+  bool disarm_requested = false;
+};
+
+std::size_t CountLines(const std::string& text) {
+  std::size_t lines = 0;
+  for (std::size_t at = text.find("\r\n"); at != std::string::npos;
+       at = text.find("\r\n", at + 2)) {
+    ++lines;
+  }
+  return lines;
+}
+
+}  // namespace
+
+TEST_CASE("The CaptureCommand class", "[app][shell][commands]") {
+  domain::sensors::Sensor sensors[] = {domain::sensors::Sensor(1), domain::sensors::Sensor(2)};
+  domain::sensors::SensorRegistry registry(sensors, 2);
+  CaptureMock capture;
+  app::shell::commands::CaptureCommand cmd(registry, capture);
+  StreamStub stream;
+
+  SECTION("The Name() method") {
+    SECTION("Should return 'capture'") {
+      REQUIRE(cmd.Name() == "capture");
+    }
+  }
+
+  SECTION("The Run() method") {
+    SECTION("When called with 'arm'") {
+      SECTION("Should arm with the default slope and scan counts") {
+        char* argv[] = {const_cast<char*>("capture"), const_cast<char*>("arm"),
+                        const_cast<char*>("2"), const_cast<char*>("30000")};
+        cmd.Run(4, argv, stream);
+        REQUIRE(capture.arm_requested);
+        REQUIRE(capture.last_config.channel == 1u);
+        REQUIRE(capture.last_config.threshold == 30000u);
+        REQUIRE(capture.last_config.slope == domain::telemetry::TriggerSlope::kFalling);
+        REQUIRE(capture.last_config.pre_scans == app::config::CAPTURE_DEFAULT_PRE_SCANS);
+        REQUIRE(capture.last_config.post_scans == app::config::CAPTURE_DEFAULT_POST_SCANS);
+        REQUIRE(stream.GetOutput() == "ok\r\n");
+      }
+
+      SECTION("Should accept the slope and scan counts") {
+        char* argv[] = {const_cast<char*>("capture"), const_cast<char*>("arm"),
+                        const_cast<char*>("1"),       const_cast<char*>("100"),
+                        const_cast<char*>("rising"),  const_cast<char*>("10"),
+                        const_cast<char*>("20")};
+        cmd.Run(7, argv, stream);
+        REQUIRE(capture.last_config.slope == domain::telemetry::TriggerSlope::kRising);
+        REQUIRE(capture.last_config.pre_scans == 10u);
+        REQUIRE(capture.last_config.post_scans == 20u);
+      }
+
+      SECTION("With an unknown sensor id, should return an error") {
+        char* argv[] = {const_cast<char*>("capture"), const_cast<char*>("arm"),
+                        const_cast<char*>("5"), const_cast<char*>("100")};
+        cmd.Run(4, argv, stream);
+        REQUIRE_FALSE(capture.arm_requested);
+        REQUIRE(stream.GetOutput() == "error: unknown sensor id\r\n");
+      }
+
+      SECTION("With a threshold above 16 bits, should show usage") {
+        char* argv[] = {const_cast<char*>("capture"), const_cast<char*>("arm"),
+                        const_cast<char*>("1"), const_cast<char*>("65536")};
+        cmd.Run(4, argv, stream);
+        REQUIRE_FALSE(capture.arm_requested);
+        REQUIRE(stream.GetOutput().find("usage:") != std::string::npos);
+      }
+
+      SECTION("When the capture refuses, should report it") {
+        capture.arm_result = false;
+        char* argv[] = {const_cast<char*>("capture"), const_cast<char*>("arm"),
+                        const_cast<char*>("1"), const_cast<char*>("100")};
+        cmd.Run(4, argv, stream);
+        REQUIRE(stream.GetOutput() == "error: request rejected\r\n");
+      }
+    }
+
+    SECTION("When called with 'off'") {
+      SECTION("Should disarm") {
+        char* argv[] = {const_cast<char*>("capture"), const_cast<char*>("off")};
+        cmd.Run(2, argv, stream);
+        REQUIRE(capture.disarm_requested);
+        REQUIRE(stream.GetOutput() == "ok\r\n");
+      }
+    }
+
+    SECTION("When called with 'status'") {
+      SECTION("Should show the capacity when idle") {
+        capture.status.capacity = 6000;
+        char* argv[] = {const_cast<char*>("capture"), const_cast<char*>("status")};
+        cmd.Run(2, argv, stream);
+        REQUIRE(stream.GetOutput() == "idle capacity=6000\r\n");
+      }
+
+      SECTION("Should show the trigger and the capture when frozen") {
+        capture.status.state = domain::telemetry::CaptureState::kFrozen;
+        capture.status.config.channel = 4;
+        capture.status.config.threshold = 30000;
+        capture.status.config.pre_scans = 1;
+        capture.status.config.post_scans = 2;
+        capture.status.scan_count = 4;
+        capture.status.trigger_timestamp_ticks = 12345;
+        char* argv[] = {const_cast<char*>("capture"), const_cast<char*>("status")};
+        cmd.Run(2, argv, stream);
+        REQUIRE(stream.GetOutput() == "frozen id=5 threshold=30000 slope=falling pre=1 post=2 "
+                                      "scans=4 trigger_t=12345\r\n");
+      }
+    }
+
+    SECTION("When called with 'read'") {
+      SECTION("Without a frozen capture, should return an error") {
+        char* argv[] = {const_cast<char*>("capture"), const_cast<char*>("read")};
+        cmd.Run(2, argv, stream);
+        REQUIRE(stream.GetOutput() == "error: no frozen capture\r\n");
+      }
+
+      SECTION("Should print a header and one row per scan of the requested range") {
+        capture.status.state = domain::telemetry::CaptureState::kFrozen;
+        capture.status.scan_count = 10;
+        char* argv[] = {const_cast<char*>("capture"), const_cast<char*>("read"),
+                        const_cast<char*>("8"), const_cast<char*>("5")};
+        cmd.Run(4, argv, stream);
+
+        const std::string& output = stream.GetOutput();
+        REQUIRE(output.rfind("index,timestamp_ticks,s1,s2,", 0) == 0u);
+        REQUIRE(CountLines(output) == 3u);
+        REQUIRE(output.find("\r\n8,8000,8,0,") != std::string::npos);
+        REQUIRE(output.find("\r\n9,9000,9,0,") != std::string::npos);
+      }
+    }
+
+    SECTION("When called without arguments") {
+      SECTION("Should show usage") {
+        char* argv[] = {const_cast<char*>("capture")};
+        cmd.Run(1, argv, stream);
+        REQUIRE(stream.GetOutput().find("usage:") != std::string::npos);
+      }
+    }
+  }
+}
@@ -0,0 +1,315 @@
+#include "app/shell/commands/midi_command.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+
+#include "app/midi/midi_output_control_requirements.hpp"
+#include "domain/io/stream_requirements.hpp"
+
+namespace {
+
+class StreamStub : public domain::io::StreamRequirements {
+ public:
+  domain::io::ReadResult Read(std::uint8_t&) noexcept override {
+    return domain::io::ReadResult::kNoData;
+  }
+  void Write(char c) noexcept override {
+    output_ += c;
+  }
+  void Write(const char* str) noexcept override {
+    output_ += str;
+  }
+  const std::string& GetOutput() const {
+    return output_;
+  }
+
+ private:
+  std::string output_;
+};
+
+class ControlMock : public app::midi::MidiOutputControlRequirements {
+ public:
+  bool RequestEnable() noexcept override {
+    enable_requested = true;
+    return accept;
+  }
+  bool RequestDisable() noexcept override {
+    disable_requested = true;
+    return accept;
+  }
+  bool RequestRoute(app::midi::MidiRoute route) noexcept override {
+    last_route = route;
+    route_requested = true;
+    return accept;
+  }
+  bool RequestChannel(std::uint8_t channel) noexcept override {
+    last_channel = channel;
+    channel_requested = true;
+    return accept;
+  }
+  bool RequestLatency(std::uint32_t latency_ticks) noexcept override {
+    last_latency_ticks = latency_ticks;
+    latency_requested = true;
+    return accept;
+  }
+  bool RequestProtocol(app::midi::MidiProtocol protocol) noexcept override {
+    last_protocol = protocol;
+    protocol_requested = true;
+    return accept;
+  }
+  bool RequestChain(bool enabled) noexcept override {
+    last_chain_enabled = enabled;
+    chain_requested = true;
+    return accept;
+  }
+  app::midi::MidiOutputStatus GetStatus() const noexcept override {
+    return status;
+  }
+
+  app::midi::MidiOutputStatus status{};
+  bool accept = true;
+  bool enable_requested = false;
+  bool disable_requested = false;
+  bool route_requested = false;
+  bool channel_requested = false;
+  bool latency_requested = false;
+  bool protocol_requested = false;
+  bool chain_requested = false;
+  bool last_chain_enabled = false;
+  app::midi::MidiRoute last_route = app::midi::MidiRoute::kUart2;
+  std::uint8_t last_channel = 0xFF;
+  std::uint32_t last_latency_ticks = 0xFFFFFFFFu;
+  app::midi::MidiProtocol last_protocol = app::midi::MidiProtocol::kMidi1;
+};
+
+constexpr const char* kUsage =
+    "usage: midi [status]\r\n"
+    "       midi on|off\r\n"
+    "       midi route uart2|uart3|both\r\n"
+    "       midi channel <1-16>\r\n"
+    "       midi latency off|<us>\r\n"
+    "       midi protocol 1|2\r\n"
+    "       midi chain on|off\r\n";
+
+}  // namespace
+
+TEST_CASE("The MidiCommand class", "[app][shell][commands]") {
+  ControlMock control;
+  app::shell::commands::MidiCommand cmd(control);
+  StreamStub stream;
+
+  SECTION("The Name() method") {
+    SECTION("Should return 'midi'") {
+      REQUIRE(cmd.Name() == "midi");
+    }
+  }
+
+  SECTION("The Run() method") {
+    SECTION("When called without arguments") {
+      SECTION("Should print the status with a 1-based channel and the scheduler delays") {
+        control.status.enabled = true;
+        control.status.route = app::midi::MidiRoute::kBoth;
+        control.status.protocol = app::midi::MidiProtocol::kMidi2;
+        control.status.channel = 9;
+        control.status.message_count = 12;
+        control.status.byte_count = 30;
+        control.status.dropped_note_count = 1;
+        control.status.dropped_controller_count = 2;
+        control.status.scheduler.note_delay_mean_ticks = 450;
+        control.status.scheduler.note_delay_max_ticks = 3200;
+        control.status.scheduler.controller_delay_mean_ticks = 900;
+        control.status.scheduler.controller_delay_max_ticks = 5000;
+        control.status.scheduler.coalesced_count = 77;
+        control.status.latency.latency_ticks = 3000;
+        control.status.latency.released_count = 40;
+        control.status.latency.late_count = 2;
+        control.status.latency.max_late_ticks = 350;
+        control.status.latency.overflow_count = 1;
+        control.status.chain_enabled = true;
+        control.status.chain.board_id = 2;
+        control.status.chain.frames_sent = 25;
+        control.status.chain.dropped_frame_count = 1;
+        control.status.chain.frames_received = 60;
+        control.status.chain.events_received = 180;
+        control.status.chain.lost_frame_count = 3;
+        control.status.chain.clock_sync = app::can::CanClockSyncState::kLocked;
+        control.status.chain.clock_offset_ticks = -1250;
+        control.status.chain.clock_drift_ppb = 42000;
+        char* argv[] = {const_cast<char*>("midi")};
+        cmd.Run(1, argv, stream);
+
+        REQUIRE(stream.GetOutput() ==
+                "on route=both protocol=2 channel=10 messages=12 bytes=30 note_drops=1 "
+                "cc_drops=2\r\n"
+                "note_delay_us mean=450 max=3200 cc_delay_us mean=900 max=5000 coalesced=77\r\n"
+                "latency_us=3000 released=40 late=2 max_late_us=350 overflows=1\r\n"
+                "chain=on board=2 tx_frames=25 tx_drops=1 rx_frames=60 rx_events=180 lost=3 "
+                "sync=locked offset_us=-1250 drift_ppb=42000\r\n");
+      }
+    }
+
+    SECTION("When called with 'status' while disabled") {
+      SECTION("Should print 'off' with the current settings") {
+        char* argv[] = {const_cast<char*>("midi"), const_cast<char*>("status")};
+        cmd.Run(2, argv, stream);
+
+        REQUIRE(stream.GetOutput() ==
+                "off route=uart2 protocol=1 channel=1 messages=0 bytes=0 note_drops=0 "
+                "cc_drops=0\r\n"
+                "note_delay_us mean=0 max=0 cc_delay_us mean=0 max=0 coalesced=0\r\n"
+                "latency_us=off released=0 late=0 max_late_us=0 overflows=0\r\n"
+                "chain=off board=0 tx_frames=0 tx_drops=0 rx_frames=0 rx_events=0 lost=0 "
+                "sync=master\r\n");
+      }
+    }
+
+    SECTION("When called with 'on'") {
+      SECTION("Should request enable and return ok") {
+        char* argv[] = {const_cast<char*>("midi"), const_cast<char*>("on")};
+        cmd.Run(2, argv, stream);
+
+        REQUIRE(control.enable_requested);
+        REQUIRE(stream.GetOutput() == "ok\r\n");
+      }
+
+      SECTION("Should report a rejected request") {
+        control.accept = false;
+        char* argv[] = {const_cast<char*>("midi"), const_cast<char*>("on")};
+        cmd.Run(2, argv, stream);
+
+        REQUIRE(stream.GetOutput() == "error: request rejected\r\n");
+      }
+    }
+
+    SECTION("When called with 'off'") {
+      SECTION("Should request disable and return ok") {
+        char* argv[] = {const_cast<char*>("midi"), const_cast<char*>("off")};
+        cmd.Run(2, argv, stream);
+
+        REQUIRE(control.disable_requested);
+        REQUIRE(stream.GetOutput() == "ok\r\n");
+      }
+    }
+
+    SECTION("When called with 'route'") {
+      SECTION("Should request the given route") {
+        char* argv[] = {const_cast<char*>("midi"), const_cast<char*>("route"),
+                        const_cast<char*>("uart3")};
+        cmd.Run(3, argv, stream);
+
+        REQUIRE(control.route_requested);
+        REQUIRE(control.last_route == app::midi::MidiRoute::kUart3);
+        REQUIRE(stream.GetOutput() == "ok\r\n");
+      }
+
+      SECTION("Should display usage for an unknown route") {
+        char* argv[] = {const_cast<char*>("midi"), const_cast<char*>("route"),
+                        const_cast<char*>("usb")};
+        cmd.Run(3, argv, stream);
+
+        REQUIRE_FALSE(control.route_requested);
+        REQUIRE(stream.GetOutput() == kUsage);
+      }
+    }
+
+    SECTION("When called with 'channel'") {
+      SECTION("Should request the 0-based channel") {
+        char* argv[] = {const_cast<char*>("midi"), const_cast<char*>("channel"),
+                        const_cast<char*>("16")};
+        cmd.Run(3, argv, stream);
+
+        REQUIRE(control.channel_requested);
+        REQUIRE(control.last_channel == 15u);
+        REQUIRE(stream.GetOutput() == "ok\r\n");
+      }
+
+      SECTION("Should display usage for an out of range channel") {
+        char* argv[] = {const_cast<char*>("midi"), const_cast<char*>("channel"),
+                        const_cast<char*>("0")};
+        cmd.Run(3, argv, stream);
+
+        REQUIRE_FALSE(control.channel_requested);
+        REQUIRE(stream.GetOutput() == kUsage);
+      }
+    }
+
+    SECTION("When called with 'protocol'") {
+      SECTION("Should request MIDI 2.0 for '2'") {
+        char* argv[] = {const_cast<char*>("midi"), const_cast<char*>("protocol"),
+                        const_cast<char*>("2")};
+        cmd.Run(3, argv, stream);
+
+        REQUIRE(control.protocol_requested);
+        REQUIRE(control.last_protocol == app::midi::MidiProtocol::kMidi2);
+        REQUIRE(stream.GetOutput() == "ok\r\n");
+      }
+
+      SECTION("Should display usage for an unknown protocol") {
+        char* argv[] = {const_cast<char*>("midi"), const_cast<char*>("protocol"),
+                        const_cast<char*>("3")};
+        cmd.Run(3, argv, stream);
+
+        REQUIRE_FALSE(control.protocol_requested);
+        REQUIRE(stream.GetOutput() == kUsage);
+      }
+    }
+
+    SECTION("When called with 'chain'") {
+      SECTION("Should request chaining on") {
+        char* argv[] = {const_cast<char*>("midi"), const_cast<char*>("chain"),
+                        const_cast<char*>("on")};
+        cmd.Run(3, argv, stream);
+
+        REQUIRE(control.chain_requested);
+        REQUIRE(control.last_chain_enabled);
+        REQUIRE(stream.GetOutput() == "ok\r\n");
+      }
+
+      SECTION("Should display usage without on or off") {
+        char* argv[] = {const_cast<char*>("midi"), const_cast<char*>("chain")};
+        cmd.Run(2, argv, stream);
+
+        REQUIRE_FALSE(control.chain_requested);
+        REQUIRE(stream.GetOutput() == kUsage);
+      }
+    }
+
+    SECTION("When called with 'latency'") {
+      SECTION("Should request the latency in microseconds") {
+        char* argv[] = {const_cast<char*>("midi"), const_cast<char*>("latency"),
+                        const_cast<char*>("3000")};
+        cmd.Run(3, argv, stream);
+
+        REQUIRE(control.latency_requested);
+        REQUIRE(control.last_latency_ticks == 3000u);
+        REQUIRE(stream.GetOutput() == "ok\r\n");
+      }
+
+      SECTION("Should request a zero latency for 'off'") {
+        char* argv[] = {const_cast<char*>("midi"), const_cast<char*>("latency"),
+                        const_cast<char*>("off")};
+        cmd.Run(3, argv, stream);
+
+        REQUIRE(control.last_latency_ticks == 0u);
+        REQUIRE(stream.GetOutput() == "ok\r\n");
+      }
+
+      SECTION("Should display usage for a latency above the maximum") {
+        char* argv[] = {const_cast<char*>("midi"), const_cast<char*>("latency"),
+                        const_cast<char*>("20001")};
+        cmd.Run(3, argv, stream);
+
+        REQUIRE_FALSE(control.latency_requested);
+        REQUIRE(stream.GetOutput() == kUsage);
+      }
+    }
+
+    SECTION("When called with an unknown argument") {
+      SECTION("Should display usage") {
+        char* argv[] = {const_cast<char*>("midi"), const_cast<char*>("bogus")};
+        cmd.Run(2, argv, stream);
+        REQUIRE(stream.GetOutput() == kUsage);
+      }
+    }
+  }
+}
@@ -0,0 +1,82 @@
+#include "app/shell/commands/noise_command.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+
+#include "domain/io/stream_requirements.hpp"
+#include "domain/sensors/sensor_noise_monitor.hpp"
+
+namespace {
+
+class StreamStub : public domain::io::StreamRequirements {
+ public:
+  domain::io::ReadResult Read(std::uint8_t&) noexcept override {
+    return domain::io::ReadResult::kNoData;
+  }
+  void Write(char c) noexcept override {
+    output_ += c;
+  }
+  void Write(const char* str) noexcept override {
+    output_ += str;
+  }
+  const std::string& GetOutput() const {
+    return output_;
+  }
+
+ private:
+  std::string output_;
+};
+
+}  // namespace
+
+TEST_CASE("The NoiseCommand class", "[app][shell][commands]") {
+  domain::sensors::SensorNoiseMonitor<2> monitor;
+  app::shell::commands::NoiseCommand cmd(monitor);
+  StreamStub stream;
+
+  SECTION("The Name() method") {
+    SECTION("Should return 'noise'") {
+      REQUIRE(cmd.Name() == "noise");
+    }
+  }
+
+  SECTION("The Run() method") {
+    SECTION("When called without arguments") {
+      SECTION("Should print a header and one row per channel") {
+        monitor.Observe(0, 100);
+        monitor.Observe(0, 102);
+        char* argv[] = {const_cast<char*>("noise")};
+        cmd.Run(1, argv, stream);
+
+        REQUIRE(stream.GetOutput() ==
+                " id         n      mean       rms       min       max       p2p\r\n"
+                "  1         2    101.00      1.00    100.00    102.00      2.00\r\n"
+                "  2         0         -         -         -         -         -\r\n");
+      }
+    }
+
+    SECTION("When called with 'reset'") {
+      SECTION("Should reset every channel and return ok") {
+        monitor.Observe(0, 100);
+        monitor.Observe(1, 200);
+        char* argv[] = {const_cast<char*>("noise"), const_cast<char*>("reset")};
+        cmd.Run(2, argv, stream);
+
+        REQUIRE(stream.GetOutput() == "ok\r\n");
+        domain::signal::statistics::RunningStats stats;
+        REQUIRE(monitor.TryRead(0, stats));
+        REQUIRE(stats.count() == 0u);
+        REQUIRE(monitor.TryRead(1, stats));
+        REQUIRE(stats.count() == 0u);
+      }
+    }
+
+    SECTION("When called with an unknown argument") {
+      SECTION("Should display usage") {
+        char* argv[] = {const_cast<char*>("noise"), const_cast<char*>("bogus")};
+        cmd.Run(2, argv, stream);
+        REQUIRE(stream.GetOutput() == "usage: noise [reset]\r\n");
+      }
+    }
+  }
+}
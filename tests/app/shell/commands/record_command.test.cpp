@@ -0,0 +1,141 @@
+#include "app/shell/commands/record_command.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "app/telemetry/capture_control_requirements.hpp"
+#include "app/telemetry/sensor_rtt_telemetry_control_requirements.hpp"
+#include "domain/io/stream_requirements.hpp"
+
+namespace {
+
+class StreamStub : public domain::io::StreamRequirements {
+ public:
+  domain::io::ReadResult Read(std::uint8_t&) noexcept override {
+    return domain::io::ReadResult::kNoData;
+  }
+  void Write(char c) noexcept override {
+    output_ += c;
+  }
+  void Write(const char* str) noexcept override {
+    output_ += str;
+  }
+  const std::string& GetOutput() const {
+    return output_;
+  }
+
+ private:
+  std::string output_;
+};
+
+class CaptureMock : public app::telemetry::CaptureControlRequirements {
+ public:
+  bool Arm(const domain::telemetry::TriggerConfig& config) noexcept override {
+    last_config = config;
+    arm_requested = true;
+    return arm_result;
+  }
+  void Disarm() noexcept override {}
+  app::telemetry::CaptureStatus GetStatus() const noexcept override {
+    app::telemetry::CaptureStatus status{};
+    status.capacity = 6000;
+    return status;
+  }
+  bool ReadScan(std::size_t, app::telemetry::CaptureScan&) const noexcept override {
+    return false;
+  }
+
+  domain::telemetry::TriggerConfig last_config{};
+  bool arm_result = true;
+  bool arm_requested = false;
+};
+
+class TelemetryMock : public app::telemetry::SensorRttTelemetryControlRequirements {
+ public:
+  bool RequestOff() noexcept override {
+    return true;
+  }
+  bool RequestObserve(std::uint8_t, domain::sensors::SensorRttMode) noexcept override {
+    return true;
+  }
+  bool RequestObserveMask(std::uint32_t, domain::sensors::SensorRttMode,
+                          app::telemetry::ScanEncoding) noexcept override {
+    return true;
+  }
+  bool RequestSetPeriod(std::uint32_t) noexcept override {
+    return true;
+  }
+  bool RequestSendCapture() noexcept override {
+    send_requested = true;
+    return send_result;
+  }
+  app::telemetry::SensorRttTelemetryStatus GetStatus() const noexcept override {
+    return {};
+  }
+
+  bool send_result = true;
+  bool send_requested = false;
+};
+
+}  // namespace
+
+TEST_CASE("The RecordCommand class", "[app][shell][commands]") {
+  CaptureMock capture;
+  TelemetryMock telemetry;
+  app::shell::commands::RecordCommand cmd(capture, telemetry);
+  StreamStub stream;
+
+  SECTION("The Name() method") {
+    SECTION("Should return 'record'") {
+      REQUIRE(cmd.Name() == "record");
+    }
+  }
+
+  SECTION("The Run() method") {
+    SECTION("When called with a duration") {
+      SECTION("Should record from the first scan and request the RTT drain") {
+        char* argv[] = {const_cast<char*>("record"), const_cast<char*>("2")};
+        cmd.Run(2, argv, stream);
+        REQUIRE(capture.arm_requested);
+        REQUIRE(capture.last_config.slope == domain::telemetry::TriggerSlope::kImmediate);
+        REQUIRE(capture.last_config.pre_scans == 0u);
+        REQUIRE(capture.last_config.post_scans == 1999u);
+        REQUIRE(telemetry.send_requested);
+        REQUIRE(stream.GetOutput() == "ok scans=2000\r\n");
+      }
+
+      SECTION("Longer than the buffer holds, should return an error") {
+        char* argv[] = {const_cast<char*>("record"), const_cast<char*>("7")};
+        cmd.Run(2, argv, stream);
+        REQUIRE_FALSE(capture.arm_requested);
+        REQUIRE(stream.GetOutput() == "error: at most 6 s fit the buffer\r\n");
+      }
+
+      SECTION("When a capture is in progress, should report it") {
+        capture.arm_result = false;
+        char* argv[] = {const_cast<char*>("record"), const_cast<char*>("1")};
+        cmd.Run(2, argv, stream);
+        REQUIRE_FALSE(telemetry.send_requested);
+        REQUIRE(stream.GetOutput() == "error: request rejected\r\n");
+      }
+
+      SECTION("When the drain cannot be queued, should say how to send it later") {
+        telemetry.send_result = false;
+        char* argv[] = {const_cast<char*>("record"), const_cast<char*>("1")};
+        cmd.Run(2, argv, stream);
+        REQUIRE(capture.arm_requested);
+        REQUIRE(stream.GetOutput().rfind("error: drain rejected", 0) == 0u);
+      }
+    }
+
+    SECTION("When called without a valid duration") {
+      SECTION("Should show usage") {
+        char* argv[] = {const_cast<char*>("record"), const_cast<char*>("0")};
+        cmd.Run(2, argv, stream);
+        REQUIRE(stream.GetOutput() == "usage: record <seconds>\r\n");
+      }
+    }
+  }
+}
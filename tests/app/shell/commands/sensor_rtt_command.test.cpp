@@ -44,11 +44,23 @@ class ControlMock : public app::telemetry::SensorRttTelemetryControlRequirements
     observe_requested = true;
     return true;
   }
+  bool RequestObserveMask(std::uint32_t channel_mask, domain::sensors::SensorRttMode mode,
+                          app::telemetry::ScanEncoding encoding) noexcept override {
+    last_channel_mask = channel_mask;
+    last_mode = mode;
+    last_encoding = encoding;
+    observe_mask_requested = true;
+    return true;
+  }
   bool RequestSetPeriod(std::uint32_t period_ms) noexcept override {
     last_period_ms = period_ms;
     period_requested = true;
     return true;
   }
+  bool RequestSendCapture() noexcept override {
+    capture_requested = true;
+    return true;
+  }
   app::telemetry::SensorRttTelemetryStatus GetStatus() const noexcept override {
     return status;
   }
@@ -57,9 +69,13 @@ class ControlMock : public app::telemetry::SensorRttTelemetryControlRequirements
   bool off_requested = false;
   bool observe_requested = false;
   bool period_requested = false;
+  bool observe_mask_requested = false;
+  bool capture_requested = false;
   std::uint8_t last_observe_id = 0;
   domain::sensors::SensorRttMode last_mode = domain::sensors::SensorRttMode::kRaw;
   std::uint32_t last_period_ms = 0;
+  std::uint32_t last_channel_mask = 0;
+  app::telemetry::ScanEncoding last_encoding = app::telemetry::ScanEncoding::kFull;
 };
 
 }  // namespace
@@ -112,6 +128,72 @@ TEST_CASE("The SensorRttCommand class", "[app][shell][commands]") {
         cmd.Run(2, argv, stream);
         REQUIRE(stream.GetOutput() == "on id=1 mode=processed period_ms=10\r\n");
       }
+
+      SECTION("Should display the channel mask when scanning") {
+        control.status.enabled = true;
+        control.status.channel_mask = 0x3u;
+        control.status.mode = domain::sensors::SensorRttMode::kRaw;
+        control.status.period_ms = 1;
+        control.status.dropped_frames = 4;
+        control.status.underruns = 2;
+        char* argv[] = {const_cast<char*>("sensor_rtt"), const_cast<char*>("status")};
+        cmd.Run(2, argv, stream);
+        REQUIRE(stream.GetOutput() ==
+                "on mask=0x00000003 mode=raw period_ms=1 dropped=4 underruns=2\r\n");
+      }
+
+      SECTION("Should mark a delta-compressed scan") {
+        control.status.enabled = true;
+        control.status.channel_mask = 0x1u;
+        control.status.encoding = app::telemetry::ScanEncoding::kDelta;
+        control.status.mode = domain::sensors::SensorRttMode::kRaw;
+        control.status.period_ms = 1;
+        char* argv[] = {const_cast<char*>("sensor_rtt"), const_cast<char*>("status")};
+        cmd.Run(2, argv, stream);
+        REQUIRE(stream.GetOutput() ==
+                "on mask=0x00000001 mode=raw delta period_ms=1 dropped=0 underruns=0\r\n");
+      }
+
+      SECTION("Should mark an envelope scan") {
+        control.status.enabled = true;
+        control.status.channel_mask = 0x3u;
+        control.status.encoding = app::telemetry::ScanEncoding::kEnvelope;
+        control.status.mode = domain::sensors::SensorRttMode::kProcessed;
+        control.status.period_ms = 10;
+        char* argv[] = {const_cast<char*>("sensor_rtt"), const_cast<char*>("status")};
+        cmd.Run(2, argv, stream);
+        REQUIRE(stream.GetOutput() ==
+                "on mask=0x00000003 mode=processed envelope period_ms=10 dropped=0 "
+                "underruns=0\r\n");
+      }
+
+      SECTION("Should show how far the scan stream is backed off") {
+        control.status.enabled = true;
+        control.status.channel_mask = 0x3u;
+        control.status.mode = domain::sensors::SensorRttMode::kRaw;
+        control.status.period_ms = 1;
+        control.status.backoff_level = 2;
+        char* argv[] = {const_cast<char*>("sensor_rtt"), const_cast<char*>("status")};
+        cmd.Run(2, argv, stream);
+        REQUIRE(stream.GetOutput() ==
+                "on mask=0x00000003 mode=raw period_ms=1 dropped=0 underruns=0 backoff=2\r\n");
+      }
+
+      SECTION("Should show the capture scans still to be sent") {
+        control.status.capture_remaining = 120;
+        char* argv[] = {const_cast<char*>("sensor_rtt"), const_cast<char*>("status")};
+        cmd.Run(2, argv, stream);
+        REQUIRE(stream.GetOutput() == "off capture=120\r\n");
+      }
+    }
+
+    SECTION("When called with 'capture'") {
+      SECTION("Should request the capture readout and return ok") {
+        char* argv[] = {const_cast<char*>("sensor_rtt"), const_cast<char*>("capture")};
+        cmd.Run(2, argv, stream);
+        REQUIRE(control.capture_requested);
+        REQUIRE(stream.GetOutput() == "ok\r\n");
+      }
     }
 
     SECTION("When called with a valid sensor id") {
@@ -162,6 +244,83 @@ TEST_CASE("The SensorRttCommand class", "[app][shell][commands]") {
       }
     }
 
+    SECTION("When called with 'scan'") {
+      SECTION("With 'all', should request the fitted sensors only") {
+        char* argv[] = {const_cast<char*>("sensor_rtt"), const_cast<char*>("scan"),
+                        const_cast<char*>("all"), const_cast<char*>("raw")};
+        cmd.Run(4, argv, stream);
+        REQUIRE(control.observe_mask_requested);
+        REQUIRE(control.last_channel_mask == 0x3u);
+        REQUIRE(control.last_mode == domain::sensors::SensorRttMode::kRaw);
+        REQUIRE(control.last_encoding == app::telemetry::ScanEncoding::kFull);
+        REQUIRE(stream.GetOutput() == "ok\r\n");
+      }
+
+      SECTION("With 'delta', should request compressed frames in either argument order") {
+        char* argv[] = {const_cast<char*>("sensor_rtt"), const_cast<char*>("scan"),
+                        const_cast<char*>("all"), const_cast<char*>("delta"),
+                        const_cast<char*>("raw")};
+        cmd.Run(5, argv, stream);
+        REQUIRE(control.observe_mask_requested);
+        REQUIRE(control.last_encoding == app::telemetry::ScanEncoding::kDelta);
+        REQUIRE(control.last_mode == domain::sensors::SensorRttMode::kRaw);
+        REQUIRE(stream.GetOutput() == "ok\r\n");
+      }
+
+      SECTION("With 'envelope', should request min/max/mean envelopes") {
+        char* argv[] = {const_cast<char*>("sensor_rtt"), const_cast<char*>("scan"),
+                        const_cast<char*>("0x1"), const_cast<char*>("envelope")};
+        cmd.Run(4, argv, stream);
+        REQUIRE(control.observe_mask_requested);
+        REQUIRE(control.last_channel_mask == 0x1u);
+        REQUIRE(control.last_encoding == app::telemetry::ScanEncoding::kEnvelope);
+        REQUIRE(control.last_mode == domain::sensors::SensorRttMode::kProcessed);
+        REQUIRE(stream.GetOutput() == "ok\r\n");
+      }
+
+      SECTION("With both 'delta' and 'envelope', should show usage") {
+        char* argv[] = {const_cast<char*>("sensor_rtt"), const_cast<char*>("scan"),
+                        const_cast<char*>("all"), const_cast<char*>("delta"),
+                        const_cast<char*>("envelope")};
+        cmd.Run(5, argv, stream);
+        REQUIRE_FALSE(control.observe_mask_requested);
+        REQUIRE(stream.GetOutput().find("usage:") != std::string::npos);
+      }
+
+      SECTION("With 'delta' twice, should show usage") {
+        char* argv[] = {const_cast<char*>("sensor_rtt"), const_cast<char*>("scan"),
+                        const_cast<char*>("all"), const_cast<char*>("delta"),
+                        const_cast<char*>("delta")};
+        cmd.Run(5, argv, stream);
+        REQUIRE_FALSE(control.observe_mask_requested);
+        REQUIRE(stream.GetOutput().find("usage:") != std::string::npos);
+      }
+
+      SECTION("With a hex mask, should default to mode 'processed'") {
+        char* argv[] = {const_cast<char*>("sensor_rtt"), const_cast<char*>("scan"),
+                        const_cast<char*>("0x2")};
+        cmd.Run(3, argv, stream);
+        REQUIRE(control.observe_mask_requested);
+        REQUIRE(control.last_channel_mask == 0x2u);
+        REQUIRE(control.last_mode == domain::sensors::SensorRttMode::kProcessed);
+      }
+
+      SECTION("With a mask of no fitted sensor, should return an error") {
+        char* argv[] = {const_cast<char*>("sensor_rtt"), const_cast<char*>("scan"),
+                        const_cast<char*>("0x4")};
+        cmd.Run(3, argv, stream);
+        REQUIRE_FALSE(control.observe_mask_requested);
+        REQUIRE(stream.GetOutput() == "error: unknown sensor id\r\n");
+      }
+
+      SECTION("Without a mask, should show usage") {
+        char* argv[] = {const_cast<char*>("sensor_rtt"), const_cast<char*>("scan")};
+        cmd.Run(2, argv, stream);
+        REQUIRE_FALSE(control.observe_mask_requested);
+        REQUIRE(stream.GetOutput().find("usage:") != std::string::npos);
+      }
+    }
+
     SECTION("When called with 'freq'") {
       SECTION("Without value, should return current frequency in Hz") {
         control.status.period_ms = 10;  // 100Hz
@@ -0,0 +1,208 @@
+#if defined(UNIT_TESTS)
+
+#include "app/tasks/sensor_rtt_telemetry_task.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <span>
+
+#include "app/analog/acquisition_state_requirements.hpp"
+#include "app/telemetry/capture_control_requirements.hpp"
+#include "app/telemetry/sensor_rtt_telemetry_command.hpp"
+#include "app/telemetry/sensor_sample_source_requirements.hpp"
+#include "app/telemetry/telemetry_sender_requirements.hpp"
+#include "domain/sensors/sensor.hpp"
+#include "domain/sensors/sensor_registry.hpp"
+#include "domain/telemetry/trigger_capture.hpp"
+#include "os/queue_requirements.hpp"
+#include "os/task.hpp"
+
+// The tests drive the task through Step(); start() is never called on the host.
+bool os::Task::create(const char*, os::TaskFn, void*, std::size_t, std::uint32_t) noexcept {
+  return false;
+}
+
+namespace {
+
+using app::telemetry::SensorRttTelemetryCommand;
+using app::telemetry::SensorRttTelemetryCommandKind;
+
+/** @brief Hands out the queued commands and times out at once when there is none. */
+class FakeCommandQueue final : public os::QueueRequirements<SensorRttTelemetryCommand> {
+ public:
+  bool Send(const SensorRttTelemetryCommand& item, std::uint32_t) noexcept override {
+    commands.push_back(item);
+    return true;
+  }
+
+  bool Receive(SensorRttTelemetryCommand& item, std::uint32_t) noexcept override {
+    if (commands.empty()) {
+      return false;
+    }
+    item = commands.front();
+    commands.pop_front();
+    return true;
+  }
+
+  std::deque<SensorRttTelemetryCommand> commands;
+};
+
+class FakeAcquisitionState final : public app::analog::AcquisitionStateRequirements {
+ public:
+  app::analog::AcquisitionState GetState() const noexcept override {
+    return app::analog::AcquisitionState::kEnabled;
+  }
+};
+
+/** @brief A host that keeps up: every write fits and the buffer is empty again at once. */
+class FakeTelemetrySender final : public app::telemetry::TelemetrySenderRequirements {
+ public:
+  void Send(std::span<const std::uint8_t> data) noexcept override {
+    sent_bytes += data.size();
+  }
+  std::size_t WritableBytes() const noexcept override {
+    return kCapacityBytes;
+  }
+  std::size_t CapacityBytes() const noexcept override {
+    return kCapacityBytes;
+  }
+  std::uint32_t DroppedWrites() const noexcept override {
+    return 0;
+  }
+  std::uint32_t Underruns() const noexcept override {
+    return 0;
+  }
+
+  static constexpr std::size_t kCapacityBytes = 4096;
+  std::size_t sent_bytes = 0;
+};
+
+/** @brief Queues nothing; dropped_records stands in for the ring's drop count. */
+class FakeSampleSource final : public app::telemetry::SensorSampleSourceRequirements {
+ public:
+  void Observe(std::uint32_t mask, domain::sensors::SensorRttMode,
+               std::uint32_t) noexcept override {
+    channel_mask = mask;
+  }
+  bool PeekSample(domain::telemetry::SensorScanSample&) const noexcept override {
+    return false;
+  }
+  void PopSample() noexcept override {}
+  bool PeekEnvelope(app::telemetry::SensorScanEnvelope&) const noexcept override {
+    return false;
+  }
+  void PopEnvelope() noexcept override {}
+  std::uint32_t DroppedRecords() const noexcept override {
+    return dropped_records;
+  }
+
+  std::uint32_t channel_mask = 0;
+  std::uint32_t dropped_records = 0;
+};
+
+/** @brief A frozen capture of scan_count scans. */
+class FakeCapture final : public app::telemetry::CaptureControlRequirements {
+ public:
+  bool Arm(const domain::telemetry::TriggerConfig&) noexcept override {
+    return true;
+  }
+  void Disarm() noexcept override {}
+  app::telemetry::CaptureStatus GetStatus() const noexcept override {
+    app::telemetry::CaptureStatus status{};
+    status.state = domain::telemetry::CaptureState::kFrozen;
+    status.scan_count = scan_count;
+    status.trigger_timestamp_ticks = 5000;
+    status.capacity = scan_count;
+    return status;
+  }
+  bool ReadScan(std::size_t index, app::telemetry::CaptureScan& out_scan) const noexcept override {
+    if (index >= scan_count) {
+      return false;
+    }
+    out_scan = app::telemetry::CaptureScan{};
+    out_scan.timestamp_ticks = static_cast<std::uint32_t>(1000u * index);
+    return true;
+  }
+
+  std::uint32_t scan_count = 2;
+};
+
+}  // namespace
+
+TEST_CASE("The SensorRttTelemetryTask class", "[app][tasks]") {
+  domain::sensors::Sensor sensors[] = {domain::sensors::Sensor(1), domain::sensors::Sensor(2),
+                                       domain::sensors::Sensor(3)};
+  domain::sensors::SensorRegistry registry(sensors, 3);
+  FakeCommandQueue queue;
+  FakeAcquisitionState adc_state;
+  FakeTelemetrySender sender;
+  FakeSampleSource source;
+  FakeCapture capture;
+  volatile bool enabled = false;
+  volatile std::uint8_t sensor_id = 0;
+  volatile domain::sensors::SensorRttMode mode = domain::sensors::SensorRttMode::kRaw;
+  volatile std::uint32_t period_ms = 1;
+  volatile std::uint32_t channel_mask = 0;
+  volatile app::telemetry::ScanEncoding encoding = app::telemetry::ScanEncoding::kFull;
+  volatile std::uint32_t dropped_frames = 0;
+  volatile std::uint32_t capture_remaining = 0;
+  volatile std::uint8_t backoff_level = 0;
+  app::Tasks::SensorRttTelemetryTask task(queue, registry, adc_state, sender, source, capture,
+                                          enabled, sensor_id, mode, period_ms, channel_mask,
+                                          encoding, dropped_frames, capture_remaining,
+                                          backoff_level);
+
+  const auto step_ms = [&task](std::uint32_t milliseconds) {
+    for (std::uint32_t i = 0; i < milliseconds; ++i) {
+      task.Step();
+    }
+  };
+
+  SensorRttTelemetryCommand observe{};
+  observe.kind = SensorRttTelemetryCommandKind::kObserveMask;
+  observe.channel_mask = 0x7u;
+  queue.Send(observe, 0);
+  task.Step();
+  REQUIRE(source.channel_mask == 0x7u);
+
+  SECTION("When a capture is read out while scans stream") {
+    SensorRttTelemetryCommand send_capture{};
+    send_capture.kind = SensorRttTelemetryCommandKind::kSendCapture;
+    queue.Send(send_capture, 0);
+    task.Step();
+
+    SECTION("Should stop queuing scans until the readout is done") {
+      REQUIRE(capture_remaining == 2u);
+      REQUIRE(source.channel_mask == 0u);
+
+      task.Step();
+
+      REQUIRE(capture_remaining == 0u);
+      REQUIRE(sender.sent_bytes != 0u);
+      REQUIRE(source.channel_mask == 0x7u);
+    }
+
+    SECTION("Should neither count nor back off for the records the pause dropped") {
+      source.dropped_records += 40u;
+      task.Step();
+      step_ms(250);
+
+      REQUIRE(dropped_frames == 0u);
+      REQUIRE(backoff_level == 0u);
+    }
+
+    SECTION("Should still back off for records lost once streaming resumed") {
+      source.dropped_records += 40u;
+      task.Step();
+      source.dropped_records += 3u;
+      step_ms(100);
+
+      REQUIRE(dropped_frames == 3u);
+      REQUIRE(backoff_level == 1u);
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,51 @@
+#if defined(UNIT_TESTS)
+
+#include "app/telemetry/live_snapshot_tap.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+
+#include "domain/sensors/sensor.hpp"
+#include "domain/sensors/sensor_registry.hpp"
+#include "domain/telemetry/live_snapshot.hpp"
+
+TEST_CASE("The LiveSnapshotTap class", "[app][telemetry]") {
+  domain::sensors::Sensor sensors[] = {domain::sensors::Sensor(1), domain::sensors::Sensor(3)};
+  domain::sensors::SensorRegistry registry(sensors, 2);
+  app::telemetry::LiveSnapshotTap::Snapshot snapshot;
+  app::telemetry::LiveSnapshotTap tap(registry, snapshot, 10000);
+  domain::telemetry::LiveSnapshotSlot<app::config_sensors::kSensorCount> slot;
+
+  constexpr std::uint8_t kIds[] = {1, 3};
+
+  SECTION("The OnSequence() method") {
+    SECTION("Should publish every fitted sensor's latest values") {
+      sensors[0].Update(1200, 3.5f, 500);
+      sensors[1].UpdateRaw(4000, 600);
+      tap.OnSequence(kIds, 2, 600);
+
+      REQUIRE(domain::telemetry::TryReadLiveSnapshot(snapshot, slot));
+      REQUIRE(slot.timestamp_ticks == 600u);
+      REQUIRE(slot.channel_mask == 0x5u);
+      REQUIRE(slot.channels[0].raw == 1200u);
+      REQUIRE(slot.channels[0].processed == 3.5f);
+      REQUIRE(slot.channels[0].timestamp_ticks == 500u);
+      REQUIRE(slot.channels[2].raw == 4000u);
+      REQUIRE(slot.channels[1].raw == 0u);
+    }
+
+    SECTION("Should publish at most once per period") {
+      for (std::uint32_t ticks = 0; ticks < 30000u; ticks += 1000u) {
+        sensors[0].UpdateRaw(static_cast<std::uint16_t>(ticks / 1000u), ticks);
+        tap.OnSequence(kIds, 2, ticks);
+      }
+
+      REQUIRE(domain::telemetry::TryReadLiveSnapshot(snapshot, slot));
+      REQUIRE(slot.publish_count == 3u);
+      REQUIRE(slot.timestamp_ticks == 20000u);
+      REQUIRE(slot.channels[0].raw == 20u);
+    }
+  }
+}
+
+#endif
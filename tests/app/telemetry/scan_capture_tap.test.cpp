@@ -0,0 +1,146 @@
+#if defined(UNIT_TESTS)
+
+#include "app/telemetry/scan_capture_tap.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <vector>
+
+#include "domain/sensors/sensor.hpp"
+#include "domain/sensors/sensor_registry.hpp"
+#include "domain/telemetry/capture_buffer_header.hpp"
+#include "domain/telemetry/trigger_capture.hpp"
+
+namespace {
+
+using domain::telemetry::CaptureState;
+
+domain::telemetry::TriggerConfig MakeConfig() {
+  domain::telemetry::TriggerConfig config{};
+  config.channel = 2;  // sensor id 3
+  config.threshold = 30000;
+  config.slope = domain::telemetry::TriggerSlope::kFalling;
+  config.pre_scans = 2;
+  config.post_scans = 1;
+  return config;
+}
+
+}  // namespace
+
+TEST_CASE("The ScanCaptureTap class", "[app][telemetry]") {
+  domain::sensors::Sensor sensors[] = {domain::sensors::Sensor(1), domain::sensors::Sensor(2),
+                                       domain::sensors::Sensor(3)};
+  domain::sensors::SensorRegistry registry(sensors, 3);
+  std::vector<app::telemetry::CaptureScan> storage(8);
+  domain::telemetry::CaptureBufferHeader header{};
+  header.magic = 0;
+  app::telemetry::ScanCaptureTap tap(registry, header, storage.data(), storage.size());
+
+  // Sensors 1 and 2 share one ADC, sensor 3 is sampled by another one 333 ticks later.
+  constexpr std::uint8_t kFirstAdcIds[] = {2, 1};
+  constexpr std::uint8_t kSecondAdcIds[] = {3};
+  const auto acquire_scan = [&](std::uint32_t index, std::uint16_t sensor3_value) {
+    sensors[0].UpdateRaw(static_cast<std::uint16_t>(100u + index), 1000u * index);
+    sensors[1].UpdateRaw(static_cast<std::uint16_t>(200u + index), 1000u * index);
+    tap.OnSequence(kFirstAdcIds, 2, 1000u * index);
+    sensors[2].UpdateRaw(sensor3_value, 1000u * index + 333u);
+    tap.OnSequence(kSecondAdcIds, 1, 1000u * index + 333u);
+  };
+
+  SECTION("The OnSequence() method") {
+    SECTION("When armed") {
+      SECTION("Should capture full scans around the trigger") {
+        REQUIRE(tap.Arm(MakeConfig()));
+        for (std::uint32_t i = 0; i < 10; ++i) {
+          acquire_scan(i, i < 6 ? 52000 : 21000);
+        }
+
+        const app::telemetry::CaptureStatus status = tap.GetStatus();
+        REQUIRE(status.state == CaptureState::kFrozen);
+        REQUIRE(status.scan_count == 4u);
+        REQUIRE(status.trigger_index == 2u);
+        REQUIRE(status.trigger_timestamp_ticks == 6000u);
+
+        app::telemetry::CaptureScan scan{};
+        REQUIRE(tap.ReadScan(0, scan));
+        REQUIRE(scan.timestamp_ticks == 4000u);
+        REQUIRE(scan.values[0] == 104u);
+        REQUIRE(scan.values[1] == 204u);
+        REQUIRE(scan.values[2] == 52000u);
+        REQUIRE(scan.values[3] == 0u);
+        REQUIRE(tap.ReadScan(3, scan));
+        REQUIRE(scan.timestamp_ticks == 7000u);
+        REQUIRE_FALSE(tap.ReadScan(4, scan));
+      }
+    }
+
+    SECTION("When a sequence repeats a staged sensor") {
+      SECTION("Should push the partial scan first") {
+        domain::telemetry::TriggerConfig config = MakeConfig();
+        config.channel = 0;
+        config.pre_scans = 0;
+        config.post_scans = 0;
+        REQUIRE(tap.Arm(config));
+
+        sensors[0].UpdateRaw(52000, 0);
+        tap.OnSequence(kFirstAdcIds, 2, 0);
+        sensors[0].UpdateRaw(21000, 1000);
+        tap.OnSequence(kFirstAdcIds, 2, 1000);
+        tap.OnSequence(kFirstAdcIds, 2, 2000);
+
+        REQUIRE(tap.GetStatus().state == CaptureState::kFrozen);
+        REQUIRE(tap.GetStatus().trigger_timestamp_ticks == 1000u);
+      }
+    }
+
+    SECTION("When idle") {
+      SECTION("Should record nothing") {
+        for (std::uint32_t i = 0; i < 10; ++i) {
+          acquire_scan(i, i < 6 ? 52000 : 21000);
+        }
+        app::telemetry::CaptureScan scan{};
+        REQUIRE(tap.GetStatus().state == CaptureState::kIdle);
+        REQUIRE_FALSE(tap.ReadScan(0, scan));
+      }
+    }
+  }
+
+  SECTION("The buffer header") {
+    SECTION("Should describe the buffer from construction") {
+      REQUIRE(header.magic == domain::telemetry::kCaptureBufferMagic);
+      REQUIRE(header.header_bytes == 64u);
+      REQUIRE(header.scan_bytes == sizeof(app::telemetry::CaptureScan));
+      REQUIRE(header.channel_mask == 0x7u);
+      REQUIRE(header.capacity == 8u);
+      REQUIRE(header.state == static_cast<std::uint8_t>(CaptureState::kIdle));
+    }
+
+    SECTION("Should follow the capture from arming to freezing") {
+      REQUIRE(tap.Arm(MakeConfig()));
+      acquire_scan(0, 52000);
+      REQUIRE(header.state == static_cast<std::uint8_t>(CaptureState::kArmed));
+      REQUIRE(header.capture_number == 1u);
+      REQUIRE(header.scan_count == 0u);
+
+      for (std::uint32_t i = 1; i < 12; ++i) {
+        acquire_scan(i, i < 9 ? 52000 : 21000);
+      }
+      REQUIRE(header.state == static_cast<std::uint8_t>(CaptureState::kFrozen));
+      REQUIRE(header.scan_count == 4u);
+      REQUIRE(header.trigger_index == 2u);
+      REQUIRE(header.trigger_timestamp_ticks == 9000u);
+      REQUIRE(header.trigger_channel == 2u);
+      // Scans 7..10 were written to slots 7, 0, 1, 2 of the 8-slot ring.
+      REQUIRE(header.first_slot == 7u);
+      REQUIRE(storage[(header.first_slot + 3u) % 8u].timestamp_ticks == 10000u);
+    }
+  }
+
+  SECTION("The GetStatus() method") {
+    SECTION("Should report the ring capacity") {
+      REQUIRE(tap.GetStatus().capacity == 8u);
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,191 @@
+#if defined(UNIT_TESTS)
+
+#include "app/telemetry/sensor_sample_tap.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+
+#include "app/telemetry/sensor_sample_source_requirements.hpp"
+#include "domain/sensors/sensor.hpp"
+#include "domain/sensors/sensor_registry.hpp"
+#include "domain/sensors/sensor_rtt_mode.hpp"
+#include "domain/telemetry/sensor_scan_frame.hpp"
+
+TEST_CASE("The SensorSampleTap class", "[app][telemetry]") {
+  domain::sensors::Sensor sensors[] = {domain::sensors::Sensor(1), domain::sensors::Sensor(2),
+                                       domain::sensors::Sensor(3)};
+  domain::sensors::SensorRegistry registry(sensors, 3);
+  app::telemetry::SensorSampleTap tap(registry);
+  sensors[0].Update(100, 1.5f, 10);
+  sensors[1].Update(200, -0.25f, 10);
+  sensors[2].Update(300, 2.0f, 10);
+
+  constexpr std::uint8_t kSequenceIds[] = {3, 1, 2};
+  domain::telemetry::SensorScanSample sample{};
+
+  SECTION("The OnSequence() method") {
+    SECTION("When no channel is observed") {
+      SECTION("Should queue nothing") {
+        tap.OnSequence(kSequenceIds, 3, 1000);
+        REQUIRE_FALSE(tap.ring().TryPop(sample));
+      }
+    }
+
+    SECTION("When raw values are observed") {
+      SECTION("Should queue the observed channels in ascending id order") {
+        tap.Observe(0x5u, domain::sensors::SensorRttMode::kRaw, 0);
+        tap.OnSequence(kSequenceIds, 3, 1000);
+
+        REQUIRE(tap.ring().TryPop(sample));
+        REQUIRE(sample.timestamp_ticks == 1000u);
+        REQUIRE(sample.channel_mask == 0x5u);
+        REQUIRE(sample.count == 2u);
+        REQUIRE(sample.values[0] == 100u);
+        REQUIRE(sample.values[1] == 300u);
+      }
+    }
+
+    SECTION("When processed values are observed") {
+      SECTION("Should queue them scaled to microamps") {
+        tap.Observe(0x3u, domain::sensors::SensorRttMode::kProcessed, 0);
+        tap.OnSequence(kSequenceIds, 3, 1000);
+
+        REQUIRE(tap.ring().TryPop(sample));
+        REQUIRE(static_cast<std::int16_t>(sample.values[0]) == 1500);
+        REQUIRE(static_cast<std::int16_t>(sample.values[1]) == -250);
+      }
+    }
+
+    SECTION("When a scan is split over several sequences") {
+      constexpr std::uint8_t kFirstSequenceIds[] = {3, 1};
+      constexpr std::uint8_t kSecondSequenceIds[] = {2};
+
+      SECTION("Should queue one record for the whole scan at its first sequence's time") {
+        tap.Observe(0x7u, domain::sensors::SensorRttMode::kRaw, 0);
+        tap.OnSequence(kFirstSequenceIds, 2, 1000);
+        REQUIRE(tap.ring().size() == 0u);
+
+        tap.OnSequence(kSecondSequenceIds, 1, 1333);
+
+        REQUIRE(tap.ring().TryPop(sample));
+        REQUIRE(sample.timestamp_ticks == 1000u);
+        REQUIRE(sample.channel_mask == 0x7u);
+        REQUIRE(sample.count == 3u);
+        REQUIRE(sample.values[0] == 100u);
+        REQUIRE(sample.values[1] == 200u);
+        REQUIRE(sample.values[2] == 300u);
+        REQUIRE_FALSE(tap.ring().TryPop(sample));
+      }
+
+      SECTION("Should queue the partial scan when a staged channel comes round again") {
+        tap.Observe(0x7u, domain::sensors::SensorRttMode::kRaw, 0);
+        tap.OnSequence(kFirstSequenceIds, 2, 1000);
+        tap.OnSequence(kFirstSequenceIds, 2, 2000);
+
+        REQUIRE(tap.ring().TryPop(sample));
+        REQUIRE(sample.timestamp_ticks == 1000u);
+        REQUIRE(sample.channel_mask == 0x5u);
+        REQUIRE(sample.count == 2u);
+        REQUIRE_FALSE(tap.ring().TryPop(sample));
+      }
+
+      SECTION("Should drop the partial scan when the selection changes") {
+        tap.Observe(0x7u, domain::sensors::SensorRttMode::kRaw, 0);
+        tap.OnSequence(kFirstSequenceIds, 2, 1000);
+        tap.Observe(0x2u, domain::sensors::SensorRttMode::kRaw, 0);
+        tap.OnSequence(kSecondSequenceIds, 1, 1333);
+
+        REQUIRE(tap.ring().TryPop(sample));
+        REQUIRE(sample.timestamp_ticks == 1333u);
+        REQUIRE(sample.channel_mask == 0x2u);
+        REQUIRE_FALSE(tap.ring().TryPop(sample));
+      }
+    }
+
+    SECTION("When every scan is queued") {
+      SECTION("Should keep one record per scan until the ring is full, then count drops") {
+        tap.Observe(0x1u, domain::sensors::SensorRttMode::kRaw, 0);
+        const std::size_t capacity = app::telemetry::SensorSampleTap::Ring::capacity();
+        for (std::uint32_t i = 0; i < capacity + 3u; ++i) {
+          tap.OnSequence(kSequenceIds, 3, i);
+        }
+
+        REQUIRE(tap.ring().size() == capacity);
+        REQUIRE(tap.ring().dropped_count() == 3u);
+        REQUIRE(tap.ring().TryPop(sample));
+        REQUIRE(sample.timestamp_ticks == 0u);
+      }
+    }
+
+    SECTION("When envelopes are observed") {
+      SECTION("Should queue one envelope per period instead of every sequence") {
+        tap.Observe(0x3u, domain::sensors::SensorRttMode::kProcessed, 10000);
+        tap.OnSequence(kSequenceIds, 3, 1000);
+        sensors[0].Update(100, 4.0f, 5000);
+        tap.OnSequence(kSequenceIds, 3, 5000);
+        REQUIRE(tap.envelope_ring().size() == 0u);
+
+        tap.OnSequence(kSequenceIds, 3, 11000);
+
+        app::telemetry::SensorSampleTap::Envelope envelope{};
+        REQUIRE_FALSE(tap.ring().TryPop(sample));
+        REQUIRE(tap.envelope_ring().TryPop(envelope));
+        REQUIRE(envelope.first_timestamp_ticks == 1000u);
+        REQUIRE(envelope.channel_mask == 0x3u);
+        REQUIRE(envelope.min[0] == 1500);
+        REQUIRE(envelope.max[0] == 4000);
+        REQUIRE(envelope.mean(0) == 2750);
+        REQUIRE(envelope.min[1] == -250);
+        REQUIRE(envelope.count[1] == 2u);
+      }
+
+      SECTION("Should start a new envelope when the selection changes") {
+        tap.Observe(0x1u, domain::sensors::SensorRttMode::kRaw, 10000);
+        tap.OnSequence(kSequenceIds, 3, 1000);
+        tap.Observe(0x4u, domain::sensors::SensorRttMode::kRaw, 10000);
+        tap.OnSequence(kSequenceIds, 3, 12000);
+        tap.OnSequence(kSequenceIds, 3, 22000);
+
+        app::telemetry::SensorSampleTap::Envelope envelope{};
+        REQUIRE(tap.envelope_ring().TryPop(envelope));
+        REQUIRE(envelope.first_timestamp_ticks == 12000u);
+        REQUIRE(envelope.channel_mask == 0x4u);
+        REQUIRE(envelope.max[2] == 300);
+        REQUIRE_FALSE(tap.envelope_ring().TryPop(envelope));
+      }
+    }
+  }
+
+  SECTION("As a sample source") {
+    app::telemetry::SensorSampleSourceRequirements& source = tap;
+
+    SECTION("Should hand out the queued records in order and count what the ring dropped") {
+      source.Observe(0x1u, domain::sensors::SensorRttMode::kRaw, 0);
+      const std::size_t capacity = app::telemetry::SensorSampleTap::Ring::capacity();
+      for (std::uint32_t i = 0; i < capacity + 2u; ++i) {
+        tap.OnSequence(kSequenceIds, 3, i);
+      }
+
+      REQUIRE(source.PeekSample(sample));
+      REQUIRE(sample.timestamp_ticks == 0u);
+      REQUIRE(source.PeekSample(sample));
+      REQUIRE(sample.timestamp_ticks == 0u);
+      source.PopSample();
+      REQUIRE(source.PeekSample(sample));
+      REQUIRE(sample.timestamp_ticks == 1u);
+      REQUIRE(source.DroppedRecords() == 2u);
+    }
+
+    SECTION("Should stop queuing once nothing is observed") {
+      source.Observe(0, domain::sensors::SensorRttMode::kRaw, 0);
+      tap.OnSequence(kSequenceIds, 3, 1000);
+
+      app::telemetry::SensorScanEnvelope envelope{};
+      REQUIRE_FALSE(source.PeekSample(sample));
+      REQUIRE_FALSE(source.PeekEnvelope(envelope));
+    }
+  }
+}
+
+#endif
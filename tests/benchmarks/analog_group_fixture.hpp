@@ -0,0 +1,48 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <utility>
+
+#include "app/config/sensors.hpp"
+#include "app/config/signal_processing.hpp"
+#include "domain/sensors/processed_sensor_group.hpp"
+#include "domain/sensors/sensor.hpp"
+#include "domain/sensors/sensor_noise_monitor.hpp"
+
+namespace benchmarks {
+
+// Mirrors the wiring done by the analog subsystem composer: 22 sensors, one production
+// processor per sensor, grouped behind a ProcessedSensorGroup with the noise monitor attached.
+struct AnalogGroupFixture {
+  static constexpr std::size_t kSensorCount = app::config_sensors::kSensorCount;
+
+  using Processor = app::config::AnalogSensorProcessor;
+  using NoiseMonitor = domain::sensors::SensorNoiseMonitor<kSensorCount>;
+  using Group = domain::sensors::ProcessedSensorGroup<Processor, NoiseMonitor>;
+
+  template <std::size_t... kIs>
+  static std::array<domain::sensors::Sensor, kSensorCount> MakeSensors(
+      std::index_sequence<kIs...>) noexcept {
+    return {domain::sensors::Sensor(app::config_sensors::kSensorIds[kIs])...};
+  }
+
+  // The group asserts on null sensors, so the pointers must be filled before it is built.
+  static std::array<domain::sensors::Sensor*, kSensorCount> MakeSensorPtrs(
+      std::array<domain::sensors::Sensor, kSensorCount>& sensors) noexcept {
+    std::array<domain::sensors::Sensor*, kSensorCount> ptrs{};
+    for (std::size_t i = 0; i < kSensorCount; ++i) {
+      ptrs[i] = &sensors[i];
+    }
+    return ptrs;
+  }
+
+  std::array<domain::sensors::Sensor, kSensorCount> sensors =
+      MakeSensors(std::make_index_sequence<kSensorCount>{});
+  std::array<domain::sensors::Sensor*, kSensorCount> sensor_ptrs = MakeSensorPtrs(sensors);
+  std::array<Processor, kSensorCount> processors{};
+  NoiseMonitor noise_monitor{};
+  Group group{sensor_ptrs.data(), processors.data(), kSensorCount, &noise_monitor};
+};
+
+}  // namespace benchmarks
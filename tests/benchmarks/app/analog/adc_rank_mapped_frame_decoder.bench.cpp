@@ -0,0 +1,76 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "analog_group_fixture.hpp"
+#include "app/analog/adc_rank_mapped_frame_decoder.hpp"
+#include "app/config/sensors.hpp"
+#include "benchmark_signals.hpp"
+
+namespace {
+
+constexpr std::size_t kMaxSequencesPerHalfBuffer = 32;
+
+template <std::size_t kRankCount>
+std::array<std::uint16_t, kRankCount * kMaxSequencesPerHalfBuffer> MakeHalfBuffer() noexcept {
+  std::array<std::uint16_t, kRankCount * kMaxSequencesPerHalfBuffer> half_buffer{};
+  for (std::size_t i = 0; i < half_buffer.size(); ++i) {
+    half_buffer[i] = benchmarks::kKeyStrikeTrace[i % benchmarks::kTraceSampleCount];
+  }
+  return half_buffer;
+}
+
+template <std::size_t kRankCount>
+void DecodeHalfBuffer(benchmark::State& state,
+                      const std::uint8_t (&sensor_id_by_rank)[kRankCount]) noexcept {
+  benchmarks::AnalogGroupFixture fixture;
+  const app::analog::AdcRankMappedFrameDecoder decoder{};
+  const auto half_buffer = MakeHalfBuffer<kRankCount>();
+  const std::size_t sequences_per_half_buffer = static_cast<std::size_t>(state.range(0));
+  std::uint32_t timestamp_ticks = 0;
+
+  for (auto _ : state) {
+    const std::uint16_t* sequence = half_buffer.data();
+    for (std::size_t seq = 0; seq < sequences_per_half_buffer; ++seq) {
+      decoder.ApplySequence(sequence, kRankCount, sensor_id_by_rank, fixture.group,
+                            timestamp_ticks);
+      sequence += kRankCount;
+      timestamp_ticks += 1000u;
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<std::int64_t>(sequences_per_half_buffer * kRankCount));
+}
+
+void BM_ApplySequenceAdc1(benchmark::State& state) {
+  DecodeHalfBuffer(state, app::config_sensors::kAdc1SensorIdByRank);
+}
+
+void BM_ApplySequenceAdc2(benchmark::State& state) {
+  DecodeHalfBuffer(state, app::config_sensors::kAdc2SensorIdByRank);
+}
+
+void BM_ApplySequenceAdc3(benchmark::State& state) {
+  DecodeHalfBuffer(state, app::config_sensors::kAdc3SensorIdByRank);
+}
+
+}  // namespace
+
+BENCHMARK(BM_ApplySequenceAdc1)
+    ->Name("analog/AdcRankMappedFrameDecoder/ApplySequence/adc1_7_ranks")
+    ->ArgName("sequences_per_half_buffer")
+    ->Arg(1)
+    ->Arg(kMaxSequencesPerHalfBuffer);
+BENCHMARK(BM_ApplySequenceAdc2)
+    ->Name("analog/AdcRankMappedFrameDecoder/ApplySequence/adc2_7_ranks")
+    ->ArgName("sequences_per_half_buffer")
+    ->Arg(1)
+    ->Arg(kMaxSequencesPerHalfBuffer);
+BENCHMARK(BM_ApplySequenceAdc3)
+    ->Name("analog/AdcRankMappedFrameDecoder/ApplySequence/adc3_8_ranks")
+    ->ArgName("sequences_per_half_buffer")
+    ->Arg(1)
+    ->Arg(kMaxSequencesPerHalfBuffer);
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace benchmarks {
+
+// Deterministic synthetic ADC trace: a resting key with a few counts of noise, then a strike ramp
+// down to the key bed, a hold, and a release back to rest. Values are 16-bit ADC counts as
+// produced by the TIA front-end (rest is close to full scale, a pressed key pulls it down).
+template <std::size_t kSampleCount>
+constexpr std::array<std::uint16_t, kSampleCount> MakeKeyStrikeTrace() noexcept {
+  constexpr std::int32_t kRestCounts = 52000;
+  constexpr std::int32_t kKeyBedCounts = 21000;
+  constexpr std::int32_t kTravelCounts = kRestCounts - kKeyBedCounts;
+  constexpr std::size_t kStrikeStart = kSampleCount / 4u;
+  constexpr std::size_t kStrikeLength = kSampleCount / 16u;
+  constexpr std::size_t kReleaseStart = kSampleCount / 2u;
+
+  std::array<std::uint16_t, kSampleCount> trace{};
+  std::uint32_t noise_state = 0x12345678u;
+  for (std::size_t i = 0; i < kSampleCount; ++i) {
+    noise_state = noise_state * 1664525u + 1013904223u;
+    const std::int32_t noise_counts = static_cast<std::int32_t>((noise_state >> 28) & 0x7u) - 3;
+
+    std::int32_t level = kRestCounts;
+    if (i >= kStrikeStart && i < kStrikeStart + kStrikeLength) {
+      const std::int32_t progress = static_cast<std::int32_t>(i - kStrikeStart);
+      level = kRestCounts - (kTravelCounts * progress) / static_cast<std::int32_t>(kStrikeLength);
+    } else if (i >= kStrikeStart + kStrikeLength && i < kReleaseStart) {
+      level = kKeyBedCounts;
+    }
+    trace[i] = static_cast<std::uint16_t>(level + noise_counts);
+  }
+  return trace;
+}
+
+inline constexpr std::size_t kTraceSampleCount = 4096;
+inline constexpr std::array<std::uint16_t, kTraceSampleCount> kKeyStrikeTrace =
+    MakeKeyStrikeTrace<kTraceSampleCount>();
+
+}  // namespace benchmarks
@@ -0,0 +1,70 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "benchmark_signals.hpp"
+#include "domain/music/key_tracker.hpp"
+#include "domain/music/note_event.hpp"
+
+namespace {
+
+constexpr std::size_t kKeyCount = 22;
+constexpr float kRestCounts = 52000.0f;
+constexpr float kCountsPerPosition = 31000.0f / 0.5f;
+
+class EventCounter {
+ public:
+  void OnNoteEvent(const domain::music::NoteEvent& event) noexcept {
+    benchmark::DoNotOptimize(event);
+    ++event_count;
+  }
+
+  std::int64_t event_count = 0;
+};
+
+// Key strike trace converted to key positions (0 at rest, 0.5 at the key bed), each key shifted
+// in time so that strikes are spread over the scans.
+std::array<float, benchmarks::kTraceSampleCount> MakePositionTrace() noexcept {
+  std::array<float, benchmarks::kTraceSampleCount> positions{};
+  for (std::size_t i = 0; i < benchmarks::kTraceSampleCount; ++i) {
+    positions[i] = (kRestCounts - static_cast<float>(benchmarks::kKeyStrikeTrace[i])) /
+                   kCountsPerPosition;
+  }
+  return positions;
+}
+
+void BM_ScanAllKeys(benchmark::State& state) {
+  static const std::array<float, benchmarks::kTraceSampleCount> kPositionTrace =
+      MakePositionTrace();
+  constexpr std::size_t kKeyPhaseStep = benchmarks::kTraceSampleCount / kKeyCount;
+
+  domain::music::KeyTracker<kKeyCount> tracker(domain::music::KeyTrackerConfig{},
+                                               domain::music::kDefaultVelocityCurve,
+                                               domain::music::kNoteC4);
+  EventCounter counter;
+  std::array<float, kKeyCount> positions{};
+  std::array<std::uint32_t, kKeyCount> timestamps_ticks{};
+  std::size_t scan_index = 0;
+  std::uint32_t now_ticks = 0;
+
+  for (auto _ : state) {
+    for (std::size_t key = 0; key < kKeyCount; ++key) {
+      positions[key] =
+          kPositionTrace[(scan_index + key * kKeyPhaseStep) % benchmarks::kTraceSampleCount];
+      timestamps_ticks[key] = now_ticks;
+    }
+    tracker.Scan(positions.data(), timestamps_ticks.data(), counter);
+    scan_index = (scan_index + 1u) % benchmarks::kTraceSampleCount;
+    now_ticks += 1000u;
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kKeyCount));
+  state.counters["events"] =
+      benchmark::Counter(static_cast<double>(counter.event_count), benchmark::Counter::kIsRate);
+}
+
+}  // namespace
+
+BENCHMARK(BM_ScanAllKeys)->Name("music/KeyTracker/Scan/22_keys");
@@ -0,0 +1,51 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+#include "domain/music/music_event.hpp"
+#include "domain/music/music_event_queue.hpp"
+
+namespace {
+
+using domain::music::MusicEvent;
+using domain::music::MusicEventQueue;
+using domain::music::MusicEventType;
+
+using Queue = MusicEventQueue<64, 64>;
+
+// Push + pop of one event; the queue never fills, so this is the steady-state hot path cost.
+void BM_PushPop(benchmark::State& state, MusicEventType type) {
+  static Queue queue;
+  MusicEvent out{};
+  std::uint32_t timestamp_ticks = 0;
+
+  for (auto _ : state) {
+    queue.Push(
+        MusicEvent{.timestamp_ticks = timestamp_ticks++, .type = type, .number = 64, .value = 100});
+    benchmark::DoNotOptimize(queue.TryPop(out));
+    benchmark::DoNotOptimize(out);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Controller push into a permanently full ring: every push overwrites the oldest entry.
+void BM_PushControllerOverwrite(benchmark::State& state) {
+  static Queue queue;
+  std::uint32_t timestamp_ticks = 0;
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(queue.Push(MusicEvent{.timestamp_ticks = timestamp_ticks++,
+                                                   .type = MusicEventType::kControlChange,
+                                                   .number = 64,
+                                                   .value = 100}));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+}  // namespace
+
+BENCHMARK_CAPTURE(BM_PushPop, note, MusicEventType::kNoteOn)
+    ->Name("music/MusicEventQueue/PushPop/note");
+BENCHMARK_CAPTURE(BM_PushPop, controller, MusicEventType::kControlChange)
+    ->Name("music/MusicEventQueue/PushPop/controller");
+BENCHMARK(BM_PushControllerOverwrite)->Name("music/MusicEventQueue/Push/controller_overwrite");
@@ -0,0 +1,42 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstddef>
+
+#include "domain/music/velocity_curve.hpp"
+
+namespace {
+
+constexpr float kFastestTravelTicks = 2'000.0f;
+constexpr float kSlowestTravelTicks = 100'000.0f;
+constexpr float kTravelTicksStep = 97.0f;
+
+void BM_TableLookup(benchmark::State& state) {
+  static constexpr domain::music::VelocityCurve<1024> kCurve(
+      kFastestTravelTicks, kSlowestTravelTicks,
+      domain::music::MakeLogarithmicVelocityTable<1024>(kFastestTravelTicks, kSlowestTravelTicks));
+  float travel_ticks = kFastestTravelTicks;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(kCurve.Lookup(travel_ticks));
+    travel_ticks = travel_ticks < kSlowestTravelTicks ? travel_ticks + kTravelTicksStep
+                                                      : kFastestTravelTicks;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void BM_AnalyticLogarithm(benchmark::State& state) {
+  const float full_range = std::log(kSlowestTravelTicks / kFastestTravelTicks);
+  float travel_ticks = kFastestTravelTicks;
+  for (auto _ : state) {
+    const float strength = std::log(kSlowestTravelTicks / travel_ticks) / full_range;
+    benchmark::DoNotOptimize(static_cast<domain::music::Velocity>(1.0f + strength * 126.0f));
+    travel_ticks = travel_ticks < kSlowestTravelTicks ? travel_ticks + kTravelTicksStep
+                                                      : kFastestTravelTicks;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+}  // namespace
+
+BENCHMARK(BM_TableLookup)->Name("music/VelocityCurve/Lookup/logarithmic_1024");
+BENCHMARK(BM_AnalyticLogarithm)->Name("music/VelocityCurve/AnalyticLog");
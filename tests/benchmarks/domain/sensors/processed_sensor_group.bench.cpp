@@ -0,0 +1,30 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+
+#include "analog_group_fixture.hpp"
+#include "benchmark_signals.hpp"
+
+namespace {
+
+void BM_UpdateAtAllSensors(benchmark::State& state) {
+  benchmarks::AnalogGroupFixture fixture;
+  std::size_t trace_index = 0;
+  std::uint32_t timestamp_ticks = 0;
+  for (auto _ : state) {
+    const std::uint16_t raw_value = benchmarks::kKeyStrikeTrace[trace_index];
+    for (std::size_t i = 0; i < benchmarks::AnalogGroupFixture::kSensorCount; ++i) {
+      fixture.group.UpdateAt(i, raw_value, timestamp_ticks);
+    }
+    benchmark::ClobberMemory();
+    trace_index = (trace_index + 1u) % benchmarks::kTraceSampleCount;
+    timestamp_ticks += 1000u;
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<std::int64_t>(benchmarks::AnalogGroupFixture::kSensorCount));
+}
+
+}  // namespace
+
+BENCHMARK(BM_UpdateAtAllSensors)->Name("sensors/ProcessedSensorGroup/UpdateAt/22_sensors");
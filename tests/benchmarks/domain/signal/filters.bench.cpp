@@ -0,0 +1,50 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+
+#include "benchmark_signals.hpp"
+#include "domain/signal/filters/ema_filter.hpp"
+#include "domain/signal/filters/identity_filter.hpp"
+#include "domain/signal/filters/sg5_smoother.hpp"
+#include "domain/signal/processors/tia_current_converter.hpp"
+
+namespace {
+
+template <typename ProcessorT>
+void BM_Process(benchmark::State& state) {
+  ProcessorT processor;
+  std::size_t index = 0;
+  for (auto _ : state) {
+    const float sample = static_cast<float>(benchmarks::kKeyStrikeTrace[index]);
+    benchmark::DoNotOptimize(processor.Process(sample));
+    index = (index + 1u) % benchmarks::kTraceSampleCount;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template <typename ProcessorT>
+void BM_PushThenComputeOrRaw(benchmark::State& state) {
+  ProcessorT processor;
+  std::size_t index = 0;
+  for (auto _ : state) {
+    const float sample = static_cast<float>(benchmarks::kKeyStrikeTrace[index]);
+    processor.Push(sample);
+    benchmark::DoNotOptimize(processor.ComputeOrRaw(sample));
+    index = (index + 1u) % benchmarks::kTraceSampleCount;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+using Ema = domain::signal::filters::EmaFilterRatio<1, 8>;
+using Identity = domain::signal::filters::IdentityFilter;
+using Sg5 = domain::signal::filters::Sg5Smoother;
+using Tia = domain::signal::processors::TiaCurrentConverter<2048, 16, 1800>;
+
+}  // namespace
+
+BENCHMARK(BM_Process<Identity>)->Name("filters/IdentityFilter/Process");
+BENCHMARK(BM_Process<Ema>)->Name("filters/EmaFilterRatio<1,8>/Process");
+BENCHMARK(BM_PushThenComputeOrRaw<Ema>)->Name("filters/EmaFilterRatio<1,8>/PushComputeOrRaw");
+BENCHMARK(BM_Process<Sg5>)->Name("filters/Sg5Smoother/Process");
+BENCHMARK(BM_PushThenComputeOrRaw<Sg5>)->Name("filters/Sg5Smoother/PushComputeOrRaw");
+BENCHMARK(BM_Process<Tia>)->Name("processors/TiaCurrentConverter<2048,16,1800>/Process");
@@ -0,0 +1,42 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+
+#include "app/config/signal_processing.hpp"
+#include "benchmark_signals.hpp"
+#include "domain/signal/filters/ema_filter.hpp"
+#include "domain/signal/filters/sg5_smoother.hpp"
+#include "domain/signal/processing_pipeline.hpp"
+#include "domain/signal/processors/tia_current_converter.hpp"
+
+namespace {
+
+template <typename PipelineT>
+void BM_PipelineProcess(benchmark::State& state) {
+  PipelineT pipeline;
+  std::size_t index = 0;
+  for (auto _ : state) {
+    const float sample = static_cast<float>(benchmarks::kKeyStrikeTrace[index]);
+    benchmark::DoNotOptimize(pipeline.Process(sample));
+    index = (index + 1u) % benchmarks::kTraceSampleCount;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+using Ema = domain::signal::filters::EmaFilterRatio<1, 8>;
+using Sg5 = domain::signal::filters::Sg5Smoother;
+using Tia = domain::signal::processors::TiaCurrentConverter<2048, 16, 1800>;
+
+using ContinuousTiaEma = domain::signal::processing_pipeline::ContinuousPipeline<Tia, Ema>;
+using DecimatedEmaSg5 = domain::signal::processing_pipeline::DecimatedPipeline<4, Ema, Sg5>;
+using ContinuousTiaDecimated =
+    domain::signal::processing_pipeline::ContinuousPipeline<Tia, DecimatedEmaSg5>;
+
+}  // namespace
+
+BENCHMARK(BM_PipelineProcess<ContinuousTiaEma>)->Name("pipeline/Continuous<Tia,Ema>/Process");
+BENCHMARK(BM_PipelineProcess<DecimatedEmaSg5>)->Name("pipeline/Decimated<4,Ema,Sg5>/Process");
+BENCHMARK(BM_PipelineProcess<ContinuousTiaDecimated>)
+    ->Name("pipeline/Continuous<Tia,Decimated<4,Ema,Sg5>>/Process");
+BENCHMARK(BM_PipelineProcess<app::config::AnalogSensorProcessor>)
+    ->Name("pipeline/AnalogSensorProcessor/Process");
@@ -0,0 +1,23 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+
+#include "benchmark_signals.hpp"
+#include "domain/signal/statistics/running_stats.hpp"
+
+namespace {
+
+void BM_RunningStatsUpdate(benchmark::State& state) {
+  domain::signal::statistics::RunningStats stats;
+  std::size_t index = 0;
+  for (auto _ : state) {
+    stats.Update(benchmarks::kKeyStrikeTrace[index]);
+    benchmark::DoNotOptimize(stats);
+    index = (index + 1u) % benchmarks::kTraceSampleCount;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+}  // namespace
+
+BENCHMARK(BM_RunningStatsUpdate)->Name("statistics/RunningStats/Update");
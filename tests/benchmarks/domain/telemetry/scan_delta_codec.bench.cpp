@@ -0,0 +1,120 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+
+#include "app/config/sensors.hpp"
+#include "benchmark_signals.hpp"
+#include "domain/telemetry/scan_delta_codec.hpp"
+#include "domain/telemetry/sensor_scan_frame.hpp"
+#include "domain/telemetry/telemetry_frame.hpp"
+
+namespace {
+
+using domain::telemetry::SensorScanSample;
+
+constexpr std::size_t kKeyPhaseStep = benchmarks::kTraceSampleCount / 22u;
+
+std::uint32_t ScanMask() noexcept {
+  std::uint32_t mask = 0;
+  for (const std::uint8_t id : app::config_sensors::kSensorIds) {
+    mask |= 1u << (id - 1u);
+  }
+  return mask;
+}
+
+/**
+ * @brief One SensorSampleTap record per acquisition scan, as the 22-key board produces them:
+ * each key replays the key strike trace with its own phase.
+ *
+ * No recorded scan capture is checked in, so the scans are synthetic. The encode time does not
+ * depend much on the values, but bytes_per_ms does, and it is optimistic compared with real
+ * playing:
+ * - the noise is a uniform +/-3 counts with no drift or low-frequency wander, so rest deltas
+ *   stay in the narrowest widths;
+ * - every key replays the same trace evenly spread in phase, with no crosstalk between them;
+ * - the strike ramp covers 1/16 of the trace, so only one or two keys are moving at any time,
+ *   far fewer than in a fast passage or a chord.
+ * Compare bytes_per_ms against a `capture` dump (tools/capture_dump.py) before sizing the
+ * telemetry link from it.
+ */
+SensorScanSample MakeScan(std::uint32_t mask, std::size_t scan_index,
+                          std::uint32_t timestamp_ticks) noexcept {
+  SensorScanSample sample{};
+  sample.timestamp_ticks = timestamp_ticks;
+  sample.channel_mask = mask;
+  std::size_t channel = 0;
+  for (std::uint32_t bits = mask; bits != 0u; bits >>= 1u, ++channel) {
+    if ((bits & 1u) != 0u) {
+      sample.values[sample.count++] =
+          benchmarks::kKeyStrikeTrace[(scan_index + channel * kKeyPhaseStep) %
+                                      benchmarks::kTraceSampleCount];
+    }
+  }
+  return sample;
+}
+
+void BM_EncodeBlocks(benchmark::State& state) {
+  const std::uint32_t mask = ScanMask();
+  domain::telemetry::ScanDeltaEncoder<> block;
+  domain::telemetry::TelemetryFrameEncoder frames;
+  std::uint8_t frame[domain::telemetry::kTelemetryFrameOverheadBytes +
+                     domain::telemetry::kTelemetryMaxPayloadBytes]{};
+  std::size_t scan_index = 0;
+  std::uint32_t timestamp_ticks = 0;
+  std::int64_t records = 0;
+  std::int64_t bytes = 0;
+
+  for (auto _ : state) {
+    const SensorScanSample sample = MakeScan(mask, scan_index, timestamp_ticks);
+    if (!block.Append(sample)) {
+      bytes += static_cast<std::int64_t>(
+          frames.Encode(domain::telemetry::TelemetryFrameType::kSensorScanDelta,
+                        block.first_timestamp_ticks(), block.data(), block.size(), frame,
+                        sizeof(frame)));
+      block.Clear();
+      block.Append(sample);
+    }
+    benchmark::DoNotOptimize(frame);
+    ++records;
+    scan_index = (scan_index + 1u) % benchmarks::kTraceSampleCount;
+    timestamp_ticks += 1000u;
+  }
+
+  state.SetItemsProcessed(records);
+  state.counters["bytes_per_ms"] = benchmark::Counter(
+      static_cast<double>(bytes) / static_cast<double>(state.iterations()));
+}
+
+void BM_EncodeScanFrames(benchmark::State& state) {
+  const std::uint32_t mask = ScanMask();
+  domain::telemetry::SensorScanFrameBuilder builder;
+  domain::telemetry::TelemetryFrameEncoder frames;
+  std::uint8_t frame[domain::telemetry::kTelemetryFrameOverheadBytes +
+                     domain::telemetry::kScanFrameMaxBytes]{};
+  std::size_t scan_index = 0;
+  std::uint32_t timestamp_ticks = 0;
+  std::int64_t records = 0;
+  std::int64_t bytes = 0;
+
+  for (auto _ : state) {
+    const SensorScanSample sample = MakeScan(mask, scan_index, timestamp_ticks);
+    builder.Build(sample);
+    bytes += static_cast<std::int64_t>(
+        frames.Encode(domain::telemetry::TelemetryFrameType::kSensorScan, sample.timestamp_ticks,
+                      builder.data(), builder.size(), frame, sizeof(frame)));
+    benchmark::DoNotOptimize(frame);
+    ++records;
+    scan_index = (scan_index + 1u) % benchmarks::kTraceSampleCount;
+    timestamp_ticks += 1000u;
+  }
+
+  state.SetItemsProcessed(records);
+  state.counters["bytes_per_ms"] = benchmark::Counter(
+      static_cast<double>(bytes) / static_cast<double>(state.iterations()));
+}
+
+}  // namespace
+
+BENCHMARK(BM_EncodeBlocks)->Name("telemetry/ScanDeltaEncoder/Append/22_channels");
+BENCHMARK(BM_EncodeScanFrames)->Name("telemetry/SensorScanFrameBuilder/Build/22_channels");
@@ -0,0 +1,58 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+
+#include "app/config/sensors.hpp"
+#include "benchmark_signals.hpp"
+#include "domain/telemetry/scan_envelope.hpp"
+#include "domain/telemetry/telemetry_frame.hpp"
+
+namespace {
+
+constexpr std::size_t kChannelCount = app::config_sensors::kSensorCount;
+constexpr std::size_t kKeyPhaseStep = benchmarks::kTraceSampleCount / kChannelCount;
+constexpr std::uint32_t kPeriodTicks = 10000;
+
+/**
+ * @brief What SensorSampleTap does per 1 kHz scan in envelope mode: one Advance() per ADC
+ * sequence and one Add() per key, plus encoding a frame whenever a 10 ms envelope closes.
+ */
+void BM_AccumulateScans(benchmark::State& state) {
+  domain::telemetry::ScanEnvelopeAccumulator<kChannelCount> accumulator;
+  accumulator.Reset(kPeriodTicks);
+  domain::telemetry::ScanEnvelopeFrameBuilder builder;
+  domain::telemetry::TelemetryFrameEncoder frames;
+  std::uint8_t frame[domain::telemetry::kTelemetryFrameOverheadBytes +
+                     domain::telemetry::kScanEnvelopeMaxBytes]{};
+  std::size_t scan_index = 0;
+  std::uint32_t timestamp_ticks = 0;
+  std::int64_t bytes = 0;
+
+  for (auto _ : state) {
+    for (std::size_t adc = 0; adc < 3u; ++adc) {
+      if (accumulator.Advance(timestamp_ticks + 333u * adc)) {
+        builder.Build(accumulator.closed());
+        bytes += static_cast<std::int64_t>(frames.Encode(
+            domain::telemetry::TelemetryFrameType::kSensorScanEnvelope,
+            accumulator.closed().first_timestamp_ticks, builder.data(), builder.size(), frame,
+            sizeof(frame)));
+      }
+    }
+    for (std::size_t channel = 0; channel < kChannelCount; ++channel) {
+      accumulator.Add(channel, benchmarks::kKeyStrikeTrace[(scan_index + channel * kKeyPhaseStep) %
+                                                           benchmarks::kTraceSampleCount]);
+    }
+    benchmark::DoNotOptimize(frame);
+    scan_index = (scan_index + 1u) % benchmarks::kTraceSampleCount;
+    timestamp_ticks += 1000u;
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kChannelCount));
+  state.counters["bytes_per_ms"] = benchmark::Counter(
+      static_cast<double>(bytes) / static_cast<double>(state.iterations()));
+}
+
+}  // namespace
+
+BENCHMARK(BM_AccumulateScans)->Name("telemetry/ScanEnvelopeAccumulator/Add/22_channels");
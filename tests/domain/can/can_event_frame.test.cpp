@@ -0,0 +1,352 @@
+#if defined(UNIT_TESTS)
+
+#include "domain/can/can_event_frame.hpp"
+
+#include <array>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <utility>
+#include <vector>
+
+#include "domain/can/can_frame.hpp"
+#include "domain/music/music_event.hpp"
+
+namespace {
+
+using domain::can::CanEventPacker;
+using domain::can::CanEventUnpacker;
+using domain::can::CanFrame;
+using domain::can::CanTrafficClass;
+using domain::music::MusicEvent;
+using domain::music::MusicEventType;
+
+struct RemoteEvent {
+  std::uint8_t board_id;
+  MusicEvent event;
+};
+
+/** @brief One board on the bus: its TX FIFO and everything it received from the others. */
+class BoardStub {
+ public:
+  explicit BoardStub(std::uint8_t board_id, std::size_t tx_fifo_capacity = 64)
+      : packer(board_id), unpacker(board_id), tx_fifo_capacity_(tx_fifo_capacity) {}
+
+  bool OnCanFrame(const CanFrame& frame) {
+    if (tx_fifo.size() >= tx_fifo_capacity_) {
+      return false;
+    }
+    tx_fifo.push_back(frame);
+    return true;
+  }
+
+  void OnRemoteEvent(std::uint8_t board_id, const MusicEvent& event) {
+    received.push_back(RemoteEvent{board_id, event});
+  }
+
+  CanEventPacker packer;
+  CanEventUnpacker unpacker;
+  std::deque<CanFrame> tx_fifo;
+  std::vector<RemoteEvent> received;
+
+ private:
+  std::size_t tx_fifo_capacity_;
+};
+
+/**
+ * @brief In-memory bus. Each board offers its lowest pending identifier (TX queue mode), the
+ * lowest of those wins arbitration and the frame reaches every other board.
+ */
+class LoopbackBus {
+ public:
+  explicit LoopbackBus(std::vector<BoardStub*> boards) : boards_(std::move(boards)) {}
+
+  bool Transfer() {
+    BoardStub* winner = nullptr;
+    std::size_t winner_index = 0;
+    for (BoardStub* board : boards_) {
+      for (std::size_t i = 0; i < board->tx_fifo.size(); ++i) {
+        if (winner == nullptr || board->tx_fifo[i].id < winner->tx_fifo[winner_index].id) {
+          winner = board;
+          winner_index = i;
+        }
+      }
+    }
+    if (winner == nullptr) {
+      return false;
+    }
+    const CanFrame frame = winner->tx_fifo[winner_index];
+    winner->tx_fifo.erase(winner->tx_fifo.begin() + static_cast<std::ptrdiff_t>(winner_index));
+    order.push_back(frame.id);
+    if (drop_next) {
+      drop_next = false;
+      return true;
+    }
+    for (BoardStub* board : boards_) {
+      if (board != winner) {
+        (void) board->unpacker.Unpack(frame, *board);
+      }
+    }
+    return true;
+  }
+
+  void TransferAll() {
+    while (Transfer()) {
+    }
+  }
+
+  bool drop_next = false;
+  std::vector<std::uint32_t> order;
+
+ private:
+  std::vector<BoardStub*> boards_;
+};
+
+}  // namespace
+
+TEST_CASE("The CAN event identifiers", "[domain][can]") {
+  SECTION("Should give every note frame priority over every controller frame") {
+    REQUIRE(domain::can::MakeCanEventId(CanTrafficClass::kNote, 15) <
+            domain::can::MakeCanEventId(CanTrafficClass::kController, 0));
+  }
+
+  SECTION("Should round-trip the class and board id") {
+    CanTrafficClass traffic_class = CanTrafficClass::kNote;
+    std::uint8_t board_id = 0;
+    REQUIRE(domain::can::ParseCanEventId(
+        domain::can::MakeCanEventId(CanTrafficClass::kController, 3), traffic_class, board_id));
+    REQUIRE(traffic_class == CanTrafficClass::kController);
+    REQUIRE(board_id == 3u);
+  }
+
+  SECTION("Should reject identifiers outside the event classes") {
+    CanTrafficClass traffic_class = CanTrafficClass::kNote;
+    std::uint8_t board_id = 0;
+    REQUIRE_FALSE(domain::can::ParseCanEventId(0x080u, traffic_class, board_id));
+    REQUIRE_FALSE(domain::can::ParseCanEventId(0x7FFu, traffic_class, board_id));
+  }
+}
+
+TEST_CASE("The CanEventPacker class", "[domain][can]") {
+  BoardStub board(2);
+
+  SECTION("When a frame fills up") {
+    SECTION("Should send it at once with a padded 64-byte payload") {
+      for (std::uint8_t i = 0; i < domain::can::kCanEventsPerFrame; ++i) {
+        board.packer.Push(MusicEvent{.timestamp_ticks = i,
+                                     .type = MusicEventType::kNoteOn,
+                                     .number = static_cast<std::uint8_t>(60 + i),
+                                     .value = 0x8000},
+                          board);
+      }
+
+      REQUIRE(board.tx_fifo.size() == 1u);
+      REQUIRE(board.tx_fifo.front().length == 64u);
+      REQUIRE(board.tx_fifo.front().data[1] == domain::can::kCanEventsPerFrame);
+      REQUIRE(board.packer.pending_event_count() == 0u);
+    }
+  }
+
+  SECTION("When Flush() is called") {
+    SECTION("Should send the note frame before the controller frame") {
+      board.packer.Push(MusicEvent{.type = MusicEventType::kControlChange,
+                                   .number = 64,
+                                   .value = 127},
+                        board);
+      board.packer.Push(MusicEvent{.timestamp_ticks = 1,
+                                   .type = MusicEventType::kNoteOn,
+                                   .number = 60,
+                                   .value = 0x8000},
+                        board);
+
+      board.packer.Flush(board);
+
+      REQUIRE(board.tx_fifo.size() == 2u);
+      REQUIRE(board.tx_fifo[0].id == domain::can::MakeCanEventId(CanTrafficClass::kNote, 2));
+      REQUIRE(board.tx_fifo[1].id ==
+              domain::can::MakeCanEventId(CanTrafficClass::kController, 2));
+      REQUIRE(board.tx_fifo[0].length == 12u);
+    }
+
+    SECTION("Should not send empty frames") {
+      board.packer.Flush(board);
+      REQUIRE(board.tx_fifo.empty());
+    }
+  }
+
+  SECTION("When the TX FIFO is full") {
+    SECTION("Should count the dropped frame and its events") {
+      BoardStub full_board(1, 0);
+      full_board.packer.Push(MusicEvent{.type = MusicEventType::kNoteOn,
+                                        .number = 60,
+                                        .value = 0x8000},
+                             full_board);
+      full_board.packer.Push(MusicEvent{.timestamp_ticks = 1,
+                                        .type = MusicEventType::kNoteOff,
+                                        .number = 60,
+                                        .value = 0},
+                             full_board);
+      full_board.packer.Flush(full_board);
+
+      REQUIRE(full_board.packer.stats().dropped_frame_count == 1u);
+      REQUIRE(full_board.packer.stats().dropped_event_count == 2u);
+      REQUIRE(full_board.packer.stats().frames_sent == 0u);
+    }
+  }
+}
+
+TEST_CASE("The CanEventUnpacker class", "[domain][can]") {
+  BoardStub sender(1);
+  BoardStub receiver(0);
+
+  SECTION("Should deliver every field of the event with the sender's board id") {
+    sender.packer.Push(MusicEvent{.timestamp_ticks = 0xA1B2C3D4u,
+                                  .type = MusicEventType::kControlChange14Bit,
+                                  .number = 1,
+                                  .value = 0x3FFF},
+                       sender);
+    sender.packer.Flush(sender);
+
+    REQUIRE(receiver.unpacker.Unpack(sender.tx_fifo.front(), receiver) == 1u);
+    REQUIRE(receiver.received.size() == 1u);
+    REQUIRE(receiver.received[0].board_id == 1u);
+    REQUIRE(receiver.received[0].event.timestamp_ticks == 0xA1B2C3D4u);
+    REQUIRE(receiver.received[0].event.type == MusicEventType::kControlChange14Bit);
+    REQUIRE(receiver.received[0].event.number == 1u);
+    REQUIRE(receiver.received[0].event.value == 0x3FFFu);
+  }
+
+  SECTION("Should ignore frames carrying its own board id") {
+    BoardStub twin(0);
+    twin.packer.Push(MusicEvent{.type = MusicEventType::kNoteOn,
+                                .number = 60,
+                                .value = 0x8000},
+                     twin);
+    twin.packer.Flush(twin);
+
+    REQUIRE(receiver.unpacker.Unpack(twin.tx_fifo.front(), receiver) == 0u);
+    REQUIRE(receiver.received.empty());
+  }
+
+  SECTION("Should reject a count that does not fit the payload") {
+    sender.packer.Push(MusicEvent{.type = MusicEventType::kNoteOn,
+                                  .number = 60,
+                                  .value = 0x8000},
+                       sender);
+    sender.packer.Flush(sender);
+    CanFrame frame = sender.tx_fifo.front();
+    frame.data[1] = 3;
+
+    REQUIRE(receiver.unpacker.Unpack(frame, receiver) == 0u);
+    REQUIRE(receiver.unpacker.stats().malformed_frame_count == 1u);
+  }
+}
+
+TEST_CASE("Four boards chained on a loopback bus", "[domain][can]") {
+  BoardStub master(0);
+  BoardStub board1(1);
+  BoardStub board2(2);
+  BoardStub board3(3);
+  std::array<BoardStub*, 3> slaves{&board1, &board2, &board3};
+  LoopbackBus bus({&master, &board1, &board2, &board3});
+
+  SECTION("When every board plays a chord over a controller sweep") {
+    constexpr std::uint32_t kPollTicks = 1000;
+    constexpr std::uint32_t kFramesPerPoll = 2;
+    std::array<std::uint32_t, 4> sent{};
+
+    for (std::uint32_t now = 0; now < 40u * kPollTicks; now += kPollTicks) {
+      for (std::uint8_t id = 1; id < 4; ++id) {
+        BoardStub& board = *slaves[id - 1u];
+        const std::uint8_t base = static_cast<std::uint8_t>(21u + 22u * id);
+        for (std::uint8_t key = 0; key < 5; ++key) {
+          board.packer.Push(
+              MusicEvent{.timestamp_ticks = now,
+                         .type = MusicEventType::kPolyPressure,
+                         .number = static_cast<std::uint8_t>(base + key),
+                         .value = static_cast<std::uint16_t>((now / kPollTicks) % 128u)},
+              board);
+          ++sent[id];
+        }
+        if (now == 20u * kPollTicks) {
+          for (std::uint8_t key = 0; key < 10; ++key) {
+            board.packer.Push(MusicEvent{.timestamp_ticks = now,
+                                         .type = MusicEventType::kNoteOn,
+                                         .number = static_cast<std::uint8_t>(base + key),
+                                         .value = 0x8000},
+                              board);
+            ++sent[id];
+          }
+        }
+        board.packer.Flush(board);
+      }
+      // The bus carries fewer frames than the boards produce, so a backlog builds up.
+      for (std::uint32_t i = 0; i < kFramesPerPoll; ++i) {
+        (void) bus.Transfer();
+      }
+    }
+    bus.TransferAll();
+
+    SECTION("Should merge every event of every other board at the master") {
+      std::array<std::uint32_t, 4> received{};
+      for (const RemoteEvent& remote : master.received) {
+        ++received[remote.board_id];
+      }
+      REQUIRE(received[0] == 0u);
+      REQUIRE(received[1] == sent[1]);
+      REQUIRE(received[2] == sent[2]);
+      REQUIRE(received[3] == sent[3]);
+      REQUIRE(master.unpacker.stats().lost_frame_count == 0u);
+    }
+
+    SECTION("Should keep each board's events of one class in order") {
+      std::array<std::uint32_t, 4> last_pressure_ticks{};
+      for (const RemoteEvent& remote : master.received) {
+        if (remote.event.type == MusicEventType::kPolyPressure) {
+          REQUIRE(remote.event.timestamp_ticks >= last_pressure_ticks[remote.board_id]);
+          last_pressure_ticks[remote.board_id] = remote.event.timestamp_ticks;
+        }
+      }
+    }
+
+    SECTION("Should deliver the chords ahead of the controller backlog") {
+      std::size_t first_note = 0;
+      while (master.received[first_note].event.type != MusicEventType::kNoteOn) {
+        ++first_note;
+      }
+      for (std::size_t i = first_note; i < first_note + 30u; ++i) {
+        REQUIRE(master.received[i].event.type == MusicEventType::kNoteOn);
+      }
+      // Pressure stamped before the chord was still waiting on the bus.
+      REQUIRE(master.received.back().event.timestamp_ticks > 20u * kPollTicks);
+      bool older_pressure_after_chord = false;
+      for (std::size_t i = first_note + 30u; i < master.received.size(); ++i) {
+        older_pressure_after_chord |= master.received[i].event.timestamp_ticks < 20u * kPollTicks;
+      }
+      REQUIRE(older_pressure_after_chord);
+    }
+  }
+
+  SECTION("When a frame is lost on the bus") {
+    SECTION("Should count the gap in the sender's sequence") {
+      for (std::uint32_t i = 0; i < 3u; ++i) {
+        board1.packer.Push(MusicEvent{.timestamp_ticks = i,
+                                      .type = MusicEventType::kNoteOn,
+                                      .number = 60,
+                                      .value = 0x8000},
+                           board1);
+        board1.packer.Flush(board1);
+      }
+      REQUIRE(bus.Transfer());
+      bus.drop_next = true;
+      bus.TransferAll();
+
+      REQUIRE(master.received.size() == 2u);
+      REQUIRE(master.unpacker.stats().lost_frame_count == 1u);
+      REQUIRE(board2.unpacker.stats().lost_frame_count == 1u);
+    }
+  }
+}
+
+#endif
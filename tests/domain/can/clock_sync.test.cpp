@@ -0,0 +1,166 @@
+#if defined(UNIT_TESTS)
+
+#include "domain/can/clock_sync.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <cstdint>
+
+#include "domain/can/can_frame.hpp"
+
+namespace {
+
+using domain::can::ClockSyncEstimator;
+
+/** @brief Deterministic pseudo-random delays for the simulated bus. */
+class Lcg {
+ public:
+  std::uint32_t Next(std::uint32_t bound) {
+    state_ = state_ * 1664525u + 1013904223u;
+    return (state_ >> 8u) % bound;
+  }
+
+ private:
+  std::uint32_t state_ = 12345u;
+};
+
+/**
+ * @brief A master and a slave clock running from the same true time (us) at different rates.
+ */
+struct SimulatedClocks {
+  std::uint32_t master_start = 0x40000000u;
+  std::uint32_t local_start = 0xFFF00000u;  // wraps a second into the run
+  double local_ppm = 80.0;
+
+  std::uint32_t Master(double true_us) const {
+    return master_start + static_cast<std::uint32_t>(static_cast<std::uint64_t>(true_us));
+  }
+
+  std::uint32_t Local(double true_us) const {
+    const double local_us = true_us * (1.0 + local_ppm * 1e-6);
+    return local_start + static_cast<std::uint32_t>(static_cast<std::uint64_t>(local_us));
+  }
+};
+
+constexpr double kSyncPeriodUs = 100000.0;
+
+/**
+ * @brief Sends syncs until end_us: 30% of them wait up to 300 us behind a frame in progress,
+ * and the receive timestamp has the 2 us resolution of one bit time.
+ */
+template <std::size_t kHistory>
+void RunSyncs(ClockSyncEstimator<kHistory>& estimator, const SimulatedClocks& clocks, Lcg& rng,
+              double start_us, double end_us) {
+  for (double t = start_us; t < end_us; t += kSyncPeriodUs) {
+    const std::uint32_t master_ticks = clocks.Master(t);
+    const double delay_us = rng.Next(10) < 3u ? static_cast<double>(rng.Next(300)) : 0.0;
+    const std::uint32_t local_ticks = clocks.Local(t + delay_us) & ~1u;
+    estimator.OnSync(master_ticks, local_ticks);
+  }
+}
+
+std::int32_t MaxError(const ClockSyncEstimator<8>& estimator, const SimulatedClocks& clocks,
+                      double start_us, double end_us) {
+  std::int32_t max_error = 0;
+  for (double t = start_us; t < end_us; t += 1234.5) {
+    const std::int32_t error =
+        static_cast<std::int32_t>(estimator.ToMaster(clocks.Local(t)) - clocks.Master(t));
+    max_error = std::abs(error) > max_error ? std::abs(error) : max_error;
+  }
+  return max_error;
+}
+
+}  // namespace
+
+TEST_CASE("The clock sync frame", "[domain][can]") {
+  SECTION("Should round-trip the master timestamp") {
+    const domain::can::CanFrame frame = domain::can::MakeClockSyncFrame(7, 0xDEADBEEFu);
+    std::uint32_t master_ticks = 0;
+
+    REQUIRE(domain::can::ParseClockSyncFrame(frame, master_ticks));
+    REQUIRE(master_ticks == 0xDEADBEEFu);
+    REQUIRE(frame.data[0] == 7u);
+  }
+
+  SECTION("Should outrank every event frame") {
+    REQUIRE(domain::can::kCanClockSyncId < 0x100u);
+  }
+
+  SECTION("Should reject other identifiers") {
+    domain::can::CanFrame frame = domain::can::MakeClockSyncFrame(0, 1);
+    frame.id = 0x101u;
+    std::uint32_t master_ticks = 0;
+
+    REQUIRE_FALSE(domain::can::ParseClockSyncFrame(frame, master_ticks));
+  }
+}
+
+TEST_CASE("The ClockSyncEstimator class", "[domain][can]") {
+  ClockSyncEstimator<8> estimator;
+  SimulatedClocks clocks;
+  Lcg rng;
+
+  SECTION("When fewer syncs than a window were received") {
+    SECTION("Should leave timestamps unchanged") {
+      RunSyncs(estimator, clocks, rng, 0.0, 3.0 * kSyncPeriodUs);
+
+      REQUIRE_FALSE(estimator.locked());
+      REQUIRE(estimator.ToMaster(1234u) == 1234u);
+    }
+  }
+
+  SECTION("When the slave clock drifts and sync frames are delayed") {
+    RunSyncs(estimator, clocks, rng, 0.0, 5e6);
+
+    SECTION("Should convert local timestamps to the master timebase within 10 us") {
+      REQUIRE(estimator.locked());
+      // Between and beyond the last syncs: the model also extrapolates.
+      REQUIRE(MaxError(estimator, clocks, 4.5e6, 5.5e6) <= 10);
+    }
+
+    SECTION("Should estimate the drift") {
+      // The slave runs 80 ppm fast, so master - local shrinks by ~80 us per second.
+      REQUIRE(std::abs(estimator.drift_ppb() + 80000) < 3000);
+    }
+
+    SECTION("Should keep the estimate through a local counter wrap") {
+      REQUIRE(clocks.Local(5e6) < clocks.local_start);
+      REQUIRE(MaxError(estimator, clocks, 4.9e6, 5.0e6) <= 10);
+    }
+  }
+
+  SECTION("When every sync of a window is delayed") {
+    SECTION("Should not be pulled further than the residual delay") {
+      RunSyncs(estimator, clocks, rng, 0.0, 3e6);
+      for (int i = 0; i < 4; ++i) {
+        const double t = 3e6 + i * kSyncPeriodUs;
+        estimator.OnSync(clocks.Master(t), clocks.Local(t + 250.0));
+      }
+
+      REQUIRE(MaxError(estimator, clocks, 3.3e6, 3.4e6) <= 100);
+    }
+  }
+
+  SECTION("When the master restarts") {
+    SECTION("Should drop the old model and converge on the new offset") {
+      RunSyncs(estimator, clocks, rng, 0.0, 3e6);
+      clocks.master_start += 1000000u;
+      RunSyncs(estimator, clocks, rng, 3e6, 6e6);
+
+      REQUIRE(estimator.restart_count() == 1u);
+      REQUIRE(MaxError(estimator, clocks, 5.9e6, 6.0e6) <= 10);
+    }
+  }
+
+  SECTION("The Reset() method") {
+    SECTION("Should unlock the estimator") {
+      RunSyncs(estimator, clocks, rng, 0.0, 1e6);
+      estimator.Reset();
+
+      REQUIRE_FALSE(estimator.locked());
+      REQUIRE(estimator.sync_count() == 0u);
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,216 @@
+#if defined(UNIT_TESTS)
+
+#include "domain/midi/jitter_buffer.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "domain/music/music_event.hpp"
+
+namespace {
+
+using domain::midi::JitterBuffer;
+using domain::midi::JitterBufferConfig;
+using domain::music::MusicEvent;
+using domain::music::MusicEventType;
+
+MusicEvent MakeNoteOn(std::uint8_t note, std::uint32_t timestamp_ticks) {
+  MusicEvent event{};
+  event.timestamp_ticks = timestamp_ticks;
+  event.type = MusicEventType::kNoteOn;
+  event.number = note;
+  event.value = 100;
+  return event;
+}
+
+class SinkStub {
+ public:
+  void OnReleasedEvent(const MusicEvent& event) {
+    released.push_back(event);
+    release_ticks.push_back(now_ticks);
+  }
+
+  std::uint32_t now_ticks = 0;
+  std::vector<MusicEvent> released;
+  std::vector<std::uint32_t> release_ticks;
+};
+
+class NoexceptSinkStub {
+ public:
+  void OnReleasedEvent(const MusicEvent&) noexcept {
+    ++released_count;
+  }
+
+  std::size_t released_count = 0;
+};
+
+template <std::size_t kCapacity>
+void ReleaseAt(JitterBuffer<kCapacity>& buffer, SinkStub& sink, std::uint32_t now_ticks) {
+  sink.now_ticks = now_ticks;
+  buffer.Release(now_ticks, sink);
+}
+
+}  // namespace
+
+TEST_CASE("The JitterBuffer class", "[domain][midi]") {
+  JitterBufferConfig config{};
+  config.latency_ticks = 3000;
+  config.late_tolerance_ticks = 100;
+
+  SECTION("The Release() method") {
+    SECTION("When an event is not yet due") {
+      SECTION("Should hold it until timestamp + latency") {
+        JitterBuffer<8> buffer(config);
+        SinkStub sink;
+        buffer.Push(MakeNoteOn(60, 1000));
+
+        ReleaseAt(buffer, sink, 3999);
+        REQUIRE(sink.released.empty());
+
+        ReleaseAt(buffer, sink, 4000);
+        REQUIRE(sink.released.size() == 1u);
+        REQUIRE(buffer.stats().late_count == 0u);
+      }
+    }
+
+    SECTION("When events arrive with varying processing delay") {
+      SECTION("Should release each one at the same offset from its timestamp") {
+        JitterBuffer<8> buffer(config);
+        SinkStub sink;
+        // Strikes 1 ms apart, seen by the output after 200, 1500 and 700 ticks.
+        const std::uint32_t strikes[] = {10000, 11000, 12000};
+        const std::uint32_t processing[] = {200, 1500, 700};
+
+        std::uint32_t next_push = 0;
+        for (std::uint32_t now = 10000; now <= 16000; ++now) {
+          while (next_push < 3u && now == strikes[next_push] + processing[next_push]) {
+            buffer.Push(MakeNoteOn(static_cast<std::uint8_t>(60 + next_push), strikes[next_push]));
+            ++next_push;
+          }
+          ReleaseAt(buffer, sink, now);
+        }
+
+        REQUIRE(sink.released.size() == 3u);
+        for (std::size_t i = 0; i < 3u; ++i) {
+          REQUIRE(sink.release_ticks[i] - sink.released[i].timestamp_ticks == 3000u);
+        }
+        REQUIRE(buffer.stats().released_count == 3u);
+        REQUIRE(buffer.stats().max_late_ticks == 0u);
+      }
+    }
+
+    SECTION("When an event arrives after its slot") {
+      SECTION("Should release it at once and count it as late") {
+        JitterBuffer<8> buffer(config);
+        SinkStub sink;
+        buffer.Push(MakeNoteOn(60, 1000));
+
+        ReleaseAt(buffer, sink, 4500);
+
+        REQUIRE(sink.released.size() == 1u);
+        REQUIRE(buffer.stats().late_count == 1u);
+        REQUIRE(buffer.stats().max_late_ticks == 500u);
+      }
+
+      SECTION("Should not count a release within the tolerance as late") {
+        JitterBuffer<8> buffer(config);
+        SinkStub sink;
+        buffer.Push(MakeNoteOn(60, 1000));
+
+        ReleaseAt(buffer, sink, 4100);
+
+        REQUIRE(buffer.stats().late_count == 0u);
+        REQUIRE(buffer.stats().max_late_ticks == 100u);
+      }
+    }
+
+    SECTION("When events arrive out of timestamp order") {
+      SECTION("Should release them in due order") {
+        JitterBuffer<8> buffer(config);
+        SinkStub sink;
+        buffer.Push(MakeNoteOn(62, 2000));
+        buffer.Push(MakeNoteOn(60, 1000));
+        buffer.Push(MakeNoteOn(61, 1500));
+
+        ReleaseAt(buffer, sink, 10000);
+
+        REQUIRE(sink.released.size() == 3u);
+        REQUIRE(sink.released[0].number == 60u);
+        REQUIRE(sink.released[1].number == 61u);
+        REQUIRE(sink.released[2].number == 62u);
+      }
+    }
+
+    SECTION("When the timestamp counter wraps") {
+      SECTION("Should still release at timestamp + latency") {
+        JitterBuffer<8> buffer(config);
+        SinkStub sink;
+        buffer.Push(MakeNoteOn(60, 0xFFFFFF00u));
+
+        ReleaseAt(buffer, sink, 0xFFFFFFF0u);
+        REQUIRE(sink.released.empty());
+
+        ReleaseAt(buffer, sink, 3000u - 0x100u);
+        REQUIRE(sink.released.size() == 1u);
+        REQUIRE(buffer.stats().late_count == 0u);
+      }
+    }
+  }
+
+  SECTION("The Push() method") {
+    SECTION("When the buffer is full") {
+      SECTION("Should reject the event and count the overflow") {
+        JitterBuffer<2> buffer(config);
+        REQUIRE(buffer.Push(MakeNoteOn(60, 0)));
+        REQUIRE(buffer.Push(MakeNoteOn(61, 0)));
+        REQUIRE_FALSE(buffer.Push(MakeNoteOn(62, 0)));
+        REQUIRE(buffer.stats().overflow_count == 1u);
+      }
+    }
+  }
+
+  SECTION("The next_due_ticks() method") {
+    SECTION("Should return the earliest due time") {
+      JitterBuffer<8> buffer(config);
+      std::uint32_t due = 0;
+      REQUIRE_FALSE(buffer.next_due_ticks(due));
+
+      buffer.Push(MakeNoteOn(61, 2000));
+      buffer.Push(MakeNoteOn(60, 1000));
+
+      REQUIRE(buffer.next_due_ticks(due));
+      REQUIRE(due == 4000u);
+    }
+  }
+
+  SECTION("The Flush() method") {
+    SECTION("Should release every event regardless of its due time") {
+      JitterBuffer<8> buffer(config);
+      SinkStub sink;
+      buffer.Push(MakeNoteOn(60, 1000));
+      buffer.Push(MakeNoteOn(61, 2000));
+
+      REQUIRE(buffer.Flush(sink) == 2u);
+      REQUIRE(buffer.size() == 0u);
+      REQUIRE(sink.released.size() == 2u);
+      REQUIRE(buffer.stats().late_count == 0u);
+    }
+  }
+
+  SECTION("The Release() and Flush() methods") {
+    SECTION("Should be noexcept exactly when the sink's OnReleasedEvent() is") {
+      JitterBuffer<8> buffer(config);
+      SinkStub sink;
+      NoexceptSinkStub noexcept_sink;
+
+      STATIC_REQUIRE(noexcept(buffer.Release(0u, noexcept_sink)));
+      STATIC_REQUIRE(noexcept(buffer.Flush(noexcept_sink)));
+      STATIC_REQUIRE_FALSE(noexcept(buffer.Release(0u, sink)));
+      STATIC_REQUIRE_FALSE(noexcept(buffer.Flush(sink)));
+    }
+  }
+}
+
+#endif
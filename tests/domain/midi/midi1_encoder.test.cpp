@@ -0,0 +1,220 @@
+#if defined(UNIT_TESTS)
+
+#include "domain/midi/midi1_encoder.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <vector>
+
+#include "domain/music/music_event.hpp"
+#include "domain/music/value_scaling.hpp"
+
+namespace {
+
+using domain::midi::Midi1Encoder;
+using domain::midi::Midi1EncoderConfig;
+using domain::music::MusicEvent;
+using domain::music::MusicEventType;
+
+std::uint16_t Velocity16(std::uint8_t velocity) {
+  return static_cast<std::uint16_t>(domain::music::ScaleUp(velocity, 7u, 16u));
+}
+
+std::vector<std::uint8_t> EncodeAll(Midi1Encoder& encoder, const std::vector<MusicEvent>& events) {
+  std::vector<std::uint8_t> bytes;
+  for (const MusicEvent& event : events) {
+    std::uint8_t buffer[domain::midi::kMidi1MaxEncodedBytes]{};
+    const std::size_t length = encoder.Encode(event, buffer);
+    bytes.insert(bytes.end(), buffer, buffer + length);
+  }
+  return bytes;
+}
+
+}  // namespace
+
+TEST_CASE("The Midi1Encoder class", "[domain][midi]") {
+  SECTION("The Encode() method") {
+    SECTION("When encoding a chord with running status") {
+      SECTION("Should send the status byte only once") {
+        Midi1Encoder encoder;
+        const std::vector<std::uint8_t> bytes =
+            EncodeAll(encoder, {MusicEvent{.type = MusicEventType::kNoteOn,
+                                           .number = 60,
+                                           .value = Velocity16(100)},
+                                MusicEvent{.type = MusicEventType::kNoteOn,
+                                           .number = 64,
+                                           .value = Velocity16(90)},
+                                MusicEvent{.type = MusicEventType::kNoteOn,
+                                           .number = 67,
+                                           .value = Velocity16(80)}});
+
+        REQUIRE(bytes == std::vector<std::uint8_t>{0x90, 60, 100, 64, 90, 67, 80});
+      }
+    }
+
+    SECTION("When encoding note-off events") {
+      SECTION("Should send note-on with velocity 0 sharing the running status by default") {
+        Midi1Encoder encoder;
+        const std::vector<std::uint8_t> bytes =
+            EncodeAll(encoder, {MusicEvent{.type = MusicEventType::kNoteOn,
+                                           .number = 60,
+                                           .value = Velocity16(100)},
+                                MusicEvent{.type = MusicEventType::kNoteOff,
+                                           .number = 60,
+                                           .value = 0}});
+
+        REQUIRE(bytes == std::vector<std::uint8_t>{0x90, 60, 100, 60, 0});
+      }
+
+      SECTION("Should send a real note-off when configured so") {
+        Midi1EncoderConfig config{};
+        config.note_off_as_note_on = false;
+        Midi1Encoder encoder(config);
+        const std::vector<std::uint8_t> bytes =
+            EncodeAll(encoder, {MusicEvent{.type = MusicEventType::kNoteOn,
+                                           .number = 60,
+                                           .value = Velocity16(100)},
+                                MusicEvent{.type = MusicEventType::kNoteOff,
+                                           .number = 60,
+                                           .value = 0}});
+
+        REQUIRE(bytes == std::vector<std::uint8_t>{0x90, 60, 100, 0x80, 60, 0x40});
+      }
+    }
+
+    SECTION("When the message type changes") {
+      SECTION("Should send the new status byte and resume running status") {
+        Midi1Encoder encoder;
+        const std::vector<std::uint8_t> bytes =
+            EncodeAll(encoder, {MusicEvent{.type = MusicEventType::kNoteOn,
+                                           .number = 60,
+                                           .value = Velocity16(100)},
+                                MusicEvent{.type = MusicEventType::kControlChange,
+                                           .number = 64,
+                                           .value = 127},
+                                MusicEvent{.type = MusicEventType::kControlChange,
+                                           .number = 67,
+                                           .value = 0},
+                                MusicEvent{.type = MusicEventType::kPolyPressure,
+                                           .number = 60,
+                                           .value = 42},
+                                MusicEvent{.type = MusicEventType::kNoteOn,
+                                           .number = 62,
+                                           .value = Velocity16(70)}});
+
+        REQUIRE(bytes == std::vector<std::uint8_t>{0x90, 60, 100, 0xB0, 64, 127, 67, 0, 0xA0, 60,
+                                                   42, 0x90, 62, 70});
+      }
+    }
+
+    SECTION("When running status is disabled") {
+      SECTION("Should send the status byte with every message") {
+        Midi1EncoderConfig config{};
+        config.use_running_status = false;
+        Midi1Encoder encoder(config);
+        const std::vector<std::uint8_t> bytes =
+            EncodeAll(encoder, {MusicEvent{.type = MusicEventType::kNoteOn,
+                                           .number = 60,
+                                           .value = Velocity16(100)},
+                                MusicEvent{.type = MusicEventType::kNoteOn,
+                                           .number = 64,
+                                           .value = Velocity16(90)}});
+
+        REQUIRE(bytes == std::vector<std::uint8_t>{0x90, 60, 100, 0x90, 64, 90});
+      }
+    }
+
+    SECTION("When a channel is configured") {
+      SECTION("Should put it in the low nibble of the status byte") {
+        Midi1EncoderConfig config{};
+        config.channel = 9;
+        Midi1Encoder encoder(config);
+        const std::vector<std::uint8_t> bytes =
+            EncodeAll(encoder, {MusicEvent{.type = MusicEventType::kControlChange,
+                                           .number = 64,
+                                           .value = 127}});
+
+        REQUIRE(bytes == std::vector<std::uint8_t>{0xB9, 64, 127});
+      }
+    }
+
+    SECTION("When encoding a 14-bit controller") {
+      SECTION("Should send the MSB then the LSB on controller + 32") {
+        Midi1Encoder encoder;
+        const std::vector<std::uint8_t> bytes = EncodeAll(
+            encoder, {MusicEvent{.type = MusicEventType::kControlChange14Bit,
+                                 .number = 1,
+                                 .value = (100u << 7u) | 5u}});
+
+        REQUIRE(bytes == std::vector<std::uint8_t>{0xB0, 1, 100, 33, 5});
+      }
+
+      SECTION("Should send only the MSB for controllers without an LSB pair") {
+        Midi1Encoder encoder;
+        const std::vector<std::uint8_t> bytes =
+            EncodeAll(encoder, {MusicEvent{.type = MusicEventType::kControlChange14Bit,
+                                           .number = 64,
+                                           .value = 16383}});
+
+        REQUIRE(bytes == std::vector<std::uint8_t>{0xB0, 64, 127});
+      }
+    }
+
+    SECTION("When data values exceed 7 bits") {
+      SECTION("Should mask them so no data byte looks like a status byte") {
+        Midi1Encoder encoder;
+        const std::vector<std::uint8_t> bytes =
+            EncodeAll(encoder, {MusicEvent{.type = MusicEventType::kPolyPressure,
+                                           .number = 200,
+                                           .value = 300}});
+
+        REQUIRE(bytes == std::vector<std::uint8_t>{0xA0, 200 & 0x7F, 300 & 0x7F});
+      }
+    }
+
+    SECTION("When a note-on has a 16-bit velocity") {
+      SECTION("Should send its top 7 bits") {
+        Midi1Encoder encoder;
+        const std::vector<std::uint8_t> bytes =
+            EncodeAll(encoder, {MusicEvent{.type = MusicEventType::kNoteOn,
+                                           .number = 60,
+                                           .value = 0xC9FF},
+                                MusicEvent{.type = MusicEventType::kNoteOn,
+                                           .number = 62,
+                                           .value = 0x0100}});
+
+        REQUIRE(bytes == std::vector<std::uint8_t>{0x90, 60, 0x64, 62, 1});
+      }
+    }
+
+    SECTION("When a note-on has a velocity of 0") {
+      SECTION("Should send velocity 1 so it is not taken for a note-off") {
+        Midi1Encoder encoder;
+        const std::vector<std::uint8_t> bytes =
+            EncodeAll(encoder, {MusicEvent{.type = MusicEventType::kNoteOn,
+                                           .number = 60,
+                                           .value = 0}});
+
+        REQUIRE(bytes == std::vector<std::uint8_t>{0x90, 60, 1});
+      }
+    }
+  }
+
+  SECTION("The ResetRunningStatus() method") {
+    SECTION("Should make the next message carry its status byte") {
+      Midi1Encoder encoder;
+      EncodeAll(encoder, {MusicEvent{.type = MusicEventType::kNoteOn,
+                                     .number = 60,
+                                     .value = Velocity16(100)}});
+      encoder.ResetRunningStatus();
+      const std::vector<std::uint8_t> bytes =
+          EncodeAll(encoder, {MusicEvent{.type = MusicEventType::kNoteOn,
+                                         .number = 64,
+                                         .value = Velocity16(90)}});
+
+      REQUIRE(bytes == std::vector<std::uint8_t>{0x90, 64, 90});
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,286 @@
+#if defined(UNIT_TESTS)
+
+#include "domain/midi/midi_output_scheduler.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "domain/midi/midi1_encoder.hpp"
+#include "domain/music/music_event.hpp"
+
+namespace {
+
+using domain::midi::MidiOutputScheduler;
+using domain::midi::MidiOutputSchedulerConfig;
+using domain::music::MusicEvent;
+using domain::music::MusicEventType;
+
+constexpr std::uint32_t kTicksPerByte = 320;
+constexpr std::uint32_t kBacklogTicks = 1000;
+constexpr std::uint32_t kPollTicks = 1000;
+
+/** @brief Encodes like the firmware does and records when each event reaches the wire. */
+class LinkSink {
+ public:
+  std::size_t OnScheduledEvent(const MusicEvent& event) {
+    std::uint8_t bytes[domain::midi::kMidi1MaxEncodedBytes]{};
+    const std::size_t length = encoder_.Encode(event, bytes);
+    if (static_cast<std::int32_t>(wire_free_at_ticks_ - now_ticks) < 0) {
+      wire_free_at_ticks_ = now_ticks;
+    }
+    sent.push_back(event);
+    wire_free_at_ticks_ += static_cast<std::uint32_t>(length) * kTicksPerByte;
+    const std::uint32_t backlog = wire_free_at_ticks_ - now_ticks;
+    if (backlog > max_backlog_ticks) {
+      max_backlog_ticks = backlog;
+    }
+    return length;
+  }
+
+  std::uint32_t now_ticks = 0;
+  std::vector<MusicEvent> sent;
+  std::uint32_t max_backlog_ticks = 0;
+
+ private:
+  domain::midi::Midi1Encoder encoder_{};
+  std::uint32_t wire_free_at_ticks_ = 0;
+};
+
+template <std::size_t kNoteCapacity>
+void ServiceAt(MidiOutputScheduler<kNoteCapacity>& scheduler, LinkSink& sink,
+               std::uint32_t now_ticks) {
+  sink.now_ticks = now_ticks;
+  scheduler.Service(now_ticks, sink);
+}
+
+}  // namespace
+
+TEST_CASE("The MidiOutputScheduler class", "[domain][midi]") {
+  MidiOutputSchedulerConfig config{};
+  config.ticks_per_byte = kTicksPerByte;
+  config.max_backlog_ticks = kBacklogTicks;
+
+  SECTION("The Service() method") {
+    SECTION("When notes and controllers are pending") {
+      SECTION("Should send the notes first") {
+        MidiOutputScheduler<8> scheduler(config);
+        LinkSink sink;
+        scheduler.Push(MusicEvent{.type = MusicEventType::kControlChange,
+                                  .number = 64,
+                                  .value = 10});
+        scheduler.Push(MusicEvent{.type = MusicEventType::kPolyPressure,
+                                  .number = 60,
+                                  .value = 20});
+        scheduler.Push(MusicEvent{.type = MusicEventType::kNoteOn, .number = 60, .value = 100});
+        scheduler.Push(MusicEvent{.type = MusicEventType::kNoteOff, .number = 62, .value = 0});
+
+        ServiceAt(scheduler, sink, 0);
+        ServiceAt(scheduler, sink, 10000);
+
+        REQUIRE(sink.sent.size() == 4u);
+        REQUIRE(sink.sent[0].type == MusicEventType::kNoteOn);
+        REQUIRE(sink.sent[1].type == MusicEventType::kNoteOff);
+        REQUIRE(sink.sent[2].type == MusicEventType::kControlChange);
+        REQUIRE(sink.sent[3].type == MusicEventType::kPolyPressure);
+      }
+    }
+
+    SECTION("When the link backlog exceeds max_backlog_ticks") {
+      SECTION("Should hold the remaining events until the link drains") {
+        MidiOutputScheduler<8> scheduler(config);
+        LinkSink sink;
+        for (std::uint8_t note = 60; note < 66; ++note) {
+          scheduler.Push(MusicEvent{.type = MusicEventType::kNoteOn, .number = note, .value = 100});
+        }
+
+        ServiceAt(scheduler, sink, 0);
+        // 3 + 2 bytes keep the wire busy until 1600, past the 1000 tick budget.
+        REQUIRE(sink.sent.size() == 2u);
+        REQUIRE(scheduler.pending_note_count() == 4u);
+
+        ServiceAt(scheduler, sink, 2000);
+        REQUIRE(sink.sent.size() == 4u);
+        REQUIRE(sink.max_backlog_ticks <= kBacklogTicks + 3u * kTicksPerByte);
+      }
+    }
+
+    SECTION("When recording queueing delay") {
+      SECTION("Should measure from the event timestamp to its first byte on the wire") {
+        MidiOutputScheduler<8> scheduler(config);
+        LinkSink sink;
+        scheduler.Push(MusicEvent{.timestamp_ticks = 100,
+                                  .type = MusicEventType::kNoteOn,
+                                  .number = 60,
+                                  .value = 100});
+        scheduler.Push(MusicEvent{.timestamp_ticks = 100,
+                                  .type = MusicEventType::kNoteOn,
+                                  .number = 64,
+                                  .value = 100});
+        scheduler.Push(MusicEvent{.timestamp_ticks = 100,
+                                  .type = MusicEventType::kControlChange,
+                                  .number = 64,
+                                  .value = 127});
+
+        ServiceAt(scheduler, sink, 500);
+        ServiceAt(scheduler, sink, 1500);
+
+        REQUIRE(scheduler.note_delay().count == 2u);
+        REQUIRE(scheduler.note_delay().max_ticks == 400u + 3u * kTicksPerByte);
+        REQUIRE(scheduler.note_delay().mean_ticks() == 400u + 3u * kTicksPerByte / 2u);
+        REQUIRE(scheduler.controller_delay().count == 1u);
+        REQUIRE(scheduler.controller_delay().max_ticks == 400u + 5u * kTicksPerByte);
+      }
+    }
+  }
+
+  SECTION("The Push() method") {
+    SECTION("When a controller already has a pending value") {
+      SECTION("Should keep only the latest value in its original position") {
+        MidiOutputScheduler<8> scheduler(config);
+        LinkSink sink;
+        scheduler.Push(MusicEvent{.type = MusicEventType::kControlChange,
+                                  .number = 64,
+                                  .value = 10});
+        scheduler.Push(MusicEvent{.type = MusicEventType::kControlChange,
+                                  .number = 67,
+                                  .value = 20});
+        scheduler.Push(MusicEvent{.type = MusicEventType::kControlChange,
+                                  .number = 64,
+                                  .value = 30});
+
+        REQUIRE(scheduler.pending_controller_count() == 2u);
+        REQUIRE(scheduler.coalesced_count() == 1u);
+
+        ServiceAt(scheduler, sink, 0);
+        REQUIRE(sink.sent.size() == 2u);
+        REQUIRE(sink.sent[0].number == 64u);
+        REQUIRE(sink.sent[0].value == 30u);
+        REQUIRE(sink.sent[1].number == 67u);
+      }
+    }
+
+    SECTION("When pressure and a controller share a number") {
+      SECTION("Should coalesce them separately") {
+        MidiOutputScheduler<8> scheduler(config);
+        scheduler.Push(MusicEvent{.type = MusicEventType::kControlChange,
+                                  .number = 64,
+                                  .value = 10});
+        scheduler.Push(MusicEvent{.type = MusicEventType::kPolyPressure,
+                                  .number = 64,
+                                  .value = 20});
+        scheduler.Push(MusicEvent{.type = MusicEventType::kPolyPressure,
+                                  .number = 64,
+                                  .value = 25});
+
+        REQUIRE(scheduler.pending_controller_count() == 2u);
+        REQUIRE(scheduler.coalesced_count() == 1u);
+      }
+    }
+
+    SECTION("When the note FIFO is full") {
+      SECTION("Should reject the note and count the drop") {
+        MidiOutputScheduler<2> scheduler(config);
+        REQUIRE(scheduler.Push(MusicEvent{.type = MusicEventType::kNoteOn,
+                                          .number = 60,
+                                          .value = 100}));
+        REQUIRE(scheduler.Push(MusicEvent{.type = MusicEventType::kNoteOn,
+                                          .number = 61,
+                                          .value = 100}));
+        REQUIRE_FALSE(scheduler.Push(MusicEvent{.type = MusicEventType::kNoteOn,
+                                                .number = 62,
+                                                .value = 100}));
+        REQUIRE(scheduler.dropped_note_count() == 1u);
+      }
+    }
+  }
+
+  SECTION("The Reset() method") {
+    SECTION("Should discard pending events and statistics") {
+      MidiOutputScheduler<8> scheduler(config);
+      LinkSink sink;
+      scheduler.Push(MusicEvent{.type = MusicEventType::kNoteOn, .number = 60, .value = 100});
+      ServiceAt(scheduler, sink, 0);
+      scheduler.Push(MusicEvent{.type = MusicEventType::kControlChange, .number = 64, .value = 10});
+      scheduler.Push(MusicEvent{.type = MusicEventType::kControlChange, .number = 64, .value = 20});
+
+      scheduler.Reset();
+
+      REQUIRE_FALSE(scheduler.has_pending());
+      REQUIRE(scheduler.note_delay().count == 0u);
+      REQUIRE(scheduler.coalesced_count() == 0u);
+    }
+  }
+
+  SECTION("When a 10-note chord is struck during a pedal sweep with aftertouch") {
+    MidiOutputScheduler<32> scheduler(config);
+    LinkSink sink;
+
+    constexpr std::uint32_t kSampleTicks = 1000;
+    constexpr std::uint32_t kDurationTicks = 200000;
+    constexpr std::uint32_t kChordTicks = 50000;
+    constexpr std::uint8_t kChordNotes[] = {48, 52, 55, 60, 64, 67, 72, 76, 79, 84};
+
+    std::uint32_t controller_events = 0;
+    for (std::uint32_t now = 0; now <= kDurationTicks; now += kPollTicks) {
+      // The pedal and five held keys each produce a new value every sample.
+      const std::uint16_t sweep = static_cast<std::uint16_t>((now / kSampleTicks) % 128u);
+      scheduler.Push(MusicEvent{.timestamp_ticks = now,
+                                .type = MusicEventType::kControlChange,
+                                .number = 64,
+                                .value = sweep});
+      scheduler.Push(MusicEvent{.timestamp_ticks = now,
+                                .type = MusicEventType::kControlChange,
+                                .number = 67,
+                                .value = sweep});
+      for (std::uint8_t key = 36; key < 41; ++key) {
+        scheduler.Push(MusicEvent{.timestamp_ticks = now,
+                                  .type = MusicEventType::kPolyPressure,
+                                  .number = key,
+                                  .value = sweep});
+      }
+      controller_events += 7u;
+
+      if (now == kChordTicks) {
+        for (const std::uint8_t note : kChordNotes) {
+          scheduler.Push(MusicEvent{.timestamp_ticks = now,
+                                    .type = MusicEventType::kNoteOn,
+                                    .number = note,
+                                    .value = 100});
+        }
+      }
+      ServiceAt(scheduler, sink, now);
+    }
+
+    SECTION("Should bound every note-on delay by the backlog plus the chord itself") {
+      // Each note-on is at most 3 bytes; the backlog and poll period bound the wait in front.
+      constexpr std::uint32_t kChordBytes = 3u * sizeof(kChordNotes);
+      REQUIRE(scheduler.note_delay().count == sizeof(kChordNotes));
+      REQUIRE(scheduler.note_delay().max_ticks <= kBacklogTicks + kChordBytes * kTicksPerByte);
+
+      std::size_t first_note = 0;
+      while (sink.sent[first_note].type != MusicEventType::kNoteOn) {
+        ++first_note;
+      }
+      for (std::size_t i = 0; i < sizeof(kChordNotes); ++i) {
+        REQUIRE(sink.sent[first_note + i].type == MusicEventType::kNoteOn);
+        REQUIRE(sink.sent[first_note + i].number == kChordNotes[i]);
+      }
+    }
+
+    SECTION("Should never let the UART backlog grow beyond one message past the budget") {
+      REQUIRE(sink.max_backlog_ticks <=
+              kBacklogTicks + domain::midi::kMidi1MaxEncodedBytes * kTicksPerByte);
+    }
+
+    SECTION("Should coalesce the controller traffic the link cannot carry") {
+      REQUIRE(scheduler.coalesced_count() > 0u);
+      REQUIRE(scheduler.controller_delay().count + scheduler.coalesced_count() +
+                  scheduler.pending_controller_count() ==
+              controller_events);
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,187 @@
+#if defined(UNIT_TESTS)
+
+#include "domain/midi/ump_encoder.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "domain/music/music_event.hpp"
+
+namespace {
+
+using domain::midi::UmpEncoder;
+using domain::midi::UmpEncoderConfig;
+using domain::midi::UmpWordBuffer;
+using domain::music::MusicEvent;
+using domain::music::MusicEventType;
+
+std::vector<std::uint32_t> Encode(const UmpEncoder& encoder, const MusicEvent& event) {
+  std::uint32_t words[domain::midi::kUmpMaxEncodedWords]{};
+  const std::size_t length = encoder.Encode(event, words);
+  return std::vector<std::uint32_t>(words, words + length);
+}
+
+UmpEncoder MakeEncoderWithoutTimestamps(std::uint8_t channel = 0, std::uint8_t group = 0) {
+  UmpEncoderConfig config{};
+  config.channel = channel;
+  config.group = group;
+  config.emit_jr_timestamps = false;
+  return UmpEncoder(config);
+}
+
+}  // namespace
+
+TEST_CASE("The UmpEncoder class", "[domain][midi]") {
+  SECTION("The Encode() method") {
+    SECTION("When encoding a note-on") {
+      SECTION("Should produce a 64-bit MIDI 2.0 note-on with the 16-bit velocity") {
+        const UmpEncoder encoder = MakeEncoderWithoutTimestamps();
+        REQUIRE(Encode(encoder, MusicEvent{.type = MusicEventType::kNoteOn,
+                                           .number = 60,
+                                           .value = 0xC000}) ==
+                std::vector<std::uint32_t>{0x40903C00u, 0xC0000000u});
+      }
+
+      SECTION("Should place the group and channel in the first word") {
+        const UmpEncoder encoder = MakeEncoderWithoutTimestamps(9, 3);
+        REQUIRE(Encode(encoder, MusicEvent{.type = MusicEventType::kNoteOn,
+                                           .number = 0x45,
+                                           .value = 0x1234}) ==
+                std::vector<std::uint32_t>{0x43994500u, 0x12340000u});
+      }
+    }
+
+    SECTION("When encoding a note-off") {
+      SECTION("Should produce a MIDI 2.0 note-off, not a zero-velocity note-on") {
+        const UmpEncoder encoder = MakeEncoderWithoutTimestamps();
+        REQUIRE(Encode(encoder, MusicEvent{.type = MusicEventType::kNoteOff,
+                                           .number = 60,
+                                           .value = 0}) ==
+                std::vector<std::uint32_t>{0x40803C00u, 0x00000000u});
+      }
+    }
+
+    SECTION("When encoding per-note pressure") {
+      SECTION("Should widen the 7-bit pressure to 32 bits") {
+        const UmpEncoder encoder = MakeEncoderWithoutTimestamps();
+        REQUIRE(Encode(encoder, MusicEvent{.type = MusicEventType::kPolyPressure,
+                                           .number = 60,
+                                           .value = 64}) ==
+                std::vector<std::uint32_t>{0x40A03C00u, 0x80000000u});
+        REQUIRE(Encode(encoder, MusicEvent{.type = MusicEventType::kPolyPressure,
+                                           .number = 60,
+                                           .value = 127}) ==
+                std::vector<std::uint32_t>{0x40A03C00u, 0xFFFFFFFFu});
+      }
+    }
+
+    SECTION("When encoding controllers") {
+      SECTION("Should widen 7-bit values to 32 bits") {
+        const UmpEncoder encoder = MakeEncoderWithoutTimestamps();
+        REQUIRE(Encode(encoder, MusicEvent{.type = MusicEventType::kControlChange,
+                                           .number = 64,
+                                           .value = 127}) ==
+                std::vector<std::uint32_t>{0x40B04000u, 0xFFFFFFFFu});
+        REQUIRE(Encode(encoder, MusicEvent{.type = MusicEventType::kControlChange,
+                                           .number = 64,
+                                           .value = 0}) ==
+                std::vector<std::uint32_t>{0x40B04000u, 0x00000000u});
+      }
+
+      SECTION("Should widen 14-bit values to 32 bits in a single message") {
+        const UmpEncoder encoder = MakeEncoderWithoutTimestamps();
+        REQUIRE(Encode(encoder, MusicEvent{.type = MusicEventType::kControlChange14Bit,
+                                           .number = 1,
+                                           .value = 0x2000}) ==
+                std::vector<std::uint32_t>{0x40B00100u, 0x80000000u});
+        REQUIRE(Encode(encoder, MusicEvent{.type = MusicEventType::kControlChange14Bit,
+                                           .number = 1,
+                                           .value = 0x3FFF}) ==
+                std::vector<std::uint32_t>{0x40B00100u, 0xFFFFFFFFu});
+      }
+    }
+
+    SECTION("When JR timestamps are enabled") {
+      SECTION("Should precede the message with the event time in 1/31250 s units") {
+        const UmpEncoder encoder;
+        // 1'000'000 us / 32 us = 31250 = 0x7A12.
+        REQUIRE(Encode(encoder, MusicEvent{.timestamp_ticks = 1'000'000,
+                                           .type = MusicEventType::kNoteOn,
+                                           .number = 60,
+                                           .value = 0xC000}) ==
+                std::vector<std::uint32_t>{0x00207A12u, 0x40903C00u, 0xC0000000u});
+      }
+
+      SECTION("Should keep only the low 16 bits of the timestamp") {
+        const UmpEncoder encoder;
+        REQUIRE(encoder.JrTimestamp(32u * 0x12345u) == 0x00202345u);
+      }
+    }
+  }
+
+  SECTION("The SetChannel() method") {
+    SECTION("Should change the channel of the next messages") {
+      UmpEncoder encoder = MakeEncoderWithoutTimestamps();
+      encoder.SetChannel(15);
+      REQUIRE(Encode(encoder, MusicEvent{.type = MusicEventType::kNoteOn,
+                                         .number = 60,
+                                         .value = 0x8000})[0] == 0x409F3C00u);
+    }
+  }
+}
+
+TEST_CASE("The UmpWordBuffer class", "[domain][midi]") {
+  const UmpEncoder encoder;
+
+  SECTION("The Append() method") {
+    SECTION("When the packet fits") {
+      SECTION("Should append its words contiguously") {
+        UmpWordBuffer<8> buffer;
+        REQUIRE(buffer.Append(encoder, MusicEvent{.timestamp_ticks = 64,
+                                                  .type = MusicEventType::kNoteOn,
+                                                  .number = 60,
+                                                  .value = 0xC000}));
+        REQUIRE(buffer.Append(encoder, MusicEvent{.timestamp_ticks = 96,
+                                                  .type = MusicEventType::kNoteOff,
+                                                  .number = 60,
+                                                  .value = 0}));
+
+        REQUIRE(buffer.size() == 6u);
+        REQUIRE(buffer.size_bytes() == 24u);
+        const std::uint32_t expected[] = {0x00200002u, 0x40903C00u, 0xC0000000u,
+                                          0x00200003u, 0x40803C00u, 0x00000000u};
+        for (std::size_t i = 0; i < 6u; ++i) {
+          REQUIRE(buffer.data()[i] == expected[i]);
+        }
+      }
+    }
+
+    SECTION("When the packet does not fit") {
+      SECTION("Should leave the buffer unchanged") {
+        UmpWordBuffer<4> buffer;
+        REQUIRE(buffer.Append(encoder, MusicEvent{.type = MusicEventType::kNoteOn,
+                                                  .number = 60,
+                                                  .value = 0xC000}));
+        REQUIRE_FALSE(buffer.Append(encoder, MusicEvent{.type = MusicEventType::kNoteOn,
+                                                        .number = 62,
+                                                        .value = 0xC000}));
+        REQUIRE(buffer.size() == 3u);
+      }
+    }
+  }
+
+  SECTION("The Clear() method") {
+    SECTION("Should empty the buffer") {
+      UmpWordBuffer<4> buffer;
+      buffer.Append(encoder, MusicEvent{.type = MusicEventType::kNoteOn,
+                                        .number = 60,
+                                        .value = 0xC000});
+      buffer.Clear();
+      REQUIRE(buffer.size() == 0u);
+    }
+  }
+}
+
+#endif
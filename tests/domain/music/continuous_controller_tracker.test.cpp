@@ -0,0 +1,194 @@
+#if defined(UNIT_TESTS)
+
+#include "domain/music/continuous_controller_tracker.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <vector>
+
+#include "domain/music/controller_event.hpp"
+
+namespace {
+
+using domain::music::ContinuousControllerConfig;
+using domain::music::ContinuousControllerTracker;
+using domain::music::ControllerEvent;
+using domain::music::ControllerResolution;
+
+constexpr std::uint32_t kSamplePeriodTicks = 1000;
+
+class EventRecorder {
+ public:
+  void OnControllerEvent(const ControllerEvent& event) {
+    events.push_back(event);
+  }
+
+  std::vector<ControllerEvent> events;
+};
+
+ContinuousControllerConfig MakeConfig() {
+  ContinuousControllerConfig config{};
+  config.input_at_minimum = 0.0f;
+  config.input_at_maximum = 1.0f;
+  config.deadband_steps = 0.5f;
+  config.min_update_interval_ticks = 0;
+  config.max_update_interval_ticks = 0;
+  return config;
+}
+
+}  // namespace
+
+TEST_CASE("The ContinuousControllerTracker class", "[domain][music]") {
+  EventRecorder recorder;
+
+  SECTION("The Update() method") {
+    SECTION("When called for the first time") {
+      SECTION("Should emit the quantized value immediately") {
+        ContinuousControllerTracker tracker(MakeConfig());
+        tracker.Update(0.5f, 10u, recorder);
+
+        REQUIRE(recorder.events.size() == 1u);
+        REQUIRE(recorder.events[0].controller == domain::music::kControllerSustainPedal);
+        REQUIRE(recorder.events[0].resolution == ControllerResolution::k7Bit);
+        REQUIRE(recorder.events[0].value == 64u);
+        REQUIRE(recorder.events[0].timestamp_ticks == 10u);
+        REQUIRE(tracker.has_value());
+        REQUIRE(tracker.value() == 64u);
+      }
+    }
+
+    SECTION("When the input jitters around a quantization boundary") {
+      SECTION("Should not emit anything") {
+        ContinuousControllerTracker tracker(MakeConfig());
+        tracker.Update(64.0f / 127.0f, 0u, recorder);
+        for (std::uint32_t i = 1; i <= 100u; ++i) {
+          const float level = (i % 2u == 0u) ? 64.9f : 63.1f;
+          tracker.Update(level / 127.0f, i * kSamplePeriodTicks, recorder);
+        }
+
+        REQUIRE(recorder.events.size() == 1u);
+        REQUIRE(tracker.value() == 64u);
+      }
+    }
+
+    SECTION("When the input moves past the deadband") {
+      SECTION("Should emit the new quantized value") {
+        ContinuousControllerTracker tracker(MakeConfig());
+        tracker.Update(64.0f / 127.0f, 0u, recorder);
+        tracker.Update(65.2f / 127.0f, kSamplePeriodTicks, recorder);
+
+        REQUIRE(recorder.events.size() == 2u);
+        REQUIRE(recorder.events[1].value == 65u);
+      }
+    }
+
+    SECTION("When the input reaches either end of the range") {
+      SECTION("Should emit the end value regardless of the deadband") {
+        ContinuousControllerConfig config = MakeConfig();
+        config.deadband_steps = 4.0f;
+        ContinuousControllerTracker tracker(config);
+        tracker.Update(2.0f / 127.0f, 0u, recorder);
+        tracker.Update(-0.5f, kSamplePeriodTicks, recorder);
+        tracker.Update(125.0f / 127.0f, 2u * kSamplePeriodTicks, recorder);
+        tracker.Update(1.5f, 3u * kSamplePeriodTicks, recorder);
+
+        REQUIRE(recorder.events.size() == 4u);
+        REQUIRE(recorder.events[1].value == 0u);
+        REQUIRE(recorder.events[2].value == 125u);
+        REQUIRE(recorder.events[3].value == 127u);
+      }
+    }
+
+    SECTION("When the input range is inverted") {
+      SECTION("Should map the larger input to the minimum value") {
+        ContinuousControllerConfig config = MakeConfig();
+        config.input_at_minimum = 1.0f;
+        config.input_at_maximum = 0.0f;
+        ContinuousControllerTracker tracker(config);
+        tracker.Update(0.75f, 0u, recorder);
+
+        REQUIRE(recorder.events.size() == 1u);
+        REQUIRE(recorder.events[0].value == 32u);
+      }
+    }
+
+    SECTION("When the resolution is 14 bits") {
+      SECTION("Should quantize to the 0-16383 range") {
+        ContinuousControllerConfig config = MakeConfig();
+        config.resolution = ControllerResolution::k14Bit;
+        ContinuousControllerTracker tracker(config);
+        tracker.Update(0.5f, 0u, recorder);
+        tracker.Update(1.0f, kSamplePeriodTicks, recorder);
+
+        REQUIRE(recorder.events.size() == 2u);
+        REQUIRE(recorder.events[0].resolution == ControllerResolution::k14Bit);
+        REQUIRE(recorder.events[0].value == 8192u);
+        REQUIRE(recorder.events[1].value == 16383u);
+      }
+    }
+
+    SECTION("When the input changes faster than the minimum update interval") {
+      SECTION("Should emit at most once per interval and catch up with the latest value") {
+        ContinuousControllerConfig config = MakeConfig();
+        config.min_update_interval_ticks = 5u * kSamplePeriodTicks;
+        ContinuousControllerTracker tracker(config);
+        for (std::uint32_t i = 0; i <= 20u; ++i) {
+          tracker.Update(static_cast<float>(i) / 127.0f * 4.0f, i * kSamplePeriodTicks, recorder);
+        }
+
+        REQUIRE(recorder.events.size() == 5u);
+        for (std::size_t i = 1; i < recorder.events.size(); ++i) {
+          REQUIRE(recorder.events[i].timestamp_ticks - recorder.events[i - 1u].timestamp_ticks >=
+                  config.min_update_interval_ticks);
+        }
+        REQUIRE(recorder.events.back().value == 80u);
+      }
+    }
+
+    SECTION("When the maximum update interval elapses without a change") {
+      SECTION("Should re-send the last value") {
+        ContinuousControllerConfig config = MakeConfig();
+        config.max_update_interval_ticks = 10u * kSamplePeriodTicks;
+        ContinuousControllerTracker tracker(config);
+        for (std::uint32_t i = 0; i <= 25u; ++i) {
+          tracker.Update(0.5f, i * kSamplePeriodTicks, recorder);
+        }
+
+        REQUIRE(recorder.events.size() == 3u);
+        REQUIRE(recorder.events[1].value == 64u);
+        REQUIRE(recorder.events[1].timestamp_ticks == 10u * kSamplePeriodTicks);
+        REQUIRE(recorder.events[2].timestamp_ticks == 20u * kSamplePeriodTicks);
+      }
+    }
+
+    SECTION("When a half-pedal position is held") {
+      SECTION("Should settle on an intermediate value") {
+        ContinuousControllerConfig config = MakeConfig();
+        config.input_at_maximum = 0.4f;
+        ContinuousControllerTracker tracker(config);
+        for (std::uint32_t i = 0; i <= 100u; ++i) {
+          const float travel = 0.2f * static_cast<float>(i) / 100.0f;
+          tracker.Update(travel, i * kSamplePeriodTicks, recorder);
+        }
+
+        REQUIRE(tracker.value() == 64u);
+      }
+    }
+  }
+
+  SECTION("The Reset() method") {
+    SECTION("Should make the next update emit immediately") {
+      ContinuousControllerConfig config = MakeConfig();
+      config.min_update_interval_ticks = 1000u * kSamplePeriodTicks;
+      ContinuousControllerTracker tracker(config);
+      tracker.Update(0.5f, 0u, recorder);
+      tracker.Reset();
+
+      REQUIRE_FALSE(tracker.has_value());
+      tracker.Update(0.5f, kSamplePeriodTicks, recorder);
+      REQUIRE(recorder.events.size() == 2u);
+    }
+  }
+}
+
+#endif
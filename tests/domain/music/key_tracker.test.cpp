@@ -0,0 +1,198 @@
+#if defined(UNIT_TESTS)
+
+#include "domain/music/key_tracker.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <vector>
+
+#include "domain/music/note_event.hpp"
+
+namespace {
+
+using domain::music::KeyState;
+using domain::music::KeyTracker;
+using domain::music::KeyTrackerConfig;
+using domain::music::NoteEvent;
+using domain::music::NoteEventType;
+
+constexpr std::uint32_t kSamplePeriodTicks = 1000;
+constexpr float kKeyBedPosition = 0.5f;
+
+class EventRecorder {
+ public:
+  void OnNoteEvent(const NoteEvent& event) {
+    events.push_back(event);
+  }
+
+  std::vector<NoteEvent> events;
+};
+
+// Drives one key along straight segments between successive target positions, one sample every
+// kSamplePeriodTicks, each segment lasting the given number of ticks.
+class TrajectoryDriver {
+ public:
+  TrajectoryDriver(KeyTracker<4>& tracker, std::size_t key_index, EventRecorder& recorder)
+      : tracker_(tracker), key_index_(key_index), recorder_(recorder) {}
+
+  TrajectoryDriver& MoveTo(float target_position, std::uint32_t duration_ticks) {
+    const float start_position = position_;
+    const std::uint32_t start_ticks = now_ticks_;
+    while (now_ticks_ - start_ticks < duration_ticks) {
+      now_ticks_ += kSamplePeriodTicks;
+      const float progress =
+          static_cast<float>(now_ticks_ - start_ticks) / static_cast<float>(duration_ticks);
+      const float clamped_progress = progress > 1.0f ? 1.0f : progress;
+      position_ = start_position + (target_position - start_position) * clamped_progress;
+      tracker_.Update(key_index_, position_, now_ticks_, recorder_);
+    }
+    return *this;
+  }
+
+  TrajectoryDriver& Hold(std::uint32_t duration_ticks) {
+    return MoveTo(position_, duration_ticks);
+  }
+
+ private:
+  KeyTracker<4>& tracker_;
+  std::size_t key_index_;
+  EventRecorder& recorder_;
+  float position_ = 0.0f;
+  std::uint32_t now_ticks_ = 0;
+};
+
+std::uint8_t StrikeVelocity(std::uint32_t press_duration_ticks) {
+  KeyTracker<4> tracker(KeyTrackerConfig{}, domain::music::kDefaultVelocityCurve, 60);
+  EventRecorder recorder;
+  TrajectoryDriver(tracker, 0, recorder).Hold(5000).MoveTo(kKeyBedPosition, press_duration_ticks);
+  REQUIRE(recorder.events.size() == 1u);
+  return recorder.events[0].velocity;
+}
+
+}  // namespace
+
+TEST_CASE("The KeyTracker class") {
+  KeyTracker<4> tracker(KeyTrackerConfig{}, domain::music::kDefaultVelocityCurve, 60);
+  EventRecorder recorder;
+
+  SECTION("The Update() method") {
+    SECTION("When a key is struck then fully released") {
+      SECTION("Should emit a note-on then a note-off for the key note") {
+        TrajectoryDriver(tracker, 2, recorder)
+            .Hold(5000)
+            .MoveTo(kKeyBedPosition, 20'000)
+            .Hold(100'000)
+            .MoveTo(0.0f, 30'000);
+
+        REQUIRE(recorder.events.size() == 2u);
+        REQUIRE(recorder.events[0].type == NoteEventType::kNoteOn);
+        REQUIRE(recorder.events[0].note == 62u);
+        REQUIRE(recorder.events[0].velocity > 0u);
+        REQUIRE(recorder.events[1].type == NoteEventType::kNoteOff);
+        REQUIRE(recorder.events[1].note == 62u);
+        REQUIRE(recorder.events[1].timestamp_ticks > recorder.events[0].timestamp_ticks);
+        REQUIRE(tracker.state(2) == KeyState::kRest);
+      }
+
+      SECTION("Should timestamp the note-on at the interpolated strike crossing") {
+        // 0 -> 0.5 over 20000 ticks starting at 5000: strike (0.35) is reached at 19000.
+        TrajectoryDriver(tracker, 0, recorder).Hold(5000).MoveTo(kKeyBedPosition, 20'000);
+
+        REQUIRE(recorder.events.size() == 1u);
+        REQUIRE(recorder.events[0].timestamp_ticks >= 18'999u);
+        REQUIRE(recorder.events[0].timestamp_ticks <= 19'000u);
+      }
+    }
+
+    SECTION("When keys are struck at different speeds") {
+      SECTION("Should give a higher velocity to faster strikes") {
+        const std::uint8_t fast_velocity = StrikeVelocity(5'000);
+        const std::uint8_t medium_velocity = StrikeVelocity(50'000);
+        const std::uint8_t slow_velocity = StrikeVelocity(200'000);
+
+        REQUIRE(fast_velocity > medium_velocity);
+        REQUIRE(medium_velocity > slow_velocity);
+      }
+
+      SECTION("Should clamp velocity to the 1..127 range") {
+        REQUIRE(StrikeVelocity(1'000) == 127u);
+        REQUIRE(StrikeVelocity(2'000'000) == 1u);
+      }
+    }
+
+    SECTION("When a key is pressed without reaching the strike position") {
+      SECTION("Should not emit any event and return to rest") {
+        TrajectoryDriver(tracker, 1, recorder)
+            .Hold(5000)
+            .MoveTo(0.3f, 20'000)
+            .Hold(10'000)
+            .MoveTo(0.0f, 20'000);
+
+        REQUIRE(recorder.events.empty());
+        REQUIRE(tracker.state(1) == KeyState::kRest);
+      }
+    }
+
+    SECTION("When a struck key is re-struck before returning to rest") {
+      SECTION("Should emit note-off and note-on for the repetition") {
+        TrajectoryDriver driver(tracker, 0, recorder);
+        driver.Hold(5000).MoveTo(kKeyBedPosition, 20'000).Hold(10'000).MoveTo(0.12f, 15'000);
+        REQUIRE(tracker.state(0) == KeyState::kReleased);
+        REQUIRE(recorder.events.size() == 1u);
+
+        driver.MoveTo(kKeyBedPosition, 10'000).Hold(10'000).MoveTo(0.0f, 30'000);
+
+        REQUIRE(recorder.events.size() == 4u);
+        REQUIRE(recorder.events[0].type == NoteEventType::kNoteOn);
+        REQUIRE(recorder.events[1].type == NoteEventType::kNoteOff);
+        REQUIRE(recorder.events[2].type == NoteEventType::kNoteOn);
+        REQUIRE(recorder.events[2].velocity > 0u);
+        REQUIRE(recorder.events[3].type == NoteEventType::kNoteOff);
+        REQUIRE(tracker.state(0) == KeyState::kRest);
+      }
+    }
+
+    SECTION("When a struck key wobbles around the strike position") {
+      SECTION("Should not emit repeated note-on events") {
+        TrajectoryDriver(tracker, 3, recorder)
+            .Hold(5000)
+            .MoveTo(kKeyBedPosition, 20'000)
+            .MoveTo(0.3f, 5'000)
+            .MoveTo(kKeyBedPosition, 5'000)
+            .MoveTo(0.3f, 5'000)
+            .MoveTo(kKeyBedPosition, 5'000);
+
+        REQUIRE(recorder.events.size() == 1u);
+        REQUIRE(tracker.state(3) == KeyState::kStruck);
+      }
+    }
+  }
+
+  SECTION("The Scan() method") {
+    SECTION("When several keys move at once") {
+      SECTION("Should track each key independently") {
+        float positions[4] = {};
+        std::uint32_t timestamps[4] = {};
+        std::uint32_t now_ticks = 0;
+        for (std::uint32_t step = 0; step <= 30u; ++step) {
+          now_ticks += kSamplePeriodTicks;
+          const float travel = static_cast<float>(step) / 30.0f;
+          positions[0] = kKeyBedPosition * travel;
+          positions[3] = 0.1f * travel;
+          for (std::uint32_t& timestamp : timestamps) {
+            timestamp = now_ticks;
+          }
+          tracker.Scan(positions, timestamps, recorder);
+        }
+
+        REQUIRE(recorder.events.size() == 1u);
+        REQUIRE(recorder.events[0].note == 60u);
+        REQUIRE(tracker.state(0) == KeyState::kStruck);
+        REQUIRE(tracker.state(1) == KeyState::kRest);
+        REQUIRE(tracker.state(3) == KeyState::kTravelling);
+      }
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,242 @@
+#if defined(UNIT_TESTS)
+
+#include "domain/music/music_event_queue.hpp"
+
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "domain/music/music_event.hpp"
+
+namespace {
+
+using domain::music::MusicEvent;
+using domain::music::MusicEventQueue;
+using domain::music::MusicEventType;
+
+std::vector<MusicEvent> Drain(MusicEventQueue<4, 4>& queue) {
+  std::vector<MusicEvent> events;
+  MusicEvent event{};
+  while (queue.TryPop(event)) {
+    events.push_back(event);
+  }
+  return events;
+}
+
+}  // namespace
+
+TEST_CASE("The MusicEventQueue class", "[domain][music]") {
+  MusicEventQueue<4, 4> queue;
+
+  SECTION("The TryPop() method") {
+    SECTION("When the queue is empty") {
+      SECTION("Should return false") {
+        MusicEvent event{};
+        REQUIRE_FALSE(queue.TryPop(event));
+      }
+    }
+
+    SECTION("When notes and controllers are interleaved") {
+      SECTION("Should return them in timestamp order with every field intact") {
+        queue.Push(MusicEvent{.timestamp_ticks = 10,
+                              .type = MusicEventType::kControlChange,
+                              .number = 64,
+                              .value = 127});
+        queue.Push(MusicEvent{.timestamp_ticks = 20,
+                              .type = MusicEventType::kNoteOn,
+                              .number = 60,
+                              .value = 100});
+        queue.Push(MusicEvent{.timestamp_ticks = 30,
+                              .type = MusicEventType::kPolyPressure,
+                              .number = 60,
+                              .value = 42});
+        queue.Push(MusicEvent{.timestamp_ticks = 40,
+                              .type = MusicEventType::kNoteOff,
+                              .number = 60,
+                              .value = 0});
+        queue.Push(MusicEvent{.timestamp_ticks = 50,
+                              .type = MusicEventType::kControlChange14Bit,
+                              .number = 1,
+                              .value = 16383});
+
+        const std::vector<MusicEvent> events = Drain(queue);
+
+        REQUIRE(events.size() == 5u);
+        REQUIRE(events[0].type == MusicEventType::kControlChange);
+        REQUIRE(events[0].number == 64u);
+        REQUIRE(events[0].value == 127u);
+        REQUIRE(events[1].type == MusicEventType::kNoteOn);
+        REQUIRE(events[1].timestamp_ticks == 20u);
+        REQUIRE(events[1].value == 100u);
+        REQUIRE(events[2].type == MusicEventType::kPolyPressure);
+        REQUIRE(events[3].type == MusicEventType::kNoteOff);
+        REQUIRE(events[4].type == MusicEventType::kControlChange14Bit);
+        REQUIRE(events[4].value == 16383u);
+      }
+
+      SECTION("Should return the note first when timestamps are equal") {
+        queue.Push(MusicEvent{.timestamp_ticks = 10,
+                              .type = MusicEventType::kControlChange,
+                              .number = 64,
+                              .value = 0});
+        queue.Push(MusicEvent{.timestamp_ticks = 10,
+                              .type = MusicEventType::kNoteOn,
+                              .number = 60,
+                              .value = 100});
+
+        const std::vector<MusicEvent> events = Drain(queue);
+
+        REQUIRE(events.size() == 2u);
+        REQUIRE(events[0].type == MusicEventType::kNoteOn);
+      }
+    }
+  }
+
+  SECTION("The Push() method") {
+    SECTION("When the controller ring overflows") {
+      SECTION("Should drop the oldest controllers and keep every note") {
+        queue.Push(MusicEvent{.type = MusicEventType::kNoteOn, .number = 60, .value = 100});
+        for (std::uint16_t i = 0; i < 10u; ++i) {
+          REQUIRE(queue.Push(MusicEvent{.timestamp_ticks = 1u + i,
+                                        .type = MusicEventType::kControlChange,
+                                        .number = 64,
+                                        .value = i}));
+        }
+
+        const std::vector<MusicEvent> events = Drain(queue);
+
+        REQUIRE(events.size() == 5u);
+        REQUIRE(events[0].type == MusicEventType::kNoteOn);
+        REQUIRE(events[1].value == 6u);
+        REQUIRE(events[4].value == 9u);
+        REQUIRE(queue.dropped_controller_count() == 6u);
+        REQUIRE(queue.dropped_note_count() == 0u);
+      }
+    }
+
+    SECTION("When the note ring is full") {
+      SECTION("Should reject the new note and count it") {
+        for (std::uint8_t i = 0; i < 4u; ++i) {
+          REQUIRE(queue.Push(MusicEvent{.timestamp_ticks = i,
+                                        .type = MusicEventType::kNoteOn,
+                                        .number = static_cast<std::uint8_t>(60u + i),
+                                        .value = 100}));
+        }
+        REQUIRE_FALSE(queue.Push(MusicEvent{.timestamp_ticks = 4,
+                                            .type = MusicEventType::kNoteOn,
+                                            .number = 64,
+                                            .value = 100}));
+
+        const std::vector<MusicEvent> events = Drain(queue);
+
+        REQUIRE(events.size() == 4u);
+        REQUIRE(events[3].number == 63u);
+        REQUIRE(queue.dropped_note_count() == 1u);
+      }
+    }
+  }
+
+  SECTION("The sink adapters") {
+    SECTION("Should convert tracker events to music events") {
+      domain::music::NoteEvent note{};
+      note.type = domain::music::NoteEventType::kNoteOff;
+      note.note = 61;
+      note.timestamp_ticks = 1;
+      domain::music::ControllerEvent controller{};
+      controller.controller = domain::music::kControllerSoftPedal;
+      controller.resolution = domain::music::ControllerResolution::k14Bit;
+      controller.value = 8192;
+      controller.timestamp_ticks = 2;
+      domain::music::PressureEvent pressure{};
+      pressure.note = 62;
+      pressure.pressure = 90;
+      pressure.timestamp_ticks = 3;
+
+      queue.OnNoteEvent(note);
+      queue.OnControllerEvent(controller);
+      queue.OnPressureEvent(pressure);
+      const std::vector<MusicEvent> events = Drain(queue);
+
+      REQUIRE(events.size() == 3u);
+      REQUIRE(events[0].type == MusicEventType::kNoteOff);
+      REQUIRE(events[0].number == 61u);
+      REQUIRE(events[1].type == MusicEventType::kControlChange14Bit);
+      REQUIRE(events[1].number == domain::music::kControllerSoftPedal);
+      REQUIRE(events[1].value == 8192u);
+      REQUIRE(events[2].type == MusicEventType::kPolyPressure);
+      REQUIRE(events[2].value == 90u);
+    }
+  }
+}
+
+TEST_CASE("The MusicEventQueue class under concurrent use", "[domain][music][stress]") {
+  constexpr std::uint32_t kEventCount = 200'000;
+  constexpr std::uint32_t kNoteEvery = 8;
+  static MusicEventQueue<64, 16> queue;
+
+  // Every event carries its producer index in the timestamp and a value derived from it, so a
+  // torn read shows up as a mismatch.
+  // A note rejected by a full ring is retried, so every note is eventually delivered.
+  std::atomic<bool> is_producing{true};
+  std::uint32_t rejected_note_count = 0;
+  std::thread producer([&is_producing, &rejected_note_count]() {
+    for (std::uint32_t i = 0; i < kEventCount; ++i) {
+      const bool is_note = (i % kNoteEvery) == 0u;
+      const MusicEventType type =
+          is_note ? MusicEventType::kNoteOn : MusicEventType::kControlChange;
+      const MusicEvent event{.timestamp_ticks = i,
+                             .type = type,
+                             .number = static_cast<std::uint8_t>(i & 0x7Fu),
+                             .value = static_cast<std::uint16_t>(i ^ 0x5A5Au)};
+      while (is_note && !queue.Push(event)) {
+        ++rejected_note_count;
+        std::this_thread::yield();
+      }
+      if (!is_note) {
+        queue.Push(event);
+      }
+    }
+    is_producing.store(false, std::memory_order_release);
+  });
+
+  std::uint32_t note_count = 0;
+  std::uint32_t controller_count = 0;
+  std::uint32_t last_note_index = 0;
+  std::uint32_t last_controller_index = 0;
+  bool is_consistent = true;
+  bool is_ordered = true;
+  MusicEvent event{};
+  for (;;) {
+    const bool is_done = !is_producing.load(std::memory_order_acquire);
+    while (queue.TryPop(event)) {
+      const std::uint32_t index = event.timestamp_ticks;
+      is_consistent = is_consistent &&
+                      event.value == static_cast<std::uint16_t>(index ^ 0x5A5Au) &&
+                      event.number == static_cast<std::uint8_t>(index & 0x7Fu);
+      if (domain::music::IsNoteEvent(event.type)) {
+        is_ordered = is_ordered && (note_count == 0u || index > last_note_index);
+        last_note_index = index;
+        ++note_count;
+      } else {
+        is_ordered = is_ordered && (controller_count == 0u || index > last_controller_index);
+        last_controller_index = index;
+        ++controller_count;
+      }
+    }
+    if (is_done) {
+      break;
+    }
+  }
+  producer.join();
+
+  constexpr std::uint32_t kNoteTotal = (kEventCount + kNoteEvery - 1u) / kNoteEvery;
+  REQUIRE(is_consistent);
+  REQUIRE(is_ordered);
+  REQUIRE(note_count == kNoteTotal);
+  REQUIRE(queue.dropped_note_count() == rejected_note_count);
+  REQUIRE(controller_count + queue.dropped_controller_count() == kEventCount - kNoteTotal);
+}
+
+#endif
@@ -0,0 +1,230 @@
+#if defined(UNIT_TESTS)
+
+#include "domain/music/poly_pressure_generator.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "domain/music/key_tracker.hpp"
+#include "domain/music/note_event.hpp"
+#include "domain/music/pressure_event.hpp"
+
+namespace {
+
+using domain::music::KeyState;
+using domain::music::KeyTracker;
+using domain::music::KeyTrackerConfig;
+using domain::music::NoteEvent;
+using domain::music::PolyPressureConfig;
+using domain::music::PolyPressureGenerator;
+using domain::music::PressureEvent;
+
+constexpr std::size_t kKeyCount = 4;
+constexpr std::uint32_t kSamplePeriodTicks = 1000;
+constexpr float kKeyBedPosition = 0.5f;
+
+class EventRecorder {
+ public:
+  void OnNoteEvent(const NoteEvent& event) {
+    notes.push_back(event);
+  }
+
+  void OnPressureEvent(const PressureEvent& event) {
+    pressures.push_back(event);
+  }
+
+  std::size_t CountPressures(domain::music::NoteNumber note) const {
+    std::size_t count = 0;
+    for (const PressureEvent& event : pressures) {
+      count += event.note == note ? 1u : 0u;
+    }
+    return count;
+  }
+
+  std::vector<NoteEvent> notes;
+  std::vector<PressureEvent> pressures;
+};
+
+PolyPressureConfig MakeConfig() {
+  PolyPressureConfig config{};
+  config.pressure_start_position = kKeyBedPosition;
+  config.pressure_full_position = kKeyBedPosition + 0.127f;
+  config.deadband_steps = 1.0f;
+  config.min_update_interval_ticks = 10'000;
+  return config;
+}
+
+// Feeds one scan per sample period to a KeyTracker and a PolyPressureGenerator, the way the
+// acquisition task does, with per-key positions given by a synthetic profile.
+class ScanDriver {
+ public:
+  explicit ScanDriver(const PolyPressureConfig& config)
+      : tracker_(KeyTrackerConfig{}, domain::music::kDefaultVelocityCurve, 60),
+        generator_(config, 60) {}
+
+  template <typename ProfileT>
+  ScanDriver& Run(std::uint32_t duration_ticks, ProfileT profile) {
+    const std::uint32_t start_ticks = now_ticks_;
+    while (now_ticks_ - start_ticks < duration_ticks) {
+      now_ticks_ += kSamplePeriodTicks;
+      const std::uint32_t elapsed_ticks = now_ticks_ - start_ticks;
+      for (std::size_t key = 0; key < kKeyCount; ++key) {
+        positions_[key] = profile(key, elapsed_ticks, positions_[key]);
+        timestamps_[key] = now_ticks_;
+      }
+      tracker_.Scan(positions_, timestamps_, recorder);
+      generator_.Scan(tracker_, positions_, timestamps_, recorder);
+    }
+    return *this;
+  }
+
+  const PolyPressureGenerator<kKeyCount>& generator() const {
+    return generator_;
+  }
+
+  EventRecorder recorder;
+
+ private:
+  KeyTracker<kKeyCount> tracker_;
+  PolyPressureGenerator<kKeyCount> generator_;
+  float positions_[kKeyCount] = {};
+  std::uint32_t timestamps_[kKeyCount] = {};
+  std::uint32_t now_ticks_ = 0;
+};
+
+constexpr std::uint32_t kRestTicks = 5'000;
+constexpr std::uint32_t kStrikeTicks = 25'000;
+
+float Ramp(float from, float to, std::uint32_t elapsed_ticks, std::uint32_t duration_ticks) {
+  const float progress = static_cast<float>(elapsed_ticks) / static_cast<float>(duration_ticks);
+  return from + (to - from) * (progress > 1.0f ? 1.0f : progress);
+}
+
+float Strike(std::uint32_t elapsed_ticks) {
+  if (elapsed_ticks < kRestTicks) {
+    return 0.0f;
+  }
+  return Ramp(0.0f, kKeyBedPosition, elapsed_ticks - kRestTicks, 10'000);
+}
+
+auto StrikeKey(std::size_t struck_key) {
+  return [struck_key](std::size_t key, std::uint32_t elapsed_ticks, float position) {
+    return key == struck_key ? Strike(elapsed_ticks) : position;
+  };
+}
+
+}  // namespace
+
+TEST_CASE("The PolyPressureGenerator class", "[domain][music]") {
+  ScanDriver driver(MakeConfig());
+  EventRecorder& recorder = driver.recorder;
+
+  SECTION("The Scan() method") {
+    SECTION("When a struck key is pressed into the key bed") {
+      SECTION("Should emit rising pressure up to 127 for the key note") {
+        driver.Run(kStrikeTicks, StrikeKey(1))
+            .Run(200'000, [](std::size_t key, std::uint32_t t, float p) {
+              return key == 1u ? Ramp(kKeyBedPosition, kKeyBedPosition + 0.2f, t, 100'000) : p;
+            });
+
+        REQUIRE(recorder.notes.size() == 1u);
+        REQUIRE_FALSE(recorder.pressures.empty());
+        for (std::size_t i = 0; i < recorder.pressures.size(); ++i) {
+          REQUIRE(recorder.pressures[i].note == 61u);
+          if (i > 0u) {
+            REQUIRE(recorder.pressures[i].pressure > recorder.pressures[i - 1u].pressure);
+          }
+        }
+        REQUIRE(recorder.pressures.back().pressure == 127u);
+        REQUIRE(driver.generator().pressure(1) == 127u);
+      }
+    }
+
+    SECTION("When the key is released after pressure was applied") {
+      SECTION("Should send a pressure of 0 before the note-off") {
+        driver.Run(kStrikeTicks, StrikeKey(0))
+            .Run(50'000,
+                 [](std::size_t key, std::uint32_t t, float p) {
+                   return key == 0u ? Ramp(kKeyBedPosition, kKeyBedPosition + 0.06f, t, 20'000)
+                                    : p;
+                 })
+            .Run(30'000, [](std::size_t key, std::uint32_t t, float p) {
+              return key == 0u ? Ramp(kKeyBedPosition + 0.06f, 0.0f, t, 20'000) : p;
+            });
+
+        REQUIRE(recorder.notes.size() == 2u);
+        REQUIRE(recorder.pressures.back().pressure == 0u);
+        REQUIRE(recorder.pressures.back().timestamp_ticks <= recorder.notes[1].timestamp_ticks);
+        REQUIRE(driver.generator().pressure(0) == 0u);
+      }
+    }
+
+    SECTION("When the pressure jitters within the deadband") {
+      SECTION("Should not emit anything after settling") {
+        driver.Run(kStrikeTicks, StrikeKey(2))
+            .Run(100'000, [](std::size_t key, std::uint32_t, float p) {
+              return key == 2u ? kKeyBedPosition + 0.064f : p;
+            });
+        const std::size_t settled_count = recorder.pressures.size();
+
+        std::uint32_t step = 0;
+        driver.Run(500'000, [&step](std::size_t key, std::uint32_t, float p) {
+          if (key != 2u) {
+            return p;
+          }
+          ++step;
+          return kKeyBedPosition + 0.064f + ((step % 2u) == 0u ? 0.0012f : -0.0012f);
+        });
+
+        REQUIRE(settled_count == 1u);
+        REQUIRE(recorder.pressures.size() == settled_count);
+      }
+    }
+
+    SECTION("When every key of a chord modulates its pressure") {
+      SECTION("Should emit at most one event per key and update interval") {
+        constexpr std::uint32_t kDurationTicks = 1'000'000;
+        driver.Run(kStrikeTicks, [](std::size_t, std::uint32_t t, float) { return Strike(t); });
+        driver.Run(kDurationTicks, [](std::size_t key, std::uint32_t t, float) {
+          const float phase = static_cast<float>(t) / 50'000.0f + static_cast<float>(key);
+          return kKeyBedPosition + 0.06f + 0.05f * std::sin(6.2831853f * phase);
+        });
+
+        REQUIRE(recorder.notes.size() == kKeyCount);
+        const std::size_t max_per_key =
+            kDurationTicks / MakeConfig().min_update_interval_ticks + 1u;
+        for (std::size_t key = 0; key < kKeyCount; ++key) {
+          const std::size_t count = recorder.CountPressures(static_cast<std::uint8_t>(60u + key));
+          REQUIRE(count > 10u);
+          REQUIRE(count <= max_per_key);
+        }
+      }
+    }
+  }
+
+  SECTION("The Update() method") {
+    SECTION("When the key is not struck") {
+      SECTION("Should not emit pressure whatever the position") {
+        PolyPressureGenerator<kKeyCount> generator(MakeConfig(), 60);
+        generator.Update(0, KeyState::kTravelling, 1.0f, 0u, recorder);
+        generator.Update(0, KeyState::kReleased, 1.0f, 1000u, recorder);
+
+        REQUIRE(recorder.pressures.empty());
+      }
+    }
+
+    SECTION("When the key index is out of range") {
+      SECTION("Should ignore the update") {
+        PolyPressureGenerator<kKeyCount> generator(MakeConfig(), 60);
+        generator.Update(kKeyCount, KeyState::kStruck, 1.0f, 0u, recorder);
+
+        REQUIRE(recorder.pressures.empty());
+        REQUIRE(generator.pressure(kKeyCount) == 0u);
+      }
+    }
+  }
+}
+
+#endif
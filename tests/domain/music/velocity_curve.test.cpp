@@ -0,0 +1,211 @@
+#if defined(UNIT_TESTS)
+
+#include "domain/music/velocity_curve.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+
+namespace {
+
+using domain::music::VelocityCurve;
+using domain::music::VelocityTable;
+
+constexpr double kFastestTravelTicks = 2'000.0;
+constexpr double kSlowestTravelTicks = 100'000.0;
+
+constexpr VelocityTable<128> kLinearTable =
+    domain::music::MakeLinearVelocityTable<128>(kFastestTravelTicks, kSlowestTravelTicks);
+constexpr VelocityTable<1024> kLogarithmicTable =
+    domain::music::MakeLogarithmicVelocityTable<1024>(kFastestTravelTicks, kSlowestTravelTicks);
+constexpr VelocityTable<256> kDefaultSizeLogarithmicTable =
+    domain::music::MakeLogarithmicVelocityTable<256>(kFastestTravelTicks, kSlowestTravelTicks);
+constexpr VelocityTable<128> kPowerTable =
+    domain::music::MakePowerVelocityTable<128>(kFastestTravelTicks, kSlowestTravelTicks, 0.5);
+
+static_assert(kLinearTable[0] == 127u);
+static_assert(kLinearTable[127] == 1u);
+static_assert(kLogarithmicTable[0] == 127u);
+static_assert(kLogarithmicTable[1023] == 1u);
+
+double AnalyticToVelocity(double strength) {
+  if (strength <= 0.0) {
+    return 1.0;
+  }
+  if (strength >= 1.0) {
+    return 127.0;
+  }
+  return 1.0 + strength * 126.0;
+}
+
+template <std::size_t kEntryCount>
+double EntryTravelTicks(std::size_t index) {
+  return domain::music::velocity_curve_detail::EntryTravelTicks<kEntryCount>(
+      index, kFastestTravelTicks, kSlowestTravelTicks);
+}
+
+template <std::size_t kEntryCount>
+double EntrySlowness(std::size_t index) {
+  return (EntryTravelTicks<kEntryCount>(index) - kFastestTravelTicks) /
+         (kSlowestTravelTicks - kFastestTravelTicks);
+}
+
+template <std::size_t kEntryCount, typename CurveFn>
+void RequireTableMatchesAnalyticCurve(const VelocityTable<kEntryCount>& table, CurveFn curve) {
+  for (std::size_t i = 0; i < kEntryCount; ++i) {
+    const double expected = AnalyticToVelocity(curve(i));
+    REQUIRE(std::fabs(static_cast<double>(table[i]) - expected) <= 0.5 + 1e-9);
+  }
+}
+
+}  // namespace
+
+TEST_CASE("The velocity table generators") {
+  SECTION("The MakeLinearVelocityTable() function") {
+    SECTION("Should match the analytic linear curve") {
+      RequireTableMatchesAnalyticCurve(kLinearTable, [](std::size_t i) {
+        return 1.0 - EntrySlowness<128>(i);
+      });
+    }
+  }
+
+  SECTION("The MakeLogarithmicVelocityTable() function") {
+    SECTION("Should match the analytic logarithmic curve") {
+      RequireTableMatchesAnalyticCurve(kLogarithmicTable, [](std::size_t i) {
+        return std::log(kSlowestTravelTicks / EntryTravelTicks<1024>(i)) /
+               std::log(kSlowestTravelTicks / kFastestTravelTicks);
+      });
+    }
+
+    SECTION("Should change by at most one velocity step per entry at the default size") {
+      for (std::size_t i = 1; i < kDefaultSizeLogarithmicTable.size(); ++i) {
+        REQUIRE(kDefaultSizeLogarithmicTable[i - 1u] - kDefaultSizeLogarithmicTable[i] <= 1);
+      }
+      REQUIRE(kDefaultSizeLogarithmicTable[1] >= 126u);
+    }
+  }
+
+  SECTION("The MakePowerVelocityTable() function") {
+    SECTION("Should match the analytic power curve") {
+      RequireTableMatchesAnalyticCurve(kPowerTable, [](std::size_t i) {
+        return std::pow(1.0 - EntrySlowness<128>(i), 0.5);
+      });
+    }
+
+    SECTION("Should be non-increasing with travel time") {
+      for (std::size_t i = 1; i < kPowerTable.size(); ++i) {
+        REQUIRE(kPowerTable[i] <= kPowerTable[i - 1u]);
+      }
+    }
+  }
+}
+
+TEST_CASE("The EntryTravelTicks() function") {
+  SECTION("Should span the travel range with geometrically growing entries") {
+    REQUIRE(std::fabs(EntryTravelTicks<128>(0) - kFastestTravelTicks) < 1e-9);
+    REQUIRE(std::fabs(EntryTravelTicks<128>(127) - kSlowestTravelTicks) < 1e-6);
+    REQUIRE(EntryTravelTicks<128>(1) - EntryTravelTicks<128>(0) <
+            EntryTravelTicks<128>(127) - EntryTravelTicks<128>(126));
+  }
+}
+
+TEST_CASE("The VelocityCurve class") {
+  SECTION("The Lookup() method") {
+    constexpr VelocityCurve<128> curve(2'000.0f, 100'000.0f, kLinearTable);
+
+    SECTION("When the travel time is outside the table range") {
+      SECTION("Should clamp to the first and last entries") {
+        REQUIRE(curve.Lookup(0.0f) == 127u);
+        REQUIRE(curve.Lookup(-5.0f) == 127u);
+        REQUIRE(curve.Lookup(1'000'000.0f) == 1u);
+      }
+    }
+
+    SECTION("When the travel time falls between two entries") {
+      SECTION("Should return the nearest entry") {
+        // Entries 40 and 41 share an octave, where entries are evenly spaced in time.
+        const float entry40 = static_cast<float>(EntryTravelTicks<128>(40));
+        const float entry_width_ticks = static_cast<float>(EntryTravelTicks<128>(41)) - entry40;
+
+        REQUIRE(curve.Lookup(entry40) == kLinearTable[40]);
+        REQUIRE(curve.Lookup(entry40 + 0.4f * entry_width_ticks) == kLinearTable[40]);
+        REQUIRE(curve.Lookup(entry40 + 0.6f * entry_width_ticks) == kLinearTable[41]);
+      }
+    }
+
+    SECTION("When evaluated at compile time") {
+      SECTION("Should give the same result") {
+        static_assert(curve.Lookup(2'000.0f) == 127u);
+        static_assert(curve.Lookup(100'000.0f) == 1u);
+      }
+    }
+  }
+
+  SECTION("The LookupHighResolution() method") {
+    constexpr VelocityCurve<128> curve(2'000.0f, 100'000.0f, kLinearTable);
+    const float entry40 = static_cast<float>(EntryTravelTicks<128>(40));
+    const float entry_width_ticks = static_cast<float>(EntryTravelTicks<128>(41)) - entry40;
+
+    SECTION("When the travel time is on an entry") {
+      SECTION("Should return the entry widened to 16 bits") {
+        REQUIRE(curve.LookupHighResolution(2'000.0f) == 0xFFFFu);
+        REQUIRE(curve.LookupHighResolution(100'000.0f) ==
+                domain::music::ScaleUp(kLinearTable[127], 7u, 16u));
+        REQUIRE(curve.LookupHighResolution(1'000'000.0f) ==
+                domain::music::ScaleUp(kLinearTable[127], 7u, 16u));
+      }
+    }
+
+    SECTION("When the travel time falls between two entries") {
+      SECTION("Should interpolate between their widened values") {
+        const std::uint32_t low = domain::music::ScaleUp(kLinearTable[41], 7u, 16u);
+        const std::uint32_t high = domain::music::ScaleUp(kLinearTable[40], 7u, 16u);
+        const std::uint32_t middle = curve.LookupHighResolution(entry40 + 0.5f * entry_width_ticks);
+
+        REQUIRE(middle > low);
+        REQUIRE(middle < high);
+        REQUIRE(std::abs(static_cast<int>(middle) - static_cast<int>((low + high) / 2u)) <= 2);
+      }
+
+      SECTION("Should keep the 7-bit lookup in its top bits, within one step") {
+        // Adjacent entries of this table differ by at most one step.
+        constexpr VelocityCurve<256> log_curve(2'000.0f, 100'000.0f, kDefaultSizeLogarithmicTable);
+        for (int step = 0; step < 1000; ++step) {
+          const float travel_ticks = 2'000.0f + 98.0f * static_cast<float>(step);
+          const int narrowed = log_curve.LookupHighResolution(travel_ticks) >> 9;
+          REQUIRE(std::abs(narrowed - static_cast<int>(log_curve.Lookup(travel_ticks))) <= 1);
+        }
+      }
+    }
+  }
+
+  SECTION("The LoadTable() method") {
+    SECTION("When called with a custom table") {
+      SECTION("Should use the custom table for subsequent lookups") {
+        VelocityCurve<4> curve(1'024.0f, 8'192.0f, VelocityTable<4>{100, 80, 60, 40});
+        REQUIRE(curve.Lookup(2'048.0f) == 80u);
+
+        curve.LoadTable(VelocityTable<4>{10, 20, 30, 40});
+
+        REQUIRE(curve.Lookup(2'048.0f) == 20u);
+        REQUIRE(curve.table()[3] == 40u);
+      }
+    }
+
+    SECTION("When called repeatedly") {
+      SECTION("Should always look up in the last loaded table") {
+        VelocityCurve<4> curve(1'024.0f, 8'192.0f, VelocityTable<4>{100, 80, 60, 40});
+        curve.LoadTable(VelocityTable<4>{10, 20, 30, 40});
+        curve.LoadTable(VelocityTable<4>{1, 2, 3, 4});
+        curve.LoadTable(VelocityTable<4>{5, 6, 7, 8});
+
+        REQUIRE(curve.Lookup(1'024.0f) == 5u);
+        REQUIRE(curve.Lookup(4'096.0f) == 7u);
+      }
+    }
+  }
+}
+
+#endif
@@ -4,9 +4,24 @@
 
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <cstddef>
+#include <cstdint>
 
 namespace {
 
+class RecordingMonitor {
+ public:
+  void Observe(std::size_t index, std::uint16_t sample) noexcept {
+    last_index = index;
+    last_sample = sample;
+    ++observe_count;
+  }
+
+  std::size_t last_index = 0;
+  std::uint16_t last_sample = 0;
+  int observe_count = 0;
+};
+
 class PlusOneFilter {
  public:
   void Reset() noexcept {}
@@ -37,6 +52,26 @@ TEST_CASE("The ProcessedSensorGroup class") {
         REQUIRE(s2.last_timestamp_ticks() == 99);
       }
     }
+
+    SECTION("When a monitor is attached") {
+      SECTION("Should forward the raw sample of the updated index to the monitor") {
+        domain::sensors::Sensor s1(1);
+        domain::sensors::Sensor s2(2);
+        domain::sensors::Sensor* sensors[] = {&s1, &s2};
+        PlusOneFilter filters[] = {PlusOneFilter{}, PlusOneFilter{}};
+        RecordingMonitor monitor;
+
+        domain::sensors::ProcessedSensorGroup<PlusOneFilter, RecordingMonitor> group(
+            sensors, filters, 2, &monitor);
+
+        group.UpdateAt(1, 1234, 99);
+        group.UpdateAt(2, 4321, 100);
+
+        REQUIRE(monitor.observe_count == 1);
+        REQUIRE(monitor.last_index == 1u);
+        REQUIRE(monitor.last_sample == 1234u);
+      }
+    }
   }
 }
 
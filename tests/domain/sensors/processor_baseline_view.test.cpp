@@ -0,0 +1,53 @@
+#if defined(UNIT_TESTS)
+
+#include "domain/sensors/processor_baseline_view.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include "domain/signal/filters/identity_filter.hpp"
+#include "domain/signal/processing_pipeline/continuous_pipeline.hpp"
+#include "domain/signal/processors/baseline_tracker.hpp"
+
+namespace {
+
+using Tracker = domain::signal::processors::BaselineTracker<1, 4096, 1, 100, 30000>;
+using Processor = domain::signal::processing_pipeline::ContinuousPipeline<
+    domain::signal::filters::IdentityFilter, Tracker>;
+
+}  // namespace
+
+TEST_CASE("The ProcessorBaselineView class") {
+  using Catch::Matchers::WithinAbs;
+
+  Processor processors[2]{};
+  domain::sensors::ProcessorBaselineView<Processor, Tracker> view(processors, 2);
+
+  SECTION("The TryReadBaseline() method") {
+    SECTION("When the tracker of the channel is seeded") {
+      SECTION("Should return its baseline") {
+        (void) processors[1].Process(0.3f);
+
+        float baseline = 0.0f;
+        REQUIRE(view.TryReadBaseline(1, baseline));
+        REQUIRE_THAT(baseline, WithinAbs(0.3f, 1e-6f));
+      }
+    }
+
+    SECTION("When the tracker of the channel has not received any sample") {
+      SECTION("Should return false") {
+        float baseline = 0.0f;
+        REQUIRE_FALSE(view.TryReadBaseline(0, baseline));
+      }
+    }
+
+    SECTION("When called with an out of range index") {
+      SECTION("Should return false") {
+        float baseline = 0.0f;
+        REQUIRE_FALSE(view.TryReadBaseline(2, baseline));
+      }
+    }
+  }
+}
+
+#endif
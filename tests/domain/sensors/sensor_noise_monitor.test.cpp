@@ -0,0 +1,86 @@
+#if defined(UNIT_TESTS)
+
+#include "domain/sensors/sensor_noise_monitor.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include "domain/signal/statistics/running_stats.hpp"
+
+TEST_CASE("The SensorNoiseMonitor class") {
+  using Catch::Matchers::WithinAbs;
+
+  domain::sensors::SensorNoiseMonitor<3> monitor;
+  domain::signal::statistics::RunningStats stats;
+
+  SECTION("The Observe() method") {
+    SECTION("When called for different channels") {
+      SECTION("Should accumulate each channel independently") {
+        monitor.Observe(0, 10);
+        monitor.Observe(0, 20);
+        monitor.Observe(2, 5);
+
+        REQUIRE(monitor.TryRead(0, stats));
+        REQUIRE(stats.count() == 2u);
+        REQUIRE_THAT(stats.mean(), WithinAbs(15.0, 1e-9));
+
+        REQUIRE(monitor.TryRead(1, stats));
+        REQUIRE(stats.count() == 0u);
+
+        REQUIRE(monitor.TryRead(2, stats));
+        REQUIRE(stats.count() == 1u);
+      }
+    }
+
+    SECTION("When called with an out of range index") {
+      SECTION("Should ignore the sample") {
+        monitor.Observe(3, 10);
+
+        for (std::size_t i = 0; i < monitor.channel_count(); ++i) {
+          REQUIRE(monitor.TryRead(i, stats));
+          REQUIRE(stats.count() == 0u);
+        }
+      }
+    }
+  }
+
+  SECTION("The TryRead() method") {
+    SECTION("When called with an out of range index") {
+      SECTION("Should return false") {
+        REQUIRE_FALSE(monitor.TryRead(3, stats));
+      }
+    }
+  }
+
+  SECTION("The RequestReset() method") {
+    SECTION("When called before any new sample") {
+      SECTION("Should make every channel read as empty") {
+        monitor.Observe(0, 10);
+        monitor.Observe(1, 20);
+
+        monitor.RequestReset();
+
+        REQUIRE(monitor.TryRead(0, stats));
+        REQUIRE(stats.count() == 0u);
+        REQUIRE(monitor.TryRead(1, stats));
+        REQUIRE(stats.count() == 0u);
+      }
+    }
+
+    SECTION("When new samples arrive after the reset") {
+      SECTION("Should accumulate only the new samples") {
+        monitor.Observe(0, 10);
+        monitor.Observe(0, 10);
+
+        monitor.RequestReset();
+        monitor.Observe(0, 42);
+
+        REQUIRE(monitor.TryRead(0, stats));
+        REQUIRE(stats.count() == 1u);
+        REQUIRE_THAT(stats.mean(), WithinAbs(42.0, 1e-9));
+      }
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,163 @@
+#if defined(UNIT_TESTS)
+
+#include "domain/signal/detectors/crossing_detector.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <cstdint>
+
+namespace {
+
+using domain::signal::detectors::CrossingDetector;
+using domain::signal::detectors::CrossingDirection;
+using domain::signal::detectors::CrossingEvent;
+using domain::signal::detectors::CrossingTime;
+using domain::signal::detectors::ElapsedTicks;
+
+constexpr std::uint32_t kSamplePeriodTicks = 1000;
+
+// Feeds value = slope * (t - start_ticks) sampled every kSamplePeriodTicks and returns the number
+// of crossings, storing the first one.
+int FeedRamp(CrossingDetector& detector, float slope_per_tick, std::uint32_t start_ticks,
+             std::uint32_t first_sample_ticks, std::uint32_t sample_count,
+             CrossingEvent& first_event) {
+  int crossing_count = 0;
+  for (std::uint32_t i = 0; i < sample_count; ++i) {
+    const std::uint32_t ts = first_sample_ticks + i * kSamplePeriodTicks;
+    const float elapsed = static_cast<float>(static_cast<std::int32_t>(ts - start_ticks));
+    CrossingEvent event{};
+    if (detector.Update(slope_per_tick * elapsed, ts, event)) {
+      if (crossing_count == 0) {
+        first_event = event;
+      }
+      ++crossing_count;
+    }
+  }
+  return crossing_count;
+}
+
+}  // namespace
+
+TEST_CASE("The CrossingDetector class") {
+  using Catch::Matchers::WithinAbs;
+
+  SECTION("The Update() method") {
+    SECTION("When a rising ramp of known slope crosses the threshold between two samples") {
+      SECTION("Should report a single rising crossing at the exact interpolated instant") {
+        CrossingDetector detector(100.0f, 90.0f);
+        CrossingEvent event{};
+
+        // 0.037 units/tick reaches 100 at t = 2702.7027 ticks.
+        const int crossing_count = FeedRamp(detector, 0.037f, 0u, 0u, 10u, event);
+
+        REQUIRE(crossing_count == 1);
+        REQUIRE(event.direction == CrossingDirection::kRising);
+        REQUIRE(event.time.ticks == 2702u);
+        const float instant = static_cast<float>(event.time.ticks) +
+                              static_cast<float>(event.time.fraction) / 65536.0f;
+        REQUIRE_THAT(instant, WithinAbs(2702.7027f, 0.01f));
+      }
+    }
+
+    SECTION("When two ramps of different slopes cross two positions") {
+      SECTION("Should measure the travel time far below the sample period resolution") {
+        constexpr float kSlopes[] = {0.011f, 0.0473f, 0.25f, 1.3f};
+        for (float slope : kSlopes) {
+          CrossingDetector first_position(50.0f, 40.0f);
+          CrossingDetector second_position(200.0f, 190.0f);
+          CrossingEvent first_event{};
+          CrossingEvent second_event{};
+          const std::uint32_t start_ticks = 123u;
+          const std::uint32_t sample_count =
+              static_cast<std::uint32_t>(250.0f / slope) / kSamplePeriodTicks + 3u;
+
+          REQUIRE(FeedRamp(first_position, slope, start_ticks, 0u, sample_count, first_event) == 1);
+          REQUIRE(FeedRamp(second_position, slope, start_ticks, 0u, sample_count, second_event) ==
+                  1);
+
+          const float expected_travel_ticks = 150.0f / slope;
+          REQUIRE_THAT(ElapsedTicks(first_event.time, second_event.time),
+                       WithinAbs(expected_travel_ticks, expected_travel_ticks * 1e-4f + 0.05f));
+        }
+      }
+    }
+
+    SECTION("When timestamps wrap around during the crossing") {
+      SECTION("Should interpolate across the wrap") {
+        CrossingDetector detector(100.0f, 90.0f);
+        CrossingEvent event{};
+        const std::uint32_t start_ticks = 0xFFFFF000u;
+
+        REQUIRE(FeedRamp(detector, 0.025f, start_ticks, start_ticks, 10u, event) == 1);
+
+        const CrossingTime origin{start_ticks, 0};
+        REQUIRE_THAT(ElapsedTicks(origin, event.time), WithinAbs(4000.0f, 0.01f));
+        REQUIRE(event.time.ticks == 0xFFFFF000u + 4000u);
+      }
+    }
+
+    SECTION("When the signal wobbles around the threshold within the hysteresis band") {
+      SECTION("Should report only one rising crossing") {
+        CrossingDetector detector(100.0f, 90.0f);
+        constexpr float kValues[] = {80.0f, 101.0f, 95.0f, 102.0f, 91.0f, 100.0f, 99.0f};
+        int crossing_count = 0;
+        std::uint32_t ts = 0;
+        for (float value : kValues) {
+          CrossingEvent event{};
+          if (detector.Update(value, ts, event)) {
+            ++crossing_count;
+          }
+          ts += kSamplePeriodTicks;
+        }
+
+        REQUIRE(crossing_count == 1);
+        REQUIRE(detector.is_high());
+      }
+    }
+
+    SECTION("When the signal drops below the falling threshold") {
+      SECTION("Should report a falling crossing interpolated on the falling threshold") {
+        CrossingDetector detector(100.0f, 90.0f);
+        CrossingEvent event{};
+        (void) detector.Update(120.0f, 0u, event);
+
+        REQUIRE_FALSE(detector.Update(95.0f, 1000u, event));
+        REQUIRE(detector.Update(75.0f, 2000u, event));
+
+        REQUIRE(event.direction == CrossingDirection::kFalling);
+        REQUIRE(event.time.ticks == 1250u);
+        REQUIRE(event.time.fraction == 0u);
+        REQUIRE_FALSE(detector.is_high());
+      }
+    }
+
+    SECTION("When the first sample is already above the rising threshold") {
+      SECTION("Should start high without reporting a crossing") {
+        CrossingDetector detector(100.0f, 90.0f);
+        CrossingEvent event{};
+
+        REQUIRE_FALSE(detector.Update(150.0f, 0u, event));
+        REQUIRE(detector.is_high());
+      }
+    }
+  }
+
+  SECTION("The Reset() method") {
+    SECTION("When called while high") {
+      SECTION("Should re-arm from the next sample") {
+        CrossingDetector detector(100.0f, 90.0f);
+        CrossingEvent event{};
+        (void) detector.Update(150.0f, 0u, event);
+
+        detector.Reset();
+
+        REQUIRE_FALSE(detector.Update(50.0f, 1000u, event));
+        REQUIRE(detector.Update(150.0f, 2000u, event));
+        REQUIRE(event.direction == CrossingDirection::kRising);
+        REQUIRE(event.time.ticks == 1500u);
+      }
+    }
+  }
+}
+
+#endif
@@ -34,6 +34,20 @@ TEST_CASE("The ContinuousPipeline class") {
     }
   }
 
+  SECTION("The stage() method") {
+    SECTION("When called with the type of a stage") {
+      SECTION("Should give read access to that stage") {
+        CounterStage::ResetCounts();
+        ContinuousPipeline<PlusTenStage, CounterStage> pipeline;
+
+        pipeline.Process(1.0f);
+        pipeline.Process(2.0f);
+
+        REQUIRE(pipeline.stage<CounterStage>().process_count == 2u);
+      }
+    }
+  }
+
   SECTION("The Reset() method") {
     CounterStage::ResetCounts();
     ContinuousPipeline<CounterStage> pipeline;
@@ -0,0 +1,134 @@
+#if defined(UNIT_TESTS)
+
+#include "domain/signal/processors/baseline_tracker.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <cstdint>
+
+namespace {
+
+constexpr float kRestLevel = 0.25f;
+constexpr float kStrikeDepth = 0.4f;
+constexpr float kToleranceMa = 1e-4f;
+constexpr std::uint32_t kRecoverySamples = 30000;
+
+using TestTracker = domain::signal::processors::BaselineTracker<1, 4096, 1, 100, kRecoverySamples>;
+
+}  // namespace
+
+TEST_CASE("The BaselineTracker class") {
+  using Catch::Matchers::WithinAbs;
+
+  SECTION("The Process() method") {
+    SECTION("When called with the first sample") {
+      SECTION("Should seed the baseline on it and output zero") {
+        TestTracker tracker;
+
+        REQUIRE_THAT(tracker.Process(kRestLevel), WithinAbs(0.0f, kToleranceMa));
+        REQUIRE(tracker.has_baseline());
+        REQUIRE_THAT(tracker.baseline(), WithinAbs(kRestLevel, kToleranceMa));
+      }
+    }
+
+    SECTION("When the resting level drifts slowly") {
+      SECTION("Should follow the drift and keep the output close to zero") {
+        TestTracker tracker;
+        constexpr std::uint32_t kSampleCount = 200'000u;
+        constexpr float kDriftPerSample = 0.1f / static_cast<float>(kSampleCount);
+
+        float level = kRestLevel;
+        float output = 0.0f;
+        for (std::uint32_t i = 0; i < kSampleCount; ++i) {
+          level += kDriftPerSample;
+          output = tracker.Process(level);
+          REQUIRE(output < 0.005f);
+        }
+
+        REQUIRE_THAT(tracker.baseline(), WithinAbs(level, 0.005f));
+        REQUIRE_THAT(output, WithinAbs(0.0f, 0.005f));
+      }
+    }
+
+    SECTION("When a key strike happens on top of the drifting rest level") {
+      SECTION("Should freeze the baseline during the strike and output the strike depth") {
+        TestTracker tracker;
+        float level = kRestLevel;
+        for (std::uint32_t i = 0; i < 20'000u; ++i) {
+          level += 1e-7f;
+          (void) tracker.Process(level);
+        }
+        const float baseline_before_strike = tracker.baseline();
+
+        for (std::uint32_t i = 0; i < 50u; ++i) {
+          const float travel = kStrikeDepth * static_cast<float>(i + 1u) / 50.0f;
+          (void) tracker.Process(level + travel);
+        }
+        for (std::uint32_t i = 0; i < 5'000u; ++i) {
+          REQUIRE_THAT(tracker.Process(level + kStrikeDepth), WithinAbs(kStrikeDepth, 0.002f));
+        }
+
+        REQUIRE_THAT(tracker.baseline(), WithinAbs(baseline_before_strike, 0.002f));
+        REQUIRE_THAT(tracker.Process(level), WithinAbs(0.0f, 0.002f));
+      }
+    }
+
+    SECTION("When the input drops below the baseline by more than the gate") {
+      SECTION("Should re-seed the baseline on the new resting level") {
+        TestTracker tracker;
+        (void) tracker.Process(kRestLevel);
+
+        REQUIRE_THAT(tracker.Process(kRestLevel - 0.05f), WithinAbs(0.0f, kToleranceMa));
+        REQUIRE_THAT(tracker.baseline(), WithinAbs(kRestLevel - 0.05f, kToleranceMa));
+      }
+    }
+
+    SECTION("When the resting level steps up beyond the gate and stays there") {
+      SECTION("Should re-seed the baseline after the recovery period") {
+        TestTracker tracker;
+        (void) tracker.Process(kRestLevel);
+        const float stepped_level = kRestLevel + 0.05f;
+
+        for (std::uint32_t i = 1; i < kRecoverySamples; ++i) {
+          const float jitter = (i & 1u) != 0u ? 0.002f : -0.002f;
+          REQUIRE_THAT(tracker.Process(stepped_level + jitter), WithinAbs(0.05f, 0.003f));
+        }
+        REQUIRE_THAT(tracker.Process(stepped_level), WithinAbs(0.0f, kToleranceMa));
+
+        REQUIRE_THAT(tracker.baseline(), WithinAbs(stepped_level, kToleranceMa));
+        REQUIRE_THAT(tracker.Process(stepped_level), WithinAbs(0.0f, kToleranceMa));
+      }
+    }
+
+    SECTION("When a key keeps moving above the gate for longer than the recovery period") {
+      SECTION("Should keep the baseline frozen") {
+        TestTracker tracker;
+        (void) tracker.Process(kRestLevel);
+
+        for (std::uint32_t i = 0; i < 3u * kRecoverySamples; ++i) {
+          const float travel = (i / 500u) % 2u == 0u ? kStrikeDepth : kStrikeDepth / 2.0f;
+          (void) tracker.Process(kRestLevel + travel);
+        }
+
+        REQUIRE_THAT(tracker.baseline(), WithinAbs(kRestLevel, kToleranceMa));
+      }
+    }
+  }
+
+  SECTION("The Reset() method") {
+    SECTION("When called after receiving samples") {
+      SECTION("Should forget the baseline and re-seed on the next sample") {
+        TestTracker tracker;
+        (void) tracker.Process(kRestLevel);
+
+        tracker.Reset();
+        REQUIRE_FALSE(tracker.has_baseline());
+
+        REQUIRE_THAT(tracker.Process(kRestLevel + kStrikeDepth), WithinAbs(0.0f, kToleranceMa));
+        REQUIRE_THAT(tracker.baseline(), WithinAbs(kRestLevel + kStrikeDepth, kToleranceMa));
+      }
+    }
+  }
+}
+
+#endif
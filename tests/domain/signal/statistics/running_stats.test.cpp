@@ -0,0 +1,124 @@
+#if defined(UNIT_TESTS)
+
+#include "domain/signal/statistics/running_stats.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <cstdint>
+
+TEST_CASE("The RunningStats class") {
+  using Catch::Matchers::WithinAbs;
+  using Catch::Matchers::WithinRel;
+
+  SECTION("The Update() method") {
+    SECTION("When called with a few samples") {
+      SECTION("Should compute count, mean, population variance, min, max and peak-to-peak") {
+        domain::signal::statistics::RunningStats stats;
+        const std::uint16_t samples[] = {2, 4, 4, 4, 5, 5, 7, 9};
+        for (std::uint16_t sample : samples) {
+          stats.Update(sample);
+        }
+
+        REQUIRE(stats.count() == 8u);
+        REQUIRE_THAT(stats.mean(), WithinAbs(5.0, 1e-12));
+        REQUIRE_THAT(stats.variance(), WithinAbs(4.0, 1e-12));
+        REQUIRE_THAT(stats.stddev(), WithinAbs(2.0, 1e-12));
+        REQUIRE(stats.min() == 2u);
+        REQUIRE(stats.max() == 9u);
+        REQUIRE(stats.peak_to_peak() == 7u);
+      }
+    }
+
+    SECTION("When called with a single sample") {
+      SECTION("Should report zero variance and equal min and max") {
+        domain::signal::statistics::RunningStats stats;
+        stats.Update(52000);
+
+        REQUIRE(stats.count() == 1u);
+        REQUIRE_THAT(stats.mean(), WithinAbs(52000.0, 1e-9));
+        REQUIRE(stats.variance() == 0.0);
+        REQUIRE(stats.min() == 52000u);
+        REQUIRE(stats.max() == 52000u);
+      }
+    }
+
+    SECTION("When fed millions of small noise samples on top of a large offset") {
+      SECTION("Should keep mean and variance exact") {
+        domain::signal::statistics::RunningStats stats;
+        constexpr std::uint32_t kSampleCount = 10'000'000u;
+        for (std::uint32_t i = 0; i < kSampleCount; ++i) {
+          stats.Update((i & 1u) != 0u ? 52001 : 52000);
+        }
+
+        REQUIRE(stats.count() == kSampleCount);
+        REQUIRE_THAT(stats.mean(), WithinAbs(52000.5, 1e-6));
+        REQUIRE_THAT(stats.variance(), WithinRel(0.25, 1e-6));
+        REQUIRE(stats.peak_to_peak() == 1u);
+      }
+
+      SECTION("Should match a two-pass reference computation") {
+        domain::signal::statistics::RunningStats stats;
+        constexpr std::uint32_t kSampleCount = 4'000'000u;
+        std::uint32_t noise_state = 0x12345678u;
+        auto next_sample = [&noise_state]() noexcept {
+          noise_state = noise_state * 1664525u + 1013904223u;
+          return static_cast<std::uint16_t>(51997u + (noise_state >> 29));
+        };
+
+        double sum = 0.0;
+        for (std::uint32_t i = 0; i < kSampleCount; ++i) {
+          const std::uint16_t sample = next_sample();
+          stats.Update(sample);
+          sum += static_cast<double>(sample);
+        }
+        const double reference_mean = sum / static_cast<double>(kSampleCount);
+
+        noise_state = 0x12345678u;
+        double squared_deviation_sum = 0.0;
+        for (std::uint32_t i = 0; i < kSampleCount; ++i) {
+          const double deviation = static_cast<double>(next_sample()) - reference_mean;
+          squared_deviation_sum += deviation * deviation;
+        }
+        const double reference_variance = squared_deviation_sum / static_cast<double>(kSampleCount);
+
+        REQUIRE_THAT(stats.mean(), WithinAbs(reference_mean, 1e-6));
+        REQUIRE_THAT(stats.variance(), WithinRel(reference_variance, 1e-6));
+        REQUIRE(stats.min() == 51997u);
+        REQUIRE(stats.max() == 52004u);
+      }
+    }
+
+    SECTION("When the samples move far from the first one") {
+      SECTION("Should keep the variance of the whole range") {
+        domain::signal::statistics::RunningStats stats;
+        stats.Update(0);
+        stats.Update(65535);
+
+        REQUIRE_THAT(stats.mean(), WithinAbs(32767.5, 1e-9));
+        REQUIRE_THAT(stats.variance(), WithinRel(32767.5 * 32767.5, 1e-12));
+        REQUIRE(stats.peak_to_peak() == 65535u);
+      }
+    }
+  }
+
+  SECTION("The Reset() method") {
+    SECTION("When called after receiving samples") {
+      SECTION("Should restart the accumulation from scratch") {
+        domain::signal::statistics::RunningStats stats;
+        stats.Update(100);
+        stats.Update(300);
+
+        stats.Reset();
+        stats.Update(10);
+
+        REQUIRE(stats.count() == 1u);
+        REQUIRE_THAT(stats.mean(), WithinAbs(10.0, 1e-12));
+        REQUIRE(stats.variance() == 0.0);
+        REQUIRE(stats.min() == 10u);
+        REQUIRE(stats.max() == 10u);
+      }
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,229 @@
+#if defined(UNIT_TESTS)
+
+#include "domain/telemetry/double_buffer_tx.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Stands in for the UART and its TX DMA: reads the submitted buffer in place, a few
+ * bytes per Tick(), and reports completion the way the interrupt does.
+ */
+template <std::size_t kBufferBytes>
+class FakeUart {
+ public:
+  explicit FakeUart(domain::telemetry::DoubleBufferTx<kBufferBytes>& tx) noexcept : tx_(tx) {}
+
+  // What the sender does after each write and from the transfer-complete interrupt.
+  void Kick() {
+    const std::uint8_t* data = nullptr;
+    std::size_t length = 0;
+    if (tx_.TakeSubmission(data, length)) {
+      REQUIRE(dma_data_ == nullptr);
+      dma_data_ = data;
+      dma_length_ = length;
+      dma_position_ = 0;
+      snapshot_.assign(data, data + length);
+    }
+  }
+
+  void Send(const std::vector<std::uint8_t>& bytes) {
+    (void) tx_.Write(bytes.data(), bytes.size());
+    Kick();
+  }
+
+  void Tick(std::size_t bytes_per_tick) {
+    if (dma_data_ == nullptr) {
+      return;
+    }
+    for (std::size_t i = 0; i < bytes_per_tick && dma_position_ < dma_length_; ++i) {
+      line.push_back(dma_data_[dma_position_++]);
+    }
+    if (dma_position_ == dma_length_) {
+      // The buffer must not have changed while the DMA owned it.
+      REQUIRE(std::vector<std::uint8_t>(dma_data_, dma_data_ + dma_length_) == snapshot_);
+      dma_data_ = nullptr;
+      tx_.OnTransferComplete();
+      Kick();
+    }
+  }
+
+  std::vector<std::uint8_t> line;
+
+ private:
+  domain::telemetry::DoubleBufferTx<kBufferBytes>& tx_;
+  const std::uint8_t* dma_data_ = nullptr;
+  std::size_t dma_length_ = 0;
+  std::size_t dma_position_ = 0;
+  std::vector<std::uint8_t> snapshot_;
+};
+
+std::vector<std::uint8_t> MakeFrame(std::uint8_t tag, std::size_t length) {
+  std::vector<std::uint8_t> frame(length);
+  for (std::size_t i = 0; i < length; ++i) {
+    frame[i] = static_cast<std::uint8_t>(tag + i);
+  }
+  return frame;
+}
+
+}  // namespace
+
+TEST_CASE("The DoubleBufferTx class", "[domain][telemetry]") {
+  SECTION("The Write() method") {
+    SECTION("When the transmitter is idle") {
+      SECTION("Should hand the written bytes to it at once") {
+        domain::telemetry::DoubleBufferTx<64> tx;
+        FakeUart<64> uart(tx);
+        uart.Send(MakeFrame(1, 10));
+
+        REQUIRE(tx.busy());
+        REQUIRE(tx.WritableBytes() == 64u);
+        uart.Tick(100);
+        REQUIRE(uart.line == MakeFrame(1, 10));
+        REQUIRE(tx.stats().sent_bytes == 10u);
+      }
+    }
+
+    SECTION("When a transfer is in flight") {
+      SECTION("Should fill the other buffer and send it next, in order") {
+        domain::telemetry::DoubleBufferTx<64> tx;
+        FakeUart<64> uart(tx);
+        uart.Send(MakeFrame(1, 10));
+        uart.Send(MakeFrame(20, 8));
+        uart.Send(MakeFrame(40, 8));
+
+        REQUIRE(tx.stats().submitted_buffers == 1u);
+        REQUIRE(tx.WritableBytes() == 48u);
+
+        uart.Tick(100);
+        REQUIRE(tx.stats().submitted_buffers == 2u);
+        uart.Tick(100);
+
+        std::vector<std::uint8_t> expected = MakeFrame(1, 10);
+        for (const auto& part : {MakeFrame(20, 8), MakeFrame(40, 8)}) {
+          expected.insert(expected.end(), part.begin(), part.end());
+        }
+        REQUIRE(uart.line == expected);
+      }
+    }
+
+    SECTION("When the data does not fit the fill buffer") {
+      SECTION("Should refuse it whole and count the overflow") {
+        domain::telemetry::DoubleBufferTx<16> tx;
+        FakeUart<16> uart(tx);
+        uart.Send(MakeFrame(1, 16));
+        uart.Send(MakeFrame(2, 12));
+        uart.Send(MakeFrame(3, 6));
+
+        REQUIRE(tx.stats().overflow_count == 1u);
+        REQUIRE(tx.stats().dropped_bytes == 6u);
+        REQUIRE(tx.WritableBytes() == 4u);
+
+        uart.Tick(100);
+        uart.Tick(100);
+        REQUIRE(uart.line.size() == 28u);
+      }
+    }
+  }
+
+  SECTION("The OnTransferComplete() method") {
+    SECTION("When nothing is queued behind the transfer") {
+      SECTION("Should let the line go idle without counting an underrun") {
+        domain::telemetry::DoubleBufferTx<32> tx;
+        FakeUart<32> uart(tx);
+        uart.Send(MakeFrame(1, 4));
+        uart.Tick(100);
+
+        REQUIRE_FALSE(tx.busy());
+        REQUIRE(tx.stats().underrun_count == 0u);
+      }
+    }
+
+    SECTION("When a write is still being copied in") {
+      SECTION("Should count an underrun and send the write once committed") {
+        domain::telemetry::DoubleBufferTx<32> tx;
+        FakeUart<32> uart(tx);
+        uart.Send(MakeFrame(1, 4));
+        std::uint8_t* space = tx.BeginWrite(3);
+        REQUIRE(space != nullptr);
+
+        uart.Tick(100);
+
+        REQUIRE_FALSE(tx.busy());
+        REQUIRE(tx.stats().underrun_count == 1u);
+
+        space[0] = 7;
+        space[1] = 8;
+        space[2] = 9;
+        tx.CommitWrite();
+        uart.Kick();
+        uart.Tick(100);
+
+        REQUIRE(uart.line == std::vector<std::uint8_t>{1, 2, 3, 4, 7, 8, 9});
+        REQUIRE(tx.stats().underrun_count == 1u);
+      }
+    }
+  }
+
+  SECTION("The BeginWrite() method") {
+    SECTION("While a write is open") {
+      domain::telemetry::DoubleBufferTx<32> tx;
+      REQUIRE(tx.BeginWrite(4) != nullptr);
+
+      SECTION("Should refuse another write and hold back the fill buffer") {
+        const std::uint8_t* submitted = nullptr;
+        std::size_t length = 0;
+
+        REQUIRE(tx.BeginWrite(2) == nullptr);
+        REQUIRE(tx.WritableBytes() == 0u);
+        REQUIRE_FALSE(tx.TakeSubmission(submitted, length));
+        REQUIRE(tx.stats().overflow_count == 1u);
+      }
+    }
+  }
+
+  SECTION("The AbortSubmission() method") {
+    SECTION("Should free the transmitter and count the bytes as dropped") {
+      domain::telemetry::DoubleBufferTx<32> tx;
+      const std::uint8_t data[5]{};
+      const std::uint8_t* submitted = nullptr;
+      std::size_t length = 0;
+      REQUIRE(tx.Write(data, sizeof(data)));
+      REQUIRE(tx.TakeSubmission(submitted, length));
+
+      tx.AbortSubmission();
+
+      REQUIRE_FALSE(tx.busy());
+      REQUIRE(tx.stats().dropped_bytes == 5u);
+    }
+  }
+
+  SECTION("When streaming frames to a line faster than the producer") {
+    SECTION("Should deliver every frame unchanged without overflow") {
+      domain::telemetry::DoubleBufferTx<256> tx;
+      FakeUart<256> uart(tx);
+      std::vector<std::uint8_t> expected;
+      for (std::uint32_t tick = 0; tick < 2000; ++tick) {
+        // A 61-byte scan frame per tick against a line moving 64 bytes per tick.
+        const std::vector<std::uint8_t> frame = MakeFrame(static_cast<std::uint8_t>(tick), 61);
+        if (tx.WritableBytes() >= frame.size()) {
+          expected.insert(expected.end(), frame.begin(), frame.end());
+        }
+        uart.Send(frame);
+        uart.Tick(64);
+      }
+      for (int i = 0; i < 10; ++i) {
+        uart.Tick(64);
+      }
+
+      REQUIRE(tx.stats().overflow_count == 0u);
+      REQUIRE(uart.line == expected);
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,112 @@
+#if defined(UNIT_TESTS)
+
+#include "domain/telemetry/live_snapshot.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace {
+
+using domain::telemetry::LiveSnapshot;
+using domain::telemetry::LiveSnapshotChannel;
+using domain::telemetry::LiveSnapshotPublisher;
+using domain::telemetry::LiveSnapshotSlot;
+
+std::uint32_t ReadU32(const std::uint8_t* data, std::size_t offset) {
+  std::uint32_t value = 0;
+  std::memcpy(&value, data + offset, sizeof(value));
+  return value;
+}
+
+void FillRamp(LiveSnapshotChannel* channels, std::uint16_t base) {
+  for (std::size_t i = 0; i < 3u; ++i) {
+    channels[i].raw = static_cast<std::uint16_t>(base + i);
+    channels[i].processed = static_cast<float>(base + i) * 0.5f;
+    channels[i].timestamp_ticks = base;
+  }
+}
+
+}  // namespace
+
+TEST_CASE("The LiveSnapshotPublisher class", "[domain][telemetry]") {
+  LiveSnapshot<3> snapshot;
+  std::memset(static_cast<void*>(&snapshot), 0xA5, sizeof(snapshot));
+  LiveSnapshotPublisher<3> publisher(snapshot, 1'000'000);
+  const auto* bytes = reinterpret_cast<const std::uint8_t*>(&snapshot);
+
+  SECTION("The constructor") {
+    SECTION("Should describe the layout in the header, whatever the memory held before") {
+      REQUIRE(ReadU32(bytes, 0) == domain::telemetry::kLiveSnapshotMagic);
+      REQUIRE(snapshot.version == domain::telemetry::kLiveSnapshotVersion);
+      REQUIRE(snapshot.header_bytes == 32u);
+      REQUIRE(snapshot.slot_bytes == 16u + 3u * 12u);
+      REQUIRE(snapshot.channel_count == 3u);
+      REQUIRE(snapshot.slot_count == 2u);
+      REQUIRE(ReadU32(bytes, 12) == 1'000'000u);
+      REQUIRE(ReadU32(bytes, 32) == 0u);
+      REQUIRE(snapshot.slots[1].channels[2].raw == 0u);
+    }
+  }
+
+  SECTION("The Publish() method") {
+    SECTION("Should alternate slots and point latest_slot at the one just written") {
+      publisher.Publish(1000, 0x7u, [](LiveSnapshotChannel* channels) { FillRamp(channels, 10); });
+      REQUIRE(ReadU32(bytes, 16) == 1u);
+      publisher.Publish(2000, 0x7u, [](LiveSnapshotChannel* channels) { FillRamp(channels, 20); });
+      REQUIRE(ReadU32(bytes, 16) == 0u);
+
+      const std::size_t slot0 = 32u;
+      REQUIRE(ReadU32(bytes, slot0) == 2u);
+      REQUIRE(ReadU32(bytes, slot0 + 4u) == 2000u);
+      REQUIRE(ReadU32(bytes, slot0 + 8u) == 2u);
+      REQUIRE(ReadU32(bytes, slot0 + 12u) == 0x7u);
+      REQUIRE(ReadU32(bytes, slot0 + 16u + 12u) == 21u);
+      REQUIRE(publisher.publish_count() == 2u);
+    }
+
+    SECTION("Should keep the sequence odd while the slot is being filled") {
+      std::uint32_t sequence_during_fill = 0;
+      publisher.Publish(1000, 0x7u, [&](LiveSnapshotChannel* channels) {
+        sequence_during_fill = snapshot.slots[1].sequence.load();
+        FillRamp(channels, 10);
+      });
+      REQUIRE(sequence_during_fill == 1u);
+      REQUIRE(snapshot.slots[1].sequence.load() == 2u);
+    }
+  }
+}
+
+TEST_CASE("The TryReadLiveSnapshot() function", "[domain][telemetry]") {
+  LiveSnapshot<3> snapshot;
+  LiveSnapshotSlot<3> out;
+
+  SECTION("When the snapshot was never initialized") {
+    SECTION("Should fail") {
+      REQUIRE_FALSE(domain::telemetry::TryReadLiveSnapshot(snapshot, out));
+    }
+  }
+
+  SECTION("When a publish has completed") {
+    LiveSnapshotPublisher<3> publisher(snapshot, 1'000'000);
+    publisher.Publish(1000, 0x5u, [](LiveSnapshotChannel* channels) { FillRamp(channels, 10); });
+    publisher.Publish(2000, 0x5u, [](LiveSnapshotChannel* channels) { FillRamp(channels, 20); });
+
+    SECTION("Should copy the latest slot") {
+      REQUIRE(domain::telemetry::TryReadLiveSnapshot(snapshot, out));
+      REQUIRE(out.timestamp_ticks == 2000u);
+      REQUIRE(out.publish_count == 2u);
+      REQUIRE(out.channel_mask == 0x5u);
+      REQUIRE(out.channels[2].raw == 22u);
+      REQUIRE(out.channels[2].processed == 11.0f);
+    }
+
+    SECTION("Should fail while the latest slot is being rewritten") {
+      snapshot.slots[0].sequence.fetch_add(1u);
+      REQUIRE_FALSE(domain::telemetry::TryReadLiveSnapshot(snapshot, out));
+    }
+  }
+}
+
+#endif
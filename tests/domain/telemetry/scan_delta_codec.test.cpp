@@ -0,0 +1,274 @@
+#if defined(UNIT_TESTS)
+
+#include "domain/telemetry/scan_delta_codec.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "domain/telemetry/sensor_scan_frame.hpp"
+#include "domain/telemetry/telemetry_frame.hpp"
+
+namespace {
+
+using domain::telemetry::ReadVarint;
+using domain::telemetry::ScanDeltaConfig;
+using domain::telemetry::ScanDeltaDecoder;
+using domain::telemetry::ScanDeltaEncoder;
+using domain::telemetry::ScanFrameSize;
+using domain::telemetry::SensorScanSample;
+using domain::telemetry::TelemetryFrameDecoder;
+using domain::telemetry::TelemetryFrameEncoder;
+using domain::telemetry::TelemetryFrameType;
+using domain::telemetry::TelemetryFrameView;
+using domain::telemetry::WriteVarint;
+using domain::telemetry::ZigZagDecode16;
+using domain::telemetry::ZigZagEncode16;
+
+// One acquisition scan of the 22 sensors, bit n-1 for sensor id n.
+constexpr std::uint32_t kScanMask = 0x003FFFFFu;
+
+/** @brief Resting keys with a few counts of noise; channel 5 is struck and released. */
+std::vector<SensorScanSample> MakeScans(std::size_t milliseconds) {
+  std::vector<SensorScanSample> scans;
+  std::uint32_t noise_state = 0x2468ACE1u;
+  for (std::size_t ms = 0; ms < milliseconds; ++ms) {
+    SensorScanSample sample{};
+    sample.timestamp_ticks = static_cast<std::uint32_t>(1000u * ms);
+    sample.channel_mask = kScanMask;
+    for (std::uint32_t bits = sample.channel_mask; bits != 0u; bits &= bits - 1u) {
+      noise_state = noise_state * 1664525u + 1013904223u;
+      std::int32_t level = 52000 + static_cast<std::int32_t>((noise_state >> 28) & 0x7u) - 3;
+      if ((bits & (0u - bits)) == 0x10u && ms >= 100u && ms < 400u) {
+        level -= ms < 120u ? static_cast<std::int32_t>(ms - 100u) * 1500 : 30000;
+      }
+      sample.values[sample.count++] = static_cast<std::uint16_t>(level);
+    }
+    scans.push_back(sample);
+  }
+  return scans;
+}
+
+class ScanSink {
+ public:
+  void OnScanSample(const SensorScanSample& sample) {
+    samples.push_back(sample);
+  }
+
+  std::vector<SensorScanSample> samples;
+};
+
+/** @brief Decodes the byte stream like the host does. */
+class StreamSink {
+ public:
+  void OnTelemetryFrame(const TelemetryFrameView& frame) {
+    decoder.Decode(frame, scans);
+  }
+
+  ScanDeltaDecoder decoder;
+  ScanSink scans;
+};
+
+/** @brief Encodes scans into framed blocks, skipping the frames listed in lost_frames. */
+std::vector<std::uint8_t> EncodeStream(const std::vector<SensorScanSample>& scans,
+                                       const ScanDeltaConfig& config,
+                                       const std::vector<std::size_t>& lost_frames = {}) {
+  ScanDeltaEncoder<> block(config);
+  TelemetryFrameEncoder frames;
+  std::vector<std::uint8_t> stream;
+  std::size_t frame_index = 0;
+  const auto flush = [&]() {
+    std::uint8_t frame[domain::telemetry::kTelemetryFrameOverheadBytes +
+                       domain::telemetry::kTelemetryMaxPayloadBytes]{};
+    const std::size_t size =
+        frames.Encode(TelemetryFrameType::kSensorScanDelta, block.first_timestamp_ticks(),
+                      block.data(), block.size(), frame, sizeof(frame));
+    REQUIRE(size != 0u);
+    bool lost = false;
+    for (const std::size_t index : lost_frames) {
+      lost = lost || index == frame_index;
+    }
+    if (!lost) {
+      stream.insert(stream.end(), frame, frame + size);
+    }
+    ++frame_index;
+    block.Clear();
+  };
+  for (const SensorScanSample& sample : scans) {
+    if (!block.Append(sample)) {
+      flush();
+      REQUIRE(block.Append(sample));
+    }
+  }
+  if (!block.empty()) {
+    flush();
+  }
+  return stream;
+}
+
+bool SameScan(const SensorScanSample& a, const SensorScanSample& b) {
+  if (a.timestamp_ticks != b.timestamp_ticks || a.channel_mask != b.channel_mask ||
+      a.count != b.count) {
+    return false;
+  }
+  for (std::size_t i = 0; i < a.count; ++i) {
+    if (a.values[i] != b.values[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+TEST_CASE("The scan delta varint helpers", "[domain][telemetry]") {
+  SECTION("The ZigZagEncode16() function") {
+    SECTION("Should map small magnitudes of either sign to small codes") {
+      REQUIRE(ZigZagEncode16(0) == 0u);
+      REQUIRE(ZigZagEncode16(-1) == 1u);
+      REQUIRE(ZigZagEncode16(1) == 2u);
+      REQUIRE(ZigZagEncode16(-32768) == 0xFFFFu);
+      for (std::int32_t value = -32768; value <= 32767; value += 7) {
+        const auto v = static_cast<std::int16_t>(value);
+        REQUIRE(ZigZagDecode16(ZigZagEncode16(v)) == v);
+      }
+    }
+  }
+
+  SECTION("The WriteVarint() and ReadVarint() functions") {
+    SECTION("Should round-trip with 7 bits per byte") {
+      std::uint8_t bytes[domain::telemetry::kVarintMaxBytes]{};
+      REQUIRE(WriteVarint(127u, bytes, sizeof(bytes)) == 1u);
+      REQUIRE(WriteVarint(128u, bytes, sizeof(bytes)) == 2u);
+      REQUIRE(WriteVarint(0xFFFFFFFFu, bytes, sizeof(bytes)) == 5u);
+
+      std::uint32_t value = 0;
+      REQUIRE(ReadVarint(bytes, sizeof(bytes), value) == 5u);
+      REQUIRE(value == 0xFFFFFFFFu);
+    }
+
+    SECTION("Should reject a truncated value or a short output") {
+      std::uint8_t bytes[2]{};
+      REQUIRE(WriteVarint(0x4000u, bytes, sizeof(bytes)) == 0u);
+      REQUIRE(WriteVarint(300u, bytes, sizeof(bytes)) == 2u);
+
+      std::uint32_t value = 0;
+      REQUIRE(ReadVarint(bytes, 1u, value) == 0u);
+    }
+  }
+}
+
+TEST_CASE("The ScanDeltaEncoder and ScanDeltaDecoder classes", "[domain][telemetry]") {
+  const std::vector<SensorScanSample> scans = MakeScans(1000);
+  ScanDeltaConfig config{};
+  config.keyframe_interval = 100;
+
+  SECTION("When every frame arrives") {
+    const std::vector<std::uint8_t> stream = EncodeStream(scans, config);
+    TelemetryFrameDecoder<> frames;
+    StreamSink sink;
+    frames.Feed(stream.data(), stream.size(), sink);
+
+    SECTION("Should reproduce every scan exactly") {
+      REQUIRE(sink.scans.samples.size() == scans.size());
+      for (std::size_t i = 0; i < scans.size(); ++i) {
+        REQUIRE(SameScan(sink.scans.samples[i], scans[i]));
+      }
+      REQUIRE(sink.decoder.stats().unreferenced_record_count == 0u);
+      REQUIRE(sink.decoder.stats().malformed_frame_count == 0u);
+    }
+
+    SECTION("Should take less than half the bytes of one scan frame per scan") {
+      std::size_t uncompressed = 0;
+      for (const SensorScanSample& sample : scans) {
+        uncompressed +=
+            domain::telemetry::kTelemetryFrameOverheadBytes + ScanFrameSize(sample.channel_mask);
+      }
+      REQUIRE(stream.size() * 2u < uncompressed);
+    }
+  }
+
+  SECTION("When a frame is lost") {
+    const std::vector<std::uint8_t> stream = EncodeStream(scans, config, {3});
+    TelemetryFrameDecoder<> frames;
+    StreamSink sink;
+    frames.Feed(stream.data(), stream.size(), sink);
+
+    SECTION("Should skip delta records until key records restore each channel") {
+      REQUIRE(sink.decoder.stats().unreferenced_record_count > 0u);
+      // Every channel is keyed again within keyframe_interval + 1 of its records.
+      REQUIRE(sink.decoder.stats().unreferenced_record_count <= config.keyframe_interval + 1u);
+      REQUIRE(SameScan(sink.scans.samples.back(), scans.back()));
+    }
+
+    SECTION("Should deliver the surviving records with their original values") {
+      std::size_t next = 0;
+      for (const SensorScanSample& decoded : sink.scans.samples) {
+        while (next < scans.size() && scans[next].timestamp_ticks != decoded.timestamp_ticks) {
+          ++next;
+        }
+        REQUIRE(next < scans.size());
+        REQUIRE(SameScan(decoded, scans[next]));
+      }
+    }
+  }
+
+  SECTION("The Append() method") {
+    SECTION("Should refuse a record that does not fit and leave the block unchanged") {
+      ScanDeltaEncoder<64> block(config);
+      REQUIRE(block.Append(scans[0]));
+      const std::size_t size = block.size();
+      REQUIRE_FALSE(block.Append(scans[1]));
+      REQUIRE(block.size() == size);
+      REQUIRE(block.record_count() == 1u);
+    }
+
+    SECTION("Should key a channel again after keyframe_interval records") {
+      ScanDeltaConfig short_interval{};
+      short_interval.keyframe_interval = 2;
+      ScanDeltaEncoder<> block(short_interval);
+      std::vector<std::uint8_t> headers;
+      for (std::size_t i = 0; i < 4u; ++i) {
+        const std::size_t offset = block.size();
+        REQUIRE(block.Append(scans[i]));
+        headers.push_back(block.data()[offset]);
+      }
+      REQUIRE((headers[0] & domain::telemetry::kScanDeltaKeyFlag) != 0u);
+      REQUIRE((headers[1] & domain::telemetry::kScanDeltaKeyFlag) == 0u);
+      REQUIRE((headers[2] & domain::telemetry::kScanDeltaKeyFlag) == 0u);
+      REQUIRE((headers[3] & domain::telemetry::kScanDeltaKeyFlag) != 0u);
+    }
+  }
+
+  SECTION("The Reset() method") {
+    SECTION("Should make the next record a key record") {
+      ScanDeltaEncoder<> block(config);
+      REQUIRE(block.Append(scans[0]));
+      block.Reset();
+      REQUIRE(block.empty());
+      REQUIRE(block.Append(scans[1]));
+      REQUIRE((block.data()[0] & domain::telemetry::kScanDeltaKeyFlag) != 0u);
+    }
+  }
+
+  SECTION("The Decode() method") {
+    SECTION("When a block references an unknown mask slot") {
+      SECTION("Should count it as malformed") {
+        const std::uint8_t payload[] = {0x05u, 0x00u};
+        TelemetryFrameView frame{};
+        frame.type = TelemetryFrameType::kSensorScanDelta;
+        frame.payload = payload;
+        frame.payload_length = sizeof(payload);
+        ScanDeltaDecoder decoder;
+        ScanSink sink;
+
+        REQUIRE_FALSE(decoder.Decode(frame, sink));
+        REQUIRE(decoder.stats().malformed_frame_count == 1u);
+        REQUIRE(sink.samples.empty());
+      }
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,154 @@
+#if defined(UNIT_TESTS)
+
+#include "domain/telemetry/scan_envelope.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+using domain::telemetry::ScanEnvelope;
+using domain::telemetry::ScanEnvelopeAccumulator;
+using domain::telemetry::ScanEnvelopeFrameBuilder;
+
+std::uint16_t ReadU16(const std::uint8_t* data, std::size_t offset) {
+  return static_cast<std::uint16_t>(data[offset] | (data[offset + 1u] << 8u));
+}
+
+std::uint32_t ReadU32(const std::uint8_t* data, std::size_t offset) {
+  return static_cast<std::uint32_t>(ReadU16(data, offset)) |
+         (static_cast<std::uint32_t>(ReadU16(data, offset + 2u)) << 16u);
+}
+
+}  // namespace
+
+TEST_CASE("The ScanEnvelopeAccumulator class", "[domain][telemetry]") {
+  ScanEnvelopeAccumulator<4> accumulator;
+  accumulator.Reset(10000);
+
+  SECTION("The Advance() method") {
+    SECTION("When samples stay within one period") {
+      SECTION("Should keep the envelope open") {
+        REQUIRE_FALSE(accumulator.Advance(0));
+        accumulator.Add(0, 5);
+        REQUIRE_FALSE(accumulator.Advance(9999));
+        accumulator.Add(0, 7);
+
+        REQUIRE(accumulator.current().count[0] == 2u);
+        REQUIRE(accumulator.current().last_timestamp_ticks == 9999u);
+      }
+    }
+
+    SECTION("When a sample reaches the end of the period") {
+      SECTION("Should close the envelope and start the next one with that sample") {
+        (void) accumulator.Advance(100);
+        accumulator.Add(1, 40);
+        accumulator.Add(1, -3);
+        accumulator.Add(1, 12);
+        (void) accumulator.Advance(9000);
+
+        REQUIRE(accumulator.Advance(10100));
+        accumulator.Add(1, 8);
+
+        const ScanEnvelope<4>& closed = accumulator.closed();
+        REQUIRE(closed.first_timestamp_ticks == 100u);
+        REQUIRE(closed.last_timestamp_ticks == 9000u);
+        REQUIRE(closed.channel_mask == 0x2u);
+        REQUIRE(closed.min[1] == -3);
+        REQUIRE(closed.max[1] == 40);
+        REQUIRE(closed.mean(1) == 16);
+        REQUIRE(accumulator.current().first_timestamp_ticks == 10100u);
+        REQUIRE(accumulator.current().count[1] == 1u);
+      }
+    }
+
+    SECTION("When the timestamp counter wraps") {
+      SECTION("Should still close after one period") {
+        (void) accumulator.Advance(0xFFFFF000u);
+        REQUIRE_FALSE(accumulator.Advance(0x00000100u));
+        REQUIRE(accumulator.Advance(0xFFFFF000u + 10000u));
+      }
+    }
+  }
+
+  SECTION("The Reset() method") {
+    SECTION("Should drop the open envelope") {
+      (void) accumulator.Advance(0);
+      accumulator.Add(0, 1);
+      accumulator.Reset(10000);
+
+      REQUIRE_FALSE(accumulator.Advance(20000));
+      REQUIRE(accumulator.current().channel_mask == 0u);
+      REQUIRE(accumulator.current().first_timestamp_ticks == 20000u);
+    }
+  }
+
+  SECTION("When a 1 kHz signal is decimated to 100 Hz") {
+    // 1 ms samples of a 300 Hz sine plus a single-sample spike no 100 Hz poll would land on.
+    ScanEnvelopeAccumulator<1> decimator;
+    decimator.Reset(10000);
+    std::vector<ScanEnvelope<1>> envelopes;
+    constexpr std::uint32_t kSpikeAt = 137;
+    for (std::uint32_t sample = 0; sample <= 200u; ++sample) {
+      if (decimator.Advance(sample * 1000u)) {
+        envelopes.push_back(decimator.closed());
+      }
+      const double phase = 2.0 * 3.14159265358979 * 300.0 * sample / 1000.0;
+      std::int32_t value = 2000 + static_cast<std::int32_t>(std::lround(1000.0 * std::sin(phase)));
+      if (sample == kSpikeAt) {
+        value = 9000;
+      }
+      decimator.Add(0, value);
+    }
+
+    SECTION("Should emit one envelope per period covering every sample") {
+      REQUIRE(envelopes.size() == 20u);
+      for (const ScanEnvelope<1>& envelope : envelopes) {
+        REQUIRE(envelope.count[0] == 10u);
+        REQUIRE(envelope.max[0] - envelope.min[0] > 1500);
+      }
+    }
+
+    SECTION("Should keep the spike in its period's maximum") {
+      REQUIRE(envelopes[kSpikeAt / 10u].max[0] == 9000);
+      REQUIRE(envelopes[kSpikeAt / 10u - 1u].max[0] < 3100);
+    }
+  }
+}
+
+TEST_CASE("The ScanEnvelopeFrameBuilder class", "[domain][telemetry]") {
+  SECTION("The Build() method") {
+    SECTION("Should pack the observed channels in ascending id order") {
+      ScanEnvelopeAccumulator<4> accumulator;
+      accumulator.Reset(10000);
+      (void) accumulator.Advance(1000);
+      accumulator.Add(0, 100);
+      accumulator.Add(2, -250);
+      accumulator.Add(2, 250);
+      (void) accumulator.Advance(1900);
+      accumulator.Add(0, 300);
+      accumulator.Add(2, 0);
+
+      ScanEnvelopeFrameBuilder builder;
+      builder.Build(accumulator.current());
+
+      const std::uint8_t* data = builder.data();
+      REQUIRE(builder.size() == domain::telemetry::kScanEnvelopeHeaderBytes +
+                                    2u * domain::telemetry::kScanEnvelopeChannelBytes);
+      REQUIRE(ReadU32(data, 0) == 0x5u);
+      REQUIRE(ReadU32(data, 4) == 900u);
+      REQUIRE(ReadU16(data, 8) == 3u);
+      REQUIRE(ReadU16(data, 10) == 100u);
+      REQUIRE(ReadU16(data, 12) == 300u);
+      REQUIRE(ReadU16(data, 14) == 200u);
+      REQUIRE(static_cast<std::int16_t>(ReadU16(data, 16)) == -250);
+      REQUIRE(ReadU16(data, 18) == 250u);
+      REQUIRE(ReadU16(data, 20) == 0u);
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,82 @@
+#if defined(UNIT_TESTS)
+
+#include "domain/telemetry/sensor_scan_frame.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace {
+
+using domain::telemetry::ScaleProcessedValue;
+using domain::telemetry::ScanFrameSize;
+using domain::telemetry::SensorScanFrameBuilder;
+
+std::uint32_t ReadU32(const std::uint8_t* bytes) {
+  return static_cast<std::uint32_t>(bytes[0]) | (static_cast<std::uint32_t>(bytes[1]) << 8u) |
+         (static_cast<std::uint32_t>(bytes[2]) << 16u) |
+         (static_cast<std::uint32_t>(bytes[3]) << 24u);
+}
+
+std::uint16_t ReadU16(const std::uint8_t* bytes) {
+  return static_cast<std::uint16_t>(bytes[0] | (bytes[1] << 8u));
+}
+
+}  // namespace
+
+TEST_CASE("The SensorScanFrameBuilder class", "[domain][telemetry]") {
+  SECTION("The Begin() and Append() methods") {
+    SECTION("Should write the mask and values little endian") {
+      SensorScanFrameBuilder builder;
+      builder.Begin(0x80000005u);
+      builder.Append(std::uint16_t{0x0ABC});
+      builder.Append(std::int16_t{-2});
+
+      REQUIRE(builder.size() == ScanFrameSize(0x5u));
+      REQUIRE(ReadU32(builder.data()) == 0x80000005u);
+      REQUIRE(ReadU16(builder.data() + 4) == 0x0ABCu);
+      REQUIRE(ReadU16(builder.data() + 6) == 0xFFFEu);
+    }
+
+    SECTION("When all 22 keys are selected") {
+      SECTION("Should pack them into 48 bytes") {
+        constexpr std::uint32_t kMask = (1u << 22u) - 1u;
+        SensorScanFrameBuilder builder;
+        builder.Begin(kMask);
+        for (std::uint16_t i = 0; i < 22u; ++i) {
+          builder.Append(i);
+        }
+
+        REQUIRE(builder.size() == 48u);
+        REQUIRE(ScanFrameSize(kMask) == 48u);
+        REQUIRE(ReadU16(builder.data() + 4 + 2 * 21) == 21u);
+      }
+    }
+
+    SECTION("When Begin() is called again") {
+      SECTION("Should start a new frame") {
+        SensorScanFrameBuilder builder;
+        builder.Begin(0x1u);
+        builder.Append(std::uint16_t{7});
+        builder.Begin(0x2u);
+
+        REQUIRE(builder.size() == domain::telemetry::kScanFrameHeaderBytes);
+        REQUIRE(ReadU32(builder.data()) == 2u);
+      }
+    }
+  }
+
+  SECTION("The ScaleProcessedValue() function") {
+    SECTION("Should round milliamps to microamps") {
+      REQUIRE(ScaleProcessedValue(1.2344f) == 1234);
+      REQUIRE(ScaleProcessedValue(-0.0016f) == -2);
+    }
+
+    SECTION("Should saturate out-of-range values") {
+      REQUIRE(ScaleProcessedValue(40.0f) == 32767);
+      REQUIRE(ScaleProcessedValue(-40.0f) == -32768);
+    }
+  }
+}
+
+#endif
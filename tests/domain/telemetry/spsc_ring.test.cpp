@@ -0,0 +1,103 @@
+#if defined(UNIT_TESTS)
+
+#include "domain/telemetry/spsc_ring.hpp"
+
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <thread>
+
+namespace {
+
+using domain::telemetry::SpscRing;
+
+struct Record {
+  std::uint32_t sequence = 0;
+  std::uint32_t check = 0;
+};
+
+}  // namespace
+
+TEST_CASE("The SpscRing class", "[domain][telemetry]") {
+  SECTION("The TryPush() method") {
+    SECTION("When the ring is full") {
+      SECTION("Should reject the record and count the drop") {
+        SpscRing<Record, 2> ring;
+        REQUIRE(ring.TryPush(Record{1, 0}));
+        REQUIRE(ring.TryPush(Record{2, 0}));
+        REQUIRE_FALSE(ring.TryPush(Record{3, 0}));
+
+        REQUIRE(ring.size() == 2u);
+        REQUIRE(ring.dropped_count() == 1u);
+      }
+
+      SECTION("Should keep the records already queued") {
+        SpscRing<Record, 2> ring;
+        ring.TryPush(Record{1, 0});
+        ring.TryPush(Record{2, 0});
+        ring.TryPush(Record{3, 0});
+
+        Record out{};
+        REQUIRE(ring.TryPop(out));
+        REQUIRE(out.sequence == 1u);
+        REQUIRE(ring.TryPop(out));
+        REQUIRE(out.sequence == 2u);
+        REQUIRE_FALSE(ring.TryPop(out));
+      }
+    }
+  }
+
+  SECTION("The Peek() method") {
+    SECTION("Should return the oldest record without consuming it") {
+      SpscRing<Record, 4> ring;
+      ring.TryPush(Record{7, 0});
+
+      Record out{};
+      REQUIRE(ring.Peek(out));
+      REQUIRE(ring.Peek(out));
+      REQUIRE(out.sequence == 7u);
+      REQUIRE(ring.size() == 1u);
+
+      ring.Pop();
+      REQUIRE(ring.size() == 0u);
+      REQUIRE_FALSE(ring.Peek(out));
+    }
+  }
+
+  SECTION("When a producer and a consumer run concurrently") {
+    SECTION("Should deliver every accepted record once, in order and intact") {
+      constexpr std::uint32_t kRecords = 200000;
+      SpscRing<Record, 64> ring;
+      std::atomic<bool> done{false};
+
+      std::thread producer([&ring, &done] {
+        for (std::uint32_t i = 1; i <= kRecords; ++i) {
+          ring.TryPush(Record{i, ~i});
+        }
+        done.store(true, std::memory_order_release);
+      });
+
+      std::uint32_t received = 0;
+      std::uint32_t last_sequence = 0;
+      bool ordered = true;
+      for (;;) {
+        Record out{};
+        if (ring.TryPop(out)) {
+          ordered = ordered && out.sequence > last_sequence && out.check == ~out.sequence;
+          last_sequence = out.sequence;
+          ++received;
+          continue;
+        }
+        if (done.load(std::memory_order_acquire) && ring.size() == 0u) {
+          break;
+        }
+      }
+      producer.join();
+
+      REQUIRE(ordered);
+      REQUIRE(received + ring.dropped_count() == kRecords);
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,255 @@
+#if defined(UNIT_TESTS)
+
+#include "domain/telemetry/telemetry_frame.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+using domain::telemetry::TelemetryFrameDecoder;
+using domain::telemetry::TelemetryFrameEncoder;
+using domain::telemetry::TelemetryFrameType;
+using domain::telemetry::TelemetryFrameView;
+
+struct DecodedFrame {
+  TelemetryFrameType type = TelemetryFrameType::kSensorValue;
+  std::uint16_t sequence = 0;
+  std::uint32_t timestamp_ticks = 0;
+  std::vector<std::uint8_t> payload;
+};
+
+class FrameSink {
+ public:
+  void OnTelemetryFrame(const TelemetryFrameView& view) {
+    frames.push_back(DecodedFrame{view.type, view.sequence, view.timestamp_ticks,
+                                  std::vector<std::uint8_t>(view.payload,
+                                                            view.payload + view.payload_length)});
+  }
+
+  std::vector<DecodedFrame> frames;
+};
+
+std::vector<std::uint8_t> EncodeFrame(TelemetryFrameEncoder& encoder, TelemetryFrameType type,
+                                      std::uint32_t timestamp_ticks,
+                                      const std::vector<std::uint8_t>& payload) {
+  std::vector<std::uint8_t> frame(domain::telemetry::kTelemetryFrameOverheadBytes +
+                                  payload.size());
+  const std::size_t size = encoder.Encode(type, timestamp_ticks, payload.data(), payload.size(),
+                                          frame.data(), frame.size());
+  frame.resize(size);
+  return frame;
+}
+
+void Append(std::vector<std::uint8_t>& stream, const std::vector<std::uint8_t>& bytes) {
+  stream.insert(stream.end(), bytes.begin(), bytes.end());
+}
+
+std::vector<std::uint8_t> MakePayload(std::size_t length, std::uint8_t seed) {
+  std::vector<std::uint8_t> payload(length);
+  for (std::size_t i = 0; i < length; ++i) {
+    payload[i] = static_cast<std::uint8_t>(seed + i * 7u);
+  }
+  return payload;
+}
+
+}  // namespace
+
+TEST_CASE("The Crc16() function", "[domain][telemetry]") {
+  SECTION("Should match the CRC-16/CCITT-FALSE check value") {
+    const std::uint8_t kCheck[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+    REQUIRE(domain::telemetry::Crc16(kCheck, sizeof(kCheck)) == 0x29B1u);
+  }
+}
+
+TEST_CASE("The TelemetryFrameEncoder class", "[domain][telemetry]") {
+  SECTION("The Encode() method") {
+    SECTION("Should write the header fields little endian and count the sequence") {
+      TelemetryFrameEncoder encoder;
+      const std::vector<std::uint8_t> payload = {1, 2, 3};
+      EncodeFrame(encoder, TelemetryFrameType::kSensorScan, 0, payload);
+      const std::vector<std::uint8_t> frame =
+          EncodeFrame(encoder, TelemetryFrameType::kSensorScan, 0x11223344u, payload);
+
+      REQUIRE(frame.size() == 16u);
+      REQUIRE(frame[0] == 0xA5u);
+      REQUIRE(frame[1] == 0x5Au);
+      REQUIRE(frame[2] == 2u);
+      REQUIRE(frame[3] == 1u);
+      REQUIRE(frame[4] == 0u);
+      REQUIRE(frame[5] == 0x44u);
+      REQUIRE(frame[8] == 0x11u);
+      REQUIRE(frame[9] == 3u);
+      REQUIRE(frame[10] == 0u);
+      REQUIRE(encoder.next_sequence() == 2u);
+    }
+
+    SECTION("When the frame does not fit the output") {
+      SECTION("Should write nothing and keep the sequence") {
+        TelemetryFrameEncoder encoder;
+        const std::uint8_t payload[4] = {};
+        std::uint8_t out[16] = {};
+        REQUIRE(encoder.Encode(TelemetryFrameType::kSensorValue, 0, payload, sizeof(payload), out,
+                               sizeof(out)) == 0u);
+        REQUIRE(encoder.next_sequence() == 0u);
+      }
+    }
+  }
+}
+
+TEST_CASE("The TelemetryFrameDecoder class", "[domain][telemetry]") {
+  TelemetryFrameEncoder encoder;
+  TelemetryFrameDecoder<> decoder;
+  FrameSink sink;
+
+  SECTION("The Feed() method") {
+    SECTION("When frames of mixed types arrive in arbitrary chunks") {
+      SECTION("Should decode each one intact") {
+        std::vector<std::uint8_t> stream;
+        Append(stream, EncodeFrame(encoder, TelemetryFrameType::kSensorValue, 10,
+                                   MakePayload(5, 1)));
+        Append(stream, EncodeFrame(encoder, TelemetryFrameType::kSensorScan, 20,
+                                   MakePayload(48, 2)));
+        Append(stream, EncodeFrame(encoder, TelemetryFrameType::kSensorValue, 30, {}));
+
+        for (std::size_t offset = 0; offset < stream.size(); offset += 7u) {
+          const std::size_t chunk = stream.size() - offset < 7u ? stream.size() - offset : 7u;
+          decoder.Feed(stream.data() + offset, chunk, sink);
+        }
+
+        REQUIRE(sink.frames.size() == 3u);
+        REQUIRE(sink.frames[0].type == TelemetryFrameType::kSensorValue);
+        REQUIRE(sink.frames[0].payload == MakePayload(5, 1));
+        REQUIRE(sink.frames[1].type == TelemetryFrameType::kSensorScan);
+        REQUIRE(sink.frames[1].timestamp_ticks == 20u);
+        REQUIRE(sink.frames[1].payload == MakePayload(48, 2));
+        REQUIRE(sink.frames[2].payload.empty());
+        REQUIRE(decoder.stats().lost_frame_count == 0u);
+        REQUIRE(decoder.stats().skipped_byte_count == 0u);
+      }
+    }
+
+    SECTION("When the stream starts mid-frame") {
+      SECTION("Should resynchronize on the next frame") {
+        std::vector<std::uint8_t> stream =
+            EncodeFrame(encoder, TelemetryFrameType::kSensorScan, 1, MakePayload(20, 3));
+        stream.erase(stream.begin(), stream.begin() + 6);
+        Append(stream, EncodeFrame(encoder, TelemetryFrameType::kSensorScan, 2,
+                                   MakePayload(20, 4)));
+
+        decoder.Feed(stream.data(), stream.size(), sink);
+
+        REQUIRE(sink.frames.size() == 1u);
+        REQUIRE(sink.frames[0].timestamp_ticks == 2u);
+        REQUIRE(decoder.stats().skipped_byte_count == 27u);
+      }
+    }
+
+    SECTION("When a byte of a frame is corrupted") {
+      SECTION("Should drop that frame, count the CRC error and the lost sequence") {
+        std::vector<std::uint8_t> stream;
+        Append(stream, EncodeFrame(encoder, TelemetryFrameType::kSensorScan, 1,
+                                   MakePayload(12, 5)));
+        std::vector<std::uint8_t> damaged =
+            EncodeFrame(encoder, TelemetryFrameType::kSensorScan, 2, MakePayload(12, 6));
+        damaged[15] ^= 0x10u;
+        Append(stream, damaged);
+        Append(stream, EncodeFrame(encoder, TelemetryFrameType::kSensorScan, 3,
+                                   MakePayload(12, 7)));
+
+        decoder.Feed(stream.data(), stream.size(), sink);
+
+        REQUIRE(sink.frames.size() == 2u);
+        REQUIRE(sink.frames[0].timestamp_ticks == 1u);
+        REQUIRE(sink.frames[1].timestamp_ticks == 3u);
+        REQUIRE(decoder.stats().crc_error_count == 1u);
+        REQUIRE(decoder.stats().lost_frame_count == 1u);
+      }
+    }
+
+    SECTION("When a frame is truncated by a skipped write") {
+      SECTION("Should find the frames that follow it once its announced length has arrived") {
+        std::vector<std::uint8_t> stream;
+        std::vector<std::uint8_t> truncated =
+            EncodeFrame(encoder, TelemetryFrameType::kSensorScan, 1, MakePayload(40, 8));
+        truncated.resize(20);
+        Append(stream, truncated);
+        Append(stream, EncodeFrame(encoder, TelemetryFrameType::kSensorValue, 2,
+                                   MakePayload(5, 9)));
+
+        decoder.Feed(stream.data(), stream.size(), sink);
+        REQUIRE(sink.frames.empty());
+
+        const std::vector<std::uint8_t> next =
+            EncodeFrame(encoder, TelemetryFrameType::kSensorScan, 3, MakePayload(30, 10));
+        decoder.Feed(next.data(), next.size(), sink);
+
+        REQUIRE(sink.frames.size() == 2u);
+        REQUIRE(sink.frames[0].type == TelemetryFrameType::kSensorValue);
+        REQUIRE(sink.frames[0].payload == MakePayload(5, 9));
+        REQUIRE(sink.frames[1].timestamp_ticks == 3u);
+        REQUIRE(decoder.stats().crc_error_count == 1u);
+      }
+    }
+
+    SECTION("When the encoder's frames are skipped by the link") {
+      SECTION("Should count the gap in sequence numbers, across the wrap") {
+        for (int i = 0; i < 65534; ++i) {
+          EncodeFrame(encoder, TelemetryFrameType::kSensorValue, 0, {});
+        }
+        std::vector<std::uint8_t> stream =
+            EncodeFrame(encoder, TelemetryFrameType::kSensorValue, 0, {});
+        for (int i = 0; i < 3; ++i) {
+          EncodeFrame(encoder, TelemetryFrameType::kSensorValue, 0, {});
+        }
+        Append(stream, EncodeFrame(encoder, TelemetryFrameType::kSensorValue, 0, {}));
+
+        decoder.Feed(stream.data(), stream.size(), sink);
+
+        REQUIRE(sink.frames.size() == 2u);
+        REQUIRE(sink.frames[0].sequence == 65534u);
+        REQUIRE(sink.frames[1].sequence == 2u);
+        REQUIRE(decoder.stats().lost_frame_count == 3u);
+      }
+    }
+
+    SECTION("When a header announces an oversized payload") {
+      SECTION("Should treat it as noise instead of waiting for the bytes") {
+        std::vector<std::uint8_t> stream = {0xA5, 0x5A, 1, 0, 0, 0, 0, 0, 0, 0xFF, 0xFF};
+        Append(stream, EncodeFrame(encoder, TelemetryFrameType::kSensorValue, 7,
+                                   MakePayload(5, 1)));
+
+        decoder.Feed(stream.data(), stream.size(), sink);
+
+        REQUIRE(sink.frames.size() == 1u);
+        REQUIRE(sink.frames[0].timestamp_ticks == 7u);
+      }
+    }
+
+    SECTION("When random noise is interleaved with frames") {
+      SECTION("Should recover every intact frame") {
+        std::vector<std::uint8_t> stream;
+        std::uint32_t noise = 0x12345678u;
+        for (std::uint32_t i = 0; i < 200u; ++i) {
+          Append(stream, EncodeFrame(encoder, TelemetryFrameType::kSensorScan, i,
+                                     MakePayload(i % 50u, static_cast<std::uint8_t>(i))));
+          for (std::uint32_t n = 0; n < i % 5u; ++n) {
+            noise = noise * 1664525u + 1013904223u;
+            stream.push_back(static_cast<std::uint8_t>(noise >> 24u));
+          }
+        }
+
+        decoder.Feed(stream.data(), stream.size(), sink);
+
+        REQUIRE(sink.frames.size() == 200u);
+        for (std::uint32_t i = 0; i < 200u; ++i) {
+          REQUIRE(sink.frames[i].timestamp_ticks == i);
+        }
+      }
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,147 @@
+#if defined(UNIT_TESTS)
+
+#include "domain/telemetry/telemetry_rate_controller.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace {
+
+using domain::telemetry::TelemetryRateController;
+using domain::telemetry::TelemetryRateControllerConfig;
+
+constexpr std::size_t kCapacity = 4096;
+
+/**
+ * @brief A 4 KB up-buffer between the telemetry task and a host reading consume_per_ms bytes
+ * each millisecond. Frames that do not fit are lost, as with the sample ring in front of RTT.
+ * Level n produces the bytes/ms of full scans, delta blocks, then envelopes every 10, 50, 250
+ * and 1000 ms for 22 channels.
+ */
+class SimulatedLink {
+ public:
+  static constexpr std::uint32_t kMilliBytesPerMs[] = {100000, 40000, 15500, 3100, 620, 155};
+
+  void Run(TelemetryRateController& controller, std::uint32_t duration_ms) {
+    for (std::uint32_t ms = 0; ms < duration_ms; ++ms) {
+      pending_milli_bytes += kMilliBytesPerMs[controller.level()];
+      const std::size_t bytes = pending_milli_bytes / 1000u;
+      pending_milli_bytes %= 1000u;
+      if (used + bytes <= kCapacity) {
+        used += bytes;
+      } else {
+        ++lost;
+      }
+      used = used > consume_per_ms ? used - consume_per_ms : 0u;
+      (void) controller.Update(1, used, kCapacity, lost);
+    }
+  }
+
+  std::size_t consume_per_ms = 0;
+  std::size_t used = 0;
+  std::uint32_t lost = 0;
+  std::uint32_t pending_milli_bytes = 0;
+};
+
+}  // namespace
+
+TEST_CASE("The TelemetryRateController class", "[domain][telemetry]") {
+  TelemetryRateControllerConfig config{};
+  TelemetryRateController controller(config);
+
+  SECTION("The Update() method") {
+    SECTION("When a window sees frames lost") {
+      SECTION("Should step down at the end of the window even with an empty buffer") {
+        REQUIRE_FALSE(controller.Update(50, 0, kCapacity, 3));
+        REQUIRE(controller.Update(50, 0, kCapacity, 3));
+        REQUIRE(controller.level() == 1u);
+        REQUIRE(controller.stats().lossy_windows == 1u);
+      }
+    }
+
+    SECTION("When the buffer peaks above the high mark within a window") {
+      SECTION("Should step down even if it drained again") {
+        (void) controller.Update(10, kCapacity * 3u / 4u, kCapacity, 0);
+        REQUIRE(controller.Update(90, 0, kCapacity, 0));
+        REQUIRE(controller.level() == 1u);
+      }
+    }
+
+    SECTION("When already at the most compact level") {
+      SECTION("Should stay there") {
+        for (std::uint32_t i = 0; i < 10u; ++i) {
+          (void) controller.Update(100, kCapacity, kCapacity, 0);
+        }
+        REQUIRE(controller.level() == config.max_level);
+        REQUIRE(controller.stats().step_down_count == config.max_level);
+      }
+    }
+
+    SECTION("When the buffer stays between the marks") {
+      SECTION("Should hold the level") {
+        (void) controller.Update(100, kCapacity, kCapacity, 0);
+        for (std::uint32_t i = 0; i < 100u; ++i) {
+          REQUIRE_FALSE(controller.Update(100, kCapacity / 4u, kCapacity, 0));
+        }
+        REQUIRE(controller.level() == 1u);
+      }
+    }
+
+    SECTION("When the buffer has stayed nearly empty for raise_windows windows") {
+      SECTION("Should step back up one level") {
+        (void) controller.Update(100, kCapacity, kCapacity, 0);
+        (void) controller.Update(100, kCapacity, kCapacity, 0);
+        for (std::uint32_t i = 1; i < config.raise_windows; ++i) {
+          REQUIRE_FALSE(controller.Update(100, 0, kCapacity, 0));
+        }
+        REQUIRE(controller.Update(100, 0, kCapacity, 0));
+        REQUIRE(controller.level() == 1u);
+        REQUIRE(controller.stats().step_up_count == 1u);
+      }
+    }
+  }
+
+  SECTION("The Reset() method") {
+    SECTION("Should return to level 0 without counting earlier losses") {
+      (void) controller.Update(100, kCapacity, kCapacity, 0);
+      controller.Reset(7);
+      REQUIRE(controller.level() == 0u);
+      REQUIRE_FALSE(controller.Update(100, 0, kCapacity, 7));
+    }
+  }
+
+  SECTION("When the host slows down and recovers") {
+    SimulatedLink link;
+    link.consume_per_ms = 200;
+    link.Run(controller, 2000);
+    const std::uint32_t lost_while_fast = link.lost;
+    const std::uint8_t level_while_fast = controller.level();
+
+    link.consume_per_ms = 30;
+    link.Run(controller, 1000);
+    const std::uint32_t lost_while_adapting = link.lost;
+    link.Run(controller, 3000);
+    const std::uint32_t lost_once_adapted = link.lost - lost_while_adapting;
+    const std::uint8_t level_while_slow = controller.level();
+
+    link.consume_per_ms = 200;
+    link.Run(controller, 10000);
+
+    SECTION("Should send the requested stream while the host keeps up") {
+      REQUIRE(lost_while_fast == 0u);
+      REQUIRE(level_while_fast == 0u);
+    }
+
+    SECTION("Should settle on a level the host can take, without further losses") {
+      REQUIRE(level_while_slow >= 2u);
+      REQUIRE(lost_once_adapted == 0u);
+    }
+
+    SECTION("Should return to the requested stream once the host catches up") {
+      REQUIRE(controller.level() == 0u);
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,195 @@
+#if defined(UNIT_TESTS)
+
+#include "domain/telemetry/trigger_capture.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+using domain::telemetry::CaptureState;
+using domain::telemetry::TriggerConfig;
+using domain::telemetry::TriggerSlope;
+
+constexpr std::size_t kChannels = 4;
+using Capture = domain::telemetry::TriggerCapture<kChannels>;
+using Scan = Capture::Scan;
+
+Scan MakeScan(std::uint32_t index, std::uint16_t trigger_value) {
+  Scan scan{};
+  scan.timestamp_ticks = 1000u * index;
+  scan.values = {static_cast<std::uint16_t>(index), trigger_value, 0, 0};
+  return scan;
+}
+
+TriggerConfig MakeConfig(TriggerSlope slope, std::uint32_t pre_scans, std::uint32_t post_scans) {
+  TriggerConfig config{};
+  config.channel = 1;
+  config.threshold = 30000;
+  config.slope = slope;
+  config.pre_scans = pre_scans;
+  config.post_scans = post_scans;
+  return config;
+}
+
+/** @brief Rest at 52000 counts; the key goes down at strike_index and stays down. */
+void PushStrike(Capture& capture, std::uint32_t scan_count, std::uint32_t strike_index) {
+  for (std::uint32_t i = 0; i < scan_count; ++i) {
+    capture.Push(MakeScan(i, i < strike_index ? 52000 : 21000));
+  }
+}
+
+}  // namespace
+
+TEST_CASE("The TriggerCapture class", "[domain][telemetry]") {
+  std::vector<Scan> storage(16);
+  Capture capture(storage.data(), storage.size());
+
+  SECTION("The Push() method") {
+    SECTION("When the trigger channel crosses the threshold") {
+      SECTION("Should keep pre_scans before and post_scans after the trigger scan") {
+        REQUIRE(capture.Arm(MakeConfig(TriggerSlope::kFalling, 3, 4)));
+        PushStrike(capture, 40, 25);
+
+        REQUIRE(capture.state() == CaptureState::kFrozen);
+        REQUIRE(capture.size() == 8u);
+        REQUIRE(capture.trigger_index() == 3u);
+        REQUIRE(capture.trigger_timestamp_ticks() == 25000u);
+        for (std::size_t i = 0; i < capture.size(); ++i) {
+          REQUIRE(capture.scan(i).values[0] == 22u + i);
+        }
+      }
+
+      SECTION("Should freeze on the trigger scan without post-trigger scans") {
+        REQUIRE(capture.Arm(MakeConfig(TriggerSlope::kFalling, 2, 0)));
+        PushStrike(capture, 10, 5);
+
+        REQUIRE(capture.state() == CaptureState::kFrozen);
+        REQUIRE(capture.size() == 3u);
+        REQUIRE(capture.scan(2).values[0] == 5u);
+      }
+    }
+
+    SECTION("When the slope does not match") {
+      SECTION("Should stay armed") {
+        REQUIRE(capture.Arm(MakeConfig(TriggerSlope::kRising, 2, 2)));
+        PushStrike(capture, 20, 10);
+        REQUIRE(capture.state() == CaptureState::kArmed);
+        REQUIRE(capture.size() == 0u);
+      }
+
+      SECTION("Should fire on either slope when asked to") {
+        REQUIRE(capture.Arm(MakeConfig(TriggerSlope::kEither, 1, 1)));
+        for (std::uint32_t i = 0; i < 10; ++i) {
+          capture.Push(MakeScan(i, i < 4 ? 1000 : 40000));
+        }
+        REQUIRE(capture.state() == CaptureState::kFrozen);
+        REQUIRE(capture.trigger_timestamp_ticks() == 4000u);
+      }
+    }
+
+    SECTION("When the crossing comes before pre_scans are recorded") {
+      SECTION("Should ignore it and wait for the next crossing") {
+        REQUIRE(capture.Arm(MakeConfig(TriggerSlope::kFalling, 5, 1)));
+        for (std::uint32_t i = 0; i < 20; ++i) {
+          const bool down = (i >= 2 && i < 4) || i >= 12;
+          capture.Push(MakeScan(i, down ? 21000 : 52000));
+        }
+        REQUIRE(capture.state() == CaptureState::kFrozen);
+        REQUIRE(capture.trigger_timestamp_ticks() == 12000u);
+        REQUIRE(capture.scan(0).values[0] == 7u);
+      }
+    }
+
+    SECTION("When the ring wraps while armed") {
+      SECTION("Should read the capture in chronological order") {
+        REQUIRE(capture.Arm(MakeConfig(TriggerSlope::kFalling, 10, 5)));
+        PushStrike(capture, 100, 77);
+
+        REQUIRE(capture.size() == 16u);
+        REQUIRE(capture.first_slot() == 67u % 16u);
+        for (std::size_t i = 0; i < capture.size(); ++i) {
+          REQUIRE(capture.scan(i).timestamp_ticks == 1000u * (67u + i));
+        }
+      }
+    }
+
+    SECTION("When the slope is immediate") {
+      SECTION("Should record from the first scan into the start of the storage") {
+        REQUIRE(capture.Arm(MakeConfig(TriggerSlope::kImmediate, 0, 15)));
+        PushStrike(capture, 40, 100);
+
+        REQUIRE(capture.state() == CaptureState::kFrozen);
+        REQUIRE(capture.size() == 16u);
+        REQUIRE(capture.first_slot() == 0u);
+        REQUIRE(capture.trigger_timestamp_ticks() == 0u);
+        for (std::size_t i = 0; i < storage.size(); ++i) {
+          REQUIRE(storage[i].timestamp_ticks == 1000u * i);
+        }
+      }
+
+      SECTION("Should fire once pre_scans are recorded") {
+        REQUIRE(capture.Arm(MakeConfig(TriggerSlope::kImmediate, 4, 2)));
+        PushStrike(capture, 10, 100);
+
+        REQUIRE(capture.state() == CaptureState::kFrozen);
+        REQUIRE(capture.trigger_timestamp_ticks() == 4000u);
+        REQUIRE(capture.scan(0).timestamp_ticks == 0u);
+      }
+    }
+
+    SECTION("When frozen") {
+      SECTION("Should ignore further scans") {
+        REQUIRE(capture.Arm(MakeConfig(TriggerSlope::kFalling, 1, 1)));
+        PushStrike(capture, 6, 3);
+        REQUIRE(capture.state() == CaptureState::kFrozen);
+        capture.Push(MakeScan(99, 52000));
+        capture.Push(MakeScan(100, 21000));
+        REQUIRE(capture.scan(2).values[0] == 4u);
+      }
+    }
+  }
+
+  SECTION("The Arm() method") {
+    SECTION("Should refuse a capture longer than the ring or an unknown channel") {
+      REQUIRE_FALSE(capture.Arm(MakeConfig(TriggerSlope::kFalling, 8, 8)));
+      REQUIRE(capture.Arm(MakeConfig(TriggerSlope::kFalling, 8, 7)));
+      capture.Disarm();
+
+      TriggerConfig config = MakeConfig(TriggerSlope::kFalling, 1, 1);
+      config.channel = kChannels;
+      REQUIRE_FALSE(capture.Arm(config));
+      REQUIRE(capture.state() == CaptureState::kIdle);
+    }
+
+    SECTION("Should refuse while a capture is in progress") {
+      REQUIRE(capture.Arm(MakeConfig(TriggerSlope::kFalling, 1, 1)));
+      REQUIRE_FALSE(capture.Arm(MakeConfig(TriggerSlope::kRising, 1, 1)));
+      REQUIRE(capture.config().slope == TriggerSlope::kFalling);
+    }
+
+    SECTION("Should start over from a frozen capture") {
+      REQUIRE(capture.Arm(MakeConfig(TriggerSlope::kFalling, 1, 1)));
+      PushStrike(capture, 6, 3);
+      REQUIRE(capture.Arm(MakeConfig(TriggerSlope::kFalling, 1, 1)));
+      REQUIRE(capture.state() == CaptureState::kArmed);
+      REQUIRE(capture.size() == 0u);
+    }
+  }
+
+  SECTION("The Disarm() method") {
+    SECTION("Should stop recording") {
+      REQUIRE(capture.Arm(MakeConfig(TriggerSlope::kFalling, 1, 4)));
+      PushStrike(capture, 4, 2);
+      REQUIRE(capture.state() == CaptureState::kTriggered);
+
+      capture.Disarm();
+      PushStrike(capture, 10, 0);
+      REQUIRE(capture.state() == CaptureState::kIdle);
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,120 @@
+#!/usr/bin/env python3
+"""
+Bench Compare - Compares two Google Benchmark JSON reports and flags regressions.
+
+Typical usage (from a Host-Release build):
+  cmake --build --preset Host-Release --target benchmark_json
+  python3 tools/bench_compare.py tests/benchmarks/baseline.json build/Host-Release/benchmarks.json
+
+To refresh the stored baseline after an intended performance change, copy the new report over
+tests/benchmarks/baseline.json (baselines are only comparable on the same host machine).
+
+Exit code is 1 when at least one benchmark is slower than the baseline by more than the
+threshold, 0 otherwise.
+"""
+
+import argparse
+import json
+import sys
+from typing import Dict, List, Tuple
+
+PREFERRED_AGGREGATE = "median"
+
+
+def load_report(path: str) -> Dict:
+    with open(path, "r", encoding="utf-8") as report_file:
+        return json.load(report_file)
+
+
+def extract_times_ns(report: Dict, metric: str) -> Dict[str, float]:
+    """Returns benchmark name -> time in nanoseconds.
+
+    When the report contains aggregates (--benchmark_repetitions), the median aggregate is used.
+    Otherwise the single iteration entry is used.
+    """
+    time_unit_to_ns = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+    single_run_times: Dict[str, float] = {}
+    aggregate_times: Dict[str, float] = {}
+
+    for entry in report.get("benchmarks", []):
+        name = entry.get("run_name", entry["name"])
+        time_ns = float(entry[metric]) * time_unit_to_ns[entry.get("time_unit", "ns")]
+        if entry.get("run_type") == "aggregate":
+            if entry.get("aggregate_name") == PREFERRED_AGGREGATE:
+                aggregate_times[name] = time_ns
+        else:
+            single_run_times.setdefault(name, time_ns)
+
+    merged = dict(single_run_times)
+    merged.update(aggregate_times)
+    return merged
+
+
+def compare(
+    baseline: Dict[str, float], current: Dict[str, float]
+) -> Tuple[List[Tuple[str, float, float, float]], List[str], List[str]]:
+    rows = []
+    for name in sorted(baseline.keys() & current.keys()):
+        base_ns = baseline[name]
+        current_ns = current[name]
+        relative_change = (current_ns - base_ns) / base_ns if base_ns > 0 else 0.0
+        rows.append((name, base_ns, current_ns, relative_change))
+
+    missing = sorted(baseline.keys() - current.keys())
+    added = sorted(current.keys() - baseline.keys())
+    return rows, missing, added
+
+
+def format_row(name: str, base_ns: float, current_ns: float, relative_change: float,
+               threshold: float, name_width: int) -> str:
+    if relative_change > threshold:
+        verdict = "REGRESSION"
+    elif relative_change < -threshold:
+        verdict = "improved"
+    else:
+        verdict = "ok"
+    return (f"{name:<{name_width}}  {base_ns:>12.2f}  {current_ns:>12.2f}  "
+            f"{relative_change * 100.0:>+8.1f}%  {verdict}")
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description="Compare Google Benchmark JSON reports")
+    parser.add_argument("baseline", help="Baseline JSON report (e.g. tests/benchmarks/baseline.json)")
+    parser.add_argument("current", help="Current JSON report (e.g. build/Host-Release/benchmarks.json)")
+    parser.add_argument("--threshold", type=float, default=0.10,
+                        help="Relative slowdown flagged as a regression (default: 0.10 = 10%%)")
+    parser.add_argument("--metric", choices=["cpu_time", "real_time"], default="cpu_time",
+                        help="Time metric to compare (default: cpu_time)")
+    parser.add_argument("--fail-on-missing", action="store_true",
+                        help="Also fail when a baseline benchmark is absent from the current report")
+    args = parser.parse_args()
+
+    baseline = extract_times_ns(load_report(args.baseline), args.metric)
+    current = extract_times_ns(load_report(args.current), args.metric)
+    rows, missing, added = compare(baseline, current)
+
+    name_width = max([len("benchmark")] + [len(row[0]) for row in rows])
+    print(f"{'benchmark':<{name_width}}  {'baseline ns':>12}  {'current ns':>12}  {'change':>9}")
+    regression_count = 0
+    for name, base_ns, current_ns, relative_change in rows:
+        print(format_row(name, base_ns, current_ns, relative_change, args.threshold, name_width))
+        if relative_change > args.threshold:
+            regression_count += 1
+
+    for name in missing:
+        print(f"missing from current report: {name}")
+    for name in added:
+        print(f"not in baseline: {name}")
+
+    print(f"\n{regression_count} regression(s) above {args.threshold * 100.0:.1f}% "
+          f"({args.metric}, {len(rows)} compared)")
+
+    if regression_count > 0:
+        return 1
+    if args.fail_on_missing and missing:
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
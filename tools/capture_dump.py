@@ -0,0 +1,97 @@
+#!/usr/bin/env python3
+"""
+Capture Dump - Decodes a raw debugger dump of the capture buffer in RAM_D2 into CSV.
+
+The buffer starts with the header documented in
+domain/include/domain/telemetry/capture_buffer_header.hpp, followed by the scan slots. It sits
+at the start of RAM_D2 (0x30000000); dump the header plus capacity * scan_bytes bytes, e.g. all
+288 KB with J-Link Commander:
+
+  savebin capture.bin 0x30000000 0x48000
+
+Typical usage:
+  python3 tools/capture_dump.py capture.bin > capture.csv
+"""
+
+import argparse
+import struct
+import sys
+from dataclasses import dataclass
+from typing import Iterator, List, Tuple
+
+MAGIC = 0x5041434B
+HEADER_FORMAT = "<IHHHBBIIIIIIIIIIBBH8x"
+HEADER_BYTES = struct.calcsize(HEADER_FORMAT)
+STATE_NAMES = {0: "idle", 1: "armed", 2: "triggered", 3: "frozen"}
+
+
+@dataclass
+class CaptureHeader:
+    magic: int
+    version: int
+    header_bytes: int
+    scan_bytes: int
+    channel_count: int
+    state: int
+    channel_mask: int
+    capacity: int
+    pre_scans: int
+    post_scans: int
+    scan_count: int
+    first_slot: int
+    trigger_index: int
+    trigger_timestamp_ticks: int
+    ticks_per_second: int
+    capture_number: int
+    trigger_channel: int
+    trigger_slope: int
+    trigger_threshold: int
+
+
+def parse_header(data: bytes) -> CaptureHeader:
+    if len(data) < HEADER_BYTES:
+        raise ValueError("dump shorter than the capture header")
+    header = CaptureHeader(*struct.unpack_from(HEADER_FORMAT, data))
+    if header.magic != MAGIC:
+        raise ValueError(f"bad magic 0x{header.magic:08x}, not a capture buffer dump")
+    return header
+
+
+def iter_scans(data: bytes, header: CaptureHeader) -> Iterator[Tuple[int, List[int]]]:
+    """Yields (timestamp, raw values by sensor id - 1) in chronological order."""
+    if STATE_NAMES.get(header.state) != "frozen":
+        raise ValueError(f"capture is {STATE_NAMES.get(header.state, header.state)}, not frozen")
+    value_format = f"<I{header.channel_count}H"
+    for index in range(header.scan_count):
+        slot = (header.first_slot + index) % header.capacity
+        offset = header.header_bytes + slot * header.scan_bytes
+        if offset + header.scan_bytes > len(data):
+            raise ValueError(f"dump ends before scan {index} (slot {slot})")
+        timestamp, *values = struct.unpack_from(value_format, data, offset)
+        yield timestamp, values
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description="Decode a RAM_D2 capture buffer dump to CSV")
+    parser.add_argument("dump", help="Binary dump starting at the capture buffer header")
+    args = parser.parse_args()
+
+    with open(args.dump, "rb") as dump:
+        data = dump.read()
+    try:
+        header = parse_header(data)
+        ids = [bit + 1 for bit in range(header.channel_count) if header.channel_mask & (1 << bit)]
+        print(f"capture #{header.capture_number}: {header.scan_count} scans, trigger index "
+              f"{header.trigger_index} at t={header.trigger_timestamp_ticks}", file=sys.stderr)
+        print("index,timestamp_ticks," + ",".join(f"s{sensor_id}" for sensor_id in ids))
+        for index, (timestamp, values) in enumerate(iter_scans(data, header)):
+            print(f"{index},{timestamp}," +
+                  ",".join(str(values[sensor_id - 1]) for sensor_id in ids))
+    except ValueError as error:
+        print(f"error: {error}", file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,202 @@
+#!/usr/bin/env python3
+"""
+Live Snapshot - Decodes the LiveSnapshot table the firmware keeps at the start of RAM_D3.
+
+The layout and the read protocol are documented in
+domain/include/domain/telemetry/live_snapshot.hpp. The table is read through the debug port
+while the target runs, so it costs the firmware nothing beyond the copy it publishes anyway.
+
+Either decode a dump taken with a debugger (592 bytes for 22 sensors), e.g. with J-Link
+Commander:
+
+  savebin live.bin 0x38000000 0x250
+
+or poll a running target through OpenOCD's Tcl server (port 6666 by default):
+
+  python3 tools/live_snapshot.py live.bin
+  python3 tools/live_snapshot.py --openocd localhost:6666 --interval 0.2
+"""
+
+import argparse
+import socket
+import struct
+import sys
+import time
+from dataclasses import dataclass
+from typing import Callable, List, Optional
+
+BASE_ADDRESS = 0x38000000
+MAGIC = 0x4556494C
+VERSION = 1
+HEADER_FORMAT = "<IHHHBBII12x"
+HEADER_BYTES = struct.calcsize(HEADER_FORMAT)
+SLOT_HEADER_FORMAT = "<IIII"
+SLOT_HEADER_BYTES = struct.calcsize(SLOT_HEADER_FORMAT)
+CHANNEL_FORMAT = "<H2xfI"
+CHANNEL_BYTES = struct.calcsize(CHANNEL_FORMAT)
+READ_ATTEMPTS = 8
+
+
+@dataclass
+class LiveHeader:
+    magic: int
+    version: int
+    header_bytes: int
+    slot_bytes: int
+    channel_count: int
+    slot_count: int
+    ticks_per_second: int
+    latest_slot: int
+
+
+@dataclass
+class LiveChannel:
+    raw: int
+    processed: float
+    timestamp_ticks: int
+
+
+@dataclass
+class LiveSlot:
+    sequence: int
+    timestamp_ticks: int
+    publish_count: int
+    channel_mask: int
+    channels: List[LiveChannel]
+
+
+def parse_header(data: bytes) -> LiveHeader:
+    if len(data) < HEADER_BYTES:
+        raise ValueError("read shorter than the live snapshot header")
+    header = LiveHeader(*struct.unpack_from(HEADER_FORMAT, data))
+    if header.magic != MAGIC:
+        raise ValueError(f"bad magic 0x{header.magic:08x}, not a live snapshot")
+    if header.version != VERSION:
+        raise ValueError(f"live snapshot version {header.version}, expected {VERSION}")
+    if header.slot_bytes != SLOT_HEADER_BYTES + header.channel_count * CHANNEL_BYTES:
+        raise ValueError(f"slot size {header.slot_bytes} does not match "
+                         f"{header.channel_count} channels")
+    return header
+
+
+def slot_offset(header: LiveHeader, index: int) -> int:
+    return header.header_bytes + index * header.slot_bytes
+
+
+def parse_slot(data: bytes, header: LiveHeader) -> LiveSlot:
+    sequence, timestamp, publish_count, channel_mask = struct.unpack_from(SLOT_HEADER_FORMAT, data)
+    channels = [LiveChannel(*struct.unpack_from(CHANNEL_FORMAT, data,
+                                                SLOT_HEADER_BYTES + i * CHANNEL_BYTES))
+                for i in range(header.channel_count)]
+    return LiveSlot(sequence, timestamp, publish_count, channel_mask, channels)
+
+
+def read_snapshot(read: Callable[[int, int], bytes]) -> LiveSlot:
+    """
+    Reads a consistent slot with read(offset, length): the slot named by latest_slot is kept if
+    its sequence was even before the copy and unchanged after it.
+    """
+    for _ in range(READ_ATTEMPTS):
+        header = parse_header(read(0, HEADER_BYTES))
+        offset = slot_offset(header, header.latest_slot % header.slot_count)
+        data = read(offset, header.slot_bytes)
+        slot = parse_slot(data, header)
+        if slot.sequence & 1:
+            continue
+        (sequence_after,) = struct.unpack("<I", read(offset, 4))
+        if sequence_after == slot.sequence:
+            return slot
+    raise ValueError(f"no consistent slot after {READ_ATTEMPTS} attempts")
+
+
+def read_dump(data: bytes) -> LiveSlot:
+    """A dump cannot be read twice; fall back to the older slot if the latest was mid-write."""
+    header = parse_header(data)
+    latest = header.latest_slot % header.slot_count
+    for index in [latest] + [i for i in range(header.slot_count) if i != latest]:
+        offset = slot_offset(header, index)
+        if offset + header.slot_bytes > len(data):
+            raise ValueError(f"dump ends before slot {index}")
+        slot = parse_slot(data[offset:offset + header.slot_bytes], header)
+        if not slot.sequence & 1:
+            return slot
+    raise ValueError("every slot was being written when the dump was taken")
+
+
+class OpenOcdReader:
+    """Reads target memory through OpenOCD's Tcl server without halting the core."""
+
+    TERMINATOR = b"\x1a"
+
+    def __init__(self, host: str, port: int, base_address: int):
+        self._socket = socket.create_connection((host, port), timeout=2.0)
+        self._base_address = base_address
+        self._pending = b""
+
+    def _command(self, command: str) -> str:
+        self._socket.sendall(command.encode() + self.TERMINATOR)
+        while self.TERMINATOR not in self._pending:
+            chunk = self._socket.recv(4096)
+            if not chunk:
+                raise ConnectionError("OpenOCD closed the connection")
+            self._pending += chunk
+        reply, _, self._pending = self._pending.partition(self.TERMINATOR)
+        return reply.decode(errors="replace")
+
+    def read(self, offset: int, length: int) -> bytes:
+        words = (length + 3) // 4
+        reply = self._command(f"read_memory 0x{self._base_address + offset:08x} 32 {words}")
+        try:
+            values = [int(token, 0) for token in reply.split()]
+        except ValueError:
+            raise ValueError(f"OpenOCD: {reply.strip()}") from None
+        if len(values) != words:
+            raise ValueError(f"OpenOCD returned {len(values)} words, expected {words}")
+        return struct.pack(f"<{words}I", *values)[:length]
+
+
+def print_slot(slot: LiveSlot, ticks_per_second: Optional[int]) -> None:
+    seconds = f" ({slot.timestamp_ticks / ticks_per_second:.3f} s)" if ticks_per_second else ""
+    print(f"publish #{slot.publish_count} at t={slot.timestamp_ticks}{seconds}")
+    print("sensor,raw,processed,timestamp_ticks")
+    for index, channel in enumerate(slot.channels):
+        if slot.channel_mask & (1 << index):
+            print(f"s{index + 1},{channel.raw},{channel.processed:.3f},{channel.timestamp_ticks}")
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description="Decode the RAM_D3 live snapshot table")
+    source = parser.add_mutually_exclusive_group(required=True)
+    source.add_argument("dump", nargs="?", help="Binary dump starting at the live snapshot")
+    source.add_argument("--openocd", metavar="HOST:PORT", help="Poll through OpenOCD's Tcl server")
+    parser.add_argument("--address", type=lambda text: int(text, 0), default=BASE_ADDRESS,
+                        help="Table address (default 0x38000000)")
+    parser.add_argument("--interval", type=float, default=0.0,
+                        help="Seconds between polls with --openocd; 0 reads once")
+    args = parser.parse_args()
+
+    try:
+        if args.dump:
+            with open(args.dump, "rb") as dump:
+                data = dump.read()
+            print_slot(read_dump(data), parse_header(data).ticks_per_second)
+            return 0
+
+        host, _, port = args.openocd.rpartition(":")
+        reader = OpenOcdReader(host or "localhost", int(port), args.address)
+        ticks_per_second = parse_header(reader.read(0, HEADER_BYTES)).ticks_per_second
+        while True:
+            print_slot(read_snapshot(reader.read), ticks_per_second)
+            if args.interval <= 0:
+                return 0
+            sys.stdout.flush()
+            time.sleep(args.interval)
+    except (OSError, ValueError) as error:
+        print(f"error: {error}", file=sys.stderr)
+        return 1
+    except KeyboardInterrupt:
+        return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
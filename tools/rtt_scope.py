@@ -9,7 +9,6 @@ apt install python3-vispy libglfw3 python3-pyglfw python3-numpy
 
 import argparse
 import socket
-import struct
 import sys
 import time
 import glfw
@@ -21,6 +20,9 @@ import vispy
 from vispy import app, scene
 from vispy.scene import visuals
 
+from telemetry_frames import (FRAME_SENSOR_SCAN, FRAME_SENSOR_VALUE, FrameDecoder,
+                              ScanDeltaDecoder, decode_sensor_scan, decode_sensor_value)
+
 # Use GLFW for window management
 vispy.use(app='glfw')
 
@@ -35,7 +37,6 @@ class RttClient:
         self.total_bytes_received = 0
         self._last_reconnect_attempt_time = 0
         self._reconnect_interval_seconds = 2.0
-        self._buffer = bytearray()
 
     def __enter__(self):
         self.connect()
@@ -70,15 +71,7 @@ class RttClient:
                 self.close()
                 return None
             self.total_bytes_received += len(data)
-            self._buffer.extend(data)
-
-            # Return all complete 4-byte frames current in buffer
-            num_frames = len(self._buffer) // 4
-            if num_frames > 0:
-                result = bytes(self._buffer[:num_frames * 4])
-                self._buffer = self._buffer[num_frames * 4:]
-                return result
-            return None
+            return data
         except BlockingIOError:
             return None
         except Exception as e:
@@ -207,6 +200,7 @@ class RttScope:
         self.sample_count = sample_count
         self.auto_scale_enabled = auto_scale
         self.data_format = data_format
+        self.link_stats = None
 
         # History Configuration
         self.history_factor = 30
@@ -711,6 +705,9 @@ class RttScope:
 
         # Build full status text
         text = f"Status: {conn_status} | Data mode: {data_mode} | Scale: {scale_label} | Format: {self.data_format}"
+        if self.link_stats is not None:
+            text += (f" | Lost: {self.link_stats.lost_frames}"
+                     f" | CRC errors: {self.link_stats.crc_errors}")
 
         # Special overlays (Snapshots / Hover values)
         if self.snapshot_message and current_time < self.snapshot_message_expiry:
@@ -735,8 +732,8 @@ def main():
     parser.add_argument("--points", type=int, default=10000, help="Number of points to display")
     parser.add_argument("--y-max", type=float, default=16384, help="Initial Y axis maximum")
     parser.add_argument("--no-auto-scale", action="store_true", help="Disable auto-scaling on startup")
-    parser.add_argument("--format", choices=["float32", "uint32"], default="float32",
-                        help="Data format (default: float32)")
+    parser.add_argument("--channel", type=int, default=0,
+                        help="Sensor id to plot from scan frames (default: first in each frame)")
 
     args = parser.parse_args()
 
@@ -744,8 +741,28 @@ def main():
         sample_count=args.points,
         y_max_initial=args.y_max,
         auto_scale=not args.no_auto_scale,
-        data_format=args.format
+        data_format="framed"
     )
+    decoder = FrameDecoder()
+    scope.link_stats = decoder.stats
+    scans = ScanDeltaDecoder()
+
+    def extract_values(frames) -> list:
+        values = []
+        for frame in frames:
+            if frame.frame_type == FRAME_SENSOR_VALUE:
+                values.append(decode_sensor_value(frame.payload)[1])
+            elif frame.frame_type == FRAME_SENSOR_SCAN:
+                for sensor_id, value in decode_sensor_scan(frame.payload):
+                    if args.channel in (0, sensor_id):
+                        values.append(float(value))
+                        break
+            for _timestamp, record in scans.decode(frame):
+                for sensor_id, value in record:
+                    if args.channel in (0, sensor_id):
+                        values.append(float(value))
+                        break
+        return values
 
     with RttClient(args.host, args.port) as client:
         def update_callback(_event):
@@ -754,11 +771,9 @@ def main():
                 raw_data = client.receive_data()
                 processed = False
                 if raw_data:
-                    value_count = len(raw_data) // 4
-                    if value_count > 0:
-                        fmt_char = 'f' if args.format == 'float32' else 'I'
-                        new_values = struct.unpack('<' + fmt_char * value_count, raw_data[:value_count*4])
-                        scope.process_incoming_values(new_values)
+                    new_values = extract_values(decoder.feed(raw_data))
+                    if new_values:
+                        scope.process_incoming_values(tuple(new_values))
                         processed = True
 
                 # If we didn't process data (or even if we did, to ensure frequent UI updates)
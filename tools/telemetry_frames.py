@@ -0,0 +1,333 @@
+#!/usr/bin/env python3
+"""
+Telemetry Frames - Decodes the framed telemetry stream sent by the firmware over RTT.
+
+The format is defined by domain/include/domain/telemetry/telemetry_frame.hpp (delta-compressed
+scan blocks by scan_delta_codec.hpp):
+
+  sync (A5 5A) | type u8 | sequence u16 | timestamp u32 | payload length u16 | payload | CRC16
+
+all little endian, CRC-16/CCITT-FALSE over type through payload. The decoder accepts bytes in
+arbitrary chunks, resynchronizes after corruption and counts frames lost on the link.
+
+Typical usage (dump frames from a J-Link RTT server):
+  python3 tools/telemetry_frames.py --host 127.0.0.1 --port 60001
+"""
+
+import argparse
+import socket
+import struct
+import sys
+from dataclasses import dataclass, field
+from typing import Iterator, List, Tuple
+
+SYNC = b"\xa5\x5a"
+HEADER_BYTES = 11
+CRC_BYTES = 2
+MAX_PAYLOAD_BYTES = 256
+
+FRAME_SENSOR_VALUE = 1
+FRAME_SENSOR_SCAN = 2
+FRAME_SENSOR_SCAN_DELTA = 3
+FRAME_CAPTURE_INFO = 4
+FRAME_SENSOR_SCAN_ENVELOPE = 5
+
+FRAME_TYPE_NAMES = {
+    FRAME_SENSOR_VALUE: "value",
+    FRAME_SENSOR_SCAN: "scan",
+    FRAME_SENSOR_SCAN_DELTA: "delta",
+    FRAME_CAPTURE_INFO: "capture",
+    FRAME_SENSOR_SCAN_ENVELOPE: "envelope",
+}
+
+CAPTURE_SLOPE_NAMES = {0: "rising", 1: "falling", 2: "either", 3: "immediate"}
+
+SCAN_DELTA_KEY_FLAG = 0x80
+SCAN_DELTA_NEW_MASK = 0x7F
+
+
+def crc16(data: bytes, crc: int = 0xFFFF) -> int:
+    """CRC-16/CCITT-FALSE."""
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+
+def encode_frame(frame_type: int, sequence: int, timestamp: int, payload: bytes) -> bytes:
+    """Builds one frame; mirrors TelemetryFrameEncoder::Encode()."""
+    body = struct.pack("<BHIH", frame_type, sequence & 0xFFFF, timestamp & 0xFFFFFFFF,
+                       len(payload)) + payload
+    return SYNC + body + struct.pack("<H", crc16(body))
+
+
+@dataclass
+class Frame:
+    frame_type: int
+    sequence: int
+    timestamp: int
+    payload: bytes
+
+
+@dataclass
+class DecoderStats:
+    frames: int = 0
+    lost_frames: int = 0
+    crc_errors: int = 0
+    skipped_bytes: int = 0
+
+
+@dataclass
+class FrameDecoder:
+    """Streaming decoder with the same resynchronization rules as TelemetryFrameDecoder."""
+    max_payload: int = MAX_PAYLOAD_BYTES
+    stats: DecoderStats = field(default_factory=DecoderStats)
+    _buffer: bytearray = field(default_factory=bytearray)
+    _next_sequence: int = -1
+
+    def feed(self, data: bytes) -> List[Frame]:
+        self._buffer.extend(data)
+        frames = []
+        while True:
+            start = self._buffer.find(SYNC)
+            if start < 0:
+                # Keep a trailing first sync byte, it may be completed by the next chunk.
+                keep = 1 if self._buffer[-1:] == SYNC[:1] else 0
+                self._skip(len(self._buffer) - keep)
+                return frames
+            self._skip(start)
+            if len(self._buffer) < HEADER_BYTES:
+                return frames
+            frame_type, sequence, timestamp, length = struct.unpack_from("<BHIH", self._buffer, 2)
+            if length > self.max_payload:
+                self._skip(1)
+                continue
+            size = HEADER_BYTES + length + CRC_BYTES
+            if len(self._buffer) < size:
+                return frames
+            (received_crc,) = struct.unpack_from("<H", self._buffer, size - CRC_BYTES)
+            if crc16(self._buffer[2:size - CRC_BYTES]) != received_crc:
+                self.stats.crc_errors += 1
+                self._skip(1)
+                continue
+            if self._next_sequence >= 0:
+                self.stats.lost_frames += (sequence - self._next_sequence) & 0xFFFF
+            self._next_sequence = (sequence + 1) & 0xFFFF
+            self.stats.frames += 1
+            frames.append(Frame(frame_type, sequence, timestamp,
+                                bytes(self._buffer[HEADER_BYTES:HEADER_BYTES + length])))
+            del self._buffer[:size]
+
+    def _skip(self, count: int) -> None:
+        if count > 0:
+            self.stats.skipped_bytes += count
+            del self._buffer[:count]
+
+
+def decode_sensor_value(payload: bytes) -> Tuple[int, float]:
+    """Returns (sensor id, value) of a FRAME_SENSOR_VALUE payload."""
+    return struct.unpack_from("<Bf", payload)
+
+
+def decode_sensor_scan(payload: bytes) -> Iterator[Tuple[int, int]]:
+    """Yields (sensor id, 16-bit value) of a FRAME_SENSOR_SCAN payload, ascending ids."""
+    (mask,) = struct.unpack_from("<I", payload)
+    offset = 4
+    for bit in range(32):
+        if mask & (1 << bit):
+            (value,) = struct.unpack_from("<H", payload, offset)
+            offset += 2
+            yield bit + 1, value
+
+
+@dataclass
+class CaptureInfo:
+    """A FRAME_CAPTURE_INFO payload; the capture's scans follow as FRAME_SENSOR_SCAN frames."""
+    channel_mask: int
+    scan_count: int
+    trigger_index: int
+    trigger_sensor_id: int
+    slope: int
+    threshold: int
+
+
+def decode_capture_info(payload: bytes) -> CaptureInfo:
+    return CaptureInfo(*struct.unpack_from("<IIIBBH", payload))
+
+
+@dataclass
+class ScanEnvelope:
+    """A FRAME_SENSOR_SCAN_ENVELOPE payload (scan_envelope.hpp); the frame timestamp is the first
+    sample's. Values are 16-bit as in FRAME_SENSOR_SCAN: raw counts, or int16 microamps."""
+    channel_mask: int
+    span_ticks: int
+    samples: int
+    channels: List[Tuple[int, int, int, int]]  # (sensor id, min, max, mean)
+
+
+def decode_scan_envelope(payload: bytes) -> ScanEnvelope:
+    mask, span_ticks, samples = struct.unpack_from("<IIH", payload)
+    offset = 10
+    channels = []
+    for bit in range(32):
+        if mask & (1 << bit):
+            low, high, mean = struct.unpack_from("<HHH", payload, offset)
+            offset += 6
+            channels.append((bit + 1, low, high, mean))
+    return ScanEnvelope(mask, span_ticks, samples, channels)
+
+
+def _read_varint(payload: bytes, offset: int) -> Tuple[int, int]:
+    value = 0
+    for index in range(5):
+        if offset + index >= len(payload):
+            break
+        byte = payload[offset + index]
+        value |= (byte & 0x7F) << (7 * index)
+        if not byte & 0x80:
+            return value, offset + index + 1
+    raise ValueError("truncated varint")
+
+
+@dataclass
+class ScanDeltaStats:
+    records: int = 0
+    unreferenced_records: int = 0
+    malformed_frames: int = 0
+
+
+@dataclass
+class ScanDeltaDecoder:
+    """Expands FRAME_SENSOR_SCAN_DELTA blocks; mirrors ScanDeltaDecoder (scan_delta_codec.hpp).
+
+    Feed every frame of the stream: a sequence gap drops the channel references and delta records
+    are skipped until key records restore them.
+    """
+    stats: ScanDeltaStats = field(default_factory=ScanDeltaStats)
+    _references: dict = field(default_factory=dict)
+    _next_sequence: int = -1
+
+    def decode(self, frame: Frame) -> List[Tuple[int, List[Tuple[int, int]]]]:
+        """Returns (timestamp, [(sensor id, value), ...]) for each decodable record."""
+        if self._next_sequence >= 0 and frame.sequence != self._next_sequence:
+            self._references.clear()
+        self._next_sequence = (frame.sequence + 1) & 0xFFFF
+        if frame.frame_type != FRAME_SENSOR_SCAN_DELTA:
+            return []
+        records = []
+        try:
+            self._decode_block(frame, records)
+        except (ValueError, IndexError, struct.error):
+            self.stats.malformed_frames += 1
+            self._references.clear()
+        return records
+
+    def _decode_block(self, frame: Frame, records: list) -> None:
+        payload = frame.payload
+        masks: List[int] = []
+        timestamp = frame.timestamp
+        offset = 0
+        while offset < len(payload):
+            header = payload[offset]
+            offset += 1
+            slot = header & SCAN_DELTA_NEW_MASK
+            if slot == SCAN_DELTA_NEW_MASK:
+                (mask,) = struct.unpack_from("<I", payload, offset)
+                offset += 4
+                masks.append(mask)
+            elif slot < len(masks):
+                mask = masks[slot]
+            else:
+                raise ValueError("unknown mask slot")
+            delta, offset = _read_varint(payload, offset)
+            timestamp = (timestamp + delta) & 0xFFFFFFFF
+
+            values = []
+            referenced = True
+            for bit in range(32):
+                if not mask & (1 << bit):
+                    continue
+                if header & SCAN_DELTA_KEY_FLAG:
+                    (value,) = struct.unpack_from("<H", payload, offset)
+                    offset += 2
+                else:
+                    code, offset = _read_varint(payload, offset)
+                    change = (code >> 1) ^ -(code & 1)
+                    referenced = referenced and bit in self._references
+                    value = (self._references.get(bit, 0) + change) & 0xFFFF
+                values.append((bit + 1, value))
+            if not referenced:
+                self.stats.unreferenced_records += 1
+                continue
+            for sensor_id, value in values:
+                self._references[sensor_id - 1] = value
+            self.stats.records += 1
+            records.append((timestamp, values))
+
+
+def describe(frame: Frame) -> str:
+    name = FRAME_TYPE_NAMES.get(frame.frame_type, f"type{frame.frame_type}")
+    text = f"#{frame.sequence:5d} t={frame.timestamp:10d} {name}"
+    if frame.frame_type == FRAME_SENSOR_VALUE:
+        sensor_id, value = decode_sensor_value(frame.payload)
+        text += f" id={sensor_id} value={value:.1f}"
+    elif frame.frame_type == FRAME_SENSOR_SCAN:
+        text += " " + " ".join(f"{sensor_id}:{value}"
+                               for sensor_id, value in decode_sensor_scan(frame.payload))
+    elif frame.frame_type == FRAME_SENSOR_SCAN_DELTA:
+        text += f" bytes={len(frame.payload)}"
+    elif frame.frame_type == FRAME_SENSOR_SCAN_ENVELOPE:
+        envelope = decode_scan_envelope(frame.payload)
+        text += f" span={envelope.span_ticks} samples={envelope.samples} " + " ".join(
+            f"{sensor_id}:{low}/{mean}/{high}" for sensor_id, low, high, mean in envelope.channels)
+    elif frame.frame_type == FRAME_CAPTURE_INFO:
+        info = decode_capture_info(frame.payload)
+        slope = CAPTURE_SLOPE_NAMES.get(info.slope, str(info.slope))
+        text += (f" mask=0x{info.channel_mask:08x} scans={info.scan_count} "
+                 f"trigger_index={info.trigger_index} id={info.trigger_sensor_id} "
+                 f"slope={slope} threshold={info.threshold}")
+    return text
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description="Dump framed telemetry from an RTT server")
+    parser.add_argument("--host", default="127.0.0.1", help="RTT server IP (default: 127.0.0.1)")
+    parser.add_argument("--port", type=int, default=60001, help="RTT server port (default: 60001)")
+    parser.add_argument("--file", help="Decode a captured byte stream instead of connecting")
+    args = parser.parse_args()
+
+    decoder = FrameDecoder()
+    scans = ScanDeltaDecoder()
+
+    def dump(frames: List[Frame]) -> None:
+        for frame in frames:
+            print(describe(frame))
+            for timestamp, values in scans.decode(frame):
+                print(f"       t={timestamp:10d} " +
+                      " ".join(f"{sensor_id}:{value}" for sensor_id, value in values))
+
+    try:
+        if args.file:
+            with open(args.file, "rb") as capture:
+                dump(decoder.feed(capture.read()))
+        else:
+            with socket.create_connection((args.host, args.port)) as connection:
+                while True:
+                    data = connection.recv(8192)
+                    if not data:
+                        break
+                    dump(decoder.feed(data))
+    except KeyboardInterrupt:
+        pass
+
+    stats = decoder.stats
+    print(f"frames={stats.frames} lost={stats.lost_frames} crc_errors={stats.crc_errors} "
+          f"skipped_bytes={stats.skipped_bytes} "
+          f"unreferenced_records={scans.stats.unreferenced_records}", file=sys.stderr)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())